@@ -2,6 +2,16 @@
 target_compile_definitions("raylib" PUBLIC "${PLATFORM_CPP}")
 target_compile_definitions("raylib" PUBLIC "${GRAPHICS}")
 
+# Software renderer runs on GLFW Null platform (headless), raylib's GLFW only allows it for that renderer
+if (TARGET glfw AND ${GRAPHICS} MATCHES "GRAPHICS_API_SOFTWARE")
+    target_compile_definitions(glfw PRIVATE "${GRAPHICS}")
+endif ()
+
+# Benchmarks are driven by recorded input, automation events required
+if (${BUILD_BENCHMARKS})
+    target_compile_definitions("raylib" PUBLIC SUPPORT_EVENTS_AUTOMATION)
+endif ()
+
 function(define_if target variable)
     if (${${variable}})
         message(STATUS "${variable}=${${variable}}")
@@ -24,10 +34,16 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_DEFAULT_FONT)
     define_if("raylib" SUPPORT_SCREEN_CAPTURE)
     define_if("raylib" SUPPORT_GIF_RECORDING)
+    define_if("raylib" SUPPORT_GIF_RECORDING_THREAD)
     define_if("raylib" SUPPORT_BUSY_WAIT_LOOP)
+    define_if("raylib" SUPPORT_ADAPTIVE_WAIT_LOOP)
     define_if("raylib" SUPPORT_EVENTS_WAITING)
     define_if("raylib" SUPPORT_WINMM_HIGHRES_TIMER)
     define_if("raylib" SUPPORT_COMPRESSION_API)
+    define_if("raylib" SUPPORT_ASSETS_ARCHIVE)
+    define_if("raylib" SUPPORT_ASYNC_LOADING)
+    define_if("raylib" SUPPORT_SHADER_CACHE)
+    define_if("raylib" SUPPORT_FILE_WATCHER)
     define_if("raylib" SUPPORT_QUADS_DRAW_MODE)
     define_if("raylib" SUPPORT_IMAGE_EXPORT)
     define_if("raylib" SUPPORT_IMAGE_GENERATION)
@@ -63,6 +79,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_FLAC)
     define_if("raylib" SUPPORT_STANDARD_FILEIO)
     define_if("raylib" SUPPORT_TRACELOG)
+    define_if("raylib" SUPPORT_PROFILER)
 
     if (UNIX AND NOT APPLE)
         target_compile_definitions("raylib" PUBLIC "MAX_FILEPATH_LENGTH=4096")
@@ -78,7 +95,7 @@ if (${CUSTOMIZE_BUILD})
     
     target_compile_definitions("raylib" PUBLIC "STORAGE_DATA_FILE=\"storage.data\"")
     target_compile_definitions("raylib" PUBLIC "MAX_CHAR_PRESSED_QUEUE=16")
-    target_compile_definitions("raylib" PUBLIC "MAX_DECOMPRESSION_SIZE=64")
+    target_compile_definitions("raylib" PUBLIC "COMPRESSION_STREAM_CHUNK_SIZE=16384")
     
     if (${GRAPHICS} MATCHES "GRAPHICS_API_OPENGL_33" OR ${GRAPHICS} MATCHES "GRAPHICS_API_OPENGL_11")
         target_compile_definitions("raylib" PUBLIC "DEFAULT_BATCH_BUFFER_ELEMENTS=8192")
@@ -105,6 +105,8 @@ if (NOT ${OPENGL_VERSION})
         set(GRAPHICS "GRAPHICS_API_OPENGL_11")
     elseif (${OPENGL_VERSION} MATCHES "ES 2.0")
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
+    elseif (${OPENGL_VERSION} MATCHES "Software")
+        set(GRAPHICS "GRAPHICS_API_SOFTWARE")
     endif ()
     if ("${SUGGESTED_GRAPHICS}" AND NOT "${SUGGESTED_GRAPHICS}" STREQUAL "${GRAPHICS}")
         message(WARNING "You are overriding the suggested GRAPHICS=${SUGGESTED_GRAPHICS} with ${GRAPHICS}! This may fail")
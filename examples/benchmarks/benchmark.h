@@ -0,0 +1,292 @@
+/*******************************************************************************************
+*
+*   benchmark.h - Headless benchmark runner for raylib examples
+*
+*   Examples run for a number of frames with hidden window and no frame rate limit (unless
+*   BENCHMARK_TARGET_FPS defined by the benchmark), driven by
+*   recorded input (automation events), frame statistics saved as JSON for regression checks
+*
+*   USAGE:
+*       benchmark_name [--frames N] [--input file.rep] [--output file.json] [--max-bytes-uploaded N] [--visible]
+*       benchmark_name --record file.rep
+*
+*       --frames N          Frames to run (default: BENCHMARK_DEFAULT_FRAMES)
+*       --input file.rep    Automation events file to play (default: benchmark default input)
+*       --output file.json  Frame statistics output file (default: benchmark_name.json)
+*       --max-bytes-uploaded N  Check mean data uploaded to GPU by frame (in bytes), benchmark fails if exceeded
+*       --visible           Show window while running
+*       --record file.rep   Record a new input file: window shown, 60 fps, runs until window closed
+*
+*   NOTE: Automation events require raylib built with SUPPORT_EVENTS_AUTOMATION (CMake: BUILD_BENCHMARKS),
+*         if not supported benchmark runs with no input
+*
+*   NOTE: Hidden window still requires a display, on Linux headless systems run with xvfb-run
+*
+*   JSON output:
+*       {
+*           "benchmark": "bunnymark", "frames": 600, "input": "resources/bunnymark.rep",
+*           "totalTime": 3.2, "cpuTime": 3.1,
+*           "checks": { "maxBytesUploaded": 4096, "passed": true },
+*           "summary": { "updateTime": { "mean": 0.4, "p50": 0.4, "p95": 0.6, "max": 1.2 }, ... },
+*           "pacing": { "waitCount": 600, "sleepTime": 9.1, "spinTime": 0.2, "errorMax": 0.3, ... },
+*           "frameStats": [ { "updateTime": 0.4, "drawTime": 4.1, "drawCalls": 3, ... }, ... ]
+*       }
+*       Times in milliseconds, except totalTime, cpuTime and pacing sleepTime/spinTime (in seconds)
+*       NOTE: pacing only saved when frames waited (BENCHMARK_TARGET_FPS), WaitTime() accuracy during benchmark
+*
+*   CHECKS:
+*       Data uploaded to GPU by frame (bytesUploaded) is checked if a limit is defined (--max-bytes-uploaded or
+*       BENCHMARK_MAX_BYTES_UPLOADED), EndBenchmark() returns EXIT_FAILURE if mean by frame exceeds the limit,
+*       to be returned by main(), benchmark target fails
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "raylib.h"
+
+#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>                 // Required for: atoi(), atol(), malloc(), free(), qsort(), EXIT_SUCCESS, EXIT_FAILURE
+#include <string.h>                 // Required for: strcmp()
+#include <time.h>                   // Required for: clock()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef BENCHMARK_DEFAULT_FRAMES
+    #define BENCHMARK_DEFAULT_FRAMES    600     // Frames run by default
+#endif
+#ifndef BENCHMARK_TARGET_FPS
+    #define BENCHMARK_TARGET_FPS          0     // Target frames per second, 0 for no frame rate limit
+#endif
+#ifndef BENCHMARK_MAX_BYTES_UPLOADED
+    #define BENCHMARK_MAX_BYTES_UPLOADED -1     // Mean data uploaded to GPU by frame limit (in bytes), -1 for no check
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static struct {
+    const char *name;               // Benchmark name
+    const char *input;              // Automation events file to play
+    const char *output;             // Frame statistics output file
+    const char *record;             // Automation events file to record (record mode)
+    bool visible;                   // Show window while running
+    int frames;                     // Frames to run
+    int frameCounter;               // Frames run
+    long maxBytesUploaded;          // Mean data uploaded to GPU by frame limit (in bytes), -1 for no check
+    FrameStats *stats;              // Frame statistics, one per frame run
+    double startTime;               // Benchmark start time
+    clock_t startClock;             // Benchmark start processor time
+    PacingStats startPacing;        // Frame pacing statistics at benchmark start
+} benchmark = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Init benchmark from command line arguments
+// NOTE: To be called before InitWindow(), window configuration flags set
+static void InitBenchmark(int argc, char *argv[], const char *name)
+{
+    benchmark.name = name;
+    benchmark.output = TextFormat("benchmark_%s.json", name);
+    benchmark.frames = BENCHMARK_DEFAULT_FRAMES;
+    benchmark.maxBytesUploaded = BENCHMARK_MAX_BYTES_UPLOADED;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) benchmark.frames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--input") == 0) && (i + 1 < argc)) benchmark.input = argv[++i];
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) benchmark.output = argv[++i];
+        else if ((strcmp(argv[i], "--record") == 0) && (i + 1 < argc)) benchmark.record = argv[++i];
+        else if ((strcmp(argv[i], "--max-bytes-uploaded") == 0) && (i + 1 < argc)) benchmark.maxBytesUploaded = atol(argv[++i]);
+        else if (strcmp(argv[i], "--visible") == 0) benchmark.visible = true;
+        else TraceLog(LOG_WARNING, "BENCHMARK: Unknown argument: %s", argv[i]);
+    }
+
+    // NOTE: TextFormat() returned string is overwritten by later calls, keep a copy
+    static char output[512] = { 0 };
+    strncpy(output, benchmark.output, sizeof(output) - 1);
+    benchmark.output = output;
+
+    if (benchmark.frames < 1) benchmark.frames = 1;
+    if ((benchmark.record == NULL) && !benchmark.visible) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+}
+
+// Start benchmark, input events playing (or recording) started
+// NOTE: To be called after resources loading, just before main loop
+static void StartBenchmark(const char *defaultInput)
+{
+    if (benchmark.record != NULL)
+    {
+        SetTargetFPS(60);
+        StartAutomationEventRecording(benchmark.record);
+        return;
+    }
+
+    if (benchmark.input == NULL) benchmark.input = defaultInput;
+
+    benchmark.stats = (FrameStats *)malloc(benchmark.frames*sizeof(FrameStats));
+    benchmark.frameCounter = -1;    // First check has no previous frame stats
+
+    SetTargetFPS(BENCHMARK_TARGET_FPS); // No frame rate limit by default, frames run as fast as possible
+
+    if ((benchmark.input != NULL) && !StartAutomationEventPlaying(benchmark.input))
+    {
+        TraceLog(LOG_WARNING, "BENCHMARK: Input events can not be played, running with no input");
+    }
+
+    benchmark.startTime = GetTime();
+    benchmark.startClock = clock();
+    benchmark.startPacing = GetPacingStats();
+}
+
+// Check if benchmark should finish, previous frame statistics stored
+// NOTE: To be used as main loop condition, instead of WindowShouldClose()
+static bool BenchmarkShouldClose(void)
+{
+    if (benchmark.record != NULL) return WindowShouldClose();
+
+    if (benchmark.frameCounter >= 0) benchmark.stats[benchmark.frameCounter] = GetFrameStats();
+    benchmark.frameCounter++;
+
+    return (benchmark.frameCounter >= benchmark.frames);
+}
+
+// Compare float values, used for percentiles
+static int CompareBenchmarkValues(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+
+// Write summary of one frame value into benchmark file: mean, median, 95th percentile and max
+static void WriteBenchmarkSummary(FILE *file, const char *name, float *values, int count, bool last)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < count; i++) sum += values[i];
+
+    qsort(values, count, sizeof(float), CompareBenchmarkValues);
+
+    fprintf(file, "        \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"max\": %.4f }%s\n",
+        name, sum/count, values[count/2], values[(count*95)/100], values[count - 1], last? "" : ",");
+}
+
+// End benchmark, frame statistics saved into output file, returns EXIT_FAILURE if a check failed
+// NOTE: To be called after main loop, before CloseWindow()
+static int EndBenchmark(void)
+{
+    if (benchmark.record != NULL)
+    {
+        StopAutomationEventRecording();
+        return EXIT_SUCCESS;
+    }
+
+    double totalTime = GetTime() - benchmark.startTime;
+    double cpuTime = (double)(clock() - benchmark.startClock)/CLOCKS_PER_SEC;
+
+    if (IsAutomationEventPlaying()) StopAutomationEventPlaying();
+
+    int count = benchmark.frames;
+
+    // Check data uploaded to GPU, mean by frame
+    double bytesUploaded = 0.0;
+    for (int i = 0; i < count; i++) bytesUploaded += benchmark.stats[i].bytesUploaded;
+    bytesUploaded /= count;
+
+    bool checkFailed = (benchmark.maxBytesUploaded >= 0) && (bytesUploaded > (double)benchmark.maxBytesUploaded);
+
+    if (checkFailed) TraceLog(LOG_WARNING, "BENCHMARK: [%s] Check failed: %.0f bytes uploaded by frame, limit %li bytes", benchmark.name, bytesUploaded, benchmark.maxBytesUploaded);
+    else if (benchmark.maxBytesUploaded >= 0) TraceLog(LOG_INFO, "BENCHMARK: [%s] Check passed: %.0f bytes uploaded by frame, limit %li bytes", benchmark.name, bytesUploaded, benchmark.maxBytesUploaded);
+
+    FILE *file = fopen(benchmark.output, "wt");
+
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "BENCHMARK: [%s] Failed to open output file", benchmark.output);
+        free(benchmark.stats);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "    \"benchmark\": \"%s\",\n", benchmark.name);
+    fprintf(file, "    \"frames\": %i,\n", count);
+    fprintf(file, "    \"input\": \"%s\",\n", (benchmark.input != NULL)? benchmark.input : "");
+    fprintf(file, "    \"totalTime\": %.4f,\n", totalTime);
+    fprintf(file, "    \"cpuTime\": %.4f,\n", cpuTime);
+    if (benchmark.maxBytesUploaded >= 0) fprintf(file, "    \"checks\": { \"maxBytesUploaded\": %li, \"passed\": %s },\n", benchmark.maxBytesUploaded, checkFailed? "false" : "true");
+
+    // Summary of frame times and rendering work
+    float *values = (float *)malloc(count*sizeof(float));
+
+    fprintf(file, "    \"summary\": {\n");
+    for (int i = 0; i < count; i++) values[i] = benchmark.stats[i].updateTime*1000.0f;
+    WriteBenchmarkSummary(file, "updateTime", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = benchmark.stats[i].drawTime*1000.0f;
+    WriteBenchmarkSummary(file, "drawTime", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = (benchmark.stats[i].updateTime + benchmark.stats[i].drawTime)*1000.0f;
+    WriteBenchmarkSummary(file, "frameTime", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = (float)benchmark.stats[i].drawCalls;
+    WriteBenchmarkSummary(file, "drawCalls", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = (float)benchmark.stats[i].vertexCount;
+    WriteBenchmarkSummary(file, "vertexCount", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = (float)benchmark.stats[i].bytesUploaded;
+    WriteBenchmarkSummary(file, "bytesUploaded", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = benchmark.stats[i].waitTime*1000.0f;
+    WriteBenchmarkSummary(file, "waitTime", values, count, false);
+    for (int i = 0; i < count; i++) values[i] = benchmark.stats[i].frameJitter*1000.0f;
+    WriteBenchmarkSummary(file, "frameJitter", values, count, true);
+    fprintf(file, "    },\n");
+
+    free(values);
+
+    // Frame pacing statistics, only waits measured during benchmark
+    // NOTE: errorMax and sleepOvershoot are not reset, values since InitWindow()
+    PacingStats pacing = GetPacingStats();
+    unsigned int waitCount = pacing.waitCount - benchmark.startPacing.waitCount;
+
+    if (waitCount > 0)
+    {
+        fprintf(file, "    \"pacing\": {\n");
+        fprintf(file, "        \"waitCount\": %u,\n", waitCount);
+        fprintf(file, "        \"sleepTime\": %.4f,\n", pacing.sleepTime - benchmark.startPacing.sleepTime);
+        fprintf(file, "        \"spinTime\": %.4f,\n", pacing.spinTime - benchmark.startPacing.spinTime);
+        fprintf(file, "        \"sleepOvershoot\": %.4f,\n", pacing.sleepOvershoot*1000.0f);
+        fprintf(file, "        \"errorMax\": %.4f,\n", pacing.errorMax*1000.0f);
+        fprintf(file, "        \"errorHistogram\": [ ");
+        for (int i = 0; i < 8; i++) fprintf(file, "%u%s", pacing.errorHistogram[i] - benchmark.startPacing.errorHistogram[i], (i < 7)? ", " : " ");
+        fprintf(file, "]\n");
+        fprintf(file, "    },\n");
+    }
+
+    // Statistics of every frame
+    fprintf(file, "    \"frameStats\": [\n");
+    for (int i = 0; i < count; i++)
+    {
+        FrameStats *stats = &benchmark.stats[i];
+
+        fprintf(file, "        { \"updateTime\": %.4f, \"drawTime\": %.4f, \"drawCalls\": %u, \"vertexCount\": %u, \"batchFlushes\": %u, "
+            "\"textureBinds\": %u, \"bytesUploaded\": %u, \"callsElided\": %u }%s\n",
+            stats->updateTime*1000.0f, stats->drawTime*1000.0f, stats->drawCalls, stats->vertexCount, stats->batchFlushes,
+            stats->textureBinds, stats->bytesUploaded, stats->callsElided, (i < (count - 1))? "," : "");
+    }
+    fprintf(file, "    ]\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+    free(benchmark.stats);
+
+    TraceLog(LOG_INFO, "BENCHMARK: [%s] %i frames run in %.3f s (cpu: %.3f s), statistics saved", benchmark.output, count, totalTime, cpuTime);
+
+    return checkFailed? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif // BENCHMARK_H
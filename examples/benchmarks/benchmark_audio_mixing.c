@@ -0,0 +1,167 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - audio mixing
+*
+*   NOTE: audio_mixed_processor example run headless, several music streams decoded (mp3, xm, ogg)
+*         and sound voices triggered by recorded key input (space), mixed output processed,
+*         stress of music streams decoding and buffers update on main thread
+*
+*   NOTE: Audio mixing happens on audio thread, frame times only measure main thread work
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "benchmark.h"
+
+#include <math.h>                   // Required for: powf(), fabsf()
+
+#define MAX_SOUND_VOICES    16      // Sound voices, one sound per voice (same wave)
+
+static float exponent = 1.0f;                 // Audio exponentiation value
+static float averageVolume[400] = { 0.0f };   // Average volume history
+
+//------------------------------------------------------------------------------------
+// Audio processing function
+//------------------------------------------------------------------------------------
+void ProcessAudio(void *buffer, unsigned int frames)
+{
+    float *samples = (float *)buffer;   // Samples internally stored as <float>s
+    float average = 0.0f;               // Temporary average volume
+
+    for (unsigned int frame = 0; frame < frames; frame++)
+    {
+        float *left = &samples[frame * 2 + 0], *right = &samples[frame * 2 + 1];
+
+        *left = powf(fabsf(*left), exponent) * ( (*left < 0.0f)? -1.0f : 1.0f );
+        *right = powf(fabsf(*right), exponent) * ( (*right < 0.0f)? -1.0f : 1.0f );
+
+        average += fabsf(*left) / frames;   // accumulating average volume
+        average += fabsf(*right) / frames;
+    }
+
+    // Moving history to the left
+    for (int i = 0; i < 399; i++) averageVolume[i] = averageVolume[i + 1];
+
+    averageVolume[399] = average;         // Adding last average value
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitBenchmark(argc, argv, "audio_mixing");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - audio mixing");
+
+    InitAudioDevice();              // Initialize audio device
+
+    AttachAudioMixedProcessor(ProcessAudio);
+
+    // Load music streams, all of them played at the same time
+    Music music[3] = { 0 };
+    music[0] = LoadMusicStream("resources/country.mp3");
+    music[1] = LoadMusicStream("resources/mini1111.xm");
+    music[2] = LoadMusicStream("resources/target.ogg");
+
+    for (int i = 0; i < 3; i++)
+    {
+        music[i].looping = true;
+        SetMusicVolume(music[i], 0.3f);
+        PlayMusicStream(music[i]);
+    }
+
+    // Load sound voices from same wave, every voice with a different pitch and pan
+    Wave wave = LoadWave("resources/coin.wav");
+    Sound voices[MAX_SOUND_VOICES] = { 0 };
+
+    for (int i = 0; i < MAX_SOUND_VOICES; i++)
+    {
+        voices[i] = LoadSoundFromWave(wave);
+        SetSoundPitch(voices[i], 0.5f + (float)i/MAX_SOUND_VOICES);
+        SetSoundPan(voices[i], (float)i/(MAX_SOUND_VOICES - 1));
+    }
+
+    UnloadWave(wave);
+
+    int currentVoice = 0;
+
+    StartBenchmark("resources/audio_mixing.rep");
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        for (int i = 0; i < 3; i++) UpdateMusicStream(music[i]);   // Update music buffers with new stream data
+
+        // Modify processing variables
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_LEFT)) exponent -= 0.05f;
+        if (IsKeyPressed(KEY_RIGHT)) exponent += 0.05f;
+
+        if (exponent <= 0.5f) exponent = 0.5f;
+        if (exponent >= 3.0f) exponent = 3.0f;
+
+        // Play next sound voice
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            PlaySound(voices[currentVoice]);
+            currentVoice = (currentVoice + 1)%MAX_SOUND_VOICES;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("EXPONENT = %.2f", exponent), 215, 180, 20, LIGHTGRAY);
+
+            DrawRectangle(199, 199, 402, 34, LIGHTGRAY);
+            for (int i = 0; i < 400; i++)
+            {
+                DrawLine(201 + i, 232 - averageVolume[i] * 32, 201 + i, 232, MAROON);
+            }
+            DrawRectangleLines(199, 199, 402, 34, GRAY);
+
+            int playing = 0;
+            for (int i = 0; i < MAX_SOUND_VOICES; i++) if (IsSoundPlaying(voices[i])) playing++;
+
+            DrawText(TextFormat("MUSIC STREAMS: 3, SOUND VOICES PLAYING: %i", playing), 180, 250, 20, LIGHTGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    EndBenchmark();             // Save frame statistics
+
+    for (int i = 0; i < MAX_SOUND_VOICES; i++) UnloadSound(voices[i]);     // Unload sound voices
+    for (int i = 0; i < 3; i++) UnloadMusicStream(music[i]);   // Unload music stream buffers from RAM
+
+    DetachAudioMixedProcessor(ProcessAudio);  // Disconnect audio processor
+
+    CloseAudioDevice();         // Close audio device (music streaming is automatically stopped)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
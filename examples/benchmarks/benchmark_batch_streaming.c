@@ -0,0 +1,106 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - batch streaming
+*
+*   NOTE: Render batch streaming mode (rlEnableRenderBatchStreaming()), static tiles layer redrawn
+*         every frame with exactly the same vertex data and flushed on its own, uploads skipped,
+*         only moving sprites vertex data uploaded (appended to streaming buffers)
+*
+*   NOTE: Data uploaded to GPU by frame checked (BENCHMARK_MAX_BYTES_UPLOADED), benchmark fails
+*         if static tiles layer is uploaded again, it would upload ~340 KB by frame
+*         (mean by frame, run at least 120 frames: static tiles are uploaded on the first two frames)
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"
+
+#include <math.h>           // Required for: sinf(), cosf()
+
+#define BENCHMARK_MAX_BYTES_UPLOADED    8192    // Static tiles uploaded only on first frames
+
+#include "benchmark.h"
+
+#define TILE_SIZE           10      // Tiles size (in pixels)
+#define SPRITES_COUNT       16      // Moving sprites drawn every frame
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitBenchmark(argc, argv, "batch_streaming");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - batch streaming");
+
+    // Render batch with streaming enabled, GPU vertex buffers sized to 4 batch buffers
+    rlRenderBatch batch = rlLoadRenderBatch(1, 8192);
+    rlEnableRenderBatchStreaming(&batch, 4);
+    rlSetRenderBatchActive(&batch);
+
+    float time = 0.0f;
+
+    StartBenchmark(NULL);
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        time += 1.0f/60.0f;         // Fixed time step, same sprites movement on every run
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw static tiles layer, flushed on its own: same vertex data every frame
+            for (int y = 0; y < screenHeight/TILE_SIZE; y++)
+            {
+                for (int x = 0; x < screenWidth/TILE_SIZE; x++)
+                {
+                    DrawRectangle(x*TILE_SIZE, y*TILE_SIZE, TILE_SIZE - 1, TILE_SIZE - 1, ColorFromHSV((float)((x + y)*4%360), 0.3f, 0.9f));
+                }
+            }
+
+            rlDrawRenderBatchActive();
+
+            // Draw moving sprites
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                Vector2 position = { 400.0f + 300.0f*sinf(time + (float)i*0.4f), 225.0f + 150.0f*cosf(time*1.3f + (float)i*0.4f) };
+                DrawRectangleV(position, (Vector2){ 24.0f, 24.0f }, ColorFromHSV((float)i*20.0f, 0.8f, 0.8f));
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    int result = EndBenchmark();    // Save frame statistics, check data uploaded
+
+    rlSetRenderBatchActive(NULL);   // Set default render batch active (current batch drawn)
+    rlUnloadRenderBatch(batch);     // Unload render batch
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return result;
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - bunnymark
+*
+*   NOTE: textures_bunnymark example run headless, bunnies spawned by recorded mouse input
+*         (mouse button held down), stress of sprites batching and texture draw calls
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "benchmark.h"
+
+#include <stdlib.h>                 // Required for: malloc(), free()
+
+#define MAX_BUNNIES        50000    // 50K bunnies limit
+
+typedef struct Bunny {
+    Vector2 position;
+    Vector2 speed;
+    Color color;
+} Bunny;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitBenchmark(argc, argv, "bunnymark");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - bunnymark");
+
+    SetRandomSeed(1234);            // Same bunnies on every run
+
+    // Load bunny texture
+    Texture2D texBunny = LoadTexture("resources/wabbit_alpha.png");
+
+    Bunny *bunnies = (Bunny *)malloc(MAX_BUNNIES*sizeof(Bunny));    // Bunnies array
+
+    int bunniesCount = 0;           // Bunnies counter
+
+    StartBenchmark("resources/bunnymark.rep");
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+        {
+            // Create more bunnies
+            for (int i = 0; i < 100; i++)
+            {
+                if (bunniesCount < MAX_BUNNIES)
+                {
+                    bunnies[bunniesCount].position = GetMousePosition();
+                    bunnies[bunniesCount].speed.x = (float)GetRandomValue(-250, 250)/60.0f;
+                    bunnies[bunniesCount].speed.y = (float)GetRandomValue(-250, 250)/60.0f;
+                    bunnies[bunniesCount].color = (Color){ GetRandomValue(50, 240),
+                                                       GetRandomValue(80, 240),
+                                                       GetRandomValue(100, 240), 255 };
+                    bunniesCount++;
+                }
+            }
+        }
+
+        // Update bunnies
+        for (int i = 0; i < bunniesCount; i++)
+        {
+            bunnies[i].position.x += bunnies[i].speed.x;
+            bunnies[i].position.y += bunnies[i].speed.y;
+
+            if (((bunnies[i].position.x + texBunny.width/2) > GetScreenWidth()) ||
+                ((bunnies[i].position.x + texBunny.width/2) < 0)) bunnies[i].speed.x *= -1;
+            if (((bunnies[i].position.y + texBunny.height/2) > GetScreenHeight()) ||
+                ((bunnies[i].position.y + texBunny.height/2 - 40) < 0)) bunnies[i].speed.y *= -1;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < bunniesCount; i++)
+            {
+                DrawTexture(texBunny, (int)bunnies[i].position.x, (int)bunnies[i].position.y, bunnies[i].color);
+            }
+
+            DrawRectangle(0, 0, screenWidth, 40, BLACK);
+            DrawText(TextFormat("bunnies: %i", bunniesCount), 120, 10, 20, GREEN);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    EndBenchmark();             // Save frame statistics
+
+    free(bunnies);              // Unload bunnies data array
+
+    UnloadTexture(texBunny);    // Unload bunny texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
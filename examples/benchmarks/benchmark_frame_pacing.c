@@ -0,0 +1,82 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - frame pacing
+*
+*   NOTE: Frames run headless at 60 fps with a light draw load, WaitTime() accuracy measured:
+*         pacing statistics (waits, sleep and busy wait times, error histogram) saved with frame
+*         statistics, busy wait share of wait time is the CPU cost of the wait loop
+*
+*   NOTE: Pacing statistics only measured with raylib built with SUPPORT_ADAPTIVE_WAIT_LOOP
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define BENCHMARK_DEFAULT_FRAMES    300     // Frames run by default, 5 seconds at target fps
+#define BENCHMARK_TARGET_FPS         60     // Frames waited to target frame time
+
+#include "benchmark.h"
+
+#define RECS_COUNT                  64      // Rectangles drawn every frame
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitBenchmark(argc, argv, "frame_pacing");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - frame pacing");
+
+    float rotation = 0.0f;
+
+    StartBenchmark(NULL);
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        rotation += 60.0f*GetFrameTime();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < RECS_COUNT; i++)
+            {
+                Rectangle rec = { 50.0f + (float)(i%16)*45.0f, 60.0f + (float)(i/16)*90.0f, 30.0f, 30.0f };
+                DrawRectanglePro(rec, (Vector2){ 15.0f, 15.0f }, rotation + (float)i*5.0f, ColorFromHSV((float)i*5.0f, 0.6f, 0.8f));
+            }
+
+            DrawFPS(screenWidth - 100, screenHeight - 30);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    EndBenchmark();             // Save frame statistics
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - models animation
+*
+*   NOTE: models_animation example run headless, animation played by recorded key input
+*         (space held down) and camera zoomed by recorded mouse wheel, stress of CPU skinning
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "benchmark.h"
+
+#define MODELS_COUNT        16      // Animated models drawn, every model animated on CPU
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitBenchmark(argc, argv, "models_animation");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - models animation");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 10.0f, 10.0f, 10.0f }; // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };      // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;             // Camera mode type
+
+    Texture2D texture = LoadTexture("resources/models/iqm/guytex.png");         // Load model texture
+
+    // Load models, every model mesh animated independently
+    Model models[MODELS_COUNT] = { 0 };
+
+    for (int i = 0; i < MODELS_COUNT; i++)
+    {
+        models[i] = LoadModel("resources/models/iqm/guy.iqm");                  // Load the animated model mesh and basic data
+        SetMaterialTexture(&models[i].materials[0], MATERIAL_MAP_DIFFUSE, texture); // Set model material map texture
+    }
+
+    // Load animation data
+    unsigned int animsCount = 0;
+    ModelAnimation *anims = LoadModelAnimations("resources/models/iqm/guyanim.iqm", &animsCount);
+    int animFrameCounter = 0;
+
+    StartBenchmark("resources/models_animation.rep");
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        // Play animation when spacebar is held down
+        if (IsKeyDown(KEY_SPACE))
+        {
+            animFrameCounter++;
+            if (animFrameCounter >= anims[0].frameCount) animFrameCounter = 0;
+
+            // Models animated with a frames offset
+            for (int i = 0; i < MODELS_COUNT; i++) UpdateModelAnimation(models[i], anims[0], (animFrameCounter + i*3)%anims[0].frameCount);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                for (int i = 0; i < MODELS_COUNT; i++)
+                {
+                    Vector3 position = { (float)(i%4)*3.0f - 4.5f, 0.0f, (float)(i/4)*3.0f - 4.5f };
+                    DrawModelEx(models[i], position, (Vector3){ 1.0f, 0.0f, 0.0f }, -90.0f, (Vector3){ 1.0f, 1.0f, 1.0f }, WHITE);
+                }
+
+                DrawGrid(10, 1.0f);         // Draw a grid
+
+            EndMode3D();
+
+            DrawText(TextFormat("animated models: %i, frame: %i", MODELS_COUNT, animFrameCounter), 10, 10, 20, MAROON);
+
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    EndBenchmark();                             // Save frame statistics
+
+    UnloadTexture(texture);                     // Unload texture
+    UnloadModelAnimations(anims, animsCount);   // Unload model animations data
+    for (int i = 0; i < MODELS_COUNT; i++)
+    {
+        models[i].materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ 0 };  // Texture shared, already unloaded
+        UnloadModel(models[i]);                 // Unload model
+    }
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
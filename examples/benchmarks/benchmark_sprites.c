@@ -0,0 +1,88 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] benchmark - sprites
+*
+*   NOTE: 10000 sprites 32x32 drawn every frame on a 1280x720 framebuffer, textured sprites
+*         and flat rectangles, opaque and alpha blended: 2D frame fill rate and blending,
+*         main target is the software renderer (raylib compiled with GRAPHICS_API_SOFTWARE)
+*
+*   Benchmark originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Benchmark licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "benchmark.h"
+
+#define SPRITES_COUNT       10000       // Number of sprites drawn every frame
+#define SPRITES_SIZE           32       // Sprites size in pixels
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 1280;
+    const int screenHeight = 720;
+
+    InitBenchmark(argc, argv, "sprites");
+
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] benchmark - sprites");
+
+    Image imSprite = GenImageChecked(SPRITES_SIZE, SPRITES_SIZE, SPRITES_SIZE/4, SPRITES_SIZE/4, ORANGE, DARKBROWN);
+    Texture2D texSprite = LoadTextureFromImage(imSprite);
+    UnloadImage(imSprite);
+
+    int frameCounter = 0;
+
+    StartBenchmark(NULL);
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!BenchmarkShouldClose()) // Run benchmark frames
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        frameCounter++;             // Sprites moved by frame, same positions on every run
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                int x = (i*37 + frameCounter*2)%(screenWidth - SPRITES_SIZE);
+                int y = (i*91)%(screenHeight - SPRITES_SIZE);
+
+                // Every third sprite is not textured, every second one is semi-transparent
+                Color tint = ((i%2) == 0)? WHITE : Fade(SKYBLUE, 0.5f);
+
+                if ((i%3) == 0) DrawRectangle(x, y, SPRITES_SIZE, SPRITES_SIZE, tint);
+                else DrawTexture(texSprite, x, y, tint);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    EndBenchmark();             // Save frame statistics
+
+    UnloadTexture(texSprite);   // Unload texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - assets archive
+*
+*   NOTE: Resources directory is packed into an assets archive (ExportArchive()), archive can also
+*         be packed offline with rpak tool (tools/rpak), mounted archive is memory mapped and files
+*         are loaded from it with usual functions, uncompressed files are not copied (zero-copy)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: NULL
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define ARCHIVE_FILENAME    "assets.rpak"
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - assets archive");
+
+    // Pack resources directory into an archive, files compressed if worth it
+    FilePathList files = LoadDirectoryFilesEx("resources", NULL, true);
+    ExportArchive(files, ARCHIVE_FILENAME, true);
+
+    // Load all files from file system, measuring time required
+    double time = GetTime();
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        unsigned int size = 0;
+        UnloadFileData(LoadFileData(files.paths[i], &size));
+    }
+    double fileSystemTime = GetTime() - time;
+
+    // Load same files from mounted archive
+    bool mounted = MountArchive(ARCHIVE_FILENAME);
+
+    time = GetTime();
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        unsigned int size = 0;
+        UnloadFileData(LoadFileData(files.paths[i], &size));
+    }
+    double archiveTime = GetTime() - time;
+
+    // Shader loaded from archive, as any other file
+    Shader shader = LoadShader(TextFormat("resources/shaders/glsl%i/point_particle.vs", GLSL_VERSION),
+                               TextFormat("resources/shaders/glsl%i/point_particle.fs", GLSL_VERSION));
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("Archive %s: %s", ARCHIVE_FILENAME, mounted? "MOUNTED" : "NOT MOUNTED"), 20, 20, 20, mounted? DARKGREEN : MAROON);
+            DrawText(TextFormat("%i files loaded from file system in %.3f ms", files.count, fileSystemTime*1000.0), 20, 50, 20, DARKGRAY);
+            DrawText(TextFormat("%i files loaded from archive in %.3f ms", files.count, archiveTime*1000.0), 20, 80, 20, DARKGRAY);
+            DrawText(TextFormat("Shader loaded from archive: %s", IsShaderReady(shader)? "YES" : "NO"), 20, 110, 20, DARKGRAY);
+
+            for (unsigned int i = 0; (i < files.count) && (i < 12); i++)
+            {
+                unsigned int size = 0;
+                bool zeroCopy = (GetArchiveFileData(files.paths[i], &size) != NULL);
+
+                DrawText(TextFormat("%s%s", files.paths[i], zeroCopy? "  [zero-copy]" : "  [compressed]"), 40, 150 + i*22, 10, zeroCopy? DARKBLUE : GRAY);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadShader(shader);           // Unload shader
+    UnmountArchive(ARCHIVE_FILENAME);   // Unmount archive, after all data loaded from it is unloaded
+    UnloadDirectoryFiles(files);    // Unload files list
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - async loading
+*
+*   NOTE: Assets are loaded asynchronously (LoadAssetAsync()), files reading and decoding is done
+*         in loading threads while main loop keeps running, GPU upload is done at EndDrawing()
+*         with a limited time per frame (SetAssetUploadBudget()), no frame hitches while loading
+*
+*   NOTE: Assets loaded are generated and exported on first run (big images and a mesh)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_TEXTURES        8       // Textures loaded asynchronously
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - async loading");
+
+    // Generate assets to be loaded (only first run)
+    for (int i = 0; i < MAX_TEXTURES; i++)
+    {
+        const char *fileName = TextFormat("async_image_%02i.png", i);
+
+        if (!FileExists(fileName))
+        {
+            Image image = GenImagePerlinNoise(1024, 1024, i*100, 0, 4.0f + i);
+            ImageColorTint(&image, ColorFromHSV(i*45.0f, 0.6f, 1.0f));
+            ExportImage(image, fileName);
+            UnloadImage(image);
+        }
+    }
+
+    if (!FileExists("async_model.obj"))
+    {
+        Mesh mesh = GenMeshKnot(1.0f, 2.0f, 16, 128);
+        ExportMesh(mesh, "async_model.obj");
+        UnloadMesh(mesh);
+    }
+
+    // Queue assets loading, handles checked every frame
+    int textureAssets[MAX_TEXTURES] = { 0 };
+    for (int i = 0; i < MAX_TEXTURES; i++) textureAssets[i] = LoadAssetAsync(TextFormat("async_image_%02i.png", i), ASSET_TEXTURE);
+    int modelAsset = LoadAssetAsync("async_model.obj", ASSET_MODEL);
+
+    Texture2D textures[MAX_TEXTURES] = { 0 };
+    Model model = { 0 };
+    int loadedCount = 0;
+
+    SetAssetUploadBudget(2.0f);     // Upload assets to GPU for up to 2 ms per frame
+
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 4.0f, 4.0f, 4.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };      // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;             // Camera projection type
+
+    float rotation = 0.0f;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        rotation += 2.0f;
+
+        // Retrieve assets once ready, asset handles released (data owned by us from now on)
+        for (int i = 0; i < MAX_TEXTURES; i++)
+        {
+            if ((textureAssets[i] != -1) && (GetAssetState(textureAssets[i]) == ASSET_STATE_READY))
+            {
+                textures[i] = GetAssetTexture(textureAssets[i]);
+                ReleaseAsset(textureAssets[i], false);
+                textureAssets[i] = -1;
+                loadedCount++;
+            }
+        }
+
+        if ((modelAsset != -1) && (GetAssetState(modelAsset) == ASSET_STATE_READY))
+        {
+            model = GetAssetModel(modelAsset);
+            ReleaseAsset(modelAsset, false);
+            modelAsset = -1;
+            loadedCount++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_TEXTURES; i++)
+            {
+                Rectangle dest = { 20.0f + (i%4)*95.0f, 60.0f + (i/4)*95.0f, 85.0f, 85.0f };
+
+                if (textures[i].id > 0) DrawTexturePro(textures[i], (Rectangle){ 0, 0, (float)textures[i].width, (float)textures[i].height }, dest, (Vector2){ 0 }, 0.0f, WHITE);
+                else DrawRectangleLinesEx(dest, 2, LIGHTGRAY);
+            }
+
+            if (model.meshCount > 0)
+            {
+                BeginMode3D(camera);
+                    DrawModelEx(model, (Vector3){ 2.0f, 0.0f, -2.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, rotation, (Vector3){ 0.5f, 0.5f, 0.5f }, MAROON);
+                EndMode3D();
+            }
+
+            // Loading indicator keeps spinning smoothly while assets are loaded
+            if (loadedCount < (MAX_TEXTURES + 1))
+            {
+                DrawRing((Vector2){ 600.0f, 300.0f }, 30.0f, 40.0f, rotation, rotation + 270.0f, 32, MAROON);
+                DrawText("LOADING...", 550, 350, 20, MAROON);
+            }
+
+            DrawRectangle(20, 260, 370, 20, LIGHTGRAY);
+            DrawRectangle(20, 260, 370*loadedCount/(MAX_TEXTURES + 1), 20, MAROON);
+            DrawText(TextFormat("Assets loaded: %i/%i, waiting GPU upload: %i", loadedCount, MAX_TEXTURES + 1, GetAssetUploadCount()), 20, 290, 10, DARKGRAY);
+
+            DrawText("Assets loaded in background, main loop not blocked", 20, 20, 20, DARKGRAY);
+
+            DrawFPS(screenWidth - 100, screenHeight - 30);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_TEXTURES; i++) UnloadTexture(textures[i]);
+    UnloadModel(model);
+
+    CloseWindow();                  // Close window and OpenGL context, assets still loading unloaded
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
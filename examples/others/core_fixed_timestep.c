@@ -0,0 +1,100 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - fixed timestep
+*
+*   NOTE: Simulation is updated with a fixed time step (SetFixedUpdateRate()), independent of
+*         frame rate, and drawn interpolated between last two simulation states (GetFixedUpdateAlpha())
+*
+*   NOTE: Press UP/DOWN to change target frame rate, simulation speed is not affected
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define FIXED_UPDATE_RATE       30      // Simulation updates per second
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - fixed timestep");
+
+    int targetFPS = 60;
+    SetTargetFPS(targetFPS);        // Set our game to run at 60 frames-per-second
+
+    SetFixedUpdateRate(FIXED_UPDATE_RATE);  // Set simulation to run at 30 updates-per-second
+
+    Vector2 position = { 100.0f, 225.0f };
+    Vector2 previous = position;
+    Vector2 speed = { 300.0f, 200.0f };     // Pixels per second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_UP)) targetFPS += 10;
+        else if (IsKeyPressed(KEY_DOWN) && (targetFPS > 10)) targetFPS -= 10;
+        if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_DOWN)) SetTargetFPS(targetFPS);
+
+        // Run simulation steps accumulated for this frame, always same time step
+        int steps = GetFixedUpdateSteps();
+
+        for (int i = 0; i < steps; i++)
+        {
+            previous = position;
+
+            position.x += speed.x/FIXED_UPDATE_RATE;
+            position.y += speed.y/FIXED_UPDATE_RATE;
+
+            if ((position.x < 20) || (position.x > (screenWidth - 20))) speed.x *= -1.0f;
+            if ((position.y < 20) || (position.y > (screenHeight - 20))) speed.y *= -1.0f;
+        }
+
+        // Interpolate drawn position between last two simulation states
+        float alpha = GetFixedUpdateAlpha();
+        Vector2 drawPosition = { previous.x + (position.x - previous.x)*alpha, previous.y + (position.y - previous.y)*alpha };
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawCircleV(position, 20, Fade(LIGHTGRAY, 0.5f));  // Last simulation state (not interpolated)
+            DrawCircleV(drawPosition, 20, MAROON);
+
+            FrameStats stats = GetFrameStats();
+
+            DrawText(TextFormat("Target FPS: %i (UP/DOWN to change), simulation: %i updates per second", targetFPS, FIXED_UPDATE_RATE), 20, 20, 20, DARKGRAY);
+            DrawText(TextFormat("Steps this frame: %i, alpha: %.2f", steps, alpha), 20, 50, 20, DARKGRAY);
+            DrawText(TextFormat("Frame jitter: %.3f ms, steps dropped: %i", stats.frameJitter*1000.0f, stats.fixedStepsDropped), 20, 80, 20, DARKGRAY);
+
+            DrawFPS(screenWidth - 100, screenHeight - 30);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - hot reload
+*
+*   NOTE: Assets files are watched (SetTextureHotReload(), SetShaderHotReload()), files changed are
+*         loaded every frame (LoadChangedFiles()) and only affected assets are reloaded in place
+*         (ReloadChangedAssets()), edit the files while running to see changes applied
+*
+*   NOTE: Files changes notified by system on Linux (inotify), files polled on other platforms
+*
+*   NOTE: Assets loaded are generated on first run (an image and a fragment shader),
+*         press SPACE to modify the image file from the example
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define MAX_CHANGES_SHOWN           8       // Last files changed shown
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - hot reload");
+
+    // Generate assets to be watched (only first run)
+    if (!FileExists("hot_image.png"))
+    {
+        Image image = GenImageChecked(256, 256, 32, 32, MAROON, RAYWHITE);
+        ExportImage(image, "hot_image.png");
+        UnloadImage(image);
+    }
+
+    const char *fsFileName = "hot_shader.fs";
+
+    if (!FileExists(fsFileName))
+    {
+#if (GLSL_VERSION == 330)
+        SaveFileText(fsFileName, "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nuniform sampler2D texture0;\n"
+            "uniform vec4 colDiffuse;\nout vec4 finalColor;\n\nvoid main()\n{\n    // Edit me!\n"
+            "    vec4 texelColor = texture(texture0, fragTexCoord);\n    finalColor = texelColor*colDiffuse*fragColor;\n}\n");
+#else
+        SaveFileText(fsFileName, "#version 100\nprecision mediump float;\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\n"
+            "uniform sampler2D texture0;\nuniform vec4 colDiffuse;\n\nvoid main()\n{\n    // Edit me!\n"
+            "    vec4 texelColor = texture2D(texture0, fragTexCoord);\n    gl_FragColor = texelColor*colDiffuse*fragColor;\n}\n");
+#endif
+    }
+
+    Texture2D texture = LoadTexture("hot_image.png");
+    Shader shader = LoadShader(0, fsFileName);
+
+    // Assets reloaded in place on files changes, files watched
+    SetTextureHotReload(&texture, "hot_image.png");
+    SetShaderHotReload(&shader, 0, fsFileName);
+
+    char changes[MAX_CHANGES_SHOWN][1024] = { 0 };   // NOTE: TextFormat() result fits (MAX_TEXT_BUFFER_LENGTH)
+    int changesCount = 0;
+    int reloadedCount = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            // Modify image file, same as an external editor would do
+            Image image = GenImageChecked(256, 256, 32, 32, ColorFromHSV((float)GetRandomValue(0, 360), 0.7f, 0.8f), RAYWHITE);
+            ExportImage(image, "hot_image.png");
+            UnloadImage(image);
+        }
+
+        // Files changed since last frame, only assets affected are reloaded
+        FilePathList files = LoadChangedFiles();
+
+        if (files.count > 0)
+        {
+            reloadedCount += ReloadChangedAssets(files);
+
+            for (unsigned int i = 0; i < files.count; i++)
+            {
+                TextCopy(changes[changesCount%MAX_CHANGES_SHOWN], TextFormat("[%.2f] %s", GetTime(), files.paths[i]));
+                changesCount++;
+            }
+        }
+
+        UnloadChangedFiles(files);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginShaderMode(shader);
+                DrawTexture(texture, 20, 60, WHITE);
+            EndShaderMode();
+
+            DrawText("Edit hot_image.png or the shader file, changes applied while running", 20, 20, 20, DARKGRAY);
+            DrawText("Press SPACE to modify hot_image.png", 300, 60, 20, GRAY);
+            DrawText(TextFormat("Assets reloaded: %i", reloadedCount), 300, 100, 20, MAROON);
+
+            DrawText("Last files changed:", 300, 150, 20, DARKGRAY);
+            for (int i = 0; (i < changesCount) && (i < MAX_CHANGES_SHOWN); i++)
+            {
+                DrawText(changes[(changesCount - 1 - i)%MAX_CHANGES_SHOWN], 300, 180 + i*20, 10, GRAY);
+            }
+
+            DrawFPS(screenWidth - 100, screenHeight - 30);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);         // Unload texture
+    UnloadShader(shader);           // Unload shader
+
+    CloseWindow();                  // Close window and OpenGL context, files watching finished
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - screen recording
+*
+*   NOTE: Screen frames are read at EndDrawing() and encoded in a worker thread, recording can be
+*         an animated gif (.gif) or a lossless frames sequence (.qoi) or uncompressed (.raw)
+*
+*   NOTE: Recording can be started and stopped by code, no user input required (automated runs),
+*         in this example first seconds are recorded automatically as a frames sequence
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define AUTO_RECORDING_FRAMES      120      // Frames recorded automatically on start
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - screen recording");
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+
+    // Record first frames as a lossless frames sequence, one frame every 2 game frames (30 fps)
+    SetScreenRecordingRate(2);
+    StartScreenRecording("capture.qoi");
+
+    int framesCounter = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        framesCounter++;
+
+        if (framesCounter == AUTO_RECORDING_FRAMES) StopScreenRecording();
+
+        if (IsKeyPressed(KEY_G))
+        {
+            if (IsScreenRecording()) StopScreenRecording();
+            else
+            {
+                SetScreenRecordingRate(6);  // 10 fps gif
+                StartScreenRecording("capture.gif");
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < 8; i++)
+            {
+                DrawCircle(100 + i*85, 225 + (int)(80.0f*((framesCounter + i*10)%60 - 30)/30.0f), 30, ColorFromHSV(i*45.0f, 0.8f, 0.9f));
+            }
+
+            if (IsScreenRecording()) DrawText("RECORDING...", 20, 20, 20, MAROON);
+            else DrawText("Press G to start/stop gif recording", 20, 20, 20, DARKGRAY);
+
+            DrawText(TextFormat("Frame: %i", framesCounter), 20, screenHeight - 30, 20, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context, recording stopped and saved
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - mesh list
+*
+*   NOTE: Meshes are packed in shared vertex buffers and drawn together with DrawMeshList(),
+*         on OpenGL 4.3 a shader reading meshes transforms from a shader buffer allows drawing
+*         all meshes with a single multi-draw indirect call; press SPACE to compare with DrawMesh()
+*
+*   NOTE: On other graphics APIs meshes are drawn one by one with vertex buffers bound once
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+
+#define MESHES_TYPES            3       // Number of different meshes
+#define MESHES_SIDE            24       // Meshes grid side, MESHES_SIDE*MESHES_SIDE meshes drawn
+
+// Mesh list vertex shader for multi-draw indirect, mesh transform read by draw id
+static const char *vsMeshList =
+    "#version 430                                                       \n"
+    "in vec3 vertexPosition;                                            \n"
+    "in vec4 vertexColor;                                               \n"
+    "in float vertexDrawId;                                             \n"
+    "uniform mat4 mvp;                                                  \n"
+    "layout(std430, binding = 0) readonly buffer transformsBuffer { mat4 transforms[]; }; \n"
+    "out vec4 fragColor;                                                \n"
+    "void main()                                                        \n"
+    "{                                                                  \n"
+    "    fragColor = vertexColor;                                       \n"
+    "    gl_Position = mvp*transforms[int(vertexDrawId)]*vec4(vertexPosition, 1.0); \n"
+    "}                                                                  \n";
+
+static const char *fsMeshList =
+    "#version 430                                                       \n"
+    "in vec4 fragColor;                                                 \n"
+    "uniform vec4 colDiffuse;                                           \n"
+    "out vec4 finalColor;                                               \n"
+    "void main()                                                        \n"
+    "{                                                                  \n"
+    "    finalColor = fragColor*colDiffuse;                             \n"
+    "}                                                                  \n";
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh list");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 30.0f, 30.0f, 30.0f };     // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };          // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };              // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                    // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                 // Camera mode type
+
+    Mesh types[MESHES_TYPES] = { GenMeshCube(1.0f, 1.0f, 1.0f), GenMeshSphere(0.6f, 8, 8), GenMeshCone(0.6f, 1.2f, 8) };
+
+    Mesh meshes[MESHES_SIDE*MESHES_SIDE] = { 0 };
+    for (int i = 0; i < MESHES_SIDE*MESHES_SIDE; i++) meshes[i] = types[i%MESHES_TYPES];
+
+    // Meshes data is copied into the mesh list shared buffers, same mesh can be added several times
+    MeshList list = LoadMeshList(meshes, MESHES_SIDE*MESHES_SIDE);
+
+    Matrix transforms[MESHES_SIDE*MESHES_SIDE] = { 0 };
+
+    Material material = LoadMaterialDefault();
+    material.maps[MATERIAL_MAP_DIFFUSE].color = SKYBLUE;
+
+    // Multi-draw indirect requires a shader reading meshes transforms by draw id
+    bool indirect = (rlGetVersion() == RL_OPENGL_43);
+    if (indirect) material.shader = LoadShaderFromMemory(vsMeshList, fsMeshList);
+
+    bool useList = true;
+    float time = 0.0f;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useList = !useList;
+
+        time += GetFrameTime();
+
+        for (int i = 0; i < MESHES_SIDE*MESHES_SIDE; i++)
+        {
+            float x = (float)(i%MESHES_SIDE) - MESHES_SIDE/2.0f;
+            float z = (float)(i/MESHES_SIDE) - MESHES_SIDE/2.0f;
+            float y = sinf(time*2.0f + x*0.3f + z*0.3f);
+
+            transforms[i] = MatrixMultiply(MatrixRotateY(time + i*0.1f), MatrixTranslate(x*1.5f, y, z*1.5f));
+        }
+
+        UpdateMeshListTransforms(list, transforms, 0, MESHES_SIDE*MESHES_SIDE);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                if (useList) DrawMeshList(list, material);
+                else
+                {
+                    for (int i = 0; i < MESHES_SIDE*MESHES_SIDE; i++) DrawMesh(meshes[i], material, transforms[i]);
+                }
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 330, 60, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("Drawing: %s", useList? (indirect? "MESH LIST (INDIRECT)" : "MESH LIST") : "MESH BY MESH"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Meshes: %i (%i vertices)", list.meshCount, list.vertexCount), 20, 35, 10, BLACK);
+            DrawText("Press SPACE to toggle mesh list", 20, 50, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMeshList(list);           // Unload mesh list from CPU and GPU
+    for (int i = 0; i < MESHES_TYPES; i++) UnloadMesh(types[i]);
+    if (indirect) UnloadShader(material.shader);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - render batch vertex layout benchmark
+*
+*   NOTE: This example measures the CPU time required to fill 100k quads through
+*         rlVertex3f()/rlTexCoord2f()/rlColor4ub() into a render batch, comparing
+*         separate vertex arrays (default) against interleaved vertex layout.
+*         Batch flushes (GPU upload + draw) are timed apart from the CPU fill.
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdlib.h>             // Required for: NULL
+
+#define BENCHMARK_QUADS         100000      // Number of quads filled per benchmark run
+#define BENCHMARK_BATCH_QUADS    10000      // Render batch elements (quads), fits 16-bit indices on OpenGL ES 2.0
+
+// Benchmark results
+typedef struct BatchTiming {
+    double fillTime;        // CPU time filling the batch vertex data (seconds)
+    double flushTime;       // Time uploading and drawing the batch (seconds)
+} BatchTiming;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static BatchTiming RunBatchBenchmark(rlRenderBatch *batch, int screenWidth, int screenHeight);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - render batch vertex layout");
+
+    // Load one custom render batch per vertex layout
+    rlRenderBatch batchSeparate = rlLoadRenderBatchEx(1, BENCHMARK_BATCH_QUADS, RL_BATCH_LAYOUT_SEPARATE);
+    rlRenderBatch batchInterleaved = rlLoadRenderBatchEx(1, BENCHMARK_BATCH_QUADS, RL_BATCH_LAYOUT_INTERLEAVED);
+
+    BatchTiming timingSeparate = { 0 };
+    BatchTiming timingInterleaved = { 0 };
+    int runs = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // ...
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Run both benchmarks every frame and accumulate results
+            BatchTiming separate = RunBatchBenchmark(&batchSeparate, screenWidth, screenHeight);
+            BatchTiming interleaved = RunBatchBenchmark(&batchInterleaved, screenWidth, screenHeight);
+
+            timingSeparate.fillTime += separate.fillTime;
+            timingSeparate.flushTime += separate.flushTime;
+            timingInterleaved.fillTime += interleaved.fillTime;
+            timingInterleaved.flushTime += interleaved.flushTime;
+            runs++;
+
+            DrawRectangle(10, 10, 480, 110, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("%i quads per run, average of %i runs", BENCHMARK_QUADS, runs), 20, 20, 10, DARKGRAY);
+            DrawText(TextFormat("SEPARATE:    fill %.3f ms | flush %.3f ms",
+                timingSeparate.fillTime*1000.0/runs, timingSeparate.flushTime*1000.0/runs), 20, 45, 20, BLACK);
+            DrawText(TextFormat("INTERLEAVED: fill %.3f ms | flush %.3f ms",
+                timingInterleaved.fillTime*1000.0/runs, timingInterleaved.flushTime*1000.0/runs), 20, 75, 20, BLACK);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    rlUnloadRenderBatch(batchSeparate);     // Unload render batches
+    rlUnloadRenderBatch(batchInterleaved);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Fill BENCHMARK_QUADS quads into provided batch, timing vertex fill and batch flushes separately
+// NOTE: Batch is flushed explicitly every BENCHMARK_BATCH_QUADS, so no flush happens inside rlVertex3f()
+static BatchTiming RunBatchBenchmark(rlRenderBatch *batch, int screenWidth, int screenHeight)
+{
+    BatchTiming timing = { 0 };
+
+    rlSetRenderBatchActive(batch);
+
+    for (int filled = 0; filled < BENCHMARK_QUADS; filled += BENCHMARK_BATCH_QUADS)
+    {
+        double startTime = GetTime();
+
+        rlBegin(RL_QUADS);
+            for (int i = 0; i < BENCHMARK_BATCH_QUADS; i++)
+            {
+                float x = (float)((filled + i)%screenWidth);
+                float y = (float)(((filled + i)/screenWidth)%screenHeight);
+
+                rlColor4ub((unsigned char)i, (unsigned char)(i >> 8), 255, 255);
+
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex3f(x, y, 0.0f);
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex3f(x, y + 1.0f, 0.0f);
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex3f(x + 1.0f, y + 1.0f, 0.0f);
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex3f(x + 1.0f, y, 0.0f);
+            }
+        rlEnd();
+
+        timing.fillTime += (GetTime() - startTime);
+
+        startTime = GetTime();
+        rlDrawRenderBatch(batch);       // Upload vertex data to GPU and draw
+        timing.flushTime += (GetTime() - startTime);
+    }
+
+    rlSetRenderBatchActive(NULL);       // Restore default internal batch
+
+    return timing;
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - render batch recording from multiple threads
+*
+*   NOTE: This example requires linking with pthreads library on MinGW,
+*   it can be accomplished passing -static parameter to compiler
+*
+*   NOTE: Every worker thread records its particles geometry into its own render batch record
+*         (CPU only, no GL calls), main thread submits all records in a deterministic order
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "pthread.h"                        // POSIX style threads management
+
+#include <math.h>                           // Required for: sinf(), cosf()
+
+#define MAX_WORKERS             4           // Number of worker threads recording geometry
+#define PARTICLES_PER_WORKER    5000        // Number of particles recorded by every worker
+
+// Worker thread recording data
+typedef struct WorkerData {
+    rlBatchRecord record;                   // Worker render batch record
+    int index;                              // Worker index, used to generate particles
+    float time;                             // Current time, used to animate particles
+    int screenWidth;
+    int screenHeight;
+} WorkerData;
+
+static void *RecordParticlesThread(void *arg);  // Worker thread function declaration
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - render batch recording");
+
+    WorkerData workers[MAX_WORKERS] = { 0 };
+    rlBatchRecord records[MAX_WORKERS] = { 0 };
+
+    for (int i = 0; i < MAX_WORKERS; i++)
+    {
+        workers[i].record = rlLoadBatchRecord(PARTICLES_PER_WORKER*4);
+        workers[i].index = i;
+        workers[i].screenWidth = screenWidth;
+        workers[i].screenHeight = screenHeight;
+    }
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Record particles geometry on worker threads
+        pthread_t threads[MAX_WORKERS] = { 0 };
+
+        for (int i = 0; i < MAX_WORKERS; i++)
+        {
+            workers[i].time = (float)GetTime();
+            pthread_create(&threads[i], NULL, &RecordParticlesThread, &workers[i]);
+        }
+
+        for (int i = 0; i < MAX_WORKERS; i++)
+        {
+            pthread_join(threads[i], NULL);
+            records[i] = workers[i].record;     // Keep records in workers order
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Submit all records on main thread, always in the same order
+            rlSubmitBatchRecords(records, MAX_WORKERS);
+
+            DrawRectangle(10, 10, 250, 40, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("Particles: %i (%i threads)", MAX_WORKERS*PARTICLES_PER_WORKER, MAX_WORKERS), 20, 20, 10, BLACK);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_WORKERS; i++) rlUnloadBatchRecord(workers[i].record);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+// Worker thread function: record particles quads into worker record
+// NOTE: Only rlRecord*() functions are used, no rlgl global state is accessed
+static void *RecordParticlesThread(void *arg)
+{
+    WorkerData *worker = (WorkerData *)arg;
+    rlBatchRecord *record = &worker->record;
+
+    rlResetBatchRecord(record);
+
+    rlRecordBegin(record, RL_QUADS);
+
+        for (int i = 0; i < PARTICLES_PER_WORKER; i++)
+        {
+            float angle = (float)(worker->index*PARTICLES_PER_WORKER + i)*0.01f + worker->time*(0.2f + 0.1f*worker->index);
+            float radius = 20.0f + (float)(i%200);
+            float x = worker->screenWidth/2.0f + cosf(angle)*radius*1.6f;
+            float y = worker->screenHeight/2.0f + sinf(angle)*radius;
+
+            rlRecordColor4ub(record, (unsigned char)(60*worker->index), (unsigned char)(i%255), 200, 255);
+
+            rlRecordTexCoord2f(record, 0.0f, 0.0f);
+            rlRecordVertex2f(record, x, y);
+            rlRecordTexCoord2f(record, 0.0f, 1.0f);
+            rlRecordVertex2f(record, x, y + 2.0f);
+            rlRecordTexCoord2f(record, 1.0f, 1.0f);
+            rlRecordVertex2f(record, x + 2.0f, y + 2.0f);
+            rlRecordTexCoord2f(record, 1.0f, 0.0f);
+            rlRecordVertex2f(record, x + 2.0f, y);
+        }
+
+    rlRecordEnd(record);
+
+    return NULL;
+}
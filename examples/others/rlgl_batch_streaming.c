@@ -0,0 +1,115 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - render batch streaming
+*
+*   NOTE: This example draws a sprites scene through a custom render batch, small enough to
+*         require several batch draws per frame, and reports vertex data uploaded per frame.
+*         With streaming enabled, successive batch draws append vertex data to the GPU buffers
+*         and unchanged vertex data (static scene) is not uploaded again.
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdlib.h>             // Required for: NULL
+
+#define BATCH_QUADS          2048       // Render batch elements (quads)
+#define STREAM_BUFFERS          8       // Streaming GPU buffers size (in batch buffers), fits a full frame
+#define SPRITES_COUNT       10000       // Number of sprites to draw
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - render batch streaming");
+
+    rlRenderBatch batch = rlLoadRenderBatchEx(1, BATCH_QUADS, RL_BATCH_LAYOUT_INTERLEAVED);
+
+    bool streaming = false;
+    bool animated = false;
+    float time = 0.0f;
+
+    rlRenderStats stats = { 0 };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            streaming = !streaming;
+
+            if (streaming) rlEnableRenderBatchStreaming(&batch, STREAM_BUFFERS);
+            else rlDisableRenderBatchStreaming(&batch);
+        }
+
+        if (IsKeyPressed(KEY_A)) animated = !animated;
+        if (animated) time += GetFrameTime();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Measure only scene vertex data uploads, previous frame text is not considered
+            rlResetRenderStats();
+
+            rlSetRenderBatchActive(&batch);
+
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                float x = (float)((i*7)%screenWidth);
+                float y = (float)((i*13)%screenHeight);
+
+                // Animated sprites change vertex data every frame, static ones do not
+                if (animated && ((i%10) == 0)) y += 10.0f*time;
+
+                DrawRectangle((int)x, (int)y%screenHeight, 6, 6, ColorFromHSV((float)(i%360), 0.8f, 0.9f));
+            }
+
+            rlSetRenderBatchActive(NULL);   // Draw remaining scene vertex data, restore default batch
+
+            stats = rlGetRenderStats();
+
+            DrawRectangle(10, 10, 340, 120, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("Streaming [SPACE]: %s", streaming? "ON" : "OFF"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Animated [A]: %s", animated? "ON" : "OFF"), 20, 35, 10, BLACK);
+            DrawText(TextFormat("Batch uploads: %i (skipped: %i)", stats.batchUploads, stats.batchUploadSkips), 20, 60, 10, DARKGRAY);
+            DrawText(TextFormat("Buffers orphaned: %i", stats.batchOrphans), 20, 75, 10, DARKGRAY);
+            DrawText(TextFormat("Uploaded per frame: %.2f KB", stats.bytesUploaded/1024.0f), 20, 100, 20, MAROON);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    rlUnloadRenderBatch(batch);     // Unload render batch
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
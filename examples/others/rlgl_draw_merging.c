@@ -0,0 +1,102 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - render batch draw calls merging
+*
+*   NOTE: This example draws a tile map interleaving two textures, every tile requires a new
+*         draw call and the batch draw calls limit forces several batch draws per frame.
+*         With draw merging enabled, draw calls sharing texture are merged (tiles do not overlap)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#define TILE_SIZE       16      // Tiles size in pixels
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - draw calls merging");
+
+    // Generate two tiles textures, used alternatively on the tile map
+    Image imGrass = GenImageChecked(TILE_SIZE, TILE_SIZE, TILE_SIZE/4, TILE_SIZE/4, GREEN, DARKGREEN);
+    Image imStone = GenImageChecked(TILE_SIZE, TILE_SIZE, TILE_SIZE/2, TILE_SIZE/2, LIGHTGRAY, GRAY);
+    Texture2D texGrass = LoadTextureFromImage(imGrass);
+    Texture2D texStone = LoadTextureFromImage(imStone);
+    UnloadImage(imGrass);
+    UnloadImage(imStone);
+
+    rlRenderStats stats = { 0 };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            if (rlIsDrawMergingEnabled()) rlDisableDrawMerging();
+            else rlEnableDrawMerging();
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            rlResetRenderStats();
+
+            // Draw tile map, alternating textures on every tile
+            for (int y = 0; y < screenHeight/TILE_SIZE; y++)
+            {
+                for (int x = 0; x < screenWidth/TILE_SIZE; x++)
+                {
+                    DrawTexture(((x + y)%2 == 0)? texGrass : texStone, x*TILE_SIZE, y*TILE_SIZE, WHITE);
+                }
+            }
+
+            rlDrawRenderBatchActive();      // Draw remaining tiles to get the frame statistics
+
+            stats = rlGetRenderStats();
+
+            DrawRectangle(10, 10, 320, 95, Fade(RAYWHITE, 0.9f));
+            DrawText(TextFormat("Draw merging [SPACE]: %s", rlIsDrawMergingEnabled()? "ON" : "OFF"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Draw calls before merging: %i", stats.drawCalls + stats.drawCallsMerged), 20, 40, 10, DARKGRAY);
+            DrawText(TextFormat("Draw calls submitted: %i", stats.drawCalls), 20, 55, 10, DARKGRAY);
+            DrawText(TextFormat("Batch uploads: %i", stats.batchUploads), 20, 80, 20, MAROON);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texGrass);        // Unload textures
+    UnloadTexture(texStone);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
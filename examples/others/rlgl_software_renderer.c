@@ -0,0 +1,99 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - software renderer
+*
+*   NOTE: This example requires raylib library compiled with GRAPHICS_API_SOFTWARE,
+*         rendering is done by CPU (external/rlsw.h), no GPU or OpenGL driver required.
+*         Software renderer does not present frames to the window, they can be read back
+*         with TakeScreenshot() or rlReadScreenPixels()
+*
+*   NOTE: On other graphics APIs the example runs the same scene as a reference
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#define SPRITES_COUNT       10000       // Number of sprites to draw
+#define SPRITES_SIZE           32       // Sprites size in pixels
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - software renderer");
+
+    bool software = (rlGetVersion() == RL_OPENGL_SOFTWARE);
+    if (!software) TraceLog(LOG_WARNING, "EXAMPLE: raylib not compiled with GRAPHICS_API_SOFTWARE, using GPU renderer");
+
+    Image imSprite = GenImageChecked(SPRITES_SIZE, SPRITES_SIZE, SPRITES_SIZE/4, SPRITES_SIZE/4, ORANGE, DARKBROWN);
+    Texture2D texSprite = LoadTextureFromImage(imSprite);
+    UnloadImage(imSprite);
+
+    float time = 0.0f;
+    int frameCounter = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        time += GetFrameTime();
+        frameCounter++;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                int x = (i*37 + (int)(time*20.0f))%screenWidth;
+                int y = (i*91)%screenHeight;
+
+                // Every third sprite is not textured, every second one is semi-transparent
+                Color tint = ((i%2) == 0)? WHITE : Fade(SKYBLUE, 0.5f);
+
+                if ((i%3) == 0) DrawRectangle(x, y, SPRITES_SIZE, SPRITES_SIZE, tint);
+                else DrawTexture(texSprite, x, y, tint);
+            }
+
+            DrawRectangle(10, 10, 300, 60, Fade(RAYWHITE, 0.9f));
+            DrawText(TextFormat("Renderer: %s", software? "SOFTWARE (CPU)" : "GPU"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Sprites: %i", SPRITES_COUNT), 20, 35, 10, DARKGRAY);
+            DrawFPS(20, 50);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+
+        // Software rendered frames are not presented, save one to check results
+        if (software && (frameCounter == 60)) TakeScreenshot("rlgl_software_renderer.png");
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texSprite);       // Unload texture
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************************
+*
+*   raylib [rlgl] example - texture batching
+*
+*   NOTE: Texture batching allows several textures on a single draw call, sprites drawn with
+*         different textures do not break the render batch; draw calls are counted with
+*         GetFrameStats(), press SPACE to toggle texture batching and compare
+*
+*   NOTE: Texture batching requires OpenGL 3.3+, on OpenGL ES 2.0 one texture is used by draw call
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#define TEXTURES_COUNT          6       // Number of different sprite textures
+#define SPRITES_COUNT        1200       // Number of sprites to draw
+#define SPRITES_SIZE           24       // Sprites size in pixels
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [rlgl] example - texture batching");
+
+    // Generate some textures, every sprite uses a different texture than the previous one
+    Color colors[TEXTURES_COUNT] = { RED, ORANGE, GOLD, LIME, SKYBLUE, VIOLET };
+    Texture2D textures[TEXTURES_COUNT] = { 0 };
+
+    for (int i = 0; i < TEXTURES_COUNT; i++)
+    {
+        Image image = GenImageChecked(SPRITES_SIZE, SPRITES_SIZE, SPRITES_SIZE/4, SPRITES_SIZE/4, colors[i], DARKGRAY);
+        textures[i] = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    NPatchInfo nPatchInfo = { (Rectangle){ 0.0f, 0.0f, SPRITES_SIZE, SPRITES_SIZE }, 6, 6, 6, 6, NPATCH_NINE_PATCH };
+
+    rlEnableTextureBatching();
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            if (rlIsTextureBatchingEnabled()) rlDisableTextureBatching();
+            else rlEnableTextureBatching();
+        }
+
+        // Draw calls of the previous frame
+        FrameStats stats = GetFrameStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                Texture2D texture = textures[i%TEXTURES_COUNT];
+                float x = (float)((i*SPRITES_SIZE)%screenWidth);
+                float y = (float)(80 + ((i*SPRITES_SIZE)/screenWidth)*(SPRITES_SIZE/2));
+
+                // Half of the sprites are drawn as n-patches, scaled
+                if ((i%2) == 0) DrawTexturePro(texture, (Rectangle){ 0, 0, SPRITES_SIZE, SPRITES_SIZE }, (Rectangle){ x, y, SPRITES_SIZE, SPRITES_SIZE }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+                else DrawTextureNPatch(texture, nPatchInfo, (Rectangle){ x, y, SPRITES_SIZE, SPRITES_SIZE*1.5f }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+            }
+
+            DrawRectangle(10, 10, 330, 60, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("Texture batching: %s", rlIsTextureBatchingEnabled()? "ON" : "OFF"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Draw calls: %i (%i sprites, %i textures)", stats.drawCalls, SPRITES_COUNT, TEXTURES_COUNT), 20, 35, 10, BLACK);
+            DrawText("Press SPACE to toggle texture batching", 20, 50, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < TEXTURES_COUNT; i++) UnloadTexture(textures[i]);   // Unload textures
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************************
+*
+*   raylib [shaders] example - shader binary cache
+*
+*   NOTE: Shader programs are stored as driver binaries into a cache directory (SetShaderCacheDirectory())
+*         and loaded from there instead of compiled again, this example measures shaders loading time:
+*         compiled with no cache (cold) and loaded from cache binaries (warm)
+*
+*   NOTE: Shader binaries cache requires raylib compiled with SUPPORT_SHADER_CACHE and driver
+*         program binaries support (OpenGL 4.1, GL_ARB_get_program_binary or GL_OES_get_program_binary)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB, PLATFORM_NX
+    #define GLSL_VERSION            100
+#endif
+
+#define SHADERS_COUNT          40       // Number of shader variants to load
+
+// Fragment shader variants, same code with a different color constant (different shader programs)
+static const char *fsCode100 =
+    "#version 100                                   \n"
+    "precision mediump float;                       \n"
+    "varying vec2 fragTexCoord;                     \n"
+    "varying vec4 fragColor;                        \n"
+    "uniform sampler2D texture0;                    \n"
+    "uniform vec4 colDiffuse;                       \n"
+    "const vec3 variant = vec3(%.3f, %.3f, 0.5);    \n"
+    "void main()                                    \n"
+    "{                                              \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord);\n"
+    "    gl_FragColor = vec4(variant, 1.0)*texelColor*colDiffuse*fragColor;\n"
+    "}                                              \n";
+
+static const char *fsCode330 =
+    "#version 330                                   \n"
+    "in vec2 fragTexCoord;                          \n"
+    "in vec4 fragColor;                             \n"
+    "uniform sampler2D texture0;                    \n"
+    "uniform vec4 colDiffuse;                       \n"
+    "const vec3 variant = vec3(%.3f, %.3f, 0.5);    \n"
+    "out vec4 finalColor;                           \n"
+    "void main()                                    \n"
+    "{                                              \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);\n"
+    "    finalColor = vec4(variant, 1.0)*texelColor*colDiffuse*fragColor;\n"
+    "}                                              \n";
+
+// Load all shader variants, returns loading time in milliseconds
+static double LoadShaderVariants(Shader *shaders)
+{
+    double startTime = GetTime();
+
+    for (int i = 0; i < SHADERS_COUNT; i++)
+    {
+        float r = (float)(i%8)/7.0f;
+        float g = (float)(i/8)/4.0f;
+
+        shaders[i] = LoadShaderFromMemory(0, TextFormat((GLSL_VERSION == 330)? fsCode330 : fsCode100, r, g));
+    }
+
+    return (GetTime() - startTime)*1000.0;
+}
+
+static void UnloadShaderVariants(Shader *shaders)
+{
+    for (int i = 0; i < SHADERS_COUNT; i++) UnloadShader(shaders[i]);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shaders] example - shader binary cache");
+
+    Shader shaders[SHADERS_COUNT] = { 0 };
+
+    // Cold start: shaders compiled from code, cache disabled
+    SetShaderCacheDirectory(0);
+    double coldTime = LoadShaderVariants(shaders);
+    UnloadShaderVariants(shaders);
+
+    // First start with cache: shaders compiled and program binaries stored in cache
+    // NOTE: Cache directory must exist, binaries from a previous run are reused
+    SetShaderCacheDirectory(GetWorkingDirectory());
+    double storeTime = LoadShaderVariants(shaders);
+    UnloadShaderVariants(shaders);
+
+    // Warm start: shaders loaded from cache program binaries
+    double warmTime = LoadShaderVariants(shaders);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Nothing to update, loading times measured on initialization
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw one rectangle with every loaded shader variant
+            for (int i = 0; i < SHADERS_COUNT; i++)
+            {
+                BeginShaderMode(shaders[i]);
+                    DrawRectangle(40 + (i%8)*90, 150 + (i/8)*55, 80, 45, WHITE);
+                EndShaderMode();
+            }
+
+            DrawText(TextFormat("Shaders loading time (%i shaders):", SHADERS_COUNT), 40, 20, 20, DARKGRAY);
+            DrawText(TextFormat("Compiled, no cache (cold): %.2f ms", coldTime), 40, 50, 20, MAROON);
+            DrawText(TextFormat("Compiled, stored in cache: %.2f ms", storeTime), 40, 75, 20, DARKGRAY);
+            DrawText(TextFormat("Loaded from cache (warm): %.2f ms", warmTime), 40, 100, 20, DARKGREEN);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadShaderVariants(shaders);  // Unload shaders
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - atlas packing
+*
+*   NOTE: Sprites are packed at runtime into texture atlas pages, sprites drawn from the same
+*         page share the texture and do not break the render batch; press SPACE to compare with
+*         one texture per sprite, press R to unload and load again a group of sprites (streaming)
+*
+*   Example originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define SPRITES_TYPES          48       // Number of different sprite images
+#define SPRITES_COUNT        2000       // Number of sprites to draw
+#define STREAMED_TYPES         16       // Number of sprite images unloaded and loaded again with R
+
+// Generate sprite image, different size and colors by type
+static Image GenSpriteImage(int type, int generation)
+{
+    int size = 16 + (type%4)*8;
+    Color color = ColorFromHSV((float)((type*37 + generation*90)%360), 0.8f, 0.9f);
+
+    return GenImageChecked(size, size, size/4, size/4, color, DARKGRAY);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - atlas packing");
+
+    TextureAtlas atlas = LoadTextureAtlas(256, 256, 1);     // Atlas pages of 256x256 pixels, 1 pixel padding
+    AtlasSprite sprites[SPRITES_TYPES] = { 0 };
+    Texture2D textures[SPRITES_TYPES] = { 0 };              // Same sprites, one texture each
+
+    for (int i = 0; i < SPRITES_TYPES; i++)
+    {
+        Image image = GenSpriteImage(i, 0);
+        sprites[i] = LoadAtlasSpriteFromImage(&atlas, image);
+        textures[i] = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    bool useAtlas = true;
+    int generation = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useAtlas = !useAtlas;
+
+        if (IsKeyPressed(KEY_R))
+        {
+            // Replace a group of sprites, released atlas space is reused by new ones
+            generation++;
+
+            for (int i = 0; i < STREAMED_TYPES; i++) UnloadAtlasSprite(&atlas, sprites[i]);
+
+            for (int i = 0; i < STREAMED_TYPES; i++)
+            {
+                Image image = GenSpriteImage(i, generation);
+                sprites[i] = LoadAtlasSpriteFromImage(&atlas, image);
+                UnloadTexture(textures[i]);
+                textures[i] = LoadTextureFromImage(image);
+                UnloadImage(image);
+            }
+        }
+
+        // Render stats of the previous frame
+        FrameStats stats = GetFrameStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < SPRITES_COUNT; i++)
+            {
+                int type = (i*7)%SPRITES_TYPES;
+                Vector2 position = { (float)((i*53)%(screenWidth - 40)), (float)(80 + (i*29)%(screenHeight - 120)) };
+
+                if (useAtlas) DrawTextureRec(sprites[type].texture, sprites[type].source, position, WHITE);
+                else DrawTexture(textures[type], (int)position.x, (int)position.y, WHITE);
+            }
+
+            // Draw atlas pages scaled down
+            if (useAtlas)
+            {
+                for (int i = 0; i < atlas.pageCount; i++)
+                {
+                    DrawTextureEx(atlas.pages[i], (Vector2){ (float)(screenWidth - 100 - i*100), 10.0f }, 0.0f, 90.0f/atlas.width, WHITE);
+                    DrawRectangleLines(screenWidth - 100 - i*100, 10, 90, 90, DARKGRAY);
+                }
+            }
+
+            DrawRectangle(10, 10, 360, 60, Fade(SKYBLUE, 0.9f));
+            DrawText(TextFormat("Sprites source: %s", useAtlas? TextFormat("ATLAS (%i pages)", atlas.pageCount) : "ONE TEXTURE BY SPRITE"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Texture binds: %i - Draw calls: %i", stats.textureBinds, stats.drawCalls), 20, 35, 10, BLACK);
+            DrawText("Press SPACE to toggle atlas, R to reload sprites", 20, 50, 10, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < SPRITES_TYPES; i++) UnloadTexture(textures[i]);
+    UnloadTextureAtlas(atlas);      // Unload atlas pages, sprites are not valid anymore
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
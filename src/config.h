@@ -55,15 +55,33 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
-#define SUPPORT_PARTIALBUSY_WAIT_LOOP
+//#define SUPPORT_PARTIALBUSY_WAIT_LOOP
+// Use an adaptive wait loop, frame sleeps for the time measured as reliable (sleep overshoot estimate) and runs a busy loop for the rest
+#define SUPPORT_ADAPTIVE_WAIT_LOOP      1
 // Wait for events passively (sleeping while no events) instead of polling them actively every frame
 //#define SUPPORT_EVENTS_WAITING          1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
+// Encode screen recording frames in a worker thread, requires POSIX threads (pthreads)
+#define SUPPORT_GIF_RECORDING_THREAD    1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
+// Support packed assets archives (.rpak), files loaded from mounted archives instead of file system, memory mapped if possible
+#define SUPPORT_ASSETS_ARCHIVE          1
+// Support assets loading in background threads (LoadAssetAsync()), GPU upload done on main thread, time budgeted
+// NOTE: Requires POSIX threads (pthreads), assets loaded on main thread at EndDrawing() if not available (Windows, Web)
+#define SUPPORT_ASYNC_LOADING           1
+// Scan subdirectories in parallel threads on recursive directory loading (LoadDirectoryFilesEx()), requires POSIX threads (pthreads)
+// NOTE: Files order is not deterministic, useful for big directory trees on slow storage
+//#define SUPPORT_PARALLEL_DIRECTORY_SCAN 1
+// Support shader program binaries cache, LoadShader() loads binaries from cache directory instead of compiling, set with SetShaderCacheDirectory()
+// NOTE: Requires driver program binaries support (OpenGL 4.1, GL_ARB_get_program_binary or GL_OES_get_program_binary)
+#define SUPPORT_SHADER_CACHE            1
+// Support files changes watching (WatchFile()) and assets hot-reloading (textures, shaders, models)
+// NOTE: Changes notified by inotify on Linux, files modification times polled otherwise (FILE_WATCH_POLL_INTERVAL)
+#define SUPPORT_FILE_WATCHER            1
 // Support automatic generated events, loading and recording of those events when required
 //#define SUPPORT_EVENTS_AUTOMATION       1
 // Support custom frame control, only for advance users
@@ -78,7 +96,6 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -90,7 +107,22 @@
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
 
-#define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define COMPRESSION_STREAM_CHUNK_SIZE 16384     // Input data chunk size read by streaming decompression (DecompressDataStream())
+#define MAX_WATCHED_FILES              64       // Maximum number of files and directories watched (WatchFile())
+#define MAX_HOT_RELOAD_ASSETS          64       // Maximum number of assets hot-reloaded on files changes
+#define FILE_WATCH_POLL_INTERVAL      0.5       // Files changes polling interval in seconds (no system notifications)
+#define DIRECTORY_SCAN_THREADS          4       // Directories scanning threads on recursive scan (SUPPORT_PARALLEL_DIRECTORY_SCAN)
+#define MAX_MOUNTED_ARCHIVES            4       // Maximum number of assets archives mounted at the same time (MountArchive())
+#define MAX_ASYNC_SHADERS              64       // Maximum number of shaders loading asynchronously (LoadShaderAsync())
+#define MAX_ASYNC_ASSETS               64       // Maximum number of assets loading asynchronously (LoadAssetAsync())
+#define ASYNC_LOADING_THREADS           2       // Assets loading threads
+#define ASYNC_UPLOAD_BUDGET           2.0       // Default assets GPU upload time per frame, in milliseconds (SetAssetUploadBudget())
+#define FIXED_UPDATE_MAX_STEPS          5       // Default fixed update steps limit per frame, catch-up limit (SetFixedUpdateMaxSteps())
+#define AUTOMATION_INDEX_FRAMES        60       // Automation events file frames indexed (key frame block) every frames, seek granularity (SeekAutomationEventPlaying())
+#define FRAME_TIME_HISTORY             60       // Frames time measures kept for frame jitter statistics
+#define GIF_RECORD_FRAMERATE           10       // Screen recording default rate, game frames per recorded frame (SetScreenRecordingRate())
+#define GIF_READBACK_BUFFERS            3       // Screen recording, readback pixel buffers (asynchronous readback)
+#define GIF_ENCODER_FRAMES              4       // Screen recording, frames queued for encoding (encoder thread)
 
 
 //------------------------------------------------------------------------------------
@@ -103,14 +135,22 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Software renderer (GRAPHICS_API_SOFTWARE) rasterization threads, more than 1 requires pthreads
+//#define RLSW_MAX_THREADS                       1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+#define RL_DEFAULT_BATCH_LAYOUT                0      // Default render batch vertex layout (0: separate arrays, 1: interleaved)
+#define RL_DEFAULT_BATCH_STREAM_BUFFERS        0      // Default render batch streaming VBO size (in batch buffers), 0 disables streaming
+#define RL_DEFAULT_BATCH_TEXTURE_SLOTS         8      // Maximum number of textures by draw call on texture batching (rlEnableTextureBatching())
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_UNIFORM_CACHE_ENTRIES         512      // Maximum number of uniform values tracked by state cache (skip redundant uploads)
+#define RL_MAX_CACHED_TEXTURE_UNITS           16      // Maximum number of texture units bindings tracked by state cache
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
@@ -123,6 +163,8 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID       "vertexDrawId"      // Bound by default to shader location: 7
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -211,6 +253,7 @@
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
 #define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
+#define MESH_LIST_TRANSFORMS_BINDING    0       // Mesh list transforms shader buffer (SSBO) binding point (OpenGL 4.3)
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -241,9 +284,16 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Profiler zones recording (BeginProfileZone()/EndProfileZone()), exported as Chrome trace JSON
+// NOTE: Internal zones: BeginDrawing(), EndDrawing(), PollInputEvents(), SwapScreenBuffer(), WaitTime(),
+// rlDrawRenderBatch(), UpdateMusicStream(), LoadImage(), LoadModel()
+//#define SUPPORT_PROFILER                1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       128       // Max length of one trace-log message
+#define MAX_PROFILER_EVENTS          8192       // Max profiler zones recorded per thread (ring buffer, oldest discarded)
+#define MAX_PROFILER_THREADS           16       // Max threads recording profiler zones
+#define MAX_PROFILER_ZONE_DEPTH        32       // Max profiler zones nesting depth per thread
 
 #endif // CONFIG_H
@@ -71,7 +71,11 @@ GLFWbool _glfwSelectPlatform(int desiredID, _GLFWplatform* platform)
 
     // Only allow the Null platform if specifically requested
     if (desiredID == GLFW_PLATFORM_NULL)
+#if defined(GRAPHICS_API_SOFTWARE)
+        return _glfwConnectNull(desiredID, platform);  // @raysan5: Null platform only compiled for software renderer (rglfw.c)
+#else
         return GLFW_FALSE; //_glfwConnectNull(desiredID, platform);  // @raysan5
+#endif
     else if (count == 0)
     {
         _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "This binary only supports the Null platform");
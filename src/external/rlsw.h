@@ -0,0 +1,2705 @@
+/**********************************************************************************************
+*
+*   rlsw - OpenGL 1.1 software renderer (GPU-free), used by rlgl as GRAPHICS_API_SOFTWARE
+*
+*   DESCRIPTION:
+*
+*     Implements on CPU the subset of OpenGL 1.1 required by rlgl GRAPHICS_API_OPENGL_11 code path,
+*     so raylib can render without any GPU or OpenGL driver available (headless servers, CI machines,
+*     golden-image tests, thumbnails generation...). Rendering result is read with glReadPixels().
+*
+*     Supported functionality:
+*       - Immediate mode (glBegin/glEnd) and client vertex arrays (glDrawArrays/glDrawElements)
+*       - Modelview/projection matrix stacks, viewport and scissor test
+*       - Points, lines, triangles and quads (also strips/fans), polygon wire mode, backface culling
+*       - RGBA textures (converted to RGBA8 on load) modulated by vertex color, nearest/bilinear
+*         filtering, repeat/clamp/mirrored-repeat wrapping, only base mipmap level is used
+*       - Color blending (OpenGL 1.1 blend factors), depth test and depth mask
+*
+*     Rasterization is deferred and tiled: primitives are transformed, clipped and binned into
+*     screen tiles when submitted, tiles are rasterized on glFinish(), glReadPixels() or when the
+*     binned primitives limit is reached. Every tile is rasterized by one thread (if enabled),
+*     primitives keep submission order inside every tile, so output is deterministic.
+*
+*     NOTE: All gl*() functions are mapped to sw*() functions with macros, avoiding symbols
+*     collisions with system OpenGL libraries that could be linked or loaded by the platform layer.
+*
+*   CONFIGURATION:
+*
+*   #define RLSW_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   #define RLSW_TILE_SIZE              64
+*       Screen tiles size in pixels, primitives are binned and rasterized per tile
+*
+*   #define RLSW_MAX_THREADS            4
+*       Number of threads used to rasterize tiles, values > 1 require pthreads (not supported on MSVC),
+*       defaults to 1 where pthreads are not available (MSVC, Emscripten)
+*
+*   #define RLSW_NO_SIMD
+*       Disable SSE2 spans blending and modulation, scalar code is used (same output)
+*
+*   #define RLSW_MAX_BINNED_TRIANGLES   65536
+*       Maximum number of triangles binned before rasterization is forced
+*
+*   #define RLSW_MAX_MATRIX_STACK_SIZE  32
+*       Maximum size of modelview/projection matrix stacks
+*
+*   #define RLSW_MALLOC()
+*   #define RLSW_REALLOC()
+*   #define RLSW_FREE()
+*       Memory management functions, default to stdlib ones
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLSW_H
+#define RLSW_H
+
+#ifndef RLSWAPI
+    #define RLSWAPI     // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition (OpenGL 1.1 types)
+//----------------------------------------------------------------------------------
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef void GLvoid;
+typedef signed char GLbyte;
+typedef short GLshort;
+typedef int GLint;
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef unsigned int GLuint;
+typedef int GLsizei;
+typedef float GLfloat;
+typedef float GLclampf;
+typedef double GLdouble;
+typedef double GLclampd;
+
+//----------------------------------------------------------------------------------
+// Defines and Macros (OpenGL 1.1 values)
+//----------------------------------------------------------------------------------
+#define GL_FALSE                            0
+#define GL_TRUE                             1
+
+#define GL_NO_ERROR                         0
+#define GL_INVALID_ENUM                     0x0500
+#define GL_INVALID_VALUE                    0x0501
+#define GL_INVALID_OPERATION                0x0502
+#define GL_STACK_OVERFLOW                   0x0503
+#define GL_STACK_UNDERFLOW                  0x0504
+#define GL_OUT_OF_MEMORY                    0x0505
+
+// Primitives
+#define GL_POINTS                           0x0000
+#define GL_LINES                            0x0001
+#define GL_LINE_LOOP                        0x0002
+#define GL_LINE_STRIP                       0x0003
+#define GL_TRIANGLES                        0x0004
+#define GL_TRIANGLE_STRIP                   0x0005
+#define GL_TRIANGLE_FAN                     0x0006
+#define GL_QUADS                            0x0007
+
+// Data types
+#define GL_BYTE                             0x1400
+#define GL_UNSIGNED_BYTE                    0x1401
+#define GL_SHORT                            0x1402
+#define GL_UNSIGNED_SHORT                   0x1403
+#define GL_INT                              0x1404
+#define GL_UNSIGNED_INT                     0x1405
+#define GL_FLOAT                            0x1406
+#define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
+#define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
+#define GL_UNSIGNED_SHORT_5_6_5             0x8363
+
+// Blending factors
+#define GL_ZERO                             0
+#define GL_ONE                              1
+#define GL_SRC_COLOR                        0x0300
+#define GL_ONE_MINUS_SRC_COLOR              0x0301
+#define GL_SRC_ALPHA                        0x0302
+#define GL_ONE_MINUS_SRC_ALPHA              0x0303
+#define GL_DST_ALPHA                        0x0304
+#define GL_ONE_MINUS_DST_ALPHA              0x0305
+#define GL_DST_COLOR                        0x0306
+#define GL_ONE_MINUS_DST_COLOR              0x0307
+#define GL_SRC_ALPHA_SATURATE               0x0308
+
+// Depth functions
+#define GL_NEVER                            0x0200
+#define GL_LESS                             0x0201
+#define GL_EQUAL                            0x0202
+#define GL_LEQUAL                           0x0203
+#define GL_GREATER                          0x0204
+#define GL_NOTEQUAL                         0x0205
+#define GL_GEQUAL                           0x0206
+#define GL_ALWAYS                           0x0207
+
+// Capabilities
+#define GL_CULL_FACE                        0x0B44
+#define GL_DEPTH_TEST                       0x0B71
+#define GL_BLEND                            0x0BE2
+#define GL_SCISSOR_TEST                     0x0C11
+#define GL_TEXTURE_2D                       0x0DE1
+#define GL_LINE_SMOOTH                      0x0B20
+#define GL_MULTISAMPLE                      0x809D
+
+// Faces and polygon modes
+#define GL_FRONT                            0x0404
+#define GL_BACK                             0x0405
+#define GL_FRONT_AND_BACK                   0x0408
+#define GL_CW                               0x0900
+#define GL_CCW                              0x0901
+#define GL_POINT                            0x1B00
+#define GL_LINE                             0x1B01
+#define GL_FILL                             0x1B02
+
+// Matrices
+#define GL_MODELVIEW                        0x1700
+#define GL_PROJECTION                       0x1701
+#define GL_TEXTURE                          0x1702
+#define GL_MODELVIEW_MATRIX                 0x0BA6
+#define GL_PROJECTION_MATRIX                0x0BA7
+
+// State queries
+#define GL_LINE_WIDTH                       0x0B21
+
+// Buffers
+#define GL_DEPTH_BUFFER_BIT                 0x00000100
+#define GL_STENCIL_BUFFER_BIT               0x00000400
+#define GL_COLOR_BUFFER_BIT                 0x00004000
+
+// Pixel formats
+#define GL_ALPHA                            0x1906
+#define GL_RGB                              0x1907
+#define GL_RGBA                             0x1908
+#define GL_LUMINANCE                        0x1909
+#define GL_LUMINANCE_ALPHA                  0x190A
+#define GL_UNPACK_ALIGNMENT                 0x0CF5
+#define GL_PACK_ALIGNMENT                   0x0D05
+
+// Textures parameters
+#define GL_NEAREST                          0x2600
+#define GL_LINEAR                           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST           0x2700
+#define GL_LINEAR_MIPMAP_NEAREST            0x2701
+#define GL_NEAREST_MIPMAP_LINEAR            0x2702
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
+#define GL_TEXTURE_MAG_FILTER               0x2800
+#define GL_TEXTURE_MIN_FILTER               0x2801
+#define GL_TEXTURE_WRAP_S                   0x2802
+#define GL_TEXTURE_WRAP_T                   0x2803
+#define GL_CLAMP                            0x2900
+#define GL_REPEAT                           0x2901
+#define GL_CLAMP_TO_EDGE                    0x812F
+#define GL_MIRRORED_REPEAT                  0x8370
+
+// Client vertex arrays
+#define GL_VERTEX_ARRAY                     0x8074
+#define GL_NORMAL_ARRAY                     0x8075
+#define GL_COLOR_ARRAY                      0x8076
+#define GL_TEXTURE_COORD_ARRAY              0x8078
+
+// Hints and shading
+#define GL_PERSPECTIVE_CORRECTION_HINT      0x0C50
+#define GL_LINE_SMOOTH_HINT                 0x0C52
+#define GL_DONT_CARE                        0x1100
+#define GL_FASTEST                          0x1101
+#define GL_NICEST                           0x1102
+#define GL_FLAT                             0x1D00
+#define GL_SMOOTH                           0x1D01
+
+// Strings
+#define GL_VENDOR                           0x1F00
+#define GL_RENDERER                         0x1F01
+#define GL_VERSION                          0x1F02
+#define GL_EXTENSIONS                       0x1F03
+
+// OpenGL 1.1 functions mapped to software renderer functions
+#define glBegin                 swBegin
+#define glEnd                   swEnd
+#define glVertex2i              swVertex2i
+#define glVertex2f              swVertex2f
+#define glVertex3f              swVertex3f
+#define glTexCoord2f            swTexCoord2f
+#define glNormal3f              swNormal3f
+#define glColor3f               swColor3f
+#define glColor4f               swColor4f
+#define glColor4ub              swColor4ub
+
+#define glMatrixMode            swMatrixMode
+#define glPushMatrix            swPushMatrix
+#define glPopMatrix             swPopMatrix
+#define glLoadIdentity          swLoadIdentity
+#define glMultMatrixf           swMultMatrixf
+#define glTranslatef            swTranslatef
+#define glRotatef               swRotatef
+#define glScalef                swScalef
+#define glOrtho                 swOrtho
+#define glFrustum               swFrustum
+#define glGetFloatv             swGetFloatv
+
+#define glViewport              swViewport
+#define glScissor               swScissor
+#define glEnable                swEnable
+#define glDisable               swDisable
+#define glBlendFunc             swBlendFunc
+#define glDepthFunc             swDepthFunc
+#define glDepthMask             swDepthMask
+#define glCullFace              swCullFace
+#define glFrontFace             swFrontFace
+#define glPolygonMode           swPolygonMode
+#define glLineWidth             swLineWidth
+#define glHint                  swHint
+#define glShadeModel            swShadeModel
+#define glPixelStorei           swPixelStorei
+#define glGetError              swGetError
+#define glGetString             swGetString
+
+#define glClearColor            swClearColor
+#define glClearDepth            swClearDepth
+#define glClear                 swClear
+#define glReadPixels            swReadPixels
+#define glFlush                 swFlush
+#define glFinish                swFinish
+
+#define glGenTextures           swGenTextures
+#define glDeleteTextures        swDeleteTextures
+#define glBindTexture           swBindTexture
+#define glTexImage2D            swTexImage2D
+#define glTexSubImage2D         swTexSubImage2D
+#define glTexParameteri         swTexParameteri
+#define glGetTexImage           swGetTexImage
+
+#define glEnableClientState     swEnableClientState
+#define glDisableClientState    swDisableClientState
+#define glVertexPointer         swVertexPointer
+#define glTexCoordPointer       swTexCoordPointer
+#define glNormalPointer         swNormalPointer
+#define glColorPointer          swColorPointer
+#define glDrawArrays            swDrawArrays
+#define glDrawElements          swDrawElements
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Software renderer context management
+RLSWAPI int swInit(int width, int height);              // Initialize software renderer context (framebuffer), returns 0 on failure
+RLSWAPI void swClose(void);                             // Close software renderer context
+RLSWAPI int swResize(int width, int height);            // Resize default framebuffer (content is lost)
+RLSWAPI unsigned char *swGetColorBuffer(int *width, int *height);   // Get framebuffer color data (RGBA8, bottom-up), finishes pending rendering
+
+// OpenGL 1.1 functions implementation
+RLSWAPI void swBegin(GLenum mode);
+RLSWAPI void swEnd(void);
+RLSWAPI void swVertex2i(GLint x, GLint y);
+RLSWAPI void swVertex2f(GLfloat x, GLfloat y);
+RLSWAPI void swVertex3f(GLfloat x, GLfloat y, GLfloat z);
+RLSWAPI void swTexCoord2f(GLfloat s, GLfloat t);
+RLSWAPI void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz);
+RLSWAPI void swColor3f(GLfloat r, GLfloat g, GLfloat b);
+RLSWAPI void swColor4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+RLSWAPI void swColor4ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a);
+
+RLSWAPI void swMatrixMode(GLenum mode);
+RLSWAPI void swPushMatrix(void);
+RLSWAPI void swPopMatrix(void);
+RLSWAPI void swLoadIdentity(void);
+RLSWAPI void swMultMatrixf(const GLfloat *m);
+RLSWAPI void swTranslatef(GLfloat x, GLfloat y, GLfloat z);
+RLSWAPI void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+RLSWAPI void swScalef(GLfloat x, GLfloat y, GLfloat z);
+RLSWAPI void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar);
+RLSWAPI void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar);
+RLSWAPI void swGetFloatv(GLenum pname, GLfloat *params);
+
+RLSWAPI void swViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+RLSWAPI void swScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+RLSWAPI void swEnable(GLenum cap);
+RLSWAPI void swDisable(GLenum cap);
+RLSWAPI void swBlendFunc(GLenum sfactor, GLenum dfactor);
+RLSWAPI void swDepthFunc(GLenum func);
+RLSWAPI void swDepthMask(GLboolean flag);
+RLSWAPI void swCullFace(GLenum mode);
+RLSWAPI void swFrontFace(GLenum mode);
+RLSWAPI void swPolygonMode(GLenum face, GLenum mode);
+RLSWAPI void swLineWidth(GLfloat width);
+RLSWAPI void swHint(GLenum target, GLenum mode);
+RLSWAPI void swShadeModel(GLenum mode);
+RLSWAPI void swPixelStorei(GLenum pname, GLint param);
+RLSWAPI GLenum swGetError(void);
+RLSWAPI const GLubyte *swGetString(GLenum name);
+
+RLSWAPI void swClearColor(GLclampf r, GLclampf g, GLclampf b, GLclampf a);
+RLSWAPI void swClearDepth(GLclampd depth);
+RLSWAPI void swClear(GLbitfield mask);
+RLSWAPI void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels);
+RLSWAPI void swFlush(void);
+RLSWAPI void swFinish(void);
+
+RLSWAPI void swGenTextures(GLsizei n, GLuint *textures);
+RLSWAPI void swDeleteTextures(GLsizei n, const GLuint *textures);
+RLSWAPI void swBindTexture(GLenum target, GLuint texture);
+RLSWAPI void swTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels);
+RLSWAPI void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels);
+RLSWAPI void swTexParameteri(GLenum target, GLenum pname, GLint param);
+RLSWAPI void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels);
+
+RLSWAPI void swEnableClientState(GLenum array);
+RLSWAPI void swDisableClientState(GLenum array);
+RLSWAPI void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+RLSWAPI void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+RLSWAPI void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer);
+RLSWAPI void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+RLSWAPI void swDrawArrays(GLenum mode, GLint first, GLsizei count);
+RLSWAPI void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLSW_H
+
+
+/***********************************************************************************
+*
+*   RLSW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLSW_IMPLEMENTATION)
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memcpy(), memset()
+#include <math.h>       // Required for: sqrtf(), sinf(), cosf(), floorf(), ceilf(), fabsf(), fminf(), fmaxf()
+
+#ifndef RLSW_MALLOC
+    #define RLSW_MALLOC(sz)         malloc(sz)
+#endif
+#ifndef RLSW_REALLOC
+    #define RLSW_REALLOC(ptr, sz)   realloc(ptr, sz)
+#endif
+#ifndef RLSW_FREE
+    #define RLSW_FREE(p)            free(p)
+#endif
+
+#ifndef RLSW_TILE_SIZE
+    #define RLSW_TILE_SIZE                  64      // Screen tiles size in pixels
+#endif
+#ifndef RLSW_MAX_THREADS
+    #if defined(_MSC_VER) || defined(__EMSCRIPTEN__)
+        #define RLSW_MAX_THREADS             1      // Threads used to rasterize tiles (pthreads not available)
+    #else
+        #define RLSW_MAX_THREADS             4      // Threads used to rasterize tiles
+    #endif
+#endif
+#ifndef RLSW_MAX_BINNED_TRIANGLES
+    #define RLSW_MAX_BINNED_TRIANGLES    65536      // Maximum triangles binned before forcing rasterization
+#endif
+#ifndef RLSW_MAX_MATRIX_STACK_SIZE
+    #define RLSW_MAX_MATRIX_STACK_SIZE      32      // Maximum size of matrix stacks
+#endif
+
+// Threads are only used if requested and supported by the compiler
+#if (RLSW_MAX_THREADS > 1) && !defined(_MSC_VER)
+    #define RLSW_SUPPORT_THREADS
+    #include <pthread.h>        // POSIX style threads management
+#endif
+
+// SIMD spans blending and modulation, only used if supported by the target (SSE2)
+#if !defined(RLSW_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RLSW_SUPPORT_SSE2
+        #include <emmintrin.h>      // SSE2 intrinsics
+    #endif
+#endif
+
+#define RLSW_MIN_THREADED_TRIANGLES        256      // Minimum binned triangles to rasterize with multiple threads
+#define RLSW_MAX_CLIPPED_VERTICES           12      // Maximum vertices of a triangle clipped by all clip planes
+#define RLSW_GUARD_BAND                   32.0f     // Guard band size (in viewports), primitives are clipped outside of it
+
+#define SW_CLIP_PLANES_COUNT                 6      // Clip planes: near, far, left, right, bottom, top
+#define SW_ATTRIBUTES_COUNT                  8      // Interpolated attributes: depth, 1/w, texcoord (2), color (4)
+#define SW_SUBPIXEL_SCALE                   16      // Subpixel precision: 4 bits
+#define SW_SUBPIXEL_HALF                     8      // Pixel center (subpixel units)
+
+// Blending modes, used to select rasterization loop
+#define SW_BLEND_NONE                        0
+#define SW_BLEND_ALPHA                       1      // Source alpha, one minus source alpha
+#define SW_BLEND_GENERIC                     2
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Vertex data, position in clip space
+typedef struct swVertex {
+    float position[4];          // Vertex position (clip space)
+    float texcoord[2];          // Vertex texture coordinates
+    float color[4];             // Vertex color (0.0f..255.0f)
+} swVertex;
+
+// Vertex data, position in window space
+typedef struct swScreenVertex {
+    float x, y, z;              // Window coordinates and depth [0..1]
+    float invw;                 // Inverse of clip space w (perspective correction)
+    float texcoord[2];          // Vertex texture coordinates
+    float color[4];             // Vertex color (0.0f..255.0f)
+} swScreenVertex;
+
+// Triangle attribute interpolation plane, value = start + dx*x + dy*y
+typedef struct swPlane {
+    float start;
+    float dx;
+    float dy;
+} swPlane;
+
+// Binned triangle, setup for rasterization
+typedef struct swTriangle {
+    int edgeA[3];               // Edge functions x factor (subpixel units)
+    int edgeB[3];               // Edge functions y factor (subpixel units)
+    int edgeX[3];               // Edge functions origin x (subpixel units)
+    int edgeY[3];               // Edge functions origin y (subpixel units)
+    int edgeBias[3];            // Edge functions bias (top-left fill rule)
+    int bounds[4];              // Pixels bounding box: minx, miny, maxx, maxy (inclusive)
+    int state;                  // Render state index
+    int perspective;            // Attributes require perspective correction (divided by w)
+    int rect;                   // Screen aligned rectangle (quad), every pixel inside bounds, edge functions not used
+    swPlane planes[SW_ATTRIBUTES_COUNT];    // Attributes: depth, 1/w, texcoord (2), color (4)
+} swTriangle;
+
+// Render state required by binned triangles
+typedef struct swState {
+    unsigned int texture;       // Texture id (0 if texturing disabled)
+    int blend;                  // Color blending enabled
+    GLenum srcFactor;           // Blending source factor
+    GLenum dstFactor;           // Blending destination factor
+    int depthTest;              // Depth test enabled
+    GLenum depthFunc;           // Depth test function
+    int depthMask;              // Depth write enabled
+    int clip[4];                // Pixels clipping rectangle: minx, miny, maxx, maxy (inclusive)
+} swState;
+
+// Texture data, always stored as RGBA8
+typedef struct swTexture {
+    unsigned char *pixels;      // Texture pixels (RGBA8)
+    int width;                  // Texture width
+    int height;                 // Texture height
+    GLenum minFilter;           // Minification filter
+    GLenum magFilter;           // Magnification filter
+    GLenum wrapS;               // Wrap mode for s coordinate
+    GLenum wrapT;               // Wrap mode for t coordinate
+    int opaque;                 // Every texel alpha is 255, alpha blending not required with opaque color
+    int used;                   // Texture id is in use
+} swTexture;
+
+// Screen tile, list of binned triangles
+typedef struct swTile {
+    int *triangles;             // Binned triangles indices (submission order)
+    int count;                  // Binned triangles count
+    int capacity;               // Binned triangles capacity
+} swTile;
+
+// Client vertex array
+typedef struct swArray {
+    const void *pointer;        // Array data pointer
+    GLint size;                 // Components per element
+    GLenum type;                // Components type
+    GLsizei stride;             // Stride between elements (bytes)
+    int enabled;                // Array enabled
+} swArray;
+
+// Software renderer context
+typedef struct swContext {
+    unsigned char *colorBuffer;         // Framebuffer color (RGBA8, bottom-up)
+    float *depthBuffer;                 // Framebuffer depth
+    int width;                          // Framebuffer width
+    int height;                         // Framebuffer height
+
+    swTile *tiles;                      // Screen tiles
+    int tilesX;                         // Screen tiles horizontal count
+    int tilesY;                         // Screen tiles vertical count
+
+    swTriangle *triangles;              // Binned triangles
+    int triangleCount;                  // Binned triangles count
+    int triangleCapacity;               // Binned triangles capacity
+
+    swState *states;                    // Render states used by binned triangles
+    int stateCount;                     // Render states count
+    int stateCapacity;                  // Render states capacity
+    int stateDirty;                     // Current render state changed since last state stored
+
+    swTexture *textures;                // Textures (index is texture id)
+    int textureCapacity;                // Textures capacity
+    GLuint boundTexture;                // Current bound texture
+
+    float stack[2][RLSW_MAX_MATRIX_STACK_SIZE][16];    // Matrix stacks: modelview, projection
+    int stackCounter[2];                // Matrix stacks counters
+    int matrixMode;                     // Current matrix stack (0: modelview, 1: projection)
+    float mvp[16];                      // Modelview-projection matrix, computed on primitives begin
+
+    int viewport[4];                    // Viewport: x, y, width, height
+    int scissor[4];                     // Scissor: x, y, width, height
+    int scissorTest;                    // Scissor test enabled
+    int texture2D;                      // Texturing enabled
+    int blend;                          // Color blending enabled
+    GLenum srcFactor;                   // Blending source factor
+    GLenum dstFactor;                   // Blending destination factor
+    int depthTest;                      // Depth test enabled
+    GLenum depthFunc;                   // Depth test function
+    int depthMask;                      // Depth write enabled
+    int cullFace;                       // Face culling enabled
+    GLenum cullMode;                    // Face culled: GL_FRONT, GL_BACK, GL_FRONT_AND_BACK
+    GLenum frontFace;                   // Front face winding: GL_CCW, GL_CW
+    GLenum polygonMode;                 // Polygon mode: GL_FILL, GL_LINE, GL_POINT
+    float lineWidth;                    // Lines width
+    int unpackAlignment;                // Pixels rows alignment on upload
+    int packAlignment;                  // Pixels rows alignment on read
+
+    unsigned char clearColor[4];        // Clear color
+    float clearDepth;                   // Clear depth
+
+    GLenum primitive;                   // Current primitive mode (between glBegin/glEnd)
+    int insideBegin;                    // Primitive definition in progress
+    swVertex *vertices;                 // Primitive vertices
+    int vertexCount;                    // Primitive vertices count
+    int vertexCapacity;                 // Primitive vertices capacity
+    float texcoord[2];                  // Current texture coordinates
+    float color[4];                     // Current color (0.0f..255.0f)
+
+    swArray vertexArray;                // Client vertex array: positions
+    swArray texcoordArray;              // Client vertex array: texture coordinates
+    swArray colorArray;                 // Client vertex array: colors
+
+    GLenum error;                       // Last error
+} swContext;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static swContext SW = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void swMatrixMultiply(float *result, const float *left, const float *right);   // Multiply matrices (column-major)
+static void swMatrixApply(const float *m);                  // Multiply current matrix by provided matrix
+static void swSetError(GLenum error);                       // Set error (keeps first error until checked)
+static int swUpdateTiles(void);                             // Update screen tiles for current framebuffer size
+static int swGetStateIndex(void);                           // Get current render state index, stored if changed
+static void swPushVertex(float x, float y, float z);        // Transform vertex and add it to current primitive
+static void swDrawClientArrays(GLenum mode, int first, int count, GLenum type, const void *indices);  // Draw primitives from client vertex arrays
+static void swProcessPrimitives(GLenum mode, const swVertex *vertices, int count);    // Assemble primitives from vertices
+static void swProcessTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2);
+static void swProcessQuad(const swVertex *v0, const swVertex *v1, const swVertex *v2, const swVertex *v3);
+static void swProcessLine(const swVertex *v0, const swVertex *v1);
+static void swProcessPoint(const swVertex *v);
+static float swClipDistance(const swVertex *v, int plane);  // Get vertex distance to clip plane (inside if >= 0)
+static void swLerpVertex(swVertex *result, const swVertex *a, const swVertex *b, float t);   // Interpolate vertex attributes
+static int swClipPolygon(swVertex *polygon, int count);     // Clip polygon against clip planes
+static void swProjectVertex(const swVertex *v, swScreenVertex *out);    // Transform clip space vertex to window space
+static void swBinLine(const swScreenVertex *v0, const swScreenVertex *v1, float width);
+static void swBinTriangle(const swScreenVertex *v0, const swScreenVertex *v1, const swScreenVertex *v2, int rect);
+static void swRasterizeTile(int tileIndex);                 // Rasterize all triangles binned in a tile
+static inline long long swFloorDiv(long long numerator, long long denominator);     // Integer division rounding towards negative infinity
+#if defined(RLSW_SUPPORT_THREADS)
+static void *swRasterizeTilesThread(void *arg);             // Rasterize tiles assigned to a thread
+#endif
+static void swRasterizeTriangle(const swTriangle *tri, const swState *state, const int *rect);
+static inline void swBlendSpanAlpha(unsigned char *dst, const unsigned int *src, int count);    // Blend span colors over pixels (source alpha)
+static inline void swBlendSpanColor(unsigned char *dst, const unsigned char *color, int count);  // Blend color over pixels (source alpha)
+static inline void swFillSpan(unsigned char *dst, const unsigned char *color, int count);        // Fill pixels with color
+static inline void swModulateSpan(unsigned int *span, const unsigned char *src, const int *color, int count);    // Multiply colors by color into span (GL_MODULATE)
+static void swConvertPixels(unsigned char *dst, const unsigned char *src, int width, int height, GLenum format, GLenum type, int alignment);
+static int swIsOpaque(const unsigned char *pixels, int count);      // Check every pixel alpha is 255 (RGBA8)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Context management
+//----------------------------------------------------------------------------------
+// Initialize software renderer context
+int swInit(int width, int height)
+{
+    memset(&SW, 0, sizeof(swContext));
+
+    for (int i = 0; i < 2; i++)
+    {
+        memset(SW.stack[i][0], 0, 16*sizeof(float));
+        SW.stack[i][0][0] = SW.stack[i][0][5] = SW.stack[i][0][10] = SW.stack[i][0][15] = 1.0f;
+    }
+
+    SW.srcFactor = GL_ONE;
+    SW.dstFactor = GL_ZERO;
+    SW.depthFunc = GL_LESS;
+    SW.depthMask = 1;
+    SW.cullMode = GL_BACK;
+    SW.frontFace = GL_CCW;
+    SW.polygonMode = GL_FILL;
+    SW.lineWidth = 1.0f;
+    SW.unpackAlignment = 4;
+    SW.packAlignment = 4;
+    SW.clearDepth = 1.0f;
+    SW.color[0] = SW.color[1] = SW.color[2] = SW.color[3] = 255.0f;
+    SW.stateDirty = 1;
+
+    // Texture id 0 is reserved (no texture)
+    SW.textureCapacity = 64;
+    SW.textures = (swTexture *)RLSW_MALLOC(SW.textureCapacity*sizeof(swTexture));
+    if (SW.textures == NULL) return 0;
+    memset(SW.textures, 0, SW.textureCapacity*sizeof(swTexture));
+    SW.textures[0].used = 1;
+
+    if (!swResize(width, height)) return 0;
+
+    SW.viewport[2] = SW.scissor[2] = width;
+    SW.viewport[3] = SW.scissor[3] = height;
+
+    return 1;
+}
+
+// Close software renderer context
+void swClose(void)
+{
+    for (int i = 0; i < SW.textureCapacity; i++) RLSW_FREE(SW.textures[i].pixels);
+    for (int i = 0; i < SW.tilesX*SW.tilesY; i++) RLSW_FREE(SW.tiles[i].triangles);
+
+    RLSW_FREE(SW.textures);
+    RLSW_FREE(SW.tiles);
+    RLSW_FREE(SW.triangles);
+    RLSW_FREE(SW.states);
+    RLSW_FREE(SW.vertices);
+    RLSW_FREE(SW.colorBuffer);
+    RLSW_FREE(SW.depthBuffer);
+
+    memset(&SW, 0, sizeof(swContext));
+}
+
+// Resize default framebuffer (content is lost)
+int swResize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return 0;
+
+    swFinish();
+
+    unsigned char *colorBuffer = (unsigned char *)RLSW_MALLOC((size_t)width*height*4);
+    float *depthBuffer = (float *)RLSW_MALLOC((size_t)width*height*sizeof(float));
+
+    if ((colorBuffer == NULL) || (depthBuffer == NULL))
+    {
+        RLSW_FREE(colorBuffer);
+        RLSW_FREE(depthBuffer);
+        swSetError(GL_OUT_OF_MEMORY);
+        return 0;
+    }
+
+    RLSW_FREE(SW.colorBuffer);
+    RLSW_FREE(SW.depthBuffer);
+
+    SW.colorBuffer = colorBuffer;
+    SW.depthBuffer = depthBuffer;
+    SW.width = width;
+    SW.height = height;
+
+    memset(SW.colorBuffer, 0, (size_t)width*height*4);
+    for (int i = 0; i < width*height; i++) SW.depthBuffer[i] = 1.0f;
+
+    SW.stateDirty = 1;      // Clipping rectangle depends on framebuffer size
+
+    return swUpdateTiles();
+}
+
+// Get framebuffer color data (RGBA8, bottom-up), finishes pending rendering
+unsigned char *swGetColorBuffer(int *width, int *height)
+{
+    swFinish();
+
+    if (width != NULL) *width = SW.width;
+    if (height != NULL) *height = SW.height;
+
+    return SW.colorBuffer;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vertex level operations
+//----------------------------------------------------------------------------------
+void swBegin(GLenum mode)
+{
+    if (SW.insideBegin) { swSetError(GL_INVALID_OPERATION); return; }
+
+    // Matrices can not be changed inside glBegin()/glEnd(), so mvp is computed once
+    swMatrixMultiply(SW.mvp, SW.stack[1][SW.stackCounter[1]], SW.stack[0][SW.stackCounter[0]]);
+
+    SW.primitive = mode;
+    SW.insideBegin = 1;
+    SW.vertexCount = 0;
+}
+
+void swEnd(void)
+{
+    if (!SW.insideBegin) { swSetError(GL_INVALID_OPERATION); return; }
+
+    swProcessPrimitives(SW.primitive, SW.vertices, SW.vertexCount);
+
+    SW.insideBegin = 0;
+    SW.vertexCount = 0;
+}
+
+void swVertex2i(GLint x, GLint y) { swPushVertex((float)x, (float)y, 0.0f); }
+void swVertex2f(GLfloat x, GLfloat y) { swPushVertex(x, y, 0.0f); }
+void swVertex3f(GLfloat x, GLfloat y, GLfloat z) { swPushVertex(x, y, z); }
+
+void swTexCoord2f(GLfloat s, GLfloat t)
+{
+    SW.texcoord[0] = s;
+    SW.texcoord[1] = t;
+}
+
+// NOTE: Normals are not used, lighting is not supported
+void swNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { (void)nx; (void)ny; (void)nz; }
+
+void swColor3f(GLfloat r, GLfloat g, GLfloat b) { swColor4f(r, g, b, 1.0f); }
+
+void swColor4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    SW.color[0] = ((r < 0.0f)? 0.0f : (r > 1.0f)? 1.0f : r)*255.0f;
+    SW.color[1] = ((g < 0.0f)? 0.0f : (g > 1.0f)? 1.0f : g)*255.0f;
+    SW.color[2] = ((b < 0.0f)? 0.0f : (b > 1.0f)? 1.0f : b)*255.0f;
+    SW.color[3] = ((a < 0.0f)? 0.0f : (a > 1.0f)? 1.0f : a)*255.0f;
+}
+
+void swColor4ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a)
+{
+    SW.color[0] = (float)r;
+    SW.color[1] = (float)g;
+    SW.color[2] = (float)b;
+    SW.color[3] = (float)a;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Matrix operations
+//----------------------------------------------------------------------------------
+void swMatrixMode(GLenum mode)
+{
+    if (mode == GL_MODELVIEW) SW.matrixMode = 0;
+    else if (mode == GL_PROJECTION) SW.matrixMode = 1;
+    else swSetError(GL_INVALID_ENUM);   // GL_TEXTURE matrix not supported
+}
+
+void swPushMatrix(void)
+{
+    int mode = SW.matrixMode;
+
+    if (SW.stackCounter[mode] >= (RLSW_MAX_MATRIX_STACK_SIZE - 1)) { swSetError(GL_STACK_OVERFLOW); return; }
+
+    memcpy(SW.stack[mode][SW.stackCounter[mode] + 1], SW.stack[mode][SW.stackCounter[mode]], 16*sizeof(float));
+    SW.stackCounter[mode]++;
+}
+
+void swPopMatrix(void)
+{
+    if (SW.stackCounter[SW.matrixMode] <= 0) { swSetError(GL_STACK_UNDERFLOW); return; }
+
+    SW.stackCounter[SW.matrixMode]--;
+}
+
+void swLoadIdentity(void)
+{
+    float *m = SW.stack[SW.matrixMode][SW.stackCounter[SW.matrixMode]];
+
+    memset(m, 0, 16*sizeof(float));
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+void swMultMatrixf(const GLfloat *m) { swMatrixApply(m); }
+
+void swTranslatef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, x, y, z, 1.0f };
+    swMatrixApply(m);
+}
+
+void swRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    float length = sqrtf(x*x + y*y + z*z);
+    if (length <= 0.0f) return;
+
+    x /= length;
+    y /= length;
+    z /= length;
+
+    float radians = angle*3.14159265358979323846f/180.0f;
+    float s = sinf(radians);
+    float c = cosf(radians);
+    float t = 1.0f - c;
+
+    float m[16] = {
+        x*x*t + c,   y*x*t + z*s, z*x*t - y*s, 0.0f,
+        x*y*t - z*s, y*y*t + c,   z*y*t + x*s, 0.0f,
+        x*z*t + y*s, y*z*t - x*s, z*z*t + c,   0.0f,
+        0.0f,        0.0f,        0.0f,        1.0f
+    };
+
+    swMatrixApply(m);
+}
+
+void swScalef(GLfloat x, GLfloat y, GLfloat z)
+{
+    float m[16] = { x, 0.0f, 0.0f, 0.0f, 0.0f, y, 0.0f, 0.0f, 0.0f, 0.0f, z, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    swMatrixApply(m);
+}
+
+void swOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    float m[16] = { 0 };
+
+    m[0] = (float)(2.0/(right - left));
+    m[5] = (float)(2.0/(top - bottom));
+    m[10] = (float)(-2.0/(zFar - zNear));
+    m[12] = (float)(-(right + left)/(right - left));
+    m[13] = (float)(-(top + bottom)/(top - bottom));
+    m[14] = (float)(-(zFar + zNear)/(zFar - zNear));
+    m[15] = 1.0f;
+
+    swMatrixApply(m);
+}
+
+void swFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+    float m[16] = { 0 };
+
+    m[0] = (float)(2.0*zNear/(right - left));
+    m[5] = (float)(2.0*zNear/(top - bottom));
+    m[8] = (float)((right + left)/(right - left));
+    m[9] = (float)((top + bottom)/(top - bottom));
+    m[10] = (float)(-(zFar + zNear)/(zFar - zNear));
+    m[11] = -1.0f;
+    m[14] = (float)(-2.0*zFar*zNear/(zFar - zNear));
+
+    swMatrixApply(m);
+}
+
+void swGetFloatv(GLenum pname, GLfloat *params)
+{
+    if (pname == GL_MODELVIEW_MATRIX) memcpy(params, SW.stack[0][SW.stackCounter[0]], 16*sizeof(float));
+    else if (pname == GL_PROJECTION_MATRIX) memcpy(params, SW.stack[1][SW.stackCounter[1]], 16*sizeof(float));
+    else if (pname == GL_LINE_WIDTH) params[0] = SW.lineWidth;
+    else swSetError(GL_INVALID_ENUM);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Render state
+//----------------------------------------------------------------------------------
+void swViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.viewport[0] = x;
+    SW.viewport[1] = y;
+    SW.viewport[2] = width;
+    SW.viewport[3] = height;
+    SW.stateDirty = 1;
+}
+
+void swScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.scissor[0] = x;
+    SW.scissor[1] = y;
+    SW.scissor[2] = width;
+    SW.scissor[3] = height;
+    SW.stateDirty = 1;
+}
+
+void swEnable(GLenum cap)
+{
+    switch (cap)
+    {
+        case GL_CULL_FACE: SW.cullFace = 1; break;
+        case GL_DEPTH_TEST: SW.depthTest = 1; break;
+        case GL_BLEND: SW.blend = 1; break;
+        case GL_SCISSOR_TEST: SW.scissorTest = 1; break;
+        case GL_TEXTURE_2D: SW.texture2D = 1; break;
+        default: break;     // Not supported capabilities are ignored (i.e. GL_LINE_SMOOTH)
+    }
+
+    SW.stateDirty = 1;
+}
+
+void swDisable(GLenum cap)
+{
+    switch (cap)
+    {
+        case GL_CULL_FACE: SW.cullFace = 0; break;
+        case GL_DEPTH_TEST: SW.depthTest = 0; break;
+        case GL_BLEND: SW.blend = 0; break;
+        case GL_SCISSOR_TEST: SW.scissorTest = 0; break;
+        case GL_TEXTURE_2D: SW.texture2D = 0; break;
+        default: break;
+    }
+
+    SW.stateDirty = 1;
+}
+
+void swBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    SW.srcFactor = sfactor;
+    SW.dstFactor = dfactor;
+    SW.stateDirty = 1;
+}
+
+void swDepthFunc(GLenum func) { SW.depthFunc = func; SW.stateDirty = 1; }
+void swDepthMask(GLboolean flag) { SW.depthMask = (flag != GL_FALSE); SW.stateDirty = 1; }
+void swCullFace(GLenum mode) { SW.cullMode = mode; }
+void swFrontFace(GLenum mode) { SW.frontFace = mode; }
+
+void swPolygonMode(GLenum face, GLenum mode)
+{
+    (void)face;     // Same mode used for front and back faces
+    SW.polygonMode = mode;
+}
+
+void swLineWidth(GLfloat width) { SW.lineWidth = (width < 1.0f)? 1.0f : width; }
+void swHint(GLenum target, GLenum mode) { (void)target; (void)mode; }
+void swShadeModel(GLenum mode) { (void)mode; }     // Only smooth shading supported
+
+void swPixelStorei(GLenum pname, GLint param)
+{
+    if ((param != 1) && (param != 2) && (param != 4) && (param != 8)) { swSetError(GL_INVALID_VALUE); return; }
+
+    if (pname == GL_UNPACK_ALIGNMENT) SW.unpackAlignment = param;
+    else if (pname == GL_PACK_ALIGNMENT) SW.packAlignment = param;
+    else swSetError(GL_INVALID_ENUM);
+}
+
+GLenum swGetError(void)
+{
+    GLenum error = SW.error;
+    SW.error = GL_NO_ERROR;
+
+    return error;
+}
+
+const GLubyte *swGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"rlsw (software renderer)";
+        case GL_VERSION: return (const GLubyte *)"1.1 rlsw";
+        case GL_EXTENSIONS: return (const GLubyte *)"";
+        default: swSetError(GL_INVALID_ENUM); break;
+    }
+
+    return NULL;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Framebuffer operations
+//----------------------------------------------------------------------------------
+void swClearColor(GLclampf r, GLclampf g, GLclampf b, GLclampf a)
+{
+    SW.clearColor[0] = (unsigned char)(((r < 0.0f)? 0.0f : (r > 1.0f)? 1.0f : r)*255.0f + 0.5f);
+    SW.clearColor[1] = (unsigned char)(((g < 0.0f)? 0.0f : (g > 1.0f)? 1.0f : g)*255.0f + 0.5f);
+    SW.clearColor[2] = (unsigned char)(((b < 0.0f)? 0.0f : (b > 1.0f)? 1.0f : b)*255.0f + 0.5f);
+    SW.clearColor[3] = (unsigned char)(((a < 0.0f)? 0.0f : (a > 1.0f)? 1.0f : a)*255.0f + 0.5f);
+}
+
+void swClearDepth(GLclampd depth) { SW.clearDepth = (float)((depth < 0.0)? 0.0 : (depth > 1.0)? 1.0 : depth); }
+
+// Clear framebuffer, scissor test is considered (as OpenGL does)
+void swClear(GLbitfield mask)
+{
+    swFinish();     // Pending primitives must be rasterized before clearing
+
+    int minx = 0, miny = 0, maxx = SW.width, maxy = SW.height;
+
+    if (SW.scissorTest)
+    {
+        if (SW.scissor[0] > minx) minx = SW.scissor[0];
+        if (SW.scissor[1] > miny) miny = SW.scissor[1];
+        if ((SW.scissor[0] + SW.scissor[2]) < maxx) maxx = SW.scissor[0] + SW.scissor[2];
+        if ((SW.scissor[1] + SW.scissor[3]) < maxy) maxy = SW.scissor[1] + SW.scissor[3];
+    }
+
+    if ((minx >= maxx) || (miny >= maxy)) return;
+
+    if (mask & GL_COLOR_BUFFER_BIT)
+    {
+        unsigned char *row = SW.colorBuffer + ((size_t)miny*SW.width + minx)*4;
+
+        // Fill first row, copy it to the following rows
+        for (int x = 0; x < (maxx - minx); x++) memcpy(row + x*4, SW.clearColor, 4);
+        for (int y = miny + 1; y < maxy; y++) memcpy(SW.colorBuffer + ((size_t)y*SW.width + minx)*4, row, (maxx - minx)*4);
+    }
+
+    if (mask & GL_DEPTH_BUFFER_BIT)
+    {
+        for (int y = miny; y < maxy; y++)
+        {
+            float *depth = SW.depthBuffer + (size_t)y*SW.width;
+            for (int x = minx; x < maxx; x++) depth[x] = SW.clearDepth;
+        }
+    }
+}
+
+// Read framebuffer pixels (rows bottom-up), only GL_RGBA/GL_UNSIGNED_BYTE supported
+void swReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+    if ((format != GL_RGBA) || (type != GL_UNSIGNED_BYTE)) { swSetError(GL_INVALID_ENUM); return; }
+
+    swFinish();
+
+    int rowSize = width*4;
+    int rowStride = (rowSize + SW.packAlignment - 1)/SW.packAlignment*SW.packAlignment;
+
+    for (int j = 0; j < height; j++)
+    {
+        unsigned char *dst = (unsigned char *)pixels + (size_t)j*rowStride;
+
+        for (int i = 0; i < width; i++)
+        {
+            int px = x + i;
+            int py = y + j;
+
+            // Pixels outside the framebuffer are undefined, they are returned as zero
+            if ((px < 0) || (py < 0) || (px >= SW.width) || (py >= SW.height)) memset(dst + i*4, 0, 4);
+            else memcpy(dst + i*4, SW.colorBuffer + ((size_t)py*SW.width + px)*4, 4);
+        }
+    }
+}
+
+// NOTE: Rasterization is only deferred to bin primitives, flushing does not need to wait
+void swFlush(void) { }
+
+// Rasterize all binned primitives
+void swFinish(void)
+{
+    if (SW.triangleCount == 0) return;
+
+    int tileCount = SW.tilesX*SW.tilesY;
+
+#if defined(RLSW_SUPPORT_THREADS)
+    if (SW.triangleCount >= RLSW_MIN_THREADED_TRIANGLES)
+    {
+        // Every thread rasterizes tiles interleaved: thread, thread + RLSW_MAX_THREADS, ...
+        // NOTE: Tiles do not share pixels, so no synchronization is required between threads
+        pthread_t threads[RLSW_MAX_THREADS - 1];
+        int threadIndices[RLSW_MAX_THREADS];
+        int threadCount = 1;
+
+        for (int i = 0; i < RLSW_MAX_THREADS; i++) threadIndices[i] = i;
+
+        for (int i = 1; i < RLSW_MAX_THREADS; i++)
+        {
+            if (pthread_create(&threads[threadCount - 1], NULL, swRasterizeTilesThread, &threadIndices[i]) == 0) threadCount++;
+            else break;
+        }
+
+        // Main thread rasterizes its tiles and the tiles of threads that could not be created
+        for (int i = 0; i < tileCount; i++)
+        {
+            if (((i%RLSW_MAX_THREADS) == 0) || ((i%RLSW_MAX_THREADS) >= threadCount)) swRasterizeTile(i);
+        }
+
+        for (int i = 0; i < (threadCount - 1); i++) pthread_join(threads[i], NULL);
+    }
+    else
+#endif
+    {
+        for (int i = 0; i < tileCount; i++) swRasterizeTile(i);
+    }
+
+    for (int i = 0; i < tileCount; i++) SW.tiles[i].count = 0;
+
+    SW.triangleCount = 0;
+    SW.stateCount = 0;
+    SW.stateDirty = 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Textures
+//----------------------------------------------------------------------------------
+void swGenTextures(GLsizei n, GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
+    {
+        int id = 0;
+
+        for (int j = 1; j < SW.textureCapacity; j++)
+        {
+            if (!SW.textures[j].used) { id = j; break; }
+        }
+
+        if (id == 0)
+        {
+            // NOTE: Only texture ids are stored in binned primitives states, array can be reallocated
+            swTexture *resized = (swTexture *)RLSW_REALLOC(SW.textures, SW.textureCapacity*2*sizeof(swTexture));
+            if (resized == NULL) { swSetError(GL_OUT_OF_MEMORY); textures[i] = 0; continue; }
+
+            memset(resized + SW.textureCapacity, 0, SW.textureCapacity*sizeof(swTexture));
+            id = SW.textureCapacity;
+
+            SW.textures = resized;
+            SW.textureCapacity *= 2;
+        }
+
+        SW.textures[id].used = 1;
+        SW.textures[id].minFilter = GL_NEAREST_MIPMAP_LINEAR;
+        SW.textures[id].magFilter = GL_LINEAR;
+        SW.textures[id].wrapS = GL_REPEAT;
+        SW.textures[id].wrapT = GL_REPEAT;
+
+        textures[i] = (GLuint)id;
+    }
+}
+
+void swDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    swFinish();     // Binned primitives could use deleted textures
+
+    for (int i = 0; i < n; i++)
+    {
+        GLuint id = textures[i];
+
+        if ((id == 0) || ((int)id >= SW.textureCapacity) || !SW.textures[id].used) continue;
+
+        RLSW_FREE(SW.textures[id].pixels);
+        memset(&SW.textures[id], 0, sizeof(swTexture));
+
+        if (SW.boundTexture == id) SW.boundTexture = 0;
+    }
+
+    SW.stateDirty = 1;
+}
+
+void swBindTexture(GLenum target, GLuint texture)
+{
+    if (target != GL_TEXTURE_2D) { swSetError(GL_INVALID_ENUM); return; }
+    if (((int)texture >= SW.textureCapacity) || !SW.textures[texture].used) { swSetError(GL_INVALID_VALUE); return; }
+
+    SW.boundTexture = texture;
+    SW.stateDirty = 1;
+}
+
+// Load texture pixels, converted to RGBA8
+// NOTE: Only base level is stored, mipmap levels are ignored
+void swTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    (void)internalformat;
+    (void)border;
+
+    if ((target != GL_TEXTURE_2D) || (SW.boundTexture == 0)) { swSetError(GL_INVALID_OPERATION); return; }
+    if (level > 0) return;
+    if ((width <= 0) || (height <= 0)) { swSetError(GL_INVALID_VALUE); return; }
+
+    swFinish();     // Binned primitives could use current texture data
+
+    swTexture *texture = &SW.textures[SW.boundTexture];
+
+    unsigned char *data = (unsigned char *)RLSW_MALLOC((size_t)width*height*4);
+    if (data == NULL) { swSetError(GL_OUT_OF_MEMORY); return; }
+
+    if (pixels != NULL) swConvertPixels(data, (const unsigned char *)pixels, width, height, format, type, SW.unpackAlignment);
+    else memset(data, 0, (size_t)width*height*4);
+
+    RLSW_FREE(texture->pixels);
+    texture->pixels = data;
+    texture->width = width;
+    texture->height = height;
+    texture->opaque = swIsOpaque(data, width*height);
+}
+
+void swTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    if ((target != GL_TEXTURE_2D) || (SW.boundTexture == 0)) { swSetError(GL_INVALID_OPERATION); return; }
+    if (level > 0) return;
+
+    swTexture *texture = &SW.textures[SW.boundTexture];
+
+    if ((xoffset < 0) || (yoffset < 0) || ((xoffset + width) > texture->width) || ((yoffset + height) > texture->height)) { swSetError(GL_INVALID_VALUE); return; }
+    if ((width <= 0) || (height <= 0) || (pixels == NULL)) return;
+
+    unsigned char *data = (unsigned char *)RLSW_MALLOC((size_t)width*height*4);
+    if (data == NULL) { swSetError(GL_OUT_OF_MEMORY); return; }
+
+    swConvertPixels(data, (const unsigned char *)pixels, width, height, format, type, SW.unpackAlignment);
+
+    swFinish();     // Binned primitives could use current texture data
+
+    for (int y = 0; y < height; y++) memcpy(texture->pixels + ((size_t)(yoffset + y)*texture->width + xoffset)*4, data + (size_t)y*width*4, width*4);
+
+    // NOTE: Texture with translucent texels is not checked again, only updated texels are checked
+    texture->opaque = texture->opaque && swIsOpaque(data, width*height);
+
+    RLSW_FREE(data);
+}
+
+void swTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    if ((target != GL_TEXTURE_2D) || (SW.boundTexture == 0)) { swSetError(GL_INVALID_OPERATION); return; }
+
+    swFinish();     // Binned primitives could use current texture parameters
+
+    swTexture *texture = &SW.textures[SW.boundTexture];
+
+    switch (pname)
+    {
+        case GL_TEXTURE_MIN_FILTER: texture->minFilter = (GLenum)param; break;
+        case GL_TEXTURE_MAG_FILTER: texture->magFilter = (GLenum)param; break;
+        case GL_TEXTURE_WRAP_S: texture->wrapS = (GLenum)param; break;
+        case GL_TEXTURE_WRAP_T: texture->wrapT = (GLenum)param; break;
+        default: break;     // Not supported parameters are ignored (i.e. anisotropic filtering)
+    }
+}
+
+// Get texture pixels, only GL_RGBA/GL_UNSIGNED_BYTE supported
+void swGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels)
+{
+    if ((target != GL_TEXTURE_2D) || (SW.boundTexture == 0) || (level > 0)) { swSetError(GL_INVALID_OPERATION); return; }
+    if ((format != GL_RGBA) || (type != GL_UNSIGNED_BYTE)) { swSetError(GL_INVALID_ENUM); return; }
+
+    swTexture *texture = &SW.textures[SW.boundTexture];
+    if (texture->pixels == NULL) return;
+
+    int rowSize = texture->width*4;
+    int rowStride = (rowSize + SW.packAlignment - 1)/SW.packAlignment*SW.packAlignment;
+
+    for (int y = 0; y < texture->height; y++) memcpy((unsigned char *)pixels + (size_t)y*rowStride, texture->pixels + (size_t)y*rowSize, rowSize);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Client vertex arrays
+//----------------------------------------------------------------------------------
+void swEnableClientState(GLenum array)
+{
+    if (array == GL_VERTEX_ARRAY) SW.vertexArray.enabled = 1;
+    else if (array == GL_TEXTURE_COORD_ARRAY) SW.texcoordArray.enabled = 1;
+    else if (array == GL_COLOR_ARRAY) SW.colorArray.enabled = 1;
+}
+
+void swDisableClientState(GLenum array)
+{
+    if (array == GL_VERTEX_ARRAY) SW.vertexArray.enabled = 0;
+    else if (array == GL_TEXTURE_COORD_ARRAY) SW.texcoordArray.enabled = 0;
+    else if (array == GL_COLOR_ARRAY) SW.colorArray.enabled = 0;
+}
+
+void swVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    if (type != GL_FLOAT) { swSetError(GL_INVALID_ENUM); return; }
+
+    SW.vertexArray.pointer = pointer;
+    SW.vertexArray.size = size;
+    SW.vertexArray.type = type;
+    SW.vertexArray.stride = (stride > 0)? stride : size*(GLsizei)sizeof(float);
+}
+
+void swTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    if (type != GL_FLOAT) { swSetError(GL_INVALID_ENUM); return; }
+
+    SW.texcoordArray.pointer = pointer;
+    SW.texcoordArray.size = size;
+    SW.texcoordArray.type = type;
+    SW.texcoordArray.stride = (stride > 0)? stride : size*(GLsizei)sizeof(float);
+}
+
+// NOTE: Normals are not used, lighting is not supported
+void swNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer) { (void)type; (void)stride; (void)pointer; }
+
+void swColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    if ((type != GL_UNSIGNED_BYTE) && (type != GL_FLOAT)) { swSetError(GL_INVALID_ENUM); return; }
+
+    SW.colorArray.pointer = pointer;
+    SW.colorArray.size = size;
+    SW.colorArray.type = type;
+    SW.colorArray.stride = (stride > 0)? stride : size*((type == GL_FLOAT)? (GLsizei)sizeof(float) : 1);
+}
+
+void swDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    swDrawClientArrays(mode, first, count, GL_UNSIGNED_INT, NULL);
+}
+
+// NOTE: Only GL_UNSIGNED_SHORT and GL_UNSIGNED_INT indices supported
+void swDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices)
+{
+    if ((type != GL_UNSIGNED_SHORT) && (type != GL_UNSIGNED_INT)) { swSetError(GL_INVALID_ENUM); return; }
+    if (indices == NULL) { swSetError(GL_INVALID_VALUE); return; }
+
+    swDrawClientArrays(mode, 0, count, type, indices);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Draw primitives from client vertex arrays, sequential vertices from first if no indices provided
+static void swDrawClientArrays(GLenum mode, int first, int count, GLenum type, const void *indices)
+{
+    if (!SW.vertexArray.enabled || (SW.vertexArray.pointer == NULL) || SW.insideBegin) { swSetError(GL_INVALID_OPERATION); return; }
+
+    float texcoord[2] = { SW.texcoord[0], SW.texcoord[1] };
+    float color[4] = { SW.color[0], SW.color[1], SW.color[2], SW.color[3] };
+
+    swBegin(mode);
+
+    for (int i = 0; i < count; i++)
+    {
+        int index = first + i;
+        if (indices != NULL) index = (type == GL_UNSIGNED_SHORT)? ((const unsigned short *)indices)[i] : (int)((const unsigned int *)indices)[i];
+
+        if (SW.texcoordArray.enabled && (SW.texcoordArray.pointer != NULL))
+        {
+            const float *texcoords = (const float *)((const unsigned char *)SW.texcoordArray.pointer + (size_t)index*SW.texcoordArray.stride);
+            SW.texcoord[0] = texcoords[0];
+            SW.texcoord[1] = (SW.texcoordArray.size > 1)? texcoords[1] : 0.0f;
+        }
+
+        if (SW.colorArray.enabled && (SW.colorArray.pointer != NULL))
+        {
+            const unsigned char *colors = (const unsigned char *)SW.colorArray.pointer + (size_t)index*SW.colorArray.stride;
+
+            if (SW.colorArray.type == GL_FLOAT) swColor4f(((const float *)colors)[0], ((const float *)colors)[1], ((const float *)colors)[2], (SW.colorArray.size > 3)? ((const float *)colors)[3] : 1.0f);
+            else swColor4ub(colors[0], colors[1], colors[2], (SW.colorArray.size > 3)? colors[3] : 255);
+        }
+
+        const float *position = (const float *)((const unsigned char *)SW.vertexArray.pointer + (size_t)index*SW.vertexArray.stride);
+        swPushVertex(position[0], position[1], (SW.vertexArray.size > 2)? position[2] : 0.0f);
+    }
+
+    swEnd();
+
+    // Current texcoord and color are not modified by vertex arrays
+    SW.texcoord[0] = texcoord[0];
+    SW.texcoord[1] = texcoord[1];
+    memcpy(SW.color, color, 4*sizeof(float));
+}
+
+// Multiply matrices (column-major): result = left*right
+static void swMatrixMultiply(float *result, const float *left, const float *right)
+{
+    float m[16] = { 0 };
+
+    for (int col = 0; col < 4; col++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            m[col*4 + row] = left[row]*right[col*4] + left[4 + row]*right[col*4 + 1] + left[8 + row]*right[col*4 + 2] + left[12 + row]*right[col*4 + 3];
+        }
+    }
+
+    memcpy(result, m, 16*sizeof(float));
+}
+
+// Multiply current matrix by provided matrix
+static void swMatrixApply(const float *m)
+{
+    float *current = SW.stack[SW.matrixMode][SW.stackCounter[SW.matrixMode]];
+    swMatrixMultiply(current, current, m);
+}
+
+// Set error (keeps first error until checked)
+static void swSetError(GLenum error)
+{
+    if (SW.error == GL_NO_ERROR) SW.error = error;
+}
+
+// Update screen tiles for current framebuffer size
+// NOTE: Binned primitives must be rasterized before calling this function
+static int swUpdateTiles(void)
+{
+    int tilesX = (SW.width + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+    int tilesY = (SW.height + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+
+    if ((tilesX == SW.tilesX) && (tilesY == SW.tilesY)) return 1;
+
+    for (int i = 0; i < SW.tilesX*SW.tilesY; i++) RLSW_FREE(SW.tiles[i].triangles);
+    RLSW_FREE(SW.tiles);
+
+    SW.tiles = (swTile *)RLSW_MALLOC(tilesX*tilesY*sizeof(swTile));
+    SW.tilesX = 0;
+    SW.tilesY = 0;
+
+    if (SW.tiles == NULL) { swSetError(GL_OUT_OF_MEMORY); return 0; }
+
+    memset(SW.tiles, 0, tilesX*tilesY*sizeof(swTile));
+    SW.tilesX = tilesX;
+    SW.tilesY = tilesY;
+
+    return 1;
+}
+
+// Get current render state index, stored if changed
+static int swGetStateIndex(void)
+{
+    if (!SW.stateDirty && (SW.stateCount > 0)) return SW.stateCount - 1;
+
+    if (SW.stateCount >= SW.stateCapacity)
+    {
+        int capacity = (SW.stateCapacity > 0)? SW.stateCapacity*2 : 64;
+        swState *states = (swState *)RLSW_REALLOC(SW.states, capacity*sizeof(swState));
+        if (states == NULL) { swSetError(GL_OUT_OF_MEMORY); return -1; }
+
+        SW.states = states;
+        SW.stateCapacity = capacity;
+    }
+
+    swState *state = &SW.states[SW.stateCount];
+
+    state->texture = (SW.texture2D && (SW.textures[SW.boundTexture].pixels != NULL))? SW.boundTexture : 0;
+    state->blend = SW.blend;
+    state->srcFactor = SW.srcFactor;
+    state->dstFactor = SW.dstFactor;
+    state->depthTest = SW.depthTest;
+    state->depthFunc = SW.depthFunc;
+    state->depthMask = SW.depthMask;
+
+    // Clipping rectangle: viewport, scissor and framebuffer intersection
+    // NOTE: Primitives are clipped only against near/far planes, pixels outside viewport are discarded here
+    int minx = SW.viewport[0], miny = SW.viewport[1];
+    int maxx = SW.viewport[0] + SW.viewport[2] - 1, maxy = SW.viewport[1] + SW.viewport[3] - 1;
+
+    if (SW.scissorTest)
+    {
+        if (SW.scissor[0] > minx) minx = SW.scissor[0];
+        if (SW.scissor[1] > miny) miny = SW.scissor[1];
+        if ((SW.scissor[0] + SW.scissor[2] - 1) < maxx) maxx = SW.scissor[0] + SW.scissor[2] - 1;
+        if ((SW.scissor[1] + SW.scissor[3] - 1) < maxy) maxy = SW.scissor[1] + SW.scissor[3] - 1;
+    }
+
+    state->clip[0] = (minx < 0)? 0 : minx;
+    state->clip[1] = (miny < 0)? 0 : miny;
+    state->clip[2] = (maxx >= SW.width)? SW.width - 1 : maxx;
+    state->clip[3] = (maxy >= SW.height)? SW.height - 1 : maxy;
+
+    SW.stateCount++;
+    SW.stateDirty = 0;
+
+    return SW.stateCount - 1;
+}
+
+// Transform vertex and add it to current primitive
+static void swPushVertex(float x, float y, float z)
+{
+    if (!SW.insideBegin) { swSetError(GL_INVALID_OPERATION); return; }
+
+    if (SW.vertexCount >= SW.vertexCapacity)
+    {
+        int capacity = (SW.vertexCapacity > 0)? SW.vertexCapacity*2 : 256;
+        swVertex *vertices = (swVertex *)RLSW_REALLOC(SW.vertices, capacity*sizeof(swVertex));
+        if (vertices == NULL) { swSetError(GL_OUT_OF_MEMORY); return; }
+
+        SW.vertices = vertices;
+        SW.vertexCapacity = capacity;
+    }
+
+    swVertex *v = &SW.vertices[SW.vertexCount];
+    const float *m = SW.mvp;
+
+    v->position[0] = m[0]*x + m[4]*y + m[8]*z + m[12];
+    v->position[1] = m[1]*x + m[5]*y + m[9]*z + m[13];
+    v->position[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+    v->position[3] = m[3]*x + m[7]*y + m[11]*z + m[15];
+    v->texcoord[0] = SW.texcoord[0];
+    v->texcoord[1] = SW.texcoord[1];
+    memcpy(v->color, SW.color, 4*sizeof(float));
+
+    SW.vertexCount++;
+}
+
+// Assemble primitives from vertices
+static void swProcessPrimitives(GLenum mode, const swVertex *vertices, int count)
+{
+    switch (mode)
+    {
+        case GL_POINTS: for (int i = 0; i < count; i++) swProcessPoint(&vertices[i]); break;
+        case GL_LINES: for (int i = 0; (i + 1) < count; i += 2) swProcessLine(&vertices[i], &vertices[i + 1]); break;
+        case GL_LINE_STRIP:
+        case GL_LINE_LOOP:
+        {
+            for (int i = 0; (i + 1) < count; i++) swProcessLine(&vertices[i], &vertices[i + 1]);
+            if ((mode == GL_LINE_LOOP) && (count > 2)) swProcessLine(&vertices[count - 1], &vertices[0]);
+        } break;
+        case GL_TRIANGLES: for (int i = 0; (i + 2) < count; i += 3) swProcessTriangle(&vertices[i], &vertices[i + 1], &vertices[i + 2]); break;
+        case GL_TRIANGLE_STRIP:
+        {
+            // Odd triangles are swapped to keep the strip winding
+            for (int i = 0; (i + 2) < count; i++)
+            {
+                if ((i%2) == 0) swProcessTriangle(&vertices[i], &vertices[i + 1], &vertices[i + 2]);
+                else swProcessTriangle(&vertices[i + 1], &vertices[i], &vertices[i + 2]);
+            }
+        } break;
+        case GL_TRIANGLE_FAN: for (int i = 1; (i + 1) < count; i++) swProcessTriangle(&vertices[0], &vertices[i], &vertices[i + 1]); break;
+        case GL_QUADS:
+        {
+            for (int i = 0; (i + 3) < count; i += 4) swProcessQuad(&vertices[i], &vertices[i + 1], &vertices[i + 2], &vertices[i + 3]);
+        } break;
+        default: swSetError(GL_INVALID_ENUM); break;
+    }
+}
+
+// Process triangle: clipping, projection, culling and binning
+static void swProcessTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2)
+{
+    swVertex polygon[RLSW_MAX_CLIPPED_VERTICES] = { *v0, *v1, *v2 };
+    int count = 3;
+
+    // Trivial rejection (all vertices outside the same clip plane) and clipping if any vertex is outside
+    int outside = 0;
+
+    for (int plane = 0; plane < SW_CLIP_PLANES_COUNT; plane++)
+    {
+        int outCount = (swClipDistance(v0, plane) < 0.0f) + (swClipDistance(v1, plane) < 0.0f) + (swClipDistance(v2, plane) < 0.0f);
+
+        if (outCount == 3) return;
+        outside |= outCount;
+    }
+
+    if (outside)
+    {
+        count = swClipPolygon(polygon, count);
+        if (count < 3) return;
+    }
+
+    swScreenVertex screen[RLSW_MAX_CLIPPED_VERTICES] = { 0 };
+    for (int i = 0; i < count; i++) swProjectVertex(&polygon[i], &screen[i]);
+
+    // Face culling, clipped polygon keeps triangle winding
+    float area = (screen[1].x - screen[0].x)*(screen[2].y - screen[0].y) - (screen[2].x - screen[0].x)*(screen[1].y - screen[0].y);
+
+    if (SW.cullFace)
+    {
+        int front = (SW.frontFace == GL_CCW)? (area > 0.0f) : (area < 0.0f);
+
+        if (SW.cullMode == GL_FRONT_AND_BACK) return;
+        if ((SW.cullMode == GL_BACK) && !front) return;
+        if ((SW.cullMode == GL_FRONT) && front) return;
+    }
+
+    if (SW.polygonMode == GL_FILL)
+    {
+        for (int i = 1; (i + 1) < count; i++) swBinTriangle(&screen[0], &screen[i], &screen[i + 1], 0);
+    }
+    else if (SW.polygonMode == GL_LINE)
+    {
+        for (int i = 0; i < count; i++) swBinLine(&screen[i], &screen[(i + 1)%count], SW.lineWidth);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++) swBinLine(&screen[i], &screen[i], 1.0f);
+    }
+}
+
+// Process quad: screen aligned rectangles (2d sprites and shapes) binned as one rectangle, other quads as two triangles
+// NOTE: Rectangle covers the same pixels than its two triangles (same fill rule), no edge functions evaluated on rasterization
+static void swProcessQuad(const swVertex *v0, const swVertex *v1, const swVertex *v2, const swVertex *v3)
+{
+    const swVertex *v[4] = { v0, v1, v2, v3 };
+    int aligned = (SW.polygonMode == GL_FILL);
+
+    // Rectangle requires no clipping, no perspective and attributes of a parallelogram (linear on the rectangle)
+    for (int i = 0; aligned && (i < 4); i++)
+    {
+        if (v[i]->position[3] != v0->position[3]) aligned = 0;
+        for (int plane = 0; plane < SW_CLIP_PLANES_COUNT; plane++) if (swClipDistance(v[i], plane) < 0.0f) aligned = 0;
+    }
+
+    if (aligned)
+    {
+        if ((v0->position[2] + v2->position[2]) != (v1->position[2] + v3->position[2])) aligned = 0;
+        for (int i = 0; i < 2; i++) if ((v0->texcoord[i] + v2->texcoord[i]) != (v1->texcoord[i] + v3->texcoord[i])) aligned = 0;
+        for (int i = 0; i < 4; i++) if ((v0->color[i] + v2->color[i]) != (v1->color[i] + v3->color[i])) aligned = 0;
+    }
+
+    swScreenVertex screen[4] = { 0 };
+    int sx[4] = { 0 }, sy[4] = { 0 };
+
+    if (aligned)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            swProjectVertex(v[i], &screen[i]);
+            sx[i] = (int)floorf(screen[i].x*SW_SUBPIXEL_SCALE + 0.5f);
+            sy[i] = (int)floorf(screen[i].y*SW_SUBPIXEL_SCALE + 0.5f);
+        }
+
+        // Edges aligned to window axes, on snapped vertices (as binned)
+        aligned = ((sx[0] == sx[1]) && (sx[2] == sx[3]) && (sy[1] == sy[2]) && (sy[3] == sy[0])) ||
+                  ((sy[0] == sy[1]) && (sy[2] == sy[3]) && (sx[1] == sx[2]) && (sx[3] == sx[0]));
+    }
+
+    if (!aligned)
+    {
+        swProcessTriangle(v0, v1, v2);
+        swProcessTriangle(v0, v2, v3);
+        return;
+    }
+
+    if (SW.cullFace)
+    {
+        float area = (screen[1].x - screen[0].x)*(screen[2].y - screen[0].y) - (screen[2].x - screen[0].x)*(screen[1].y - screen[0].y);
+        int front = (SW.frontFace == GL_CCW)? (area > 0.0f) : (area < 0.0f);
+
+        if (SW.cullMode == GL_FRONT_AND_BACK) return;
+        if ((SW.cullMode == GL_BACK) && !front) return;
+        if ((SW.cullMode == GL_FRONT) && front) return;
+    }
+
+    // NOTE: Any three rectangle corners define its bounds and its attributes planes
+    swBinTriangle(&screen[0], &screen[1], &screen[2], 1);
+}
+
+// Process line: clipping, projection and binning
+static void swProcessLine(const swVertex *v0, const swVertex *v1)
+{
+    swVertex clipped[2] = { *v0, *v1 };
+
+    for (int plane = 0; plane < SW_CLIP_PLANES_COUNT; plane++)
+    {
+        float d0 = swClipDistance(&clipped[0], plane);
+        float d1 = swClipDistance(&clipped[1], plane);
+
+        if ((d0 < 0.0f) && (d1 < 0.0f)) return;
+        if (d0 < 0.0f) swLerpVertex(&clipped[0], &clipped[0], &clipped[1], d0/(d0 - d1));
+        else if (d1 < 0.0f) swLerpVertex(&clipped[1], &clipped[0], &clipped[1], d0/(d0 - d1));
+    }
+
+    swScreenVertex screen[2] = { 0 };
+    swProjectVertex(&clipped[0], &screen[0]);
+    swProjectVertex(&clipped[1], &screen[1]);
+
+    swBinLine(&screen[0], &screen[1], SW.lineWidth);
+}
+
+// Process point: projection and binning
+static void swProcessPoint(const swVertex *v)
+{
+    for (int plane = 0; plane < SW_CLIP_PLANES_COUNT; plane++)
+    {
+        if (swClipDistance(v, plane) < 0.0f) return;
+    }
+
+    swScreenVertex screen = { 0 };
+    swProjectVertex(v, &screen);
+
+    swBinLine(&screen, &screen, 1.0f);
+}
+
+// Get vertex distance to clip plane (inside if >= 0)
+// NOTE: Left/right/bottom/top planes are extended by guard band, pixels outside viewport are discarded on rasterization
+static float swClipDistance(const swVertex *v, int plane)
+{
+    const float *p = v->position;
+
+    switch (plane)
+    {
+        case 0: return p[3] + p[2];                         // Near plane
+        case 1: return p[3] - p[2];                         // Far plane
+        case 2: return p[3]*RLSW_GUARD_BAND + p[0];         // Left plane
+        case 3: return p[3]*RLSW_GUARD_BAND - p[0];         // Right plane
+        case 4: return p[3]*RLSW_GUARD_BAND + p[1];         // Bottom plane
+        case 5: return p[3]*RLSW_GUARD_BAND - p[1];         // Top plane
+        default: break;
+    }
+
+    return 0.0f;
+}
+
+// Interpolate vertex attributes: result = a + (b - a)*t
+static void swLerpVertex(swVertex *result, const swVertex *a, const swVertex *b, float t)
+{
+    swVertex v = { 0 };
+
+    for (int i = 0; i < 4; i++) v.position[i] = a->position[i] + (b->position[i] - a->position[i])*t;
+    for (int i = 0; i < 2; i++) v.texcoord[i] = a->texcoord[i] + (b->texcoord[i] - a->texcoord[i])*t;
+    for (int i = 0; i < 4; i++) v.color[i] = a->color[i] + (b->color[i] - a->color[i])*t;
+
+    *result = v;
+}
+
+// Clip polygon against clip planes (Sutherland-Hodgman)
+static int swClipPolygon(swVertex *polygon, int count)
+{
+    swVertex temp[RLSW_MAX_CLIPPED_VERTICES] = { 0 };
+
+    for (int plane = 0; (plane < SW_CLIP_PLANES_COUNT) && (count >= 3); plane++)
+    {
+        int outCount = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const swVertex *a = &polygon[i];
+            const swVertex *b = &polygon[(i + 1)%count];
+            float da = swClipDistance(a, plane);
+            float db = swClipDistance(b, plane);
+
+            // NOTE: Every plane adds one vertex at most to a convex polygon, so output is limited
+            if (outCount >= (RLSW_MAX_CLIPPED_VERTICES - 1)) break;
+
+            if (da >= 0.0f) temp[outCount++] = *a;
+            if ((da >= 0.0f) != (db >= 0.0f)) swLerpVertex(&temp[outCount++], a, b, da/(da - db));
+        }
+
+        count = outCount;
+        memcpy(polygon, temp, count*sizeof(swVertex));
+    }
+
+    return count;
+}
+
+// Transform clip space vertex to window space
+static void swProjectVertex(const swVertex *v, swScreenVertex *out)
+{
+    float invw = (v->position[3] != 0.0f)? 1.0f/v->position[3] : 1.0f;
+
+    out->x = SW.viewport[0] + (v->position[0]*invw*0.5f + 0.5f)*SW.viewport[2];
+    out->y = SW.viewport[1] + (v->position[1]*invw*0.5f + 0.5f)*SW.viewport[3];
+    out->z = v->position[2]*invw*0.5f + 0.5f;
+    out->invw = invw;
+    out->texcoord[0] = v->texcoord[0];
+    out->texcoord[1] = v->texcoord[1];
+    memcpy(out->color, v->color, 4*sizeof(float));
+}
+
+// Bin line as a window space quad of provided width
+// NOTE: Points are binned as lines with equal vertices (1 pixel quad)
+static void swBinLine(const swScreenVertex *v0, const swScreenVertex *v1, float width)
+{
+    float dx = v1->x - v0->x;
+    float dy = v1->y - v0->y;
+    float length = sqrtf(dx*dx + dy*dy);
+    float half = width*0.5f;
+
+    // Quad extends half width around the line and along its direction (so short lines and points are visible)
+    float px = 0.0f, py = 0.0f, ex = half, ey = 0.0f;
+
+    if (length > 0.0001f)
+    {
+        ex = dx/length*half;
+        ey = dy/length*half;
+        px = -ey;
+        py = ex;
+    }
+    else py = half;
+
+    swScreenVertex q[4] = { *v0, *v0, *v1, *v1 };
+
+    q[0].x = v0->x - ex - px; q[0].y = v0->y - ey - py;
+    q[1].x = v0->x - ex + px; q[1].y = v0->y - ey + py;
+    q[2].x = v1->x + ex + px; q[2].y = v1->y + ey + py;
+    q[3].x = v1->x + ex - px; q[3].y = v1->y + ey - py;
+
+    swBinTriangle(&q[0], &q[1], &q[2], 0);
+    swBinTriangle(&q[0], &q[2], &q[3], 0);
+}
+
+// Setup triangle for rasterization and bin it into overlapped tiles
+// NOTE: With rect, vertices are three corners of a screen aligned rectangle, binned as the whole rectangle
+static void swBinTriangle(const swScreenVertex *v0, const swScreenVertex *v1, const swScreenVertex *v2, int rect)
+{
+    // Vertices snapped to subpixel grid, edge functions are evaluated with integers (exact),
+    // so pixels on edges shared by triangles are never missed or drawn twice
+    int sx[3] = { (int)floorf(v0->x*SW_SUBPIXEL_SCALE + 0.5f), (int)floorf(v1->x*SW_SUBPIXEL_SCALE + 0.5f), (int)floorf(v2->x*SW_SUBPIXEL_SCALE + 0.5f) };
+    int sy[3] = { (int)floorf(v0->y*SW_SUBPIXEL_SCALE + 0.5f), (int)floorf(v1->y*SW_SUBPIXEL_SCALE + 0.5f), (int)floorf(v2->y*SW_SUBPIXEL_SCALE + 0.5f) };
+
+    long long area = (long long)(sx[1] - sx[0])*(sy[2] - sy[0]) - (long long)(sx[2] - sx[0])*(sy[1] - sy[0]);
+    if (area == 0) return;      // Degenerated triangle
+
+    const swScreenVertex *v[3] = { v0, v1, v2 };
+
+    // Edge functions are positive inside counter-clockwise triangles
+    if (area < 0)
+    {
+        const swScreenVertex *tempVertex = v[1]; v[1] = v[2]; v[2] = tempVertex;
+        int temp = sx[1]; sx[1] = sx[2]; sx[2] = temp;
+        temp = sy[1]; sy[1] = sy[2]; sy[2] = temp;
+    }
+
+    if (SW.triangleCount >= RLSW_MAX_BINNED_TRIANGLES) swFinish();
+
+    int stateIndex = swGetStateIndex();
+    if (stateIndex < 0) return;
+
+    const swState *state = &SW.states[stateIndex];
+
+    // Bounding box (pixels with center inside), clipped to state clipping rectangle
+    int minx = (sx[0] < sx[1])? ((sx[0] < sx[2])? sx[0] : sx[2]) : ((sx[1] < sx[2])? sx[1] : sx[2]);
+    int miny = (sy[0] < sy[1])? ((sy[0] < sy[2])? sy[0] : sy[2]) : ((sy[1] < sy[2])? sy[1] : sy[2]);
+    int maxx = (sx[0] > sx[1])? ((sx[0] > sx[2])? sx[0] : sx[2]) : ((sx[1] > sx[2])? sx[1] : sx[2]);
+    int maxy = (sy[0] > sy[1])? ((sy[0] > sy[2])? sy[0] : sy[2]) : ((sy[1] > sy[2])? sy[1] : sy[2]);
+
+    int bounds[4] = {
+        swFloorDiv(minx - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE),
+        swFloorDiv(miny - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE),
+        swFloorDiv(maxx - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE) + 1,
+        swFloorDiv(maxy - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE) + 1
+    };
+
+    if (rect)
+    {
+        // Pixels with center inside, top-left fill rule (y-up): left and top edges included (minx <= x < maxx, miny < y <= maxy)
+        bounds[0] = (int)-swFloorDiv(-(minx - SW_SUBPIXEL_HALF), SW_SUBPIXEL_SCALE);
+        bounds[1] = (int)swFloorDiv(miny - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE) + 1;
+        bounds[2] = (int)swFloorDiv(maxx - SW_SUBPIXEL_HALF - 1, SW_SUBPIXEL_SCALE);
+        bounds[3] = (int)swFloorDiv(maxy - SW_SUBPIXEL_HALF, SW_SUBPIXEL_SCALE);
+    }
+
+    if (bounds[0] < state->clip[0]) bounds[0] = state->clip[0];
+    if (bounds[1] < state->clip[1]) bounds[1] = state->clip[1];
+    if (bounds[2] > state->clip[2]) bounds[2] = state->clip[2];
+    if (bounds[3] > state->clip[3]) bounds[3] = state->clip[3];
+
+    if ((bounds[0] > bounds[2]) || (bounds[1] > bounds[3])) return;
+
+    if (SW.triangleCount >= SW.triangleCapacity)
+    {
+        int capacity = (SW.triangleCapacity > 0)? SW.triangleCapacity*2 : 1024;
+        swTriangle *triangles = (swTriangle *)RLSW_REALLOC(SW.triangles, capacity*sizeof(swTriangle));
+        if (triangles == NULL) { swSetError(GL_OUT_OF_MEMORY); return; }
+
+        SW.triangles = triangles;
+        SW.triangleCapacity = capacity;
+    }
+
+    swTriangle *tri = &SW.triangles[SW.triangleCount];
+
+    // Edges setup, edge i goes from vertex i to vertex i + 1: E(x, y) = A*(x - x0) + B*(y - y0) + bias
+    // NOTE: Top-left fill rule (y-up window coordinates): pixels on edges going down, or horizontal going left,
+    // are inside, bias excludes pixels on other edges (E = 0)
+    for (int i = 0; i < 3; i++)
+    {
+        int j = (i + 1)%3;
+
+        tri->edgeA[i] = sy[i] - sy[j];
+        tri->edgeB[i] = sx[j] - sx[i];
+        tri->edgeX[i] = sx[i];
+        tri->edgeY[i] = sy[i];
+        tri->edgeBias[i] = ((sy[j] < sy[i]) || ((sy[j] == sy[i]) && (sx[j] < sx[i])))? 0 : -1;
+    }
+
+    memcpy(tri->bounds, bounds, 4*sizeof(int));
+    tri->state = stateIndex;
+    tri->perspective = ((v[0]->invw != v[1]->invw) || (v[0]->invw != v[2]->invw));
+    tri->rect = rect;
+
+    // Attributes planes setup, f(x, y) = start + dx*x + dy*y, using snapped vertices
+    float x0 = (float)sx[0]/SW_SUBPIXEL_SCALE, y0 = (float)sy[0]/SW_SUBPIXEL_SCALE;
+    float x10 = (float)(sx[1] - sx[0])/SW_SUBPIXEL_SCALE, y10 = (float)(sy[1] - sy[0])/SW_SUBPIXEL_SCALE;
+    float x20 = (float)(sx[2] - sx[0])/SW_SUBPIXEL_SCALE, y20 = (float)(sy[2] - sy[0])/SW_SUBPIXEL_SCALE;
+    float invArea = 1.0f/(x10*y20 - x20*y10);
+
+    float values[SW_ATTRIBUTES_COUNT][3] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        // Attributes divided by w are linear in window space (perspective correction)
+        float w = tri->perspective? v[i]->invw : 1.0f;
+
+        values[0][i] = v[i]->z;
+        values[1][i] = v[i]->invw;
+        values[2][i] = v[i]->texcoord[0]*w;
+        values[3][i] = v[i]->texcoord[1]*w;
+        values[4][i] = v[i]->color[0]*w;
+        values[5][i] = v[i]->color[1]*w;
+        values[6][i] = v[i]->color[2]*w;
+        values[7][i] = v[i]->color[3]*w;
+    }
+
+    for (int i = 0; i < SW_ATTRIBUTES_COUNT; i++)
+    {
+        float df10 = values[i][1] - values[i][0];
+        float df20 = values[i][2] - values[i][0];
+
+        tri->planes[i].dx = (df10*y20 - df20*y10)*invArea;
+        tri->planes[i].dy = (df20*x10 - df10*x20)*invArea;
+        tri->planes[i].start = values[i][0] - tri->planes[i].dx*x0 - tri->planes[i].dy*y0;
+    }
+
+    // Bin triangle into overlapped tiles
+    int triangleIndex = SW.triangleCount;
+
+    for (int ty = bounds[1]/RLSW_TILE_SIZE; ty <= bounds[3]/RLSW_TILE_SIZE; ty++)
+    {
+        for (int tx = bounds[0]/RLSW_TILE_SIZE; tx <= bounds[2]/RLSW_TILE_SIZE; tx++)
+        {
+            swTile *tile = &SW.tiles[ty*SW.tilesX + tx];
+
+            if (tile->count >= tile->capacity)
+            {
+                int capacity = (tile->capacity > 0)? tile->capacity*2 : 256;
+                int *triangles = (int *)RLSW_REALLOC(tile->triangles, capacity*sizeof(int));
+                if (triangles == NULL) { swSetError(GL_OUT_OF_MEMORY); continue; }
+
+                tile->triangles = triangles;
+                tile->capacity = capacity;
+            }
+
+            tile->triangles[tile->count++] = triangleIndex;
+        }
+    }
+
+    SW.triangleCount++;
+}
+
+#if defined(RLSW_SUPPORT_THREADS)
+// Rasterize tiles assigned to a thread (interleaved)
+static void *swRasterizeTilesThread(void *arg)
+{
+    int threadIndex = *(int *)arg;
+    int tileCount = SW.tilesX*SW.tilesY;
+
+    for (int i = threadIndex; i < tileCount; i += RLSW_MAX_THREADS) swRasterizeTile(i);
+
+    return NULL;
+}
+#endif
+
+// Rasterize all triangles binned in a tile, in submission order
+static void swRasterizeTile(int tileIndex)
+{
+    const swTile *tile = &SW.tiles[tileIndex];
+    if (tile->count == 0) return;
+
+    int tileX = (tileIndex%SW.tilesX)*RLSW_TILE_SIZE;
+    int tileY = (tileIndex/SW.tilesX)*RLSW_TILE_SIZE;
+
+    for (int i = 0; i < tile->count; i++)
+    {
+        const swTriangle *tri = &SW.triangles[tile->triangles[i]];
+
+        // Triangle bounds (already clipped) intersected with tile
+        int rect[4] = {
+            (tri->bounds[0] > tileX)? tri->bounds[0] : tileX,
+            (tri->bounds[1] > tileY)? tri->bounds[1] : tileY,
+            (tri->bounds[2] < (tileX + RLSW_TILE_SIZE - 1))? tri->bounds[2] : (tileX + RLSW_TILE_SIZE - 1),
+            (tri->bounds[3] < (tileY + RLSW_TILE_SIZE - 1))? tri->bounds[3] : (tileY + RLSW_TILE_SIZE - 1)
+        };
+
+        swRasterizeTriangle(tri, &SW.states[tri->state], rect);
+    }
+}
+
+// Integer division rounding towards negative infinity
+static inline long long swFloorDiv(long long numerator, long long denominator)
+{
+    long long quotient = numerator/denominator;
+    if (((numerator%denominator) != 0) && ((numerator < 0) != (denominator < 0))) quotient--;
+
+    return quotient;
+}
+
+// Get triangle pixels span in a row, exact (edge functions evaluated at pixels centers)
+// NOTE: Provided span limits are reduced, returns 0 if no pixel is inside
+static inline int swGetTriangleSpan(const swTriangle *tri, int y, int *minx, int *maxx)
+{
+    long long py = (long long)y*SW_SUBPIXEL_SCALE + SW_SUBPIXEL_HALF;
+
+    for (int e = 0; e < 3; e++)
+    {
+        // Pixel x is inside if: A*(16*x + 8 - x0) + rowValue >= 0
+        long long a = tri->edgeA[e];
+        long long rowValue = (long long)tri->edgeB[e]*(py - tri->edgeY[e]) + tri->edgeBias[e];
+
+        if (a == 0)
+        {
+            if (rowValue < 0) return 0;
+        }
+        else
+        {
+            long long limit = a*(tri->edgeX[e] - SW_SUBPIXEL_HALF) - rowValue;     // A*16*x >= limit
+
+            if (a > 0)
+            {
+                long long x = -swFloorDiv(-limit, a*SW_SUBPIXEL_SCALE);
+                if (x > *minx) *minx = (x > *maxx)? *maxx + 1 : (int)x;
+            }
+            else
+            {
+                long long x = swFloorDiv(limit, a*SW_SUBPIXEL_SCALE);
+                if (x < *maxx) *maxx = (x < *minx)? *minx - 1 : (int)x;
+            }
+        }
+    }
+
+    return (*minx <= *maxx);
+}
+
+// Get texel wrapped coordinate
+static inline int swWrapCoord(int coord, int size, GLenum wrap)
+{
+    if (wrap == GL_REPEAT)
+    {
+        coord %= size;
+        return (coord < 0)? coord + size : coord;
+    }
+    else if (wrap == GL_MIRRORED_REPEAT)
+    {
+        int period = size*2;
+        coord %= period;
+        if (coord < 0) coord += period;
+        return (coord >= size)? (period - 1 - coord) : coord;
+    }
+
+    return (coord < 0)? 0 : (coord >= size)? size - 1 : coord;   // GL_CLAMP, GL_CLAMP_TO_EDGE
+}
+
+// Sample texture color at provided coordinates (RGBA8)
+static inline void swSampleTexture(const swTexture *texture, float u, float v, int linear, unsigned char *texel)
+{
+    if (!linear)
+    {
+        float fx = u*texture->width;
+        float fy = v*texture->height;
+        int x = (int)fx;
+        int y = (int)fy;
+        if (fx < (float)x) x--;     // Floor for negative coordinates
+        if (fy < (float)y) y--;
+
+        // Wrapping only required out of texture limits
+        if ((unsigned int)x >= (unsigned int)texture->width) x = swWrapCoord(x, texture->width, texture->wrapS);
+        if ((unsigned int)y >= (unsigned int)texture->height) y = swWrapCoord(y, texture->height, texture->wrapT);
+
+        memcpy(texel, texture->pixels + ((size_t)y*texture->width + x)*4, 4);
+    }
+    else
+    {
+        float fx = u*texture->width - 0.5f;
+        float fy = v*texture->height - 0.5f;
+        float flx = floorf(fx);
+        float fly = floorf(fy);
+        int wx = (int)((fx - flx)*256.0f);
+        int wy = (int)((fy - fly)*256.0f);
+
+        int x0 = swWrapCoord((int)flx, texture->width, texture->wrapS);
+        int x1 = swWrapCoord((int)flx + 1, texture->width, texture->wrapS);
+        int y0 = swWrapCoord((int)fly, texture->height, texture->wrapT);
+        int y1 = swWrapCoord((int)fly + 1, texture->height, texture->wrapT);
+
+        const unsigned char *t00 = texture->pixels + ((size_t)y0*texture->width + x0)*4;
+        const unsigned char *t10 = texture->pixels + ((size_t)y0*texture->width + x1)*4;
+        const unsigned char *t01 = texture->pixels + ((size_t)y1*texture->width + x0)*4;
+        const unsigned char *t11 = texture->pixels + ((size_t)y1*texture->width + x1)*4;
+
+        for (int i = 0; i < 4; i++)
+        {
+            int top = t00[i]*256 + (t10[i] - t00[i])*wx;
+            int bottom = t01[i]*256 + (t11[i] - t01[i])*wx;
+            texel[i] = (unsigned char)((top*256 + (bottom - top)*wy + 32768) >> 16);
+        }
+    }
+}
+
+// Get blending factor for one color channel (0.0f..1.0f)
+static inline float swBlendFactor(GLenum factor, const float *src, const float *dst, int channel)
+{
+    switch (factor)
+    {
+        case GL_ZERO: return 0.0f;
+        case GL_ONE: return 1.0f;
+        case GL_SRC_COLOR: return src[channel];
+        case GL_ONE_MINUS_SRC_COLOR: return 1.0f - src[channel];
+        case GL_SRC_ALPHA: return src[3];
+        case GL_ONE_MINUS_SRC_ALPHA: return 1.0f - src[3];
+        case GL_DST_ALPHA: return dst[3];
+        case GL_ONE_MINUS_DST_ALPHA: return 1.0f - dst[3];
+        case GL_DST_COLOR: return dst[channel];
+        case GL_ONE_MINUS_DST_COLOR: return 1.0f - dst[channel];
+        case GL_SRC_ALPHA_SATURATE:
+        {
+            if (channel == 3) return 1.0f;
+            return (src[3] < (1.0f - dst[3]))? src[3] : (1.0f - dst[3]);
+        }
+        default: break;
+    }
+
+    return 1.0f;
+}
+
+// Rasterize triangle rows inside provided rectangle (inclusive)
+// NOTE: Called with constant flags (textured, blendMode, depthTest, perspective) to generate specialized loops,
+// generic loop is used for the less common states combinations
+static inline void swRasterizeRows(const swTriangle *tri, const swState *state, const int *rect, const swTexture *texture, int linear,
+                                   const int textured, const int blendMode, const int depthTest, const int perspective)
+{
+    const swPlane *planes = tri->planes;
+
+    for (int y = rect[1]; y <= rect[3]; y++)
+    {
+        int x0 = rect[0], x1 = rect[2];
+        if (!tri->rect && !swGetTriangleSpan(tri, y, &x0, &x1)) continue;
+
+        float px = (float)x0 + 0.5f;
+        float py = (float)y + 0.5f;
+        float attribs[SW_ATTRIBUTES_COUNT] = { 0 };
+
+        for (int i = 0; i < SW_ATTRIBUTES_COUNT; i++) attribs[i] = planes[i].start + planes[i].dx*px + planes[i].dy*py;
+
+        unsigned char *pixel = SW.colorBuffer + ((size_t)y*SW.width + x0)*4;
+        float *depth = SW.depthBuffer + (size_t)y*SW.width + x0;
+
+        for (int x = x0; x <= x1; x++, pixel += 4, depth++)
+        {
+            float z = attribs[0];
+            float w = perspective? 1.0f/attribs[1] : 1.0f;
+            float u = attribs[2]*w;
+            float v = attribs[3]*w;
+            int color[4] = { (int)(attribs[4]*w + 0.5f), (int)(attribs[5]*w + 0.5f), (int)(attribs[6]*w + 0.5f), (int)(attribs[7]*w + 0.5f) };
+
+            for (int i = 0; i < SW_ATTRIBUTES_COUNT; i++) attribs[i] += planes[i].dx;
+
+            if (depthTest)
+            {
+                int pass = 1;
+
+                switch (state->depthFunc)
+                {
+                    case GL_NEVER: pass = 0; break;
+                    case GL_LESS: pass = (z < *depth); break;
+                    case GL_EQUAL: pass = (z == *depth); break;
+                    case GL_LEQUAL: pass = (z <= *depth); break;
+                    case GL_GREATER: pass = (z > *depth); break;
+                    case GL_NOTEQUAL: pass = (z != *depth); break;
+                    case GL_GEQUAL: pass = (z >= *depth); break;
+                    default: break;
+                }
+
+                if (!pass) continue;
+                if (state->depthMask) *depth = (z < 0.0f)? 0.0f : (z > 1.0f)? 1.0f : z;
+            }
+
+            for (int i = 0; i < 4; i++) color[i] = (color[i] < 0)? 0 : (color[i] > 255)? 255 : color[i];
+
+            if (textured)
+            {
+                // Texture environment: GL_MODULATE
+                unsigned char texel[4];
+                swSampleTexture(texture, u, v, linear, texel);
+
+                for (int i = 0; i < 4; i++) color[i] = (color[i]*texel[i] + 255) >> 8;
+            }
+
+            if (blendMode == SW_BLEND_ALPHA)
+            {
+                // Default alpha blending, integer math
+                int sa = color[3];
+                if (sa == 0) continue;
+
+                int da = 255 - sa;
+
+                for (int i = 0; i < 4; i++)
+                {
+                    int value = color[i]*sa + pixel[i]*da + 128;
+                    pixel[i] = (unsigned char)((value + (value >> 8)) >> 8);    // Division by 255
+                }
+            }
+            else if (blendMode == SW_BLEND_GENERIC)
+            {
+                float src[4] = { color[0]/255.0f, color[1]/255.0f, color[2]/255.0f, color[3]/255.0f };
+                float dst[4] = { pixel[0]/255.0f, pixel[1]/255.0f, pixel[2]/255.0f, pixel[3]/255.0f };
+
+                for (int i = 0; i < 4; i++)
+                {
+                    float value = src[i]*swBlendFactor(state->srcFactor, src, dst, i) + dst[i]*swBlendFactor(state->dstFactor, src, dst, i);
+                    pixel[i] = (unsigned char)(((value < 0.0f)? 0.0f : (value > 1.0f)? 1.0f : value)*255.0f + 0.5f);
+                }
+            }
+            else for (int i = 0; i < 4; i++) pixel[i] = (unsigned char)color[i];
+        }
+    }
+}
+
+// Rasterize triangle rows inside provided rectangle (inclusive), 2d drawing fast path
+// NOTE: No depth test and no perspective correction, attributes interpolated in fixed point (16.16),
+// texture sampling with nearest filtering only
+static inline void swRasterizeRowsAffine(const swTriangle *tri, const int *rect, const swTexture *texture, const int textured, const int blendMode)
+{
+    const swPlane *planes = tri->planes;
+
+    // Flat color (usual for sprites and shapes) is not interpolated
+    int flat = 1;
+    for (int i = 4; i < 8; i++) if ((planes[i].dx != 0.0f) || (planes[i].dy != 0.0f)) flat = 0;
+
+    int texWidth = textured? texture->width : 1;
+    int texHeight = textured? texture->height : 1;
+    float scale[SW_ATTRIBUTES_COUNT] = { 0.0f, 0.0f, texWidth*65536.0f, texHeight*65536.0f, 65536.0f, 65536.0f, 65536.0f, 65536.0f };
+
+    int dx[SW_ATTRIBUTES_COUNT] = { 0 };
+    for (int i = 2; i < SW_ATTRIBUTES_COUNT; i++) dx[i] = (int)(planes[i].dx*scale[i]);
+
+    // Flat color computed once, same on every pixel
+    int color[4] = { 255, 255, 255, 255 };
+    int white = 0;
+    int blend = (blendMode == SW_BLEND_ALPHA);
+
+    if (flat)
+    {
+        for (int i = 0; i < 4; i++) color[i] = ((int)(planes[4 + i].start*scale[4 + i]) + 32768) >> 16;
+        for (int i = 0; i < 4; i++) color[i] = (color[i] < 0)? 0 : (color[i] > 255)? 255 : color[i];
+        white = ((color[0] & color[1] & color[2] & color[3]) == 255);
+
+        // Opaque texture with opaque color, source alpha is always 255 (blending result is source color)
+        if (textured && texture->opaque && (color[3] == 255)) blend = 0;
+    }
+
+    // NOTE: Rectangle is inside one tile, so spans are never wider than a tile
+    unsigned int span[RLSW_TILE_SIZE];
+
+    // Flat color span check cached by texels row, same texels on every row if span limits and u do not change (rectangles)
+    // NOTE: Cached texels row: -1 (none), -2 (cache not used)
+    int cachedRow = (tri->rect && (planes[2].dy == 0.0f))? -1 : -2;
+    int cachedUniform = 0;
+    int cachedColor[4] = { 0 };
+
+    for (int y = rect[1]; y <= rect[3]; y++)
+    {
+        int x0 = rect[0], x1 = rect[2];
+        if (!tri->rect && !swGetTriangleSpan(tri, y, &x0, &x1)) continue;
+
+        float px = (float)x0 + 0.5f;
+        float py = (float)y + 0.5f;
+
+        // NOTE: Only interpolated attributes are evaluated (flat color is not)
+        int attribs[SW_ATTRIBUTES_COUNT] = { 0 };
+        int attribsEnd = flat? 4 : SW_ATTRIBUTES_COUNT;
+        for (int i = textured? 2 : 4; i < attribsEnd; i++) attribs[i] = (int)((planes[i].start + planes[i].dx*px + planes[i].dy*py)*scale[i]);
+
+        unsigned char *pixel = SW.colorBuffer + ((size_t)y*SW.width + x0)*4;
+        int count = x1 - x0 + 1;
+
+        // Texture with flat color (usual for sprites), texels copied if span is inside texture limits
+        // NOTE: Texture coordinates are linear on the span, so span ends inside limits means every pixel is inside
+        int inside = 0;
+        int spanU[2] = { 0 }, spanV[2] = { 0 };
+        if (textured && flat)
+        {
+            spanU[0] = attribs[2] >> 16;
+            spanU[1] = (attribs[2] + dx[2]*(count - 1)) >> 16;
+            spanV[0] = attribs[3] >> 16;
+            spanV[1] = (attribs[3] + dx[3]*(count - 1)) >> 16;
+
+            inside = ((unsigned int)spanU[0] < (unsigned int)texWidth) && ((unsigned int)spanU[1] < (unsigned int)texWidth) &&
+                     ((unsigned int)spanV[0] < (unsigned int)texHeight) && ((unsigned int)spanV[1] < (unsigned int)texHeight);
+        }
+
+        // Span with flat color: no texture, or same texel value on every pixel (magnified texture, usual for shapes texture)
+        int uniform = flat && !textured;
+        int spanColor[4] = { color[0], color[1], color[2], color[3] };
+
+        if (inside && (spanV[0] == spanV[1]) && (cachedRow == spanV[0]))
+        {
+            uniform = cachedUniform;
+            for (int i = 0; i < 4; i++) spanColor[i] = cachedColor[i];
+        }
+        else if (inside && (spanV[0] == spanV[1]) && ((abs(spanU[1] - spanU[0]) + 1)*2 <= count))
+        {
+            const unsigned char *row = texture->pixels + (size_t)spanV[0]*texWidth*4;
+            int first = (spanU[0] < spanU[1])? spanU[0] : spanU[1];
+            int last = (spanU[0] < spanU[1])? spanU[1] : spanU[0];
+            const unsigned char *texel = row + first*4;
+
+            uniform = 1;
+            for (int t = first + 1; uniform && (t <= last); t++) uniform = (memcmp(texel, row + t*4, 4) == 0);
+
+            // Texture environment: GL_MODULATE (same result than white color for white)
+            for (int i = 0; uniform && (i < 4); i++) spanColor[i] = (color[i]*texel[i] + 255) >> 8;
+
+            if (cachedRow != -2)
+            {
+                cachedRow = spanV[0];
+                cachedUniform = uniform;
+                for (int i = 0; i < 4; i++) cachedColor[i] = spanColor[i];
+            }
+        }
+
+        // Flat color span filled (blending only required for translucent color)
+        if (uniform)
+        {
+            unsigned char result[4] = { (unsigned char)spanColor[0], (unsigned char)spanColor[1], (unsigned char)spanColor[2], (unsigned char)spanColor[3] };
+
+            if (!blend || (spanColor[3] == 255)) swFillSpan(pixel, result, count);
+            else if (spanColor[3] > 0) swBlendSpanColor(pixel, result, count);
+
+            continue;
+        }
+
+        if (inside)
+        {
+            const unsigned char *texels = texture->pixels;
+            int u = attribs[2], v = attribs[3];
+
+            // Texels row not scaled (usual for sprites), copied at once, directly to pixels if possible
+            if ((dx[2] == 65536) && (dx[3] == 0))
+            {
+                const unsigned char *row = texels + ((size_t)(v >> 16)*texWidth + (u >> 16))*4;
+
+                if (white && !blend) { memcpy(pixel, row, count*4); continue; }
+
+                if (white) memcpy(span, row, count*4);
+                else swModulateSpan(span, row, color, count);
+            }
+            else if (dx[3] == 0)
+            {
+                const unsigned char *row = texels + (size_t)(v >> 16)*texWidth*4;
+                for (int k = 0; k < count; k++, u += dx[2]) memcpy(&span[k], row + (u >> 16)*4, 4);
+            }
+            else for (int k = 0; k < count; k++, u += dx[2], v += dx[3]) memcpy(&span[k], texels + ((size_t)(v >> 16)*texWidth + (u >> 16))*4, 4);
+
+            // Texture environment: GL_MODULATE (not required for white color)
+            if (!white && ((dx[2] != 65536) || (dx[3] != 0))) swModulateSpan(span, (const unsigned char *)span, color, count);
+        }
+        else
+        {
+            // Span colors computed first, then written or blended at once
+            for (int k = 0; k < count; k++)
+            {
+                unsigned char result[4] = { (unsigned char)color[0], (unsigned char)color[1], (unsigned char)color[2], (unsigned char)color[3] };
+
+                if (!flat)
+                {
+                    for (int i = 0; i < 4; i++)
+                    {
+                        int value = (attribs[4 + i] + 32768) >> 16;
+                        result[i] = (unsigned char)((value < 0)? 0 : (value > 255)? 255 : value);
+                        attribs[4 + i] += dx[4 + i];
+                    }
+                }
+
+                if (textured)
+                {
+                    int tx = attribs[2] >> 16;
+                    int ty = attribs[3] >> 16;
+                    attribs[2] += dx[2];
+                    attribs[3] += dx[3];
+
+                    // Wrapping only required out of texture limits
+                    if ((unsigned int)tx >= (unsigned int)texWidth) tx = swWrapCoord(tx, texWidth, texture->wrapS);
+                    if ((unsigned int)ty >= (unsigned int)texHeight) ty = swWrapCoord(ty, texHeight, texture->wrapT);
+
+                    // Texture environment: GL_MODULATE (not required for white color)
+                    const unsigned char *texel = texture->pixels + ((size_t)ty*texWidth + tx)*4;
+
+                    if (white) memcpy(result, texel, 4);
+                    else for (int i = 0; i < 4; i++) result[i] = (unsigned char)((result[i]*texel[i] + 255) >> 8);
+                }
+
+                memcpy(&span[k], result, 4);
+            }
+        }
+
+        if (blend) swBlendSpanAlpha(pixel, span, count);
+        else memcpy(pixel, span, count*4);
+    }
+}
+
+// Blend span colors (RGBA8) over pixels: source alpha, one minus source alpha
+// NOTE: SIMD and scalar code compute the same exact result, division by 255 is exact in both
+static inline void swBlendSpanAlpha(unsigned char *dst, const unsigned int *src, int count)
+{
+    int k = 0;
+
+#if defined(RLSW_SUPPORT_SSE2)
+    // Four pixels blended at once, channels expanded to 16bit
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i half = _mm_set1_epi16(128);
+    const __m128i div = _mm_set1_epi16(257);
+    const __m128i opaque = _mm_set1_epi8((char)255);
+
+    for (; (k + 4) <= count; k += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + k));
+
+        // Four pixels opaque (source color) or transparent (no change), usual on sprites
+        int alphaMask = _mm_movemask_epi8(_mm_cmpeq_epi8(s, opaque)) & 0x8888;
+        if (alphaMask == 0x8888) { _mm_storeu_si128((__m128i *)(dst + k*4), s); continue; }
+        if ((alphaMask == 0) && ((_mm_movemask_epi8(_mm_cmpeq_epi8(s, zero)) & 0x8888) == 0x8888)) continue;
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + k*4));
+
+        __m128i result[2] = { 0 };
+        for (int h = 0; h < 2; h++)
+        {
+            __m128i sc = (h == 0)? _mm_unpacklo_epi8(s, zero) : _mm_unpackhi_epi8(s, zero);
+            __m128i dc = (h == 0)? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+            __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sc, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128i value = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(sc, sa), _mm_mullo_epi16(dc, _mm_sub_epi16(max, sa))), half);
+            result[h] = _mm_mulhi_epu16(value, div);    // Division by 255: (x + (x >> 8)) >> 8 == (x*257) >> 16
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + k*4), _mm_packus_epi16(result[0], result[1]));
+    }
+#endif
+
+    for (; k < count; k++)
+    {
+        unsigned char *pixel = dst + k*4;
+        unsigned int color = src[k];
+        unsigned int sa = ((const unsigned char *)&color)[3];
+
+        if (sa == 255) memcpy(pixel, &color, 4);
+        else if (sa > 0)
+        {
+            // Two channels blended at once on every 32bit multiply (16bit per channel)
+            unsigned int dstColor = 0;
+            memcpy(&dstColor, pixel, 4);
+
+            unsigned int da = 255 - sa;
+            unsigned int rb = (color & 0x00ff00ff)*sa + (dstColor & 0x00ff00ff)*da + 0x00800080;
+            unsigned int ga = ((color >> 8) & 0x00ff00ff)*sa + ((dstColor >> 8) & 0x00ff00ff)*da + 0x00800080;
+
+            // Division by 255
+            rb = ((rb + ((rb >> 8) & 0x00ff00ff)) >> 8) & 0x00ff00ff;
+            ga = (ga + ((ga >> 8) & 0x00ff00ff)) & 0xff00ff00;
+
+            unsigned int blended = rb | ga;
+            memcpy(pixel, &blended, 4);
+        }
+    }
+}
+
+// Blend color (RGBA8) over pixels: source alpha, one minus source alpha
+// NOTE: Same exact result than swBlendSpanAlpha() with a span of color, source terms computed once
+static inline void swBlendSpanColor(unsigned char *dst, const unsigned char *color, int count)
+{
+    int k = 0;
+    unsigned int sa = color[3];
+    unsigned int da = 255 - sa;
+
+#if defined(RLSW_SUPPORT_SSE2)
+    // Four pixels blended at once, channels expanded to 16bit
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i div = _mm_set1_epi16(257);
+    const __m128i factor = _mm_set1_epi16((short)da);
+    const __m128i source = _mm_setr_epi16((short)(color[0]*sa + 128), (short)(color[1]*sa + 128), (short)(color[2]*sa + 128), (short)(color[3]*sa + 128),
+                                          (short)(color[0]*sa + 128), (short)(color[1]*sa + 128), (short)(color[2]*sa + 128), (short)(color[3]*sa + 128));
+
+    for (; (k + 4) <= count; k += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + k*4));
+        __m128i lo = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), factor), source), div);
+        __m128i hi = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), factor), source), div);
+
+        _mm_storeu_si128((__m128i *)(dst + k*4), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    if (k < count)
+    {
+        unsigned int srcColor = 0;
+        memcpy(&srcColor, color, 4);
+
+        // Two channels blended at once on every 32bit multiply (16bit per channel)
+        unsigned int rbSource = (srcColor & 0x00ff00ff)*sa + 0x00800080;
+        unsigned int gaSource = ((srcColor >> 8) & 0x00ff00ff)*sa + 0x00800080;
+
+        for (; k < count; k++)
+        {
+            unsigned char *pixel = dst + k*4;
+            unsigned int dstColor = 0;
+            memcpy(&dstColor, pixel, 4);
+
+            unsigned int rb = rbSource + (dstColor & 0x00ff00ff)*da;
+            unsigned int ga = gaSource + ((dstColor >> 8) & 0x00ff00ff)*da;
+
+            // Division by 255
+            rb = ((rb + ((rb >> 8) & 0x00ff00ff)) >> 8) & 0x00ff00ff;
+            ga = (ga + ((ga >> 8) & 0x00ff00ff)) & 0xff00ff00;
+
+            unsigned int blended = rb | ga;
+            memcpy(pixel, &blended, 4);
+        }
+    }
+}
+
+// Fill pixels with color (RGBA8)
+static inline void swFillSpan(unsigned char *dst, const unsigned char *color, int count)
+{
+    int k = 0;
+
+#if defined(RLSW_SUPPORT_SSE2)
+    int value = 0;
+    memcpy(&value, color, 4);
+
+    const __m128i fill = _mm_set1_epi32(value);
+    for (; (k + 4) <= count; k += 4) _mm_storeu_si128((__m128i *)(dst + k*4), fill);
+#endif
+
+    for (; k < count; k++) memcpy(dst + k*4, color, 4);
+}
+
+// Multiply colors (RGBA8) by color into span, texture environment GL_MODULATE
+// NOTE: SIMD and scalar code compute the same exact result, (a*b + 255)/256 in both, src can be span
+static inline void swModulateSpan(unsigned int *span, const unsigned char *src, const int *color, int count)
+{
+    int k = 0;
+
+#if defined(RLSW_SUPPORT_SSE2)
+    // Four colors multiplied at once, channels expanded to 16bit
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i factor = _mm_setr_epi16((short)color[0], (short)color[1], (short)color[2], (short)color[3],
+                                          (short)color[0], (short)color[1], (short)color[2], (short)color[3]);
+
+    for (; (k + 4) <= count; k += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + k*4));
+        __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), factor), max), 8);
+        __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), factor), max), 8);
+
+        _mm_storeu_si128((__m128i *)(span + k), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; k < count; k++)
+    {
+        unsigned char texel[4] = { 0 };
+        memcpy(texel, src + k*4, 4);
+        for (int i = 0; i < 4; i++) texel[i] = (unsigned char)((color[i]*texel[i] + 255) >> 8);
+        memcpy(&span[k], texel, 4);
+    }
+}
+
+// Rasterize triangle pixels inside provided rectangle (inclusive)
+static void swRasterizeTriangle(const swTriangle *tri, const swState *state, const int *rect)
+{
+    const swTexture *texture = (state->texture != 0)? &SW.textures[state->texture] : NULL;
+
+    int blendMode = SW_BLEND_NONE;
+    if (state->blend && (state->srcFactor == GL_SRC_ALPHA) && (state->dstFactor == GL_ONE_MINUS_SRC_ALPHA)) blendMode = SW_BLEND_ALPHA;
+    else if (state->blend && !((state->srcFactor == GL_ONE) && (state->dstFactor == GL_ZERO))) blendMode = SW_BLEND_GENERIC;
+
+    // NOTE: Depth buffer is not updated if depth test is disabled (as OpenGL does)
+    int depthTest = state->depthTest;
+
+    // Minification filter is used if more than one texel maps to a pixel
+    int linear = 0;
+    if (texture != NULL)
+    {
+        float texelsPerPixel = fabsf(tri->planes[2].dx*texture->width) + fabsf(tri->planes[3].dy*texture->height);
+        GLenum filter = (texelsPerPixel > 1.0f)? texture->minFilter : texture->magFilter;
+        linear = (filter == GL_LINEAR) || (filter == GL_LINEAR_MIPMAP_NEAREST) || (filter == GL_LINEAR_MIPMAP_LINEAR);
+    }
+
+    // Specialized loops for 2d drawing (no depth test, no perspective, nearest filtering)
+    if (!depthTest && !tri->perspective && !linear && (blendMode != SW_BLEND_GENERIC))
+    {
+        if (texture != NULL)
+        {
+            if (blendMode == SW_BLEND_ALPHA) swRasterizeRowsAffine(tri, rect, texture, 1, SW_BLEND_ALPHA);
+            else swRasterizeRowsAffine(tri, rect, texture, 1, SW_BLEND_NONE);
+        }
+        else
+        {
+            if (blendMode == SW_BLEND_ALPHA) swRasterizeRowsAffine(tri, rect, NULL, 0, SW_BLEND_ALPHA);
+            else swRasterizeRowsAffine(tri, rect, NULL, 0, SW_BLEND_NONE);
+        }
+    }
+    else swRasterizeRows(tri, state, rect, texture, linear, (texture != NULL), blendMode, depthTest, tri->perspective);
+}
+
+// Check every pixel alpha is 255 (RGBA8)
+static int swIsOpaque(const unsigned char *pixels, int count)
+{
+    for (int i = 0; i < count; i++) if (pixels[i*4 + 3] != 255) return 0;
+
+    return 1;
+}
+
+// Convert pixels data to RGBA8
+static void swConvertPixels(unsigned char *dst, const unsigned char *src, int width, int height, GLenum format, GLenum type, int alignment)
+{
+    int bytesPerPixel = 4;
+
+    if (type == GL_UNSIGNED_BYTE)
+    {
+        switch (format)
+        {
+            case GL_ALPHA:
+            case GL_LUMINANCE: bytesPerPixel = 1; break;
+            case GL_LUMINANCE_ALPHA: bytesPerPixel = 2; break;
+            case GL_RGB: bytesPerPixel = 3; break;
+            case GL_RGBA: bytesPerPixel = 4; break;
+            default: swSetError(GL_INVALID_ENUM); memset(dst, 0, (size_t)width*height*4); return;
+        }
+    }
+    else if ((type == GL_UNSIGNED_SHORT_5_6_5) || (type == GL_UNSIGNED_SHORT_5_5_5_1) || (type == GL_UNSIGNED_SHORT_4_4_4_4)) bytesPerPixel = 2;
+    else { swSetError(GL_INVALID_ENUM); memset(dst, 0, (size_t)width*height*4); return; }
+
+    int rowStride = (width*bytesPerPixel + alignment - 1)/alignment*alignment;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row = src + (size_t)y*rowStride;
+
+        for (int x = 0; x < width; x++, dst += 4)
+        {
+            const unsigned char *p = row + x*bytesPerPixel;
+
+            if (type == GL_UNSIGNED_BYTE)
+            {
+                switch (format)
+                {
+                    case GL_ALPHA: dst[0] = dst[1] = dst[2] = 255; dst[3] = p[0]; break;
+                    case GL_LUMINANCE: dst[0] = dst[1] = dst[2] = p[0]; dst[3] = 255; break;
+                    case GL_LUMINANCE_ALPHA: dst[0] = dst[1] = dst[2] = p[0]; dst[3] = p[1]; break;
+                    case GL_RGB: dst[0] = p[0]; dst[1] = p[1]; dst[2] = p[2]; dst[3] = 255; break;
+                    default: memcpy(dst, p, 4); break;
+                }
+            }
+            else
+            {
+                unsigned short value = ((const unsigned short *)p)[0];
+
+                if (type == GL_UNSIGNED_SHORT_5_6_5)
+                {
+                    dst[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+                    dst[1] = (unsigned char)(((value >> 5) & 0x3f)*255/63);
+                    dst[2] = (unsigned char)((value & 0x1f)*255/31);
+                    dst[3] = 255;
+                }
+                else if (type == GL_UNSIGNED_SHORT_5_5_5_1)
+                {
+                    dst[0] = (unsigned char)(((value >> 11) & 0x1f)*255/31);
+                    dst[1] = (unsigned char)(((value >> 6) & 0x1f)*255/31);
+                    dst[2] = (unsigned char)(((value >> 1) & 0x1f)*255/31);
+                    dst[3] = (value & 0x1)? 255 : 0;
+                }
+                else
+                {
+                    dst[0] = (unsigned char)(((value >> 12) & 0xf)*17);
+                    dst[1] = (unsigned char)(((value >> 8) & 0xf)*17);
+                    dst[2] = (unsigned char)(((value >> 4) & 0xf)*17);
+                    dst[3] = (unsigned char)((value & 0xf)*17);
+                }
+            }
+        }
+    }
+}
+
+#endif  // RLSW_IMPLEMENTATION
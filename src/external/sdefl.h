@@ -167,6 +167,9 @@ struct sdefl {
 extern int sdefl_bound(int in_len);
 extern int sdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
+/* @raysan5: Chunked compression, input positions [0,off) are history (up to
+ * SDEFL_WIN_SIZ) used for matches only, pending bits kept in sdefl until last chunk */
+extern int sdeflate_chunk(struct sdefl *s, void *o, const void *i, int off, int n, int lvl, int is_last);
 
 #ifdef __cplusplus
 }
@@ -571,14 +574,20 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s,
 }
 static int
 sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+            int in_off, int in_len, int lvl, int is_last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
-  int n, i = 0, litlen = 0;
+  int n, i = in_off, litlen = 0;
   for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
     s->tbl[n] = SDEFL_NIL;
   }
+  for (n = 0; n < in_off && n + SDEFL_MIN_MATCH <= in_len; ++n) {
+    /* history positions, only available for matches */
+    unsigned h = sdefl_hash32(&in[n]);
+    s->prv[n&SDEFL_WIN_MSK] = s->tbl[h];
+    s->tbl[h] = n;
+  }
   do {int blk_end = i + SDEFL_BLK_MAX < in_len ? i + SDEFL_BLK_MAX : in_len;
     while (i < blk_end) {
       struct sdefl_match m = {0};
@@ -624,17 +633,21 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in);
+    sdefl_flush(&q, s, is_last && blk_end == in_len, in);
   } while (i < in_len);
 
-  if (s->bitcnt)
+  if (is_last && s->bitcnt)
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   return (int)(q - out);
 }
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
-  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, 0, n, lvl, 1);
+}
+extern int
+sdeflate_chunk(struct sdefl *s, void *out, const void *in, int off, int n, int lvl, int is_last) {
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, off, off + n, lvl, is_last);
 }
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -676,7 +689,7 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
   sdefl_put(&q, s, 0x78, 8); /* deflate, 32k window */
   sdefl_put(&q, s, 0x01, 8); /* fast compression */
-  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl);
+  q += sdefl_compr(s, q, (const unsigned char*)in, 0, n, lvl, 1);
 
   /* append adler checksum */
   a = sdefl_adler32(SDEFL_ADLER_INIT, (const unsigned char*)in, n);
@@ -131,6 +131,45 @@ struct sinfl {
 extern int sinflate(void *out, int cap, const void *in, int size);
 extern int zsinflate(void *out, int cap, const void *in, int size);
 
+/* @raysan5: Streaming decompression, input validated (unlike sinflate()), raw, zlib or
+ * gzip wrapped data accepted (checksums not verified). Input read from memory (in, in_len)
+ * then by read callback into chunk (optional). Output written to memory: fixed capacity
+ * or grown geometrically with SINFL_REALLOC() (grow, out can be NULL), or written by write
+ * callback from a ring buffer window (out, SINFL_WIN_SIZ bytes) keeping match history */
+#define SINFL_WIN_SIZ (64*1024)
+
+typedef int(*sinfl_read_fn)(unsigned char *buf, int len, void *usr);
+typedef int(*sinfl_write_fn)(const unsigned char *buf, int len, void *usr);
+
+struct sinfl_stream {
+  const unsigned char *in;
+  int in_len, in_pos;
+  sinfl_read_fn read;
+  unsigned char *chunk;
+  int chunk_siz;
+
+  unsigned char *out;
+  unsigned cap;
+  int grow;
+  sinfl_write_fn write;
+  void *usr;
+
+  unsigned pos, flushed, msk;
+  unsigned long long bitbuf;
+  int bitcnt;
+  int err;
+
+  unsigned lits[SINFL_LIT_TBL_SIZE];
+  unsigned dsts[SINFL_OFF_TBL_SIZE];
+};
+extern int sinflate_stream(struct sinfl_stream *s);
+
+/* @raysan5: Memory decompression to an output allocated once with exact decompressed size
+ * (SINFL_REALLOC()), size computed by a first decompression pass into a SINFL_WIN_SIZ window
+ * (data counted, not stored) unless a size hint is provided (i.e. gzip ISIZE, -1 if not
+ * available), wrong size hint detected and size computed, returns NULL on failure */
+extern unsigned char *sinflate_alloc(const void *in, int size, int size_hint, int *out_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -142,6 +181,15 @@ extern int zsinflate(void *out, int cap, const void *in, int size);
 #include <string.h> /* memcpy, memset */
 #include <assert.h> /* assert */
 
+#ifndef SINFL_REALLOC
+  #include <stdlib.h> /* realloc */
+  #define SINFL_REALLOC(p,n) realloc(p,n)
+#endif
+#ifndef SINFL_FREE
+  #include <stdlib.h> /* free */
+  #define SINFL_FREE(p) free(p)
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #define sinfl_likely(x)       __builtin_expect((x),1)
 #define sinfl_unlikely(x)     __builtin_expect((x),0)
@@ -567,6 +615,323 @@ sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
     blk_len = 5552;
   } return (unsigned)(s2 << 16) + (unsigned)s1;
 }
+static void
+sinfl_strm_refill(struct sinfl_stream *s) {
+  while (s->bitcnt <= 56) {
+    if (s->in_pos >= s->in_len) {
+      int n = s->read ? s->read(s->chunk, s->chunk_siz, s->usr) : 0;
+      if (n <= 0) {
+        s->read = 0; /* end of input */
+        break;
+      }
+      s->in = s->chunk;
+      s->in_len = n;
+      s->in_pos = 0;
+    }
+    s->bitbuf |= (unsigned long long)s->in[s->in_pos++] << s->bitcnt;
+    s->bitcnt += 8;
+  }
+}
+static unsigned
+sinfl_strm_get(struct sinfl_stream *s, int cnt) {
+  unsigned res;
+  if (s->bitcnt < cnt) sinfl_strm_refill(s);
+  if (s->bitcnt < cnt) {
+    s->err = 1;
+    return 0;
+  }
+  res = (unsigned)(s->bitbuf & ((1ull << cnt) - 1));
+  s->bitbuf >>= cnt;
+  s->bitcnt -= cnt;
+  return res;
+}
+static int
+sinfl_strm_decode(struct sinfl_stream *s, const unsigned *tbl, int bit_len) {
+  unsigned key;
+  int len;
+  if (s->bitcnt < 15) sinfl_strm_refill(s); /* max code length */
+  key = tbl[s->bitbuf & ((1u << bit_len) - 1)];
+  len = key & 0x0f;
+  if (key & 0x10) {
+    /* sub-table lookup */
+    unsigned idx = (unsigned)(s->bitbuf >> bit_len) & ((1u << len) - 1);
+    key = tbl[((key >> 16) & 0xffff) + idx];
+    len = bit_len + (key & 0x0f);
+  }
+  if (len > s->bitcnt) {
+    s->err = 1;
+    return -1;
+  }
+  s->bitbuf >>= len;
+  s->bitcnt -= len;
+  return (key >> 16) & 0x0fff;
+}
+static void
+sinfl_strm_build(struct sinfl_stream *s, unsigned *tbl, unsigned char *lens,
+                 int tbl_bits, int symcnt) {
+  /* over-subscribed codes are not valid, incomplete codes only for a single code,
+   * filled here since sinfl_build() requires a complete code */
+  int i, left = 1, codes = 0, sym = 0;
+  int cnt[16] = {0};
+  for (i = 0; i < symcnt; ++i) {
+    cnt[lens[i]]++;
+    if (lens[i]) codes++, sym = i;
+  }
+  for (i = 1; i < 16; ++i) {
+    left = (left << 1) - cnt[i];
+    if (left < 0) {
+      s->err = 1;
+      return;
+    }
+  }
+  if (left > 0) {
+    if (codes > 1) {
+      s->err = 1;
+      return;
+    }
+    for (i = 0; i < (1 << tbl_bits); ++i)
+      tbl[i] = ((unsigned)sym << 16) | 1;
+  } else sinfl_build(tbl, lens, tbl_bits, 15, symcnt);
+}
+static void
+sinfl_strm_flush(struct sinfl_stream *s) {
+  while (!s->err && s->flushed < s->pos) {
+    unsigned start = s->flushed & s->msk;
+    unsigned n = s->pos - s->flushed;
+    if (n > SINFL_WIN_SIZ - start) n = SINFL_WIN_SIZ - start; /* ring buffer wrap */
+    if (!s->write(s->out + start, (int)n, s->usr)) s->err = 1;
+    s->flushed += n;
+  }
+}
+static int
+sinfl_strm_reserve(struct sinfl_stream *s, unsigned n) {
+  /* space for next bytes (max: 258), window flushed or memory grown if required */
+  if (s->err) return 0;
+  if (s->write) {
+    /* data not written plus 32KB history always fit into window */
+    if (s->pos - s->flushed >= SINFL_WIN_SIZ/2) sinfl_strm_flush(s);
+  } else if (!s->out || s->cap - s->pos < n) {
+    unsigned cap = s->cap ? s->cap : 4096; /* initial capacity (size hint) */
+    unsigned char *out;
+    if (!s->grow) {
+      s->err = 1;
+      return 0;
+    }
+    while (cap - s->pos < n) {
+      if (cap >= 0x40000000u) {
+        cap = 0x7fffffffu;
+        if (cap - s->pos < n) {
+          s->err = 1;
+          return 0;
+        }
+        break;
+      }
+      cap <<= 1;
+    }
+    out = (unsigned char*)SINFL_REALLOC(s->out, cap);
+    if (!out) {
+      s->err = 1;
+      return 0;
+    }
+    s->out = out;
+    s->cap = cap;
+  }
+  return !s->err;
+}
+extern int
+sinflate_stream(struct sinfl_stream *s) {
+  static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+  static const unsigned short lbase[29] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,
+      43,51,59,67,83,99,115,131,163,195,227,258};
+  static const unsigned char lbits[29] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,
+      4,4,4,5,5,5,5,0};
+  static const unsigned short dbase[30] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
+      257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+  static const unsigned char dbits[30] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,
+      10,10,11,11,12,12,13,13};
+  int last = 0;
+
+  s->msk = s->write ? (SINFL_WIN_SIZ - 1) : 0xffffffffu;
+  s->pos = s->flushed = 0;
+  s->bitbuf = 0, s->bitcnt = 0, s->err = 0;
+
+  /* wrapper header: gzip (RFC 1952) or zlib (RFC 1950), raw deflate otherwise */
+  sinfl_strm_refill(s);
+  if (s->bitcnt >= 16) {
+    unsigned b0 = (unsigned)(s->bitbuf & 0xff);
+    unsigned b1 = (unsigned)((s->bitbuf >> 8) & 0xff);
+    if (b0 == 0x1f && b1 == 0x8b) {
+      unsigned flg, i, n;
+      sinfl_strm_get(s, 16);
+      if (sinfl_strm_get(s, 8) != 8) s->err = 1; /* method: deflate */
+      flg = sinfl_strm_get(s, 8);
+      for (i = 0; i < 6; ++i) sinfl_strm_get(s, 8); /* mtime, xfl, os */
+      if (flg & 0x04) { /* fextra */
+        n = sinfl_strm_get(s, 16);
+        for (i = 0; i < n && !s->err; ++i) sinfl_strm_get(s, 8);
+      }
+      if (flg & 0x08) while (!s->err && sinfl_strm_get(s, 8)); /* fname */
+      if (flg & 0x10) while (!s->err && sinfl_strm_get(s, 8)); /* fcomment */
+      if (flg & 0x02) sinfl_strm_get(s, 16); /* fhcrc */
+    } else if ((b0 & 0x0f) == 8 && ((b0 << 8) | b1) % 31 == 0) {
+      sinfl_strm_get(s, 16);
+      if (b1 & 0x20) s->err = 1; /* preset dictionary not supported */
+    }
+  }
+  while (!last && !s->err) {
+    unsigned type;
+    last = (int)sinfl_strm_get(s, 1);
+    type = sinfl_strm_get(s, 2);
+
+    if (type == 0) {
+      /* stored block */
+      unsigned len, i;
+      sinfl_strm_get(s, s->bitcnt & 7);
+      len = sinfl_strm_get(s, 16);
+      if (sinfl_strm_get(s, 16) != (~len & 0xffff)) s->err = 1;
+      for (i = 0; i < len && !s->err; ++i) {
+        unsigned c = sinfl_strm_get(s, 8);
+        if (sinfl_strm_reserve(s, 1))
+          s->out[s->pos++ & s->msk] = (unsigned char)c;
+      }
+    } else if (type == 1 || type == 2) {
+      unsigned char lens[288+32] = {0};
+      int n, nlit = 288, ndist = 32;
+      if (type == 1) {
+        /* fixed huffman codes */
+        for (n = 0; n <= 143; n++) lens[n] = 8;
+        for (n = 144; n <= 255; n++) lens[n] = 9;
+        for (n = 256; n <= 279; n++) lens[n] = 7;
+        for (n = 280; n <= 287; n++) lens[n] = 8;
+        for (n = 0; n < 32; n++) lens[288+n] = 5;
+      } else {
+        /* dynamic huffman codes */
+        unsigned hlens[SINFL_PRE_TBL_SIZE] = {0};
+        unsigned char nlens[19] = {0};
+        int nlen;
+        nlit = 257 + (int)sinfl_strm_get(s, 5);
+        ndist = 1 + (int)sinfl_strm_get(s, 5);
+        nlen = 4 + (int)sinfl_strm_get(s, 4);
+        for (n = 0; n < nlen; n++)
+          nlens[order[n]] = (unsigned char)sinfl_strm_get(s, 3);
+        if (!s->err) sinfl_strm_build(s, hlens, nlens, 7, 19);
+
+        /* decode code lengths */
+        for (n = 0; n < nlit + ndist && !s->err;) {
+          int sym = sinfl_strm_decode(s, hlens, 7), rep = 0;
+          unsigned char val = 0;
+          if (sym < 0) break;
+          else if (sym < 16) {
+            lens[n++] = (unsigned char)sym;
+            continue;
+          } else if (sym == 16) {
+            if (n == 0) {
+              s->err = 1;
+              break;
+            }
+            val = lens[n-1];
+            rep = 3 + (int)sinfl_strm_get(s, 2);
+          } else if (sym == 17) rep = 3 + (int)sinfl_strm_get(s, 3);
+          else rep = 11 + (int)sinfl_strm_get(s, 7);
+          if (n + rep > nlit + ndist) {
+            s->err = 1;
+            break;
+          }
+          while (rep-- > 0) lens[n++] = val;
+        }
+        if (!lens[256]) s->err = 1; /* end of block code required */
+      }
+      /* build lit/dist tables */
+      if (!s->err) sinfl_strm_build(s, s->lits, lens, 10, nlit);
+      if (!s->err) sinfl_strm_build(s, s->dsts, lens + nlit, 8, ndist);
+
+      /* decompress block */
+      while (!s->err) {
+        int sym = sinfl_strm_decode(s, s->lits, 10);
+        if (sym < 0) break;
+        else if (sym < 256) {
+          /* literal */
+          if (sinfl_strm_reserve(s, 1))
+            s->out[s->pos++ & s->msk] = (unsigned char)sym;
+        } else if (sym == 256) {
+          break; /* end of block */
+        } else {
+          /* match */
+          unsigned len, offs, i;
+          int dsym;
+          sym -= 257;
+          if (sym >= 29) {
+            s->err = 1;
+            break;
+          }
+          len = lbase[sym] + sinfl_strm_get(s, lbits[sym]);
+          dsym = sinfl_strm_decode(s, s->dsts, 8);
+          if (dsym < 0 || dsym >= 30) {
+            s->err = 1;
+            break;
+          }
+          offs = dbase[dsym] + sinfl_strm_get(s, dbits[dsym]);
+          if (offs > s->pos) {
+            s->err = 1;
+            break;
+          }
+          if (sinfl_strm_reserve(s, len)) {
+            unsigned char *out = s->out;
+            if (!s->write && offs >= len) {
+              memcpy(out + s->pos, out + s->pos - offs, len);
+            } else {
+              for (i = s->pos; i < s->pos + len; ++i)
+                out[i & s->msk] = out[(i - offs) & s->msk];
+            }
+            s->pos += len;
+          }
+        }
+      }
+    } else s->err = 1; /* reserved block type */
+  }
+  if (s->write) sinfl_strm_flush(s);
+  return s->err ? -1 : (int)s->pos;
+}
+static int
+sinfl_count_write(const unsigned char *buf, int len, void *usr) {
+  /* size pass: window data discarded, size counted by stream position */
+  (void)buf; (void)len; (void)usr;
+  return 1;
+}
+extern unsigned char*
+sinflate_alloc(const void *in, int size, int size_hint, int *out_len) {
+  struct sinfl_stream s;
+  unsigned char *out;
+  int len = size_hint;
+  *out_len = 0;
+  if (len < 0) {
+    /* size pass: output written to window only */
+    unsigned char *win = (unsigned char*)SINFL_REALLOC(0, SINFL_WIN_SIZ);
+    if (!win) return 0;
+    memset(&s, 0, sizeof(s));
+    s.in = (const unsigned char*)in;
+    s.in_len = size;
+    s.out = win;
+    s.write = sinfl_count_write;
+    len = sinflate_stream(&s);
+    SINFL_FREE(win);
+    if (len < 0) return 0;
+  }
+  out = (unsigned char*)SINFL_REALLOC(0, len > 0 ? len : 1);
+  if (!out) return 0;
+  memset(&s, 0, sizeof(s));
+  s.in = (const unsigned char*)in;
+  s.in_len = size;
+  s.out = out;
+  s.cap = (unsigned)len;
+  if (sinflate_stream(&s) != len) {
+    /* wrong size hint: size computed, invalid data otherwise */
+    SINFL_FREE(out);
+    return (size_hint >= 0) ? sinflate_alloc(in, size, -1, out_len) : 0;
+  }
+  *out_len = len;
+  return out;
+}
 extern int
 zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
@@ -96,6 +96,13 @@ extern int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                              unsigned int *num_shapes, tinyobj_material_t **materials,
                              unsigned int *num_materials, const char *buf, unsigned int len,
                              unsigned int flags);
+/* Parse wavefront .obj, material library file path relative to `base_dir' (NULL: working directory)
+ * NOTE: Added for raylib, materials loaded without changing working directory (thread safe)
+ */
+extern int tinyobj_parse_obj_ex(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                                unsigned int *num_shapes, tinyobj_material_t **materials,
+                                unsigned int *num_materials, const char *buf, unsigned int len,
+                                unsigned int flags, const char *base_dir);
 extern int tinyobj_parse_mtl_file(tinyobj_material_t **materials_out,
                                   unsigned int *num_materials_out,
                                   const char *filename);
@@ -1211,6 +1218,14 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                       unsigned int *num_shapes, tinyobj_material_t **materials_out,
                       unsigned int *num_materials_out, const char *buf, unsigned int len,
                       unsigned int flags) {
+  return tinyobj_parse_obj_ex(attrib, shapes, num_shapes, materials_out,
+                              num_materials_out, buf, len, flags, NULL);
+}
+
+int tinyobj_parse_obj_ex(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                         unsigned int *num_shapes, tinyobj_material_t **materials_out,
+                         unsigned int *num_materials_out, const char *buf, unsigned int len,
+                         unsigned int flags, const char *base_dir) {
   LineInfo *line_infos = NULL;
   Command *commands = NULL;
   unsigned int num_lines = 0;
@@ -1319,6 +1334,17 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
     char *filename = my_strndup(commands[mtllib_line_index].mtllib_name,
                                 commands[mtllib_line_index].mtllib_name_len);
 
+    if (base_dir != NULL && base_dir[0] != '\0' && filename[0] != '/' &&
+        filename[0] != '\\' && filename[1] != ':') {
+      size_t base_len = strlen(base_dir);
+      char *path = (char *)TINYOBJ_MALLOC(base_len + strlen(filename) + 2);
+      memcpy(path, base_dir, base_len);
+      if (base_dir[base_len - 1] != '/' && base_dir[base_len - 1] != '\\') path[base_len++] = '/';
+      strcpy(path + base_len, filename);
+      TINYOBJ_FREE(filename);
+      filename = path;
+    }
+
     int ret = tinyobj_parse_and_index_mtl_file(&materials, &num_materials, filename, &material_table);
 
     if (ret != TINYOBJ_SUCCESS) {
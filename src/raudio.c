@@ -195,6 +195,11 @@ typedef struct tagBITMAPINFOHEADER {
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
 
+    #ifndef PROFILE_ZONE_BEGIN
+        #define PROFILE_ZONE_BEGIN(name) (void)0
+        #define PROFILE_ZONE_END() (void)0
+    #endif
+
     // Allow custom memory allocators
     #ifndef RL_MALLOC
         #define RL_MALLOC(sz)           malloc(sz)
@@ -745,7 +750,11 @@ Wave LoadWave(const char *fileName)
     // Loading wave from memory data
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
+#if defined(RAUDIO_STANDALONE)
     RL_FREE(fileData);
+#else
+    UnloadFileData(fileData);       // NOTE: File data could be a view into an assets archive
+#endif
 
     return wave;
 }
@@ -1240,6 +1249,15 @@ Music LoadMusicStream(const char *fileName)
     Music music = { 0 };
     bool musicLoaded = false;
 
+#if !defined(RAUDIO_STANDALONE)
+    // Music streamed from mounted assets archive data if available (uncompressed files only),
+    // archive data is valid while mounted, no file data copy required
+    unsigned int archiveDataSize = 0;
+    const unsigned char *archiveData = GetArchiveFileData(fileName, &archiveDataSize);
+
+    if (archiveData != NULL) return LoadMusicStreamFromMemory(GetFileExtension(fileName), archiveData, (int)archiveDataSize);
+#endif
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (IsFileExtension(fileName, ".wav"))
@@ -1771,6 +1789,8 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    PROFILE_ZONE_BEGIN("UpdateMusicStream");
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1916,6 +1936,7 @@ void UpdateMusicStream(Music music)
             {
                 // Streaming is ending, we filled latest frames from input
                 StopMusicStream(music);
+                PROFILE_ZONE_END();
                 return;
             }
         }
@@ -1924,6 +1945,8 @@ void UpdateMusicStream(Music music)
     // NOTE: In case window is minimized, music stream is stopped,
     // just make sure to play again on window restore
     if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
+
+    PROFILE_ZONE_END();
 }
 
 // Check if any music is playing
@@ -284,6 +284,27 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct rAtlasPacker rAtlasPacker;
+
+// TextureAtlas, images packed at runtime into one or more textures (pages)
+typedef struct TextureAtlas {
+    int width;              // Atlas pages width
+    int height;             // Atlas pages height
+    int padding;            // Sprites padding (transparent border, in pixels)
+    int pageCount;          // Number of atlas pages
+    Texture2D *pages;       // Atlas pages textures
+    rAtlasPacker *packer;   // Pointer to internal data used by the atlas packing
+} TextureAtlas;
+
+// AtlasSprite, image packed into a texture atlas page
+typedef struct AtlasSprite {
+    Texture2D texture;      // Atlas page texture containing the sprite
+    Rectangle source;       // Sprite rectangle in atlas page texture
+    int id;                 // Sprite id in texture atlas (-1 if not packed)
+} AtlasSprite;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -397,6 +418,24 @@ typedef struct Model {
     Transform *bindPose;    // Bones base transformation (pose)
 } Model;
 
+// MeshList, static meshes sharing vertex format, packed in shared vertex buffers and drawn together
+typedef struct MeshList {
+    int meshCount;          // Number of meshes
+    int vertexCount;        // Number of vertices packed (all meshes)
+    int triangleCount;      // Number of triangles packed (all meshes)
+
+    int *firstIndex;        // Meshes first index in indices buffer
+    int *indexCount;        // Meshes indices count
+    int *baseVertex;        // Meshes indices base vertex (indices are 16 bit, relative to base vertex)
+    Matrix *transforms;     // Meshes transforms
+
+    // OpenGL identifiers
+    unsigned int vaoId;     // OpenGL Vertex Array Object id
+    unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data + draw ids)
+    unsigned int commandsId;    // OpenGL indirect draw commands buffer id (OpenGL 4.3)
+    unsigned int transformsId;  // OpenGL transforms shader storage buffer id (SSBO, OpenGL 4.3)
+} MeshList;
+
 // ModelAnimation
 typedef struct ModelAnimation {
     int boneCount;          // Number of bones
@@ -498,6 +537,42 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// Directory entry, read with directory iterator
+typedef struct DirectoryEntry {
+    const char *path;               // Entry path (base path prepended), valid until next entry read
+    const char *name;               // Entry name (pointer into path)
+    bool isDirectory;               // Entry is a directory
+} DirectoryEntry;
+
+// Directory iterator, opaque struct
+// NOTE: Actual struct is defined internally in rcore module
+typedef struct DirectoryIterator DirectoryIterator;
+
+// Frame statistics, rendering work and timing of last frame drawn
+typedef struct FrameStats {
+    unsigned int drawCalls;         // Draw calls submitted to GPU
+    unsigned int vertexCount;       // Vertex submitted on render batch draws
+    unsigned int batchFlushes;      // Render batch draws forced by batch limits (vertex or draw calls)
+    unsigned int textureBinds;      // Textures bound for draw calls
+    unsigned int bytesUploaded;     // Data uploaded to GPU: render batch, vertex buffers and textures (in bytes)
+    unsigned int callsElided;       // Redundant GL calls skipped: state changes, bindings and uniform uploads
+    float updateTime;               // Time for frame update, until BeginDrawing() (in seconds)
+    float drawTime;                 // Time for frame draw, BeginDrawing() to EndDrawing() (in seconds)
+    float waitTime;                 // Time waiting to reach target frame time (in seconds)
+    float frameJitter;              // Frame time jitter, standard deviation of last frames time (in seconds)
+    unsigned int fixedStepsDropped; // Fixed update steps dropped by catch-up limit, since SetFixedUpdateRate()
+} FrameStats;
+
+// Frame pacing statistics, WaitTime() accuracy
+typedef struct PacingStats {
+    unsigned int waitCount;         // Waits measured
+    float sleepOvershoot;           // Sleep overshoot estimate, time reserved for busy waiting (in seconds)
+    double sleepTime;               // Total time sleeping (in seconds)
+    double spinTime;                // Total time busy waiting (in seconds)
+    float errorMax;                 // Maximum wait error, time waited over requested (in seconds)
+    unsigned int errorHistogram[8];  // Wait error histogram: <10us, <25us, <50us, <100us, <250us, <500us, <1ms, more
+} PacingStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -763,7 +838,8 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_VERTEX_DRAWID        // Shader location: vertex attribute: draw id (mesh list)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -903,6 +979,25 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Asset types, loaded asynchronously (LoadAssetAsync())
+typedef enum {
+    ASSET_IMAGE = 0,                // Image (CPU memory)
+    ASSET_TEXTURE,                  // Texture (GPU memory)
+    ASSET_FONT,                     // Font (glyphs data and texture)
+    ASSET_MODEL,                    // Model (meshes and materials)
+    ASSET_WAVE                      // Wave (audio data)
+} AssetType;
+
+// Asset loading states
+typedef enum {
+    ASSET_STATE_INVALID = 0,        // Asset handle not valid (or released)
+    ASSET_STATE_QUEUED,             // Asset waiting for a loading thread
+    ASSET_STATE_LOADING,            // Asset data loading: file reading and decoding (loading thread)
+    ASSET_STATE_UPLOADING,          // Asset data loaded, waiting GPU upload (main thread, EndDrawing())
+    ASSET_STATE_READY,              // Asset ready to be used
+    ASSET_STATE_FAILED              // Asset loading failed
+} AssetState;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -910,6 +1005,8 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, unsigned in
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, unsigned int bytesToWrite);  // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef int (*DataReadCallback)(unsigned char *buffer, int size, void *userData);       // Compression: Read data chunk, returns bytes read (0 at end of data)
+typedef bool (*DataWriteCallback)(const unsigned char *data, int size, void *userData); // Compression: Write data chunk, returns false to abort
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1014,7 +1111,10 @@ RLAPI void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR s
 // NOTE: Shader functionality is not available on OpenGL 1.1
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
 RLAPI Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
+RLAPI Shader LoadShaderAsync(const char *vsFileName, const char *fsFileName);   // Load shader from files, compilation not waited (check IsShaderReady() before use)
+RLAPI Shader LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode); // Load shader from code strings, compilation not waited (check IsShaderReady() before use)
 RLAPI bool IsShaderReady(Shader shader);                                   // Check if a shader is ready
+RLAPI void SetShaderCacheDirectory(const char *dirPath);                  // Set shader binaries cache directory, NULL disables cache
 RLAPI int GetShaderLocation(Shader shader, const char *uniformName);       // Get shader uniform location
 RLAPI int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
 RLAPI void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType);               // Set shader uniform value
@@ -1036,12 +1136,28 @@ RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Get the
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
+RLAPI FrameStats GetFrameStats(void);                             // Get statistics for last frame drawn (rendering work and timing)
+RLAPI PacingStats GetPacingStats(void);                           // Get frame pacing statistics (WaitTime() accuracy)
+RLAPI void SetFixedUpdateRate(int ups);                           // Set fixed update rate (updates per second), 0 disables fixed update
+RLAPI void SetFixedUpdateMaxSteps(int steps);                     // Set fixed update steps limit per frame (catch-up limit)
+RLAPI int GetFixedUpdateSteps(void);                              // Get fixed update steps to run for current frame
+RLAPI float GetFixedUpdateAlpha(void);                            // Get fixed update interpolation alpha [0..1], time accumulated not consumed by steps
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void StartScreenRecording(const char *fileName);            // Start screen recording (filename extension defines format: .gif, .qoi or .raw frames sequence)
+RLAPI void StopScreenRecording(void);                             // Stop screen recording, queued frames encoded and saved
+RLAPI bool IsScreenRecording(void);                               // Check if screen is being recorded
+RLAPI void SetScreenRecordingRate(int frames);                    // Set screen recording rate, one frame recorded every frames (default: 10)
+RLAPI bool StartAutomationEventRecording(const char *fileName);   // Start recording input events into a file (binary, events streamed every frame)
+RLAPI void StopAutomationEventRecording(void);                    // Stop recording input events, file closed
+RLAPI bool StartAutomationEventPlaying(const char *fileName);     // Start playing input events from a file, recorded frames relative to current frame
+RLAPI void StopAutomationEventPlaying(void);                      // Stop playing input events
+RLAPI bool SeekAutomationEventPlaying(int frame);                 // Seek playing input events to a recorded frame, played on next frame (file frames index)
+RLAPI bool IsAutomationEventPlaying(void);                        // Check if input events are being played
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
@@ -1052,6 +1168,11 @@ RLAPI void MemFree(void *ptr);                                    // Internal me
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
+// Profiler functions (requires SUPPORT_PROFILER)
+RLAPI void BeginProfileZone(const char *name);                    // Begin profiler zone on current thread (name must be a static string)
+RLAPI void EndProfileZone(void);                                  // End latest profiler zone begun on current thread
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded profiler zones as Chrome trace JSON, returns true on success
+
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advance users
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
@@ -1084,14 +1205,50 @@ RLAPI bool IsPathFile(const char *path);                          // Check if a
 RLAPI FilePathList LoadDirectoryFiles(const char *dirPath);       // Load directory filepaths
 RLAPI FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan
 RLAPI void UnloadDirectoryFiles(FilePathList files);              // Unload filepaths
+RLAPI DirectoryIterator *LoadDirectoryIterator(const char *basePath, const char *filter, bool scanSubdirs); // Load directory iterator, entries read one by one (no paths list allocated)
+RLAPI bool NextDirectoryEntry(DirectoryIterator *iterator, DirectoryEntry *entry);    // Read next directory entry, returns false once all entries read
+RLAPI void UnloadDirectoryIterator(DirectoryIterator *iterator);  // Unload directory iterator
 RLAPI bool IsFileDropped(void);                                   // Check if a file has been dropped into window
 RLAPI FilePathList LoadDroppedFiles(void);                        // Load dropped filepaths
 RLAPI void UnloadDroppedFiles(FilePathList files);                // Unload dropped filepaths
 RLAPI long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
 
+// Assets archive functions
+RLAPI bool MountArchive(const char *fileName);                    // Mount assets archive (.rpak), files loaded from archive instead of file system
+RLAPI void UnmountArchive(const char *fileName);                  // Unmount assets archive, files data loaded without copy not valid anymore
+RLAPI bool IsFileInArchive(const char *fileName);                 // Check if file is available in a mounted assets archive
+RLAPI const unsigned char *GetArchiveFileData(const char *fileName, unsigned int *dataSize); // Get file data from mounted assets archive without copy, NULL if not available or compressed
+RLAPI bool ExportArchive(FilePathList files, const char *fileName, bool compress); // Export files into an assets archive (.rpak), returns true on success
+
+// Assets asynchronous loading functions
+RLAPI int LoadAssetAsync(const char *fileName, int type);         // Load asset asynchronously (AssetType), returns asset handle (-1 on failure)
+RLAPI int GetAssetState(int asset);                               // Get asset loading state (AssetState)
+RLAPI Image GetAssetImage(int asset);                             // Get asset image (ASSET_IMAGE), available once loaded
+RLAPI Texture2D GetAssetTexture(int asset);                       // Get asset texture (ASSET_TEXTURE), valid for drawing once ready
+RLAPI Font GetAssetFont(int asset);                               // Get asset font (ASSET_FONT), valid for drawing once ready
+RLAPI Model GetAssetModel(int asset);                             // Get asset model (ASSET_MODEL), valid for drawing once ready
+RLAPI Wave GetAssetWave(int asset);                               // Get asset wave (ASSET_WAVE), available once loaded
+RLAPI void ReleaseAsset(int asset, bool unloadData);              // Release asset handle, asset data unloaded or kept (owned by user, only if ready)
+RLAPI void SetAssetUploadBudget(float milliseconds);              // Set assets GPU upload time per frame (default: 2 ms)
+RLAPI int GetAssetUploadCount(void);                              // Get assets waiting GPU upload count
+RLAPI void ProcessAssetUploads(void);                             // Process assets waiting GPU upload, time budgeted (called by EndDrawing())
+
+// Files changes watching and assets hot-reloading functions
+RLAPI bool WatchFile(const char *path);                           // Watch file or directory changes (directory: files in it, not recursive)
+RLAPI void UnwatchFile(const char *path);                         // Stop watching file or directory changes
+RLAPI FilePathList LoadChangedFiles(void);                        // Load files changed since last call (every file changed only once)
+RLAPI void UnloadChangedFiles(FilePathList files);                // Unload files changed paths
+RLAPI void SetTextureHotReload(Texture2D *texture, const char *fileName);    // Set texture reloaded in place on file changes (file watched)
+RLAPI void SetShaderHotReload(Shader *shader, const char *vsFileName, const char *fsFileName);   // Set shader reloaded in place on files changes (files watched)
+RLAPI void SetModelHotReload(Model *model, const char *fileName); // Set model reloaded in place on file changes (file watched)
+RLAPI void ClearHotReload(const void *asset);                     // Clear asset hot-reloading (texture, shader or model)
+RLAPI int ReloadChangedAssets(FilePathList files);                // Reload assets of files changed, returns assets reloaded count
+
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI bool CompressDataStream(DataReadCallback read, DataWriteCallback write, void *userData);      // Compress data stream (DEFLATE algorithm), data read and written in chunks
+RLAPI bool DecompressDataStream(DataReadCallback read, DataWriteCallback write, void *userData);    // Decompress data stream (DEFLATE algorithm, zlib or gzip wrapped), data read and written in chunks
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 
@@ -1326,6 +1483,14 @@ RLAPI void UnloadRenderTexture(RenderTexture2D target);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Texture atlas functions
+// NOTE: Sprites are drawn with texture drawing functions: DrawTextureRec(sprite.texture, sprite.source, ...)
+RLAPI TextureAtlas LoadTextureAtlas(int width, int height, int padding);                                  // Load texture atlas, pages of defined size are created as required
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas pages from GPU memory (VRAM)
+RLAPI AtlasSprite LoadAtlasSprite(TextureAtlas *atlas, const char *fileName);                            // Load sprite from file into texture atlas
+RLAPI AtlasSprite LoadAtlasSpriteFromImage(TextureAtlas *atlas, Image image);                            // Load sprite from image data into texture atlas
+RLAPI void UnloadAtlasSprite(TextureAtlas *atlas, AtlasSprite sprite);                                   // Unload sprite from texture atlas, space is reused by next sprites
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -1475,6 +1640,12 @@ RLAPI bool ExportMesh(Mesh mesh, const char *fileName);
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
 
+// Mesh list management functions
+RLAPI MeshList LoadMeshList(const Mesh *meshes, int meshCount);                            // Load mesh list, meshes sharing vertex format packed in shared vertex buffers
+RLAPI void UnloadMeshList(MeshList list);                                                   // Unload mesh list from CPU and GPU
+RLAPI void UpdateMeshListTransforms(MeshList list, const Matrix *transforms, int offset, int count); // Update mesh list meshes transforms
+RLAPI void DrawMeshList(MeshList list, Material material);                                  // Draw all mesh list meshes with material and meshes transforms
+
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
 RLAPI Mesh GenMeshPlane(float width, float length, int resX, int resZ);                     // Generate plane mesh (with subdivisions)
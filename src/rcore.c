@@ -68,6 +68,10 @@
 *   #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 *       Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
 *
+*   #define SUPPORT_ADAPTIVE_WAIT_LOOP
+*       Use an adaptive wait loop, frame sleeps for the time measured as reliable (sleep overshoot estimate)
+*       and runs a busy-wait-loop only for the rest, it takes precedence over SUPPORT_PARTIALBUSY_WAIT_LOOP
+*
 *   #define SUPPORT_EVENTS_WAITING
 *       Wait for events passively (sleeping while no events) instead of polling them actively every frame
 *
@@ -75,13 +79,29 @@
 *       Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
 *   #define SUPPORT_GIF_RECORDING
-*       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback(),
+*       screen recording also available with StartScreenRecording(), as gif or frames sequence (.qoi, .raw)
+*
+*   #define SUPPORT_GIF_RECORDING_THREAD
+*       Encode recording frames in a worker thread instead of main thread, requires POSIX threads (pthreads)
 *
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
 *       provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
 *       for linkage
 *
+*   #define SUPPORT_ASSETS_ARCHIVE
+*       Support packed assets archives (.rpak) mounted with MountArchive(), LoadFileData() loads files from mounted
+*       archives (memory mapped if supported) before file system, uncompressed files are not copied (zero-copy)
+*
+*   #define SUPPORT_ASYNC_LOADING
+*       Support assets loading in background threads with LoadAssetAsync(), files reading and decoding done by
+*       loading threads (pthreads), GPU upload done on main thread at EndDrawing(), time budgeted
+*
+*   #define SUPPORT_FILE_WATCHER
+*       Support files changes watching with WatchFile() and assets hot-reloading (textures, shaders, models),
+*       changes notified by inotify on Linux, files modification times polled on other platforms
+*
 *   #define SUPPORT_EVENTS_AUTOMATION
 *       Support automatic generated events, loading and recording of those events when required
 *
@@ -145,11 +165,24 @@
 
     #define MSF_GIF_IMPL
     #include "external/msf_gif.h"   // GIF recording functionality
+
+    // NOTE: POSIX threads not available (or not linked by default) on Windows and Web
+    #if defined(SUPPORT_GIF_RECORDING_THREAD) && (defined(_WIN32) || defined(PLATFORM_WEB))
+        #undef SUPPORT_GIF_RECORDING_THREAD
+    #endif
+    #if defined(SUPPORT_GIF_RECORDING_THREAD)
+        #include <pthread.h>        // POSIX threads management (recording frames encoding)
+    #endif
+    #if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+        #include "external/qoi.h"   // QOI frames sequence recording, implementation in rtextures module
+    #endif
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
     #define SINFL_IMPLEMENTATION
     #define SINFL_NO_SIMD
+    #define SINFL_REALLOC RL_REALLOC
+    #define SINFL_FREE RL_FREE
     #include "external/sinfl.h"     // Deflate (RFC 1951) decompressor
 
     #define SDEFL_IMPLEMENTATION
@@ -193,6 +226,9 @@
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+    #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #if defined(PLATFORM_DESKTOP) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
@@ -214,6 +250,49 @@
     #define CHDIR chdir
 #endif
 
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    #if defined(_WIN32)
+        // NOTE: File mapping functions declared to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        #define ARCHIVE_MEMORY_MAPPING
+    #elif (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+        #include <sys/mman.h>       // Required for: mmap(), munmap() [Used in MountArchive()]
+        #include <fcntl.h>          // Required for: open() [Used in MountArchive()]
+        #define ARCHIVE_MEMORY_MAPPING
+    #endif
+#endif
+
+#if defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+    // NOTE: POSIX threads not available (or not linked by default) on Windows and Web
+    #if defined(_WIN32) || defined(PLATFORM_WEB)
+        #undef SUPPORT_PARALLEL_DIRECTORY_SCAN
+    #else
+        #include <pthread.h>        // POSIX threads management (directories scanning)
+    #endif
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    // NOTE: POSIX threads not available (or not linked by default) on Windows and Web,
+    // assets are loaded on main thread in that case, at EndDrawing(), time budgeted
+    #if !defined(_WIN32) && !defined(PLATFORM_WEB)
+        #include <pthread.h>        // POSIX threads management (assets loading)
+        #define ASYNC_LOADING_THREADED
+    #endif
+#endif
+
+#if defined(SUPPORT_FILE_WATCHER)
+    // NOTE: Files changes notified by inotify on Linux, files modification times polled otherwise
+    #if defined(__linux__) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+        #include <sys/inotify.h>    // Required for: inotify_init1(), inotify_add_watch(), inotify_rm_watch()
+        #define FILE_WATCH_INOTIFY
+    #endif
+#endif
+
 #if defined(PLATFORM_DESKTOP)
     #define GLFW_INCLUDE_NONE       // Disable the standard OpenGL header inclusion on GLFW3
                                     // NOTE: Already provided by rlgl implementation (on glad.h)
@@ -323,12 +402,21 @@
     #define DEFAULT_EVDEV_PATH       "/dev/input/"  // Path to the linux input events
 #endif
 
-#ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
-#endif
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH         4096        // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
+#ifndef MAX_WATCHED_FILES
+    #define MAX_WATCHED_FILES             64        // Maximum number of files and directories watched (WatchFile())
+#endif
+#ifndef MAX_HOT_RELOAD_ASSETS
+    #define MAX_HOT_RELOAD_ASSETS         64        // Maximum number of assets hot-reloaded on files changes
+#endif
+#ifndef FILE_WATCH_POLL_INTERVAL
+    #define FILE_WATCH_POLL_INTERVAL     0.5        // Files changes polling interval in seconds (no system notifications)
+#endif
+#ifndef DIRECTORY_SCAN_THREADS
+    #define DIRECTORY_SCAN_THREADS         4        // Directories scanning threads on recursive scan (SUPPORT_PARALLEL_DIRECTORY_SCAN)
+#endif
 
 #ifndef MAX_KEYBOARD_KEYS
     #define MAX_KEYBOARD_KEYS            512        // Maximum number of keyboard keys supported
@@ -355,8 +443,47 @@
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
 
-#ifndef MAX_DECOMPRESSION_SIZE
-    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
+#ifndef COMPRESSION_STREAM_CHUNK_SIZE
+    #define COMPRESSION_STREAM_CHUNK_SIZE 16384     // Input data chunk size read by streaming decompression (DecompressDataStream()), in bytes
+#endif
+#ifndef MAX_ASYNC_SHADERS
+    #define MAX_ASYNC_SHADERS             64        // Maximum number of shaders loading asynchronously (LoadShaderAsync())
+#endif
+#ifndef MAX_MOUNTED_ARCHIVES
+    #define MAX_MOUNTED_ARCHIVES           4        // Maximum number of assets archives mounted at the same time (MountArchive())
+#endif
+#ifndef MAX_ASYNC_ASSETS
+    #define MAX_ASYNC_ASSETS              64        // Maximum number of assets loading asynchronously (LoadAssetAsync())
+#endif
+#ifndef ASYNC_LOADING_THREADS
+    #define ASYNC_LOADING_THREADS          2        // Assets loading threads
+#endif
+#ifndef ASYNC_UPLOAD_BUDGET
+    #define ASYNC_UPLOAD_BUDGET          2.0        // Default assets GPU upload time per frame, in milliseconds (SetAssetUploadBudget())
+#endif
+#ifndef MAX_MATERIAL_MAPS
+    #define MAX_MATERIAL_MAPS             12        // Maximum number of shader maps supported
+#endif
+#define ASYNC_TEXTURE_DEFERRED    0x80000000        // Placeholder texture id flag, texture upload deferred (id bits: deferred texture index)
+
+#ifndef FIXED_UPDATE_MAX_STEPS
+    #define FIXED_UPDATE_MAX_STEPS         5        // Default fixed update steps limit per frame, catch-up limit (SetFixedUpdateMaxSteps())
+#endif
+#ifndef AUTOMATION_INDEX_FRAMES
+    #define AUTOMATION_INDEX_FRAMES       60        // Automation events file frames indexed (key frame block) every frames, seek granularity
+#endif
+#ifndef FRAME_TIME_HISTORY
+    #define FRAME_TIME_HISTORY            60        // Frames time measures kept for frame jitter statistics
+#endif
+
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // Screen recording default rate, game frames per recorded frame (SetScreenRecordingRate())
+#endif
+#ifndef GIF_READBACK_BUFFERS
+    #define GIF_READBACK_BUFFERS           3        // Screen recording, readback pixel buffers (asynchronous readback)
+#endif
+#ifndef GIF_ENCODER_FRAMES
+    #define GIF_ENCODER_FRAMES             4        // Screen recording, frames queued for encoding (encoder thread)
 #endif
 
 // Flags operation macros
@@ -365,6 +492,8 @@
 #define FLAG_TOGGLE(n, f) ((n) ^= (f))
 #define FLAG_CHECK(n, f) ((n) & (f))
 
+#define ARCHIVE_DATA_ALIGNMENT           64        // Assets archive entries data alignment (in bytes), zero-copy data views aligned
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -383,6 +512,152 @@ typedef struct {
 } InputEventWorker;
 #endif
 
+#if defined(SUPPORT_COMPRESSION_API)
+// Data streaming callbacks, called by decompressor streaming callbacks
+typedef struct DataStreamCallbacks {
+    DataReadCallback read;          // Input data read callback
+    DataWriteCallback write;        // Output data write callback
+    void *userData;                 // Callbacks user data
+} DataStreamCallbacks;
+#endif
+
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+// Assets archive file header (.rpak)
+// NOTE: Header followed by entries index, entries paths ('\0' terminated) and entries data (aligned)
+typedef struct ArchiveHeader {
+    char id[4];                     // Archive file identifier: "rPAK"
+    unsigned int version;           // Archive format version: 100
+    unsigned int entryCount;        // Archive entries count
+    unsigned int pathsSize;         // Entries paths size (in bytes)
+} ArchiveHeader;
+
+// Assets archive entry, entries index sorted by path hash
+typedef struct ArchiveEntry {
+    unsigned int hash;              // Entry path hash (FNV-1a)
+    unsigned int pathOffset;        // Entry path offset into paths
+    unsigned long long offset;      // Entry data offset from archive start (ARCHIVE_DATA_ALIGNMENT aligned)
+    unsigned int size;              // Entry data size stored in archive (in bytes)
+    unsigned int dataSize;          // Entry data size once decompressed (in bytes)
+    unsigned int compression;       // Entry data compression: 0-None, 1-DEFLATE
+    unsigned int reserved;          // Reserved for future use
+} ArchiveEntry;
+
+// Assets archive mounted
+typedef struct Archive {
+    char fileName[MAX_FILEPATH_LENGTH];     // Archive file name
+    unsigned char *data;            // Archive data, memory mapped or loaded
+    unsigned long long size;        // Archive data size
+    bool mapped;                    // Archive data memory mapped (loaded otherwise)
+    const ArchiveEntry *entries;    // Archive entries index
+    const char *paths;              // Archive entries paths
+    unsigned int entryCount;        // Archive entries count
+} Archive;
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Asset loading asynchronously
+// NOTE: Textures and meshes loaded in a loading thread are not uploaded to GPU, textures images are kept
+// (placeholder texture ids) and meshes not uploaded (vboId not allocated) until uploaded on main thread
+typedef struct AsyncAsset {
+    int state;                      // Asset loading state (AssetState), ASSET_STATE_INVALID if slot available
+    int type;                       // Asset type (AssetType)
+    int generation;                 // Slot reuse counter, asset handle includes it to detect released handles
+    bool released;                  // Asset released while queued or loading, data unloaded once loaded
+    unsigned int order;             // Asset loading finish order, GPU uploads done in order
+    char *fileName;                 // Asset file name
+
+    Image image;                    // Asset data: ASSET_IMAGE
+    Texture2D texture;              // Asset data: ASSET_TEXTURE
+    Font font;                      // Asset data: ASSET_FONT
+    Model model;                    // Asset data: ASSET_MODEL
+    Wave wave;                      // Asset data: ASSET_WAVE
+
+    Image *images;                  // Deferred textures images, waiting GPU upload
+    unsigned int *textureIds;       // Deferred textures ids, once uploaded
+    int imageCount;                 // Deferred textures count
+    int imageCapacity;              // Deferred textures capacity
+    int uploadCounter;              // GPU uploads done: deferred textures first, then model meshes
+} AsyncAsset;
+#endif
+
+// Paths list, paths stored in a single growable strings arena
+typedef struct PathArena {
+    char *data;                     // Paths data, '\0' terminated strings
+    unsigned int size;              // Paths data size
+    unsigned int capacity;          // Paths data size allocated
+    unsigned int *offsets;          // Paths offsets into data
+    unsigned int count;             // Paths count
+    unsigned int offsetCapacity;    // Paths offsets allocated
+} PathArena;
+
+// Directory iterator, subdirectories scanned depth-first, one directory open per depth level
+struct DirectoryIterator {
+    DIR **dirs;                     // Directories open, one per depth level
+    unsigned int *pathLengths;      // Directories path length, one per depth level
+    int depth;                      // Current depth level, -1 once all entries read
+    int depthCapacity;              // Depth levels allocated
+    char *path;                     // Current entry path
+    unsigned int pathCapacity;      // Current entry path size allocated
+    char *filter;                   // Extensions filter, NULL for all entries
+    bool scanSubdirs;               // Subdirectories scanned, only files read
+};
+
+#if defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+// Directories parallel scan, directories found are queued and scanned by any thread
+typedef struct DirectoryScan {
+    PathArena dirs;                 // Directories found, scanned in order
+    unsigned int next;              // Next directory to scan
+    int busy;                       // Threads scanning a directory (more directories can be found)
+    const char *filter;             // Extensions filter, NULL for all files
+    pthread_mutex_t mutex;          // Directories access mutex
+    pthread_cond_t cond;            // Directories changes condition (directory found or scanned)
+} DirectoryScan;
+
+// Directories parallel scan thread data
+typedef struct DirectoryScanWorker {
+    DirectoryScan *scan;            // Directories parallel scan
+    PathArena files;                // Files found by thread
+} DirectoryScanWorker;
+#endif
+
+#if defined(SUPPORT_FILE_WATCHER)
+// File watched in a directory, modification time polled
+typedef struct WatchedDirFile {
+    unsigned int hash;              // File name hash (FNV-1a)
+    long modTime;                   // File modification time
+} WatchedDirFile;
+
+// File or directory watched
+// NOTE: On inotify, files are watched through parent directory, files replaced on save (renamed) still watched
+typedef struct WatchedFile {
+    char *path;                     // File or directory path, NULL if slot available
+    bool isDirectory;               // Directory watched, changes of files in it notified (not recursive)
+#if defined(FILE_WATCH_INOTIFY)
+    int wd;                         // Watch descriptor, parent directory watch for files
+    const char *name;               // File name (in path), NULL for directories
+#else
+    long modTime;                   // File modification time
+    WatchedDirFile *files;          // Directory files modification times, sorted by name hash
+    unsigned int fileCount;         // Directory files count
+#endif
+} WatchedFile;
+
+// Hot-reload asset type
+typedef enum {
+    HOT_RELOAD_TEXTURE = 0,
+    HOT_RELOAD_SHADER,
+    HOT_RELOAD_MODEL
+} HotReloadType;
+
+// Asset hot-reloaded on files changes, asset reloaded in place (user variable)
+typedef struct HotReloadAsset {
+    int type;                       // Asset type (HotReloadType)
+    void *asset;                    // Asset reloaded: Texture2D *, Shader *, Model *; NULL if slot available
+    char *fileName;                 // Asset file name, vertex shader file name for shaders (can be NULL)
+    char *fsFileName;               // Fragment shader file name (can be NULL)
+} HotReloadAsset;
+#endif
+
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
@@ -523,11 +798,27 @@ typedef struct CoreData {
         double update;                      // Time measure for frame update
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
+        double wait;                        // Time measure for frame wait (target frame time)
         double target;                      // Desired time for one frame, if 0 not applied
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
         unsigned long long base;            // Base time measure for hi-res timer
 #endif
         unsigned int frameCounter;          // Frame counter
+        FrameStats stats;                   // Last frame statistics (rendering work and timing)
+
+        double fixed;                       // Fixed update time step, if 0 not applied
+        double refresh;                     // Display refresh time, frame time snapped to its multiples (fixed update)
+        double accumulator;                 // Fixed update time accumulated, not consumed by steps yet
+        double boundary;                    // Time measure at last frame boundary (PollInputEvents())
+        int fixedSteps;                     // Fixed update steps to run for current frame
+        int fixedMaxSteps;                  // Fixed update steps limit per frame (catch-up limit)
+        float history[FRAME_TIME_HISTORY];  // Last frames time measures, for jitter statistics
+        int historyIndex;                   // Next frame time measure index
+        int historyCount;                   // Frame time measures available (up to FRAME_TIME_HISTORY)
+
+        double overshootMean;               // Sleep overshoot mean (adaptive wait loop)
+        double overshootDeviation;          // Sleep overshoot mean deviation (adaptive wait loop)
+        PacingStats pacing;                 // Frame pacing statistics, WaitTime() accuracy
     } Time;
 } CoreData;
 
@@ -546,15 +837,113 @@ static int screenshotCounter = 0;           // Screenshots counter
 static int gifFrameCounter = 0;             // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
+
+// Screen recording frames readbacks, pixel buffers read asynchronously and retrieved some frames later
+// NOTE: If pixel buffers not supported (OpenGL ES 2.0), screen pixels are read synchronously
+static struct {
+    unsigned int id;                // Readback pixel buffer id (0 if not supported)
+    int frame;                      // Frame readback was issued (gifFrameCounter)
+    bool pending;                   // Readback issued and pixels not retrieved yet
+} recordingReadbacks[GIF_READBACK_BUFFERS] = { 0 };
+static int recordingReadbackIndex = 0;            // Next readback to issue (oldest one)
+
+// Screen recording file formats
+typedef enum {
+    RECORDING_GIF = 0,              // Animated gif (msf_gif)
+    RECORDING_QOI,                  // Frames sequence, one QOI image per frame (lossless)
+    RECORDING_RAW                   // Frames sequence, one uncompressed RGBA file per frame
+} RecordingFormat;
+
+// Screen recording frames encoder, frames data queued into a pool of buffers and encoded in order
+static struct {
+    unsigned char *data[GIF_ENCODER_FRAMES];    // Frames pixels data buffers (RGBA)
+    int pitch[GIF_ENCODER_FRAMES];              // Frames pitch in bytes, negative if rows are bottom to top
+    int width;                      // Frames width
+    int height;                     // Frames height
+    int first;                      // First queued frame
+    int count;                      // Queued frames count
+    int format;                     // Recording file format (RecordingFormat)
+    int delay;                      // GIF frames delay in centiseconds
+    int frameCounter;               // Frames sequence files counter
+    char fileName[MAX_FILEPATH_LENGTH]; // Recording file name (frames sequence files named after it)
+    char *fileExt;                  // Recording file extension (pointer into fileName)
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+    bool threaded;                  // Encoder thread running
+    bool closing;                   // Encoder thread requested to finish, once queue is empty
+    pthread_t threadId;             // Encoder thread id
+    pthread_mutex_t mutex;          // Queue access mutex
+    pthread_cond_t cond;            // Queue changes condition (frame queued or encoded)
+#endif
+} recordingEncoder = { 0 };
+static int recordingRate = GIF_RECORD_FRAMERATE;    // Screen recording rate, one frame recorded every recordingRate frames
+#endif
+
+#if defined(SUPPORT_SHADER_CACHE)
+static char shaderCacheDirectory[MAX_FILEPATH_LENGTH] = { 0 };  // Shader binaries cache directory, cache disabled if empty
+#endif
+
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+static Archive archives[MAX_MOUNTED_ARCHIVES] = { 0 };  // Assets archives mounted, files loaded from them instead of file system
+static int archiveCount = 0;                            // Assets archives mounted count
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Assets loading asynchronously, assets loaded by loading threads in queue order
+static struct {
+    AsyncAsset assets[MAX_ASYNC_ASSETS];    // Assets slots, asset handle: slot index + generation*MAX_ASYNC_ASSETS
+    int queue[MAX_ASYNC_ASSETS];    // Assets waiting loading (slots indices, ring buffer)
+    int first;                      // First queued asset
+    int count;                      // Queued assets count
+    int uploadCount;                // Assets waiting GPU upload (ASSET_STATE_UPLOADING)
+    unsigned int orderCounter;      // Assets loading finish counter
+    bool started;                   // Loading threads started (on first asset loading)
+    bool closing;                   // Loading threads requested to finish
+    int threadCount;                // Loading threads running, assets loaded on main thread if none
+#if defined(ASYNC_LOADING_THREADED)
+    pthread_t threadId[ASYNC_LOADING_THREADS];  // Loading threads ids
+#endif
+} assetLoader = { 0 };
+static double assetUploadBudget = ASYNC_UPLOAD_BUDGET/1000.0;   // Assets GPU upload time per frame (seconds)
+static RL_THREAD_LOCAL AsyncAsset *loadingAsset = NULL;         // Asset loading in current thread, GPU work deferred
+
+#if defined(ASYNC_LOADING_THREADED)
+static pthread_mutex_t assetMutex = PTHREAD_MUTEX_INITIALIZER;  // Assets state and queue access mutex
+static pthread_cond_t assetCond = PTHREAD_COND_INITIALIZER;     // Queue changes condition (asset queued or closing)
+    #define LOCK_ASSETS() pthread_mutex_lock(&assetMutex)
+    #define UNLOCK_ASSETS() pthread_mutex_unlock(&assetMutex)
+#else
+    #define LOCK_ASSETS() (void)0
+    #define UNLOCK_ASSETS() (void)0
+#endif
+#endif
+
+#if defined(SUPPORT_FILE_WATCHER)
+// Files changes watching, changes notified (or polled) collected until loaded by LoadChangedFiles()
+static struct {
+    WatchedFile files[MAX_WATCHED_FILES];   // Files and directories watched
+    HotReloadAsset assets[MAX_HOT_RELOAD_ASSETS];   // Assets hot-reloaded
+    PathArena changes;              // Files changed, not yet loaded
+#if defined(FILE_WATCH_INOTIFY)
+    int fd;                         // inotify instance file descriptor
+    bool initialized;               // inotify instance initialized (on first file watched)
+#else
+    double pollTime;                // Last files changes polling time
 #endif
+} fileWatcher = { 0 };
+#endif
+
+// Shaders loading asynchronously, checked by IsShaderReady()
+static struct {
+    unsigned int id;                // Shader program id (0 if slot available)
+    bool failed;                    // Shader program compilation failed
+    unsigned long long codeHash;    // Shader code hash to store program binary into cache once ready (0 if not cached)
+} asyncShaders[MAX_ASYNC_SHADERS] = { 0 };
 
 #if defined(PLATFORM_NX)
     s32 prev_touchcount = 0;
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-#define MAX_CODE_AUTOMATION_EVENTS      16384
-
 typedef enum AutomationEventType {
     EVENT_NONE = 0,
     // Input events
@@ -631,8 +1020,29 @@ typedef struct AutomationEvent {
     int params[3];                      // Event parameters (if required)
 } AutomationEvent;
 
-static AutomationEvent *events = NULL;        // Events array
-static unsigned int eventCount = 0;     // Events count
+// Automation events file frames index entry, key frame block position
+typedef struct AutomationFrameIndex {
+    unsigned int frame;                 // Key frame block frame (relative to recording start)
+    unsigned int offset;                // Key frame block events count position in file (after block frames)
+} AutomationFrameIndex;
+
+// Automation events recording/playing state, events streamed from/to file
+static struct {
+    FILE *file;                         // Automation events file (recording or playing)
+    unsigned int baseFrame;             // Frame counter at recording/playing start, events frames are relative to it
+    unsigned int blockFrame;            // Last frame block written (recording) or next frame block to read (playing)
+    unsigned int eventCount;            // Events recorded/played
+    int lastParams[ACTION_SETTARGETFPS + 1][3]; // Last event params by type, for params delta encoding
+    AutomationEvent *frameEvents;       // Current frame events (recording)
+    unsigned int frameEventCount;       // Current frame events count
+    unsigned int frameEventCapacity;    // Current frame events capacity
+    AutomationFrameIndex *index;        // Frames index, key frame blocks (seek)
+    unsigned int indexCount;            // Frames index entries count
+    unsigned int indexCapacity;         // Frames index entries capacity (recording)
+    unsigned int dataEnd;               // Frame blocks end position in file (playing), 0 if end of file
+    unsigned int version;               // Automation events file version (playing)
+} automation = { 0 };
+
 static bool eventsPlaying = false;      // Play events
 static bool eventsRecording = false;    // Record events
 
@@ -647,6 +1057,12 @@ static bool eventsRecording = false;    // Record events
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RMODELS) && (defined(SUPPORT_ASYNC_LOADING) || defined(SUPPORT_FILE_WATCHER))
+extern Model LoadModelFile(const char *fileName, bool defaultMesh);    // [Module: models] Load model from file, no default mesh on failure (async loading, hot-reloading)
+#endif
+#if defined(SUPPORT_PROFILER)
+extern void CloseProfiler(void);            // [Module: utils] Unload profiler threads recorded data
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -655,9 +1071,55 @@ static void InitTimer(void);                            // Initialize timer (hi-
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
-
-static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static void UpdateFrameBoundary(void);                  // Update frame boundary timing: fixed update steps and jitter statistics
+#if defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+static void UpdateSleepOvershoot(double overshoot);     // Update sleep overshoot estimate with a new measure
+#endif
+
+static bool IsDirectoryEntryDir(const struct dirent *dp, const char *path);  // Check if directory entry is a directory, no stat() required if entry type available
+static void ReservePathCapacity(char **path, unsigned int *capacity, unsigned int size);   // Reserve path buffer capacity, buffer reallocated if required
+static void AddArenaPath(PathArena *arena, const char *path, unsigned int length);  // Add path to paths arena
+static FilePathList LoadArenaFilePathList(PathArena *arena);    // Load file paths list from paths arena (arena memory reused)
+#if defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+static FilePathList LoadDirectoryFilesParallel(const char *basePath, const char *filter);   // Load directory files recursively, directories scanned in parallel threads
+static void *ScanDirectoryThread(void *arg);                // Scan directories queued (thread)
+#endif
+
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+static unsigned int GetArchivePath(const char *fileName, char *path);                       // Get archive entry path (normalized) and path hash
+static const ArchiveEntry *FindArchiveEntry(const char *fileName, const Archive **archive);  // Find file entry in mounted assets archives
+static void UnloadArchiveData(Archive *archive);                                            // Unload archive data, memory mapped or loaded
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static AsyncAsset *GetAsyncAsset(int asset);                // Get asset from handle, NULL if not valid or released
+static bool IsAsyncAssetLoaded(AsyncAsset *asset, int type);    // Check if asset data is loaded (CPU data, GPU upload not required)
+static bool LoadAsyncAssetData(AsyncAsset *asset);          // Load asset data (CPU), textures and meshes GPU upload deferred
+static void FinishAsyncAssetLoading(AsyncAsset *asset, bool success);   // Finish asset loading, waiting GPU upload if required
+static bool UploadAsyncAssetData(AsyncAsset *asset);        // Upload next asset texture or mesh to GPU, returns true once all uploaded
+static void UnloadAsyncAssetData(AsyncAsset *asset);        // Unload asset data, only uploaded data unloaded from GPU
+static void FreeAsyncAsset(AsyncAsset *asset);              // Free asset slot, asset handle not valid anymore
+static unsigned int AddDeferredTexture(AsyncAsset *asset, Image image); // Add deferred texture image (owned by asset), returns placeholder texture id
+static unsigned int GetDeferredTextureId(AsyncAsset *asset, unsigned int id);  // Get uploaded texture id from placeholder texture id
+static void CloseAssetLoading(void);                        // Close assets loading, loading threads finished and assets unloaded
+#if defined(ASYNC_LOADING_THREADED)
+static void *AssetLoadingThread(void *arg);                 // Load assets queued (thread)
+#endif
+#endif
+#if defined(SUPPORT_FILE_WATCHER)
+static WatchedFile *GetWatchedFile(const char *path);       // Get watched file or directory, NULL if not watched
+static void AddChangedFile(const char *path);               // Add file changed, not added if already changed
+static void ReadFileChanges(void);                          // Read files changes notified (inotify) or poll files modification times
+#if !defined(FILE_WATCH_INOTIFY)
+static void ScanWatchedDirectory(WatchedFile *watch, bool notify);  // Scan watched directory files modification times, changed files added
+#endif
+static HotReloadAsset *AddHotReloadAsset(void *asset, int type, const char *fileName, const char *fsFileName);  // Add asset hot-reloaded, files watched
+static bool ReloadHotReloadAsset(HotReloadAsset *asset);    // Reload asset from files, asset replaced in place
+static void CloseFileWatcher(void);                         // Close files watching, watches and hot-reload assets unloaded
+#endif
+#if defined(SUPPORT_COMPRESSION_API)
+static int ReadInflateStream(unsigned char *buffer, int size, void *userData);          // Read data chunk for streaming decompression (user callback)
+static int WriteInflateStream(const unsigned char *data, int size, void *userData);     // Write data chunk for streaming decompression (user callback)
+#endif
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
@@ -717,10 +1179,27 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 #endif  // PLATFORM_RPI || PLATFORM_DRM
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-static void LoadAutomationEvents(const char *fileName);     // Load automation events from file
-static void ExportAutomationEvents(const char *fileName);   // Export recorded automation events into a file
-static void RecordAutomationEvent(unsigned int frame);      // Record frame events (to internal events array)
-static void PlayAutomationEvent(unsigned int frame);        // Play frame events (from internal events array)
+static void WriteAutomationVarint(unsigned int value);      // Write unsigned value into automation events file (varint)
+static bool ReadAutomationVarint(unsigned int *value);      // Read unsigned value from automation events file (varint)
+static bool ReadAutomationBlockFrames(unsigned int *frames);    // Read frame block frames from automation events file, false at frame blocks end
+static bool ReadAutomationBlockCount(unsigned int *count);      // Read frame block events count from automation events file, key frame block reset
+static bool ReadAutomationEvent(int *type, int *params);    // Read event from automation events file, params decoded and checked
+static void RecordAutomationEvent(unsigned int frame);      // Record frame events (written into file)
+static void PlayAutomationEvent(unsigned int frame);        // Play frame events (read from file)
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void UpdateScreenRecording(void);                    // Update screen recording, screen frames readback
+static void ReadRecordingFrame(int index);                  // Retrieve recording frame readback pixels and queue them for encoding
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+static void *RecordingEncoderThread(void *arg);             // Encode recording frames queued (thread)
+#endif
+#endif
+
+static void SetShaderLocationsDefault(Shader shader);   // Set shader default locations (attributes and uniforms)
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned int LoadShaderCache(const char *vsCode, const char *fsCode, unsigned long long *codeHash);  // Load shader program from cache binary (0 if not cached)
+static void SaveShaderCache(unsigned int id, unsigned long long codeHash);  // Save shader program binary into cache
 #endif
 
 #if defined(_WIN32)
@@ -969,7 +1448,6 @@ void InitWindow(int width, int height, const char *title)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    events = (AutomationEvent *)malloc(MAX_CODE_AUTOMATION_EVENTS*sizeof(AutomationEvent));
     CORE.Time.frameCounter = 0;
 #endif
 
@@ -980,12 +1458,15 @@ void InitWindow(int width, int height, const char *title)
 void CloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (gifRecording) StopScreenRecording();
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    CloseAssetLoading();        // Finish loading threads, unload assets not released
+#endif
+
+#if defined(SUPPORT_FILE_WATCHER)
+    CloseFileWatcher();         // Remove files watches, assets hot-reloaded not unloaded (owned by user)
 #endif
 
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
@@ -1117,7 +1598,15 @@ void CloseWindow(void)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    free(events);
+    StopAutomationEventRecording();
+    StopAutomationEventPlaying();
+    RL_FREE(automation.frameEvents);
+    automation.frameEvents = NULL;
+    automation.frameEventCapacity = 0;
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    CloseProfiler();            // Unload profiler threads recorded zones
 #endif
 
     CORE.Window.ready = false;
@@ -1972,6 +2461,9 @@ int GetMonitorRefreshRate(int monitor)
     {
         return CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh;
     }
+#endif
+#if defined(PLATFORM_NX)
+    return 60;      // Nintendo Switch display refresh rate, handheld and docked
 #endif
     return 0;
 }
@@ -2159,6 +2651,8 @@ void ClearBackground(Color color)
 // Setup canvas (framebuffer) to start drawing
 void BeginDrawing(void)
 {
+    PROFILE_ZONE_BEGIN("BeginDrawing");
+
     // WARNING: Previously to BeginDrawing() other render textures drawing could happen,
     // consequently the measure for update vs draw is not accurate (only the total frame time is accurate)
 
@@ -2171,31 +2665,22 @@ void BeginDrawing(void)
 
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
+
+    PROFILE_ZONE_END();
 }
 
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    PROFILE_ZONE_BEGIN("EndDrawing");
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
     {
-        #define GIF_RECORD_FRAMERATE    10
-        gifFrameCounter++;
-
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
-
-            RL_FREE(screenData);    // Free image data
-        }
+        UpdateScreenRecording();       // Get current frame from backbuffer (before drawing record indicator)
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -2237,6 +2722,10 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_LOADING)
+    ProcessAssetUploads();          // Upload assets loaded asynchronously to GPU, time budgeted
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -2246,6 +2735,7 @@ void EndDrawing(void)
     CORE.Time.previous = CORE.Time.current;
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
+    CORE.Time.wait = 0.0;
 
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
@@ -2257,23 +2747,39 @@ void EndDrawing(void)
         CORE.Time.previous = CORE.Time.current;
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        CORE.Time.wait = waitTime;
     }
 
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
+    // Store frame statistics, render statistics are reset for next frame
+    // NOTE: On custom frame control, draw and wait times are not measured (user frame timing)
+    rlRenderStats renderStats = rlGetRenderStats();
+    CORE.Time.stats.drawCalls = renderStats.drawCalls;
+    CORE.Time.stats.vertexCount = renderStats.vertexCount;
+    CORE.Time.stats.batchFlushes = renderStats.batchFlushes;
+    CORE.Time.stats.textureBinds = renderStats.textureBinds;
+    CORE.Time.stats.bytesUploaded = renderStats.bytesUploaded + renderStats.bufferBytesUploaded + renderStats.textureBytesUploaded;
+    CORE.Time.stats.callsElided = renderStats.callsElided;
+    CORE.Time.stats.updateTime = (float)CORE.Time.update;
+    CORE.Time.stats.drawTime = (float)CORE.Time.draw;
+    CORE.Time.stats.waitTime = (float)CORE.Time.wait;
+    rlResetRenderStats();
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     // Events recording and playing logic
     if (eventsRecording) RecordAutomationEvent(CORE.Time.frameCounter);
     else if (eventsPlaying)
     {
         // TODO: When should we play? After/before/replace PollInputEvents()?
-        if (CORE.Time.frameCounter >= eventCount) eventsPlaying = false;
         PlayAutomationEvent(CORE.Time.frameCounter);
     }
 #endif
 
     CORE.Time.frameCounter++;
+
+    PROFILE_ZONE_END();
 }
 
 // Initialize 2D mode with custom camera (2D)
@@ -2576,54 +3082,134 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     Shader shader = { 0 };
 
+#if defined(SUPPORT_SHADER_CACHE)
+    unsigned long long codeHash = 0;
+    shader.id = LoadShaderCache(vsCode, fsCode, &codeHash);
+
+    if (shader.id == 0)
+    {
+        shader.id = rlLoadShaderCode(vsCode, fsCode);
+        if ((codeHash > 0) && (shader.id != rlGetShaderIdDefault())) SaveShaderCache(shader.id, codeHash);
+    }
+#else
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+#endif
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
     {
-        // Default shader attribute locations have been binded before linking:
-        //          vertex position location    = 0
-        //          vertex texcoord location    = 1
-        //          vertex normal location      = 2
-        //          vertex color location       = 3
-        //          vertex tangent location     = 4
-        //          vertex texcoord2 location   = 5
+        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+        SetShaderLocationsDefault(shader);
+    }
+
+    return shader;
+}
+
+// Load shader from files, compilation not waited
+// NOTE: Shader must be checked with IsShaderReady() before use, default locations are set once ready
+Shader LoadShaderAsync(const char *vsFileName, const char *fsFileName)
+{
+    Shader shader = { 0 };
+
+    char *vShaderStr = NULL;
+    char *fShaderStr = NULL;
+
+    if (vsFileName != NULL) vShaderStr = LoadFileText(vsFileName);
+    if (fsFileName != NULL) fShaderStr = LoadFileText(fsFileName);
+
+    shader = LoadShaderFromMemoryAsync(vShaderStr, fShaderStr);
+
+    UnloadFileText(vShaderStr);
+    UnloadFileText(fShaderStr);
+
+    return shader;
+}
+
+// Load shader from code strings, compilation not waited
+// NOTE: Several shaders compilation is done in parallel by driver (if supported) while application keeps working,
+// shader must be checked with IsShaderReady() before use, default locations are set once ready
+Shader LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode)
+{
+    Shader shader = { 0 };
+
+    // Default shader is already loaded, no compilation required
+    if ((vsCode == NULL) && (fsCode == NULL)) return LoadShaderFromMemory(vsCode, fsCode);
+
+    int slot = -1;
+    for (int i = 0; i < MAX_ASYNC_SHADERS; i++)
+    {
+        if (asyncShaders[i].id == 0) { slot = i; break; }
+    }
+
+    if (slot == -1)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Maximum shaders loading asynchronously reached (%i), loading shader synchronously", MAX_ASYNC_SHADERS);
+        return LoadShaderFromMemory(vsCode, fsCode);
+    }
+
+    unsigned long long codeHash = 0;
 
-        // NOTE: If any location is not found, loc point becomes -1
+#if defined(SUPPORT_SHADER_CACHE)
+    // Shader program binary loading from cache is fast, shader is ready
+    shader.id = LoadShaderCache(vsCode, fsCode, &codeHash);
 
+    if (shader.id > 0)
+    {
         shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        SetShaderLocationsDefault(shader);
 
-        // All locations reset to -1 (no location)
-        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+        return shader;
+    }
+#endif
 
-        // Get handles to GLSL input attribute locations
-        shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-        shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-        shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-        shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    shader.id = rlLoadShaderCodeAsync(vsCode, fsCode);
 
-        // Get handles to GLSL uniform locations (vertex shader)
-        shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
-        shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
-        shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
-        shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    if (shader.id > 0)
+    {
+        // All locations reset to -1 (no location) until shader is ready
+        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
-        // Get handles to GLSL uniform locations (fragment shader)
-        shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
-        shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
-        shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+        asyncShaders[slot].id = shader.id;
+        asyncShaders[slot].failed = false;
+        asyncShaders[slot].codeHash = codeHash;
     }
 
     return shader;
 }
 
 // Check if a shader is ready
+// NOTE: Shaders loaded asynchronously are ready once compilation is completed (default locations set)
 bool IsShaderReady(Shader shader)
 {
+    if ((shader.id == 0) || (shader.locs == NULL)) return false;
+
+    // Check shaders loading asynchronously, default locations are set once compilation completed
+    for (int i = 0; i < MAX_ASYNC_SHADERS; i++)
+    {
+        if (asyncShaders[i].id == shader.id)
+        {
+            if (asyncShaders[i].failed) return false;
+
+            int status = rlCheckShaderProgram(shader.id);
+
+            if (status == 0) return false;
+            else if (status < 0)
+            {
+                asyncShaders[i].failed = true;  // Failed shader kept until unloaded
+                return false;
+            }
+
+            SetShaderLocationsDefault(shader);
+#if defined(SUPPORT_SHADER_CACHE)
+            if (asyncShaders[i].codeHash > 0) SaveShaderCache(shader.id, asyncShaders[i].codeHash);
+#endif
+            asyncShaders[i].id = 0;
+            break;
+        }
+    }
+
     return ((shader.id > 0) &&          // Validate shader id (loaded successfully)
             (shader.locs != NULL));     // Validate memory has been allocated for default shader locations
 
@@ -2658,6 +3244,12 @@ void UnloadShader(Shader shader)
 {
     if (shader.id != rlGetShaderIdDefault())
     {
+        // Shader could be still loading asynchronously
+        for (int i = 0; i < MAX_ASYNC_SHADERS; i++)
+        {
+            if (asyncShaders[i].id == shader.id) asyncShaders[i].id = 0;
+        }
+
         rlUnloadShaderProgram(shader.id);
 
         // NOTE: If shader loading failed, it should be 0
@@ -2923,6 +3515,82 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get statistics for last frame drawn (rendering work and timing)
+// NOTE: Rendering statistics are only available on OpenGL 3.3 and OpenGL ES 2.0,
+// work done out of BeginDrawing()/EndDrawing() (i.e. texture loading) is accounted to next frame
+FrameStats GetFrameStats(void)
+{
+    return CORE.Time.stats;
+}
+
+// Set fixed update rate (updates per second), 0 disables fixed update
+// NOTE: Frame time is accumulated at every frame boundary (PollInputEvents(), also called by EndDrawing())
+// and consumed in fixed steps, program must run GetFixedUpdateSteps() updates per frame:
+//     for (int i = 0; i < GetFixedUpdateSteps(); i++) UpdateSimulation(1.0f/ups);
+//     DrawSimulation(GetFixedUpdateAlpha());     // Interpolate between last two simulation states
+// NOTE: Frame times close to display refresh multiples are snapped to them, so vsync timing noise
+// does not turn into steps jitter (i.e. alternating 0 and 2 steps per frame at same update and refresh rates)
+// NOTE: Rate changes reset accumulated time and frame boundary, time measured at previous rate is not
+// consumed at the new one; frame boundary reset measures a partial frame, so jitter statistics restart
+void SetFixedUpdateRate(int ups)
+{
+    double fixed = (ups < 1)? 0.0 : 1.0/(double)ups;
+    if (fixed == CORE.Time.fixed) return;
+
+    CORE.Time.fixed = fixed;
+    CORE.Time.accumulator = 0.0;
+    CORE.Time.boundary = GetTime();
+    CORE.Time.historyIndex = 0;
+    CORE.Time.historyCount = 0;
+
+    if (ups < 1)
+    {
+        CORE.Time.fixedSteps = 0;
+        return;
+    }
+
+    CORE.Time.fixedSteps = 1;           // First frame runs one step, following frames run accumulated steps
+    CORE.Time.stats.fixedStepsDropped = 0;
+    if (CORE.Time.fixedMaxSteps == 0) CORE.Time.fixedMaxSteps = FIXED_UPDATE_MAX_STEPS;
+
+    // Display refresh time, only available once window is initialized
+    int refreshRate = CORE.Window.ready? GetMonitorRefreshRate(GetCurrentMonitor()) : 0;
+    CORE.Time.refresh = (refreshRate > 0)? 1.0/(double)refreshRate : 0.0;
+
+    TRACELOG(LOG_INFO, "TIMER: Fixed update time step: %02.03f milliseconds (display refresh: %i Hz)", (float)CORE.Time.fixed*1000.0f, refreshRate);
+}
+
+// Set fixed update steps limit per frame (catch-up limit)
+// NOTE: If a frame takes longer than steps limit, exceeding time is dropped (simulation slows down)
+// instead of running more steps that take even longer (spiral of death)
+void SetFixedUpdateMaxSteps(int steps)
+{
+    CORE.Time.fixedMaxSteps = (steps > 0)? steps : 1;
+}
+
+// Get fixed update steps to run for current frame
+int GetFixedUpdateSteps(void)
+{
+    return CORE.Time.fixedSteps;
+}
+
+// Get fixed update interpolation alpha [0..1], time accumulated not consumed by steps
+float GetFixedUpdateAlpha(void)
+{
+    if (CORE.Time.fixed <= 0.0) return 1.0f;
+
+    float alpha = (float)(CORE.Time.accumulator/CORE.Time.fixed);
+
+    return (alpha < 0.0f)? 0.0f : ((alpha > 1.0f)? 1.0f : alpha);
+}
+
+// Get frame pacing statistics (WaitTime() accuracy), accumulated since InitWindow()
+// NOTE: Statistics only measured with SUPPORT_ADAPTIVE_WAIT_LOOP
+PacingStats GetPacingStats(void)
+{
+    return CORE.Time.pacing;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -2982,71 +3650,460 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
-// Get a random value between min and max (both included)
-// WARNING: Ranges higher than RAND_MAX will return invalid results
-// More specifically, if (max - min) > INT_MAX there will be an overflow,
-// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
-int GetRandomValue(int min, int max)
+// Start screen recording (filename extension defines format)
+// NOTE: Supported formats: .gif (animation), .qoi (lossless frames sequence) and .raw (uncompressed RGBA frames sequence),
+// frames sequence files are numbered after fileName (i.e. capture.qoi -> capture0000.qoi, capture0001.qoi...),
+// screen frames are read at EndDrawing() and encoded in a worker thread (if SUPPORT_GIF_RECORDING_THREAD)
+void StartScreenRecording(const char *fileName)
 {
-    if (min > max)
+#if defined(SUPPORT_GIF_RECORDING)
+    if (gifRecording) StopScreenRecording();
+
+    int format = -1;
+    if (IsFileExtension(fileName, ".gif")) format = RECORDING_GIF;
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+    else if (IsFileExtension(fileName, ".qoi")) format = RECORDING_QOI;
+#endif
+    else if (IsFileExtension(fileName, ".raw")) format = RECORDING_RAW;
+
+    if (format == -1)
     {
-        int tmp = max;
-        max = min;
-        min = tmp;
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording file format not supported", fileName);
+        return;
     }
 
-    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    snprintf(recordingEncoder.fileName, MAX_FILEPATH_LENGTH, "%s/%s", CORE.Storage.basePath, fileName);
+    recordingEncoder.fileExt = strrchr(recordingEncoder.fileName, '.');
+    recordingEncoder.format = format;
+    recordingEncoder.frameCounter = 0;
+
+    Vector2 scale = GetWindowScaleDPI();
+    recordingEncoder.width = (int)((float)CORE.Window.render.width*scale.x);
+    recordingEncoder.height = (int)((float)CORE.Window.render.height*scale.y);
+    recordingEncoder.first = 0;
+    recordingEncoder.count = 0;
+
+    // GIF frame delay in centiseconds, recorded frames time at target frame rate (60 fps if not set)
+    double frameTime = (CORE.Time.target > 0.0)? CORE.Time.target : 1.0/60.0;
+    recordingEncoder.delay = (int)(recordingRate*frameTime*100.0 + 0.5);
+    if (recordingEncoder.delay < 1) recordingEncoder.delay = 1;
+
+    for (int i = 0; i < GIF_ENCODER_FRAMES; i++) recordingEncoder.data[i] = (unsigned char *)RL_MALLOC(recordingEncoder.width*recordingEncoder.height*4);
+
+    for (int i = 0; i < GIF_READBACK_BUFFERS; i++)
     {
-        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+        recordingReadbacks[i].id = rlLoadReadbackBuffer(recordingEncoder.width, recordingEncoder.height);
+        recordingReadbacks[i].pending = false;
     }
+    recordingReadbackIndex = 0;
 
-    return (rand()%(abs(max - min) + 1) + min);
-}
+    if (recordingReadbacks[0].id == 0) TRACELOG(LOG_INFO, "SYSTEM: Screen recording readback not asynchronous, pixel buffers not supported");
 
-// Set the seed for the random number generator
-void SetRandomSeed(unsigned int seed)
-{
-    srand(seed);
-}
+    if (format == RECORDING_GIF) msf_gif_begin(&gifState, recordingEncoder.width, recordingEncoder.height);
 
-// Check if the file exists
-bool FileExists(const char *fileName)
-{
-    bool result = false;
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+    recordingEncoder.closing = false;
+    pthread_mutex_init(&recordingEncoder.mutex, NULL);
+    pthread_cond_init(&recordingEncoder.cond, NULL);
 
-#if defined(_WIN32)
-    if (_access(fileName, 0) != -1) result = true;
-#else
-    if (access(fileName, F_OK) != -1) result = true;
+    // NOTE: If encoder thread can not be created, frames are encoded in main thread
+    recordingEncoder.threaded = (pthread_create(&recordingEncoder.threadId, NULL, &RecordingEncoderThread, NULL) == 0);
+    if (!recordingEncoder.threaded) TRACELOG(LOG_WARNING, "SYSTEM: Failed to create screen recording encoder thread, frames encoded in main thread");
 #endif
 
-    // NOTE: Alternatively, stat() can be used instead of access()
-    //#include <sys/stat.h>
-    //struct stat statbuf;
-    //if (stat(filename, &statbuf) == 0) result = true;
+    gifRecording = true;
+    gifFrameCounter = 0;
 
-    return result;
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Start screen recording (one frame every %i frames)", recordingEncoder.fileName, recordingRate);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording requires SUPPORT_GIF_RECORDING");
+#endif
 }
 
-// Check file extension
-// NOTE: Extensions checking is not case-sensitive
-bool IsFileExtension(const char *fileName, const char *ext)
+// Stop screen recording, gif file saved
+// NOTE: Pending readbacks and queued frames are encoded before stopping
+void StopScreenRecording(void)
 {
-    #define MAX_FILE_EXTENSION_SIZE  16
+#if defined(SUPPORT_GIF_RECORDING)
+    if (!gifRecording) return;
 
-    bool result = false;
-    const char *fileExt = GetFileExtension(fileName);
+    for (int i = 0; i < GIF_READBACK_BUFFERS; i++)
+    {
+        int index = (recordingReadbackIndex + i)%GIF_READBACK_BUFFERS;
 
-    if (fileExt != NULL)
+        if (recordingReadbacks[index].pending) ReadRecordingFrame(index);
+        rlUnloadReadbackBuffer(recordingReadbacks[index].id);
+        recordingReadbacks[index].id = 0;
+    }
+
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+    if (recordingEncoder.threaded)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount);  // WARNING: Module required: rtext
+        pthread_mutex_lock(&recordingEncoder.mutex);
+        recordingEncoder.closing = true;
+        pthread_cond_broadcast(&recordingEncoder.cond);
+        pthread_mutex_unlock(&recordingEncoder.mutex);
 
-        char fileExtLower[MAX_FILE_EXTENSION_SIZE + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt),MAX_FILE_EXTENSION_SIZE);  // WARNING: Module required: rtext
+        pthread_join(recordingEncoder.threadId, NULL);
+        recordingEncoder.threaded = false;
+    }
 
-        for (int i = 0; i < extCount; i++)
+    pthread_cond_destroy(&recordingEncoder.cond);
+    pthread_mutex_destroy(&recordingEncoder.mutex);
+#endif
+
+    if (recordingEncoder.format == RECORDING_GIF)
+    {
+        MsfGifResult result = msf_gif_end(&gifState);
+        SaveFileData(recordingEncoder.fileName, result.data, (unsigned int)result.dataSize);
+        msf_gif_free(result);
+    }
+
+    for (int i = 0; i < GIF_ENCODER_FRAMES; i++)
+    {
+        RL_FREE(recordingEncoder.data[i]);
+        recordingEncoder.data[i] = NULL;
+    }
+
+    gifRecording = false;
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Finish screen recording", recordingEncoder.fileName);
+#endif
+}
+
+// Check if screen is being recorded
+bool IsScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return gifRecording;
+#else
+    return false;
+#endif
+}
+
+// Set screen recording rate, one frame recorded every frames game frames (default: GIF_RECORD_FRAMERATE)
+// NOTE: Rate must be set before starting recording, it also defines gif frames delay
+void SetScreenRecordingRate(int frames)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    recordingRate = (frames > 0)? frames : 1;
+#endif
+}
+
+// Start recording automation events into a file, events streamed to file every frame
+// NOTE: Binary file format, delta-encoded frame blocks:
+//   File header: "rAEV" id (4 bytes), version (4 bytes), frames index position (4 bytes, written on recording stop)
+//   Frame block: frames since previous block (varint), events count and key frame block flag (varint, count << 1 | key),
+//                events: type (1 byte), params[3] (zigzag varint, delta to previous event of same type)
+//   Frames index: entries count (4 bytes), entries: frame (4 bytes), events count position (4 bytes)
+// NOTE: Key frame blocks (indexed every AUTOMATION_INDEX_FRAMES frames) reset params delta-encoding, playing can seek to them
+bool StartAutomationEventRecording(const char *fileName)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (eventsRecording) StopAutomationEventRecording();
+    if (eventsPlaying) StopAutomationEventPlaying();
+
+    automation.file = fopen(fileName, "wb");
+
+    if (automation.file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open automation events file", fileName);
+        return false;
+    }
+
+    unsigned int version = 101;
+    unsigned int indexOffset = 0;
+    fwrite("rAEV", 1, 4, automation.file);
+    fwrite(&version, sizeof(unsigned int), 1, automation.file);
+    fwrite(&indexOffset, sizeof(unsigned int), 1, automation.file);
+
+    memset(automation.lastParams, 0, sizeof(automation.lastParams));
+    automation.baseFrame = CORE.Time.frameCounter;
+    automation.blockFrame = 0;
+    automation.eventCount = 0;
+    automation.indexCount = 0;
+    eventsRecording = true;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Automation events recording started", fileName);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Stop recording automation events, frames index written and file closed
+void StopAutomationEventRecording(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsRecording) return;
+
+    // Frames index appended to frame blocks, position written into header
+    unsigned int indexOffset = (unsigned int)ftell(automation.file);
+    fwrite(&automation.indexCount, sizeof(unsigned int), 1, automation.file);
+    if (automation.indexCount > 0) fwrite(automation.index, sizeof(AutomationFrameIndex), automation.indexCount, automation.file);
+    fseek(automation.file, 8, SEEK_SET);
+    fwrite(&indexOffset, sizeof(unsigned int), 1, automation.file);
+
+    fclose(automation.file);
+    automation.file = NULL;
+    eventsRecording = false;
+
+    RL_FREE(automation.index);
+    automation.index = NULL;
+    automation.indexCount = 0;
+    automation.indexCapacity = 0;
+
+    TRACELOG(LOG_INFO, "AUTOMATION: Automation events recording finished: %u events", automation.eventCount);
+#endif
+}
+
+// Start playing automation events from a file, events read from file every frame
+// NOTE: Recorded frames are played relative to current frame, frames index loaded if available (seek)
+bool StartAutomationEventPlaying(const char *fileName)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (eventsRecording) StopAutomationEventRecording();
+    if (eventsPlaying) StopAutomationEventPlaying();
+
+    automation.file = fopen(fileName, "rb");
+
+    if (automation.file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open automation events file", fileName);
+        return false;
+    }
+
+    char id[4] = { 0 };
+    unsigned int version = 0;
+    unsigned int indexOffset = 0;
+    bool valid = (fread(id, 1, 4, automation.file) == 4) && (fread(&version, sizeof(unsigned int), 1, automation.file) == 1) &&
+        (memcmp(id, "rAEV", 4) == 0) && ((version == 100) || (version == 101));
+
+    // Version 101 adds frames index (not available if recording was not stopped)
+    if (valid && (version == 101)) valid = (fread(&indexOffset, sizeof(unsigned int), 1, automation.file) == 1);
+
+    automation.index = NULL;
+    automation.indexCount = 0;
+    automation.dataEnd = indexOffset;
+    automation.version = version;
+
+    if (valid && (indexOffset > 0))
+    {
+        long dataStart = ftell(automation.file);
+        unsigned int count = 0;
+
+        valid = (fseek(automation.file, (long)indexOffset, SEEK_SET) == 0) && (fread(&count, sizeof(unsigned int), 1, automation.file) == 1) && (count < 0x1000000);
+
+        if (valid && (count > 0))
+        {
+            automation.index = (AutomationFrameIndex *)RL_MALLOC(count*sizeof(AutomationFrameIndex));
+            valid = (fread(automation.index, sizeof(AutomationFrameIndex), count, automation.file) == count);
+
+            // Check index entries: frames ordered, positions into frame blocks
+            for (unsigned int i = 0; valid && (i < count); i++)
+            {
+                valid = (automation.index[i].offset >= (unsigned int)dataStart) && (automation.index[i].offset < indexOffset) &&
+                    ((i == 0) || (automation.index[i].frame > automation.index[i - 1].frame));
+            }
+
+            automation.indexCount = count;
+        }
+
+        if (valid) fseek(automation.file, dataStart, SEEK_SET);
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Automation events file not valid", fileName);
+        fclose(automation.file);
+        automation.file = NULL;
+        RL_FREE(automation.index);
+        automation.index = NULL;
+        automation.indexCount = 0;
+        return false;
+    }
+
+    memset(automation.lastParams, 0, sizeof(automation.lastParams));
+    automation.baseFrame = CORE.Time.frameCounter;
+    automation.eventCount = 0;
+    eventsPlaying = true;
+
+    // Read first frame block header
+    unsigned int frames = 0;
+    if (ReadAutomationBlockFrames(&frames)) automation.blockFrame = frames;
+    else StopAutomationEventPlaying();
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Automation events playing started", fileName);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Stop playing automation events, file closed
+void StopAutomationEventPlaying(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsPlaying) return;
+
+    fclose(automation.file);
+    automation.file = NULL;
+    eventsPlaying = false;
+
+    RL_FREE(automation.index);
+    automation.index = NULL;
+    automation.indexCount = 0;
+
+    TRACELOG(LOG_INFO, "AUTOMATION: Automation events playing finished: %u events", automation.eventCount);
+#endif
+}
+
+// Seek playing automation events to a recorded frame, recorded frame played on next frame
+// NOTE: File positioned at last key frame block before frame (frames index), following blocks
+// read (params decoded, events not played) up to frame; input states are not restored
+bool SeekAutomationEventPlaying(int frame)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsPlaying || (frame < 0)) return false;
+
+    if (automation.indexCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: Automation events file has no frames index, seek not possible");
+        return false;
+    }
+
+    // Find last key frame block before frame (binary search), first one if none
+    int low = 0;
+    int high = (int)automation.indexCount - 1;
+
+    while (low < high)
+    {
+        int mid = low + (high - low + 1)/2;
+
+        if (automation.index[mid].frame <= (unsigned int)frame) low = mid;
+        else high = mid - 1;
+    }
+
+    fseek(automation.file, (long)automation.index[low].offset, SEEK_SET);
+    memset(automation.lastParams, 0, sizeof(automation.lastParams));
+    automation.blockFrame = automation.index[low].frame;
+
+    // Skip frame blocks before frame, params decoded to keep delta-encoding state
+    bool valid = true;
+
+    while (valid && (automation.blockFrame < (unsigned int)frame))
+    {
+        unsigned int count = 0;
+        valid = ReadAutomationBlockCount(&count);
+
+        for (unsigned int i = 0; valid && (i < count); i++)
+        {
+            int type = 0;
+            int params[3] = { 0 };
+            valid = ReadAutomationEvent(&type, params);
+        }
+
+        unsigned int frames = 0;
+        if (valid && ReadAutomationBlockFrames(&frames)) automation.blockFrame += frames;
+        else
+        {
+            // No frame blocks after frame, nothing else to play
+            if (!valid) TRACELOG(LOG_WARNING, "AUTOMATION: Automation events file data not valid");
+            StopAutomationEventPlaying();
+            return false;
+        }
+    }
+
+    // Recorded frame played on current frame (EndDrawing())
+    automation.baseFrame = CORE.Time.frameCounter - (unsigned int)frame;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Check if automation events are being played
+bool IsAutomationEventPlaying(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    return eventsPlaying;
+#else
+    return false;
+#endif
+}
+
+// Get a random value between min and max (both included)
+// WARNING: Ranges higher than RAND_MAX will return invalid results
+// More specifically, if (max - min) > INT_MAX there will be an overflow,
+// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
+int GetRandomValue(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    {
+        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+    }
+
+    return (rand()%(abs(max - min) + 1) + min);
+}
+
+// Set the seed for the random number generator
+void SetRandomSeed(unsigned int seed)
+{
+    srand(seed);
+}
+
+// Check if the file exists
+bool FileExists(const char *fileName)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    if (_access(fileName, 0) != -1) result = true;
+#else
+    if (access(fileName, F_OK) != -1) result = true;
+#endif
+
+    // NOTE: Alternatively, stat() can be used instead of access()
+    //#include <sys/stat.h>
+    //struct stat statbuf;
+    //if (stat(filename, &statbuf) == 0) result = true;
+
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    if (!result) result = IsFileInArchive(fileName);
+#endif
+
+    return result;
+}
+
+// Check file extension
+// NOTE: Extensions checking is not case-sensitive
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    #define MAX_FILE_EXTENSION_SIZE  16
+
+    bool result = false;
+    const char *fileExt = GetFileExtension(fileName);
+
+    if (fileExt != NULL)
+    {
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
+        int extCount = 0;
+        const char **checkExts = TextSplit(ext, ';', &extCount);  // WARNING: Module required: rtext
+
+        char fileExtLower[MAX_FILE_EXTENSION_SIZE + 1] = { 0 };
+        strncpy(fileExtLower, TextToLower(fileExt),MAX_FILE_EXTENSION_SIZE);  // WARNING: Module required: rtext
+
+        for (int i = 0; i < extCount; i++)
         {
             if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
             {
@@ -3129,7 +4186,7 @@ const char *GetFileNameWithoutExt(const char *filePath)
 {
     #define MAX_FILENAMEWITHOUTEXT_LENGTH   256
 
-    static char fileName[MAX_FILENAMEWITHOUTEXT_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char fileName[MAX_FILENAMEWITHOUTEXT_LENGTH] = { 0 };
     memset(fileName, 0, MAX_FILENAMEWITHOUTEXT_LENGTH);
 
     if (filePath != NULL) strcpy(fileName, GetFileName(filePath));   // Get filename with extension
@@ -3162,7 +4219,7 @@ const char *GetDirectoryPath(const char *filePath)
     #endif
 */
     const char *lastSlash = NULL;
-    static char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
     memset(dirPath, 0, MAX_FILEPATH_LENGTH);
 
     // In case provided path does not contain a root drive letter (C:\, D:\) nor leading path separator (\, /),
@@ -3198,7 +4255,7 @@ const char *GetDirectoryPath(const char *filePath)
 // Get previous directory path for a given path
 const char *GetPrevDirectoryPath(const char *dirPath)
 {
-    static char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
     memset(prevDirPath, 0, MAX_FILEPATH_LENGTH);
     int pathLen = (int)strlen(dirPath);
 
@@ -3307,107 +4364,192 @@ const char *GetApplicationDirectory(void)
 }
 
 // Load directory filepaths
-// NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
+// NOTE: Base path is prepended to the scanned filepaths, directories are also included
 // No recursive scanning is done!
 FilePathList LoadDirectoryFiles(const char *dirPath)
 {
-    FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
-
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
-
-    return files;
+    return LoadDirectoryFilesEx(dirPath, NULL, false);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Paths stored in a single memory block, sized to paths found (no capacity limit)
+// NOTE: On recursive scanning only files are included, directories are scanned
 FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    FilePathList files = { 0 };
+#if defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+    if (scanSubdirs) return LoadDirectoryFilesParallel(basePath, filter);
+#endif
 
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+    PathArena arena = { 0 };
+    DirectoryEntry entry = { 0 };
 
-    // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    DirectoryIterator *iterator = LoadDirectoryIterator(basePath, filter, scanSubdirs);
+    while (NextDirectoryEntry(iterator, &entry)) AddArenaPath(&arena, entry.path, (unsigned int)strlen(entry.path));
+    UnloadDirectoryIterator(iterator);
 
-    return files;
+    return LoadArenaFilePathList(&arena);
 }
 
 // Unload directory filepaths
+// NOTE: Paths strings are stored in the same memory block as paths pointers
 // WARNING: files.count is not reseted to 0 after unloading
 void UnloadDirectoryFiles(FilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
-
     RL_FREE(files.paths);
 }
 
-// Change working directory, returns true on success
-bool ChangeDirectory(const char *dir)
+// Load directory iterator, entries read one by one (no paths list allocated)
+// NOTE: Base path is prepended to entries paths, on recursive scanning only files are read
+DirectoryIterator *LoadDirectoryIterator(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    bool result = CHDIR(dir);
+    DIR *dir = opendir(basePath);
 
-    if (result != 0) TRACELOG(LOG_WARNING, "SYSTEM: Failed to change to directory: %s", dir);
+    if (dir == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+        return NULL;
+    }
 
-    return (result == 0);
-}
+    DirectoryIterator *iterator = (DirectoryIterator *)RL_CALLOC(1, sizeof(DirectoryIterator));
 
-// Check if a given path point to a file
-bool IsPathFile(const char *path)
-{
-    struct stat pathStat = { 0 };
-    stat(path, &pathStat);
+    iterator->depthCapacity = 8;
+    iterator->dirs = (DIR **)RL_MALLOC(iterator->depthCapacity*sizeof(DIR *));
+    iterator->pathLengths = (unsigned int *)RL_MALLOC(iterator->depthCapacity*sizeof(unsigned int));
+    iterator->dirs[0] = dir;
+    iterator->pathLengths[0] = (unsigned int)strlen(basePath);
+    iterator->depth = 0;
 
-    return S_ISREG(pathStat.st_mode);
-}
+    ReservePathCapacity(&iterator->path, &iterator->pathCapacity, iterator->pathLengths[0] + 1);
+    strcpy(iterator->path, basePath);
 
-// Check if a file has been dropped into window
-bool IsFileDropped(void)
-{
-    if (CORE.Window.dropFileCount > 0) return true;
-    else return false;
+    if (filter != NULL)
+    {
+        iterator->filter = (char *)RL_MALLOC(strlen(filter) + 1);
+        strcpy(iterator->filter, filter);
+    }
+
+    iterator->scanSubdirs = scanSubdirs;
+
+    return iterator;
 }
 
-// Load dropped filepaths
-FilePathList LoadDroppedFiles(void)
+// Read next directory entry, returns false once all entries read
+// NOTE: Entry path is valid until next entry is read
+bool NextDirectoryEntry(DirectoryIterator *iterator, DirectoryEntry *entry)
 {
-    FilePathList files = { 0 };
+    if (iterator == NULL) return false;
 
-    files.count = CORE.Window.dropFileCount;
-    files.paths = CORE.Window.dropFilepaths;
+    struct dirent *dp = NULL;
 
-    return files;
-}
+    while (iterator->depth >= 0)
+    {
+        dp = readdir(iterator->dirs[iterator->depth]);
+
+        if (dp == NULL)
+        {
+            // Directory finished, continue with parent directory
+            closedir(iterator->dirs[iterator->depth]);
+            iterator->depth--;
+            continue;
+        }
+
+        // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
+        if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
+
+        // Construct entry path from directory path
+        unsigned int dirLength = iterator->pathLengths[iterator->depth];
+        unsigned int length = dirLength + 1 + (unsigned int)strlen(dp->d_name);
+
+        ReservePathCapacity(&iterator->path, &iterator->pathCapacity, length + 1);
+        iterator->path[dirLength] = '/';
+        strcpy(iterator->path + dirLength + 1, dp->d_name);
+
+        bool isDirectory = IsDirectoryEntryDir(dp, iterator->path);
+
+        if (iterator->scanSubdirs && isDirectory)
+        {
+            DIR *dir = opendir(iterator->path);
+
+            if (dir != NULL)
+            {
+                if ((iterator->depth + 1) == iterator->depthCapacity)
+                {
+                    iterator->depthCapacity *= 2;
+                    iterator->dirs = (DIR **)RL_REALLOC(iterator->dirs, iterator->depthCapacity*sizeof(DIR *));
+                    iterator->pathLengths = (unsigned int *)RL_REALLOC(iterator->pathLengths, iterator->depthCapacity*sizeof(unsigned int));
+                }
+
+                iterator->depth++;
+                iterator->dirs[iterator->depth] = dir;
+                iterator->pathLengths[iterator->depth] = length;
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", iterator->path);
+
+            continue;
+        }
+
+        if ((iterator->filter != NULL) && !IsFileExtension(iterator->path, iterator->filter)) continue;
+
+        entry->path = iterator->path;
+        entry->name = iterator->path + dirLength + 1;
+        entry->isDirectory = isDirectory;
+
+        return true;
+    }
+
+    return false;
+}
+
+// Unload directory iterator
+void UnloadDirectoryIterator(DirectoryIterator *iterator)
+{
+    if (iterator == NULL) return;
+
+    for (int i = iterator->depth; i >= 0; i--) closedir(iterator->dirs[i]);
+
+    RL_FREE(iterator->dirs);
+    RL_FREE(iterator->pathLengths);
+    RL_FREE(iterator->path);
+    RL_FREE(iterator->filter);
+    RL_FREE(iterator);
+}
+
+// Change working directory, returns true on success
+bool ChangeDirectory(const char *dir)
+{
+    bool result = CHDIR(dir);
+
+    if (result != 0) TRACELOG(LOG_WARNING, "SYSTEM: Failed to change to directory: %s", dir);
+
+    return (result == 0);
+}
+
+// Check if a given path point to a file
+bool IsPathFile(const char *path)
+{
+    struct stat pathStat = { 0 };
+    stat(path, &pathStat);
+
+    return S_ISREG(pathStat.st_mode);
+}
+
+// Check if a file has been dropped into window
+bool IsFileDropped(void)
+{
+    if (CORE.Window.dropFileCount > 0) return true;
+    else return false;
+}
+
+// Load dropped filepaths
+FilePathList LoadDroppedFiles(void)
+{
+    FilePathList files = { 0 };
+
+    files.count = CORE.Window.dropFileCount;
+    files.paths = CORE.Window.dropFilepaths;
+
+    return files;
+}
 
 // Unload dropped filepaths
 void UnloadDroppedFiles(FilePathList files)
@@ -3440,2270 +4582,4181 @@ long GetFileModTime(const char *fileName)
     return 0;
 }
 
-// Compress data (DEFLATE algorithm)
-unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
+// Mount assets archive (.rpak), files loaded from archive instead of file system
+// NOTE: Archive data memory mapped if supported (loaded at once otherwise), uncompressed files loaded with
+// LoadFileData() are views into archive data (zero-copy), they must be unloaded before unmounting archive
+bool MountArchive(const char *fileName)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
+    bool result = false;
 
-    unsigned char *compData = NULL;
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    if (archiveCount >= MAX_MOUNTED_ARCHIVES)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount archive, maximum archives mounted (%i)", fileName, MAX_MOUNTED_ARCHIVES);
+        return false;
+    }
 
-#if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl sdefl = { 0 };
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
-    *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbwi
+    Archive archive = { 0 };
 
-    TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
-#endif
+#if defined(ARCHIVE_MEMORY_MAPPING) && defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);  // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
 
-    return compData;
-}
+    if (file != (void *)(size_t)-1)
+    {
+        long long size = 0;
 
-// Decompress data (DEFLATE algorithm)
-unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
-{
-    unsigned char *data = NULL;
+        if (GetFileSizeEx(file, &size) && (size > 0))
+        {
+            // NOTE: Copy-on-write mapping, data modified by loaders is not written to file
+            void *mapping = CreateFileMappingA(file, NULL, 0x08, 0, 0, NULL);       // PAGE_WRITECOPY
 
-#if defined(SUPPORT_COMPRESSION_API)
-    // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+            if (mapping != NULL)
+            {
+                archive.data = (unsigned char *)MapViewOfFile(mapping, 0x01, 0, 0, 0);    // FILE_MAP_COPY
+                archive.size = (unsigned long long)size;
+                CloseHandle(mapping);       // NOTE: Mapping kept until view is unmapped
+            }
+        }
+
+        CloseHandle(file);
+    }
+#elif defined(ARCHIVE_MEMORY_MAPPING)
+    int file = open(fileName, O_RDONLY);
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
-    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
-    unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
+    if (file >= 0)
+    {
+        struct stat info = { 0 };
 
-    if (temp != NULL) data = temp;
-    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+        if ((fstat(file, &info) == 0) && (info.st_size > 0))
+        {
+            // NOTE: Private mapping (copy-on-write), data modified by loaders is not written to file
+            void *data = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
 
-    *dataSize = length;
+            if (data != MAP_FAILED)
+            {
+                archive.data = (unsigned char *)data;
+                archive.size = (unsigned long long)info.st_size;
+            }
+        }
 
-    TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+        close(file);                        // NOTE: Mapping kept until unmapped
+    }
 #endif
 
-    return data;
-}
+    archive.mapped = (archive.data != NULL);
 
-// Encode data to Base64 string
-char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
-{
-    static const unsigned char base64encodeTable[] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-        'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
-    };
+    if (!archive.mapped)
+    {
+        // Archive data loaded at once if memory mapping is not supported
+        unsigned int size = 0;
+        archive.data = LoadFileData(fileName, &size);
+        archive.size = size;
+    }
 
-    static const int modTable[] = { 0, 2, 1 };
+    if (archive.data != NULL)
+    {
+        // Check archive header, entries index and entries data bounds
+        const ArchiveHeader *header = (const ArchiveHeader *)archive.data;
 
-    *outputSize = 4*((dataSize + 2)/3);
+        result = (archive.size >= sizeof(ArchiveHeader)) && (memcmp(header->id, "rPAK", 4) == 0) && (header->version == 100) &&
+                 ((sizeof(ArchiveHeader) + (unsigned long long)header->entryCount*sizeof(ArchiveEntry) + header->pathsSize) <= archive.size);
 
-    char *encodedData = (char *)RL_MALLOC(*outputSize);
+        if (result)
+        {
+            archive.entryCount = header->entryCount;
+            archive.entries = (const ArchiveEntry *)(archive.data + sizeof(ArchiveHeader));
+            archive.paths = (const char *)(archive.entries + archive.entryCount);
 
-    if (encodedData == NULL) return NULL;
+            if ((header->pathsSize == 0) || (archive.paths[header->pathsSize - 1] != '\0')) result = (archive.entryCount == 0);
 
-    for (int i = 0, j = 0; i < dataSize;)
-    {
-        unsigned int octetA = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetB = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetC = (i < dataSize)? (unsigned char)data[i++] : 0;
+            for (unsigned int i = 0; (i < archive.entryCount) && result; i++)
+            {
+                const ArchiveEntry *entry = &archive.entries[i];
 
-        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
+                if ((entry->pathOffset >= header->pathsSize) || (entry->offset > archive.size) || (entry->size > (archive.size - entry->offset)) ||
+                    (entry->compression > 1) || ((entry->compression == 0) && (entry->size != entry->dataSize))) result = false;
+            }
+        }
 
-        encodedData[j++] = base64encodeTable[(triple >> 3*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 2*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 1*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 0*6) & 0x3F];
-    }
+        if (result)
+        {
+            strncpy(archive.fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+            archives[archiveCount] = archive;
+            archiveCount++;
 
-    for (int i = 0; i < modTable[dataSize%3]; i++) encodedData[*outputSize - 1 - i] = '=';  // Padding character
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Archive mounted successfully (%i files, %s)", fileName, archive.entryCount, archive.mapped? "memory mapped" : "loaded");
+        }
+        else
+        {
+            UnloadArchiveData(&archive);
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount archive, not valid archive data", fileName);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open archive", fileName);
+#endif
 
-    return encodedData;
+    return result;
 }
 
-// Decode Base64 string data
-unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
+// Unmount assets archive
+// WARNING: Files data loaded from archive without copy (zero-copy) is not valid anymore
+void UnmountArchive(const char *fileName)
 {
-    static const unsigned char base64decodeTable[] = {
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
-        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
-        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
-    };
-
-    // Get output size of Base64 input data
-    int outSize = 0;
-    for (int i = 0; data[4*i] != 0; i++)
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    for (int i = 0; i < archiveCount; i++)
     {
-        if (data[4*i + 3] == '=')
+        if (strcmp(archives[i].fileName, fileName) == 0)
         {
-            if (data[4*i + 2] == '=') outSize += 1;
-            else outSize += 2;
+            Archive archive = archives[i];
+
+            for (int j = i; j < (archiveCount - 1); j++) archives[j] = archives[j + 1];
+            archiveCount--;
+            memset(&archives[archiveCount], 0, sizeof(Archive));
+
+            UnloadArchiveData(&archive);
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Archive unmounted successfully", fileName);
+            return;
         }
-        else outSize += 3;
     }
 
-    // Allocate memory to store decoded Base64 data
-    unsigned char *decodedData = (unsigned char *)RL_MALLOC(outSize);
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Archive not mounted", fileName);
+#endif
+}
 
-    for (int i = 0; i < outSize/3; i++)
-    {
-        unsigned char a = base64decodeTable[(int)data[4*i]];
-        unsigned char b = base64decodeTable[(int)data[4*i + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*i + 2]];
-        unsigned char d = base64decodeTable[(int)data[4*i + 3]];
+// Check if file is available in a mounted assets archive
+bool IsFileInArchive(const char *fileName)
+{
+    bool result = false;
 
-        decodedData[3*i] = (a << 2) | (b >> 4);
-        decodedData[3*i + 1] = (b << 4) | (c >> 2);
-        decodedData[3*i + 2] = (c << 6) | d;
-    }
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    const Archive *archive = NULL;
+    result = (archiveCount > 0) && (FindArchiveEntry(fileName, &archive) != NULL);
+#endif
 
-    if (outSize%3 == 1)
-    {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        decodedData[outSize - 1] = (a << 2) | (b >> 4);
-    }
-    else if (outSize%3 == 2)
+    return result;
+}
+
+// Get file data from mounted assets archive without copy (zero-copy), valid while archive is mounted
+// NOTE: Returns NULL if file is not available or it is compressed (use LoadFileData() instead)
+const unsigned char *GetArchiveFileData(const char *fileName, unsigned int *dataSize)
+{
+    const unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    const Archive *archive = NULL;
+    const ArchiveEntry *entry = (archiveCount > 0)? FindArchiveEntry(fileName, &archive) : NULL;
+
+    if ((entry != NULL) && (entry->compression == 0))
     {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*n + 2]];
-        decodedData[outSize - 2] = (a << 2) | (b >> 4);
-        decodedData[outSize - 1] = (b << 4) | (c >> 2);
+        data = archive->data + entry->offset;
+        *dataSize = entry->size;
     }
+#endif
 
-    *outputSize = outSize;
-    return decodedData;
+    return data;
 }
 
-// Open URL with default system browser (if available)
-// NOTE: This function is only safe to use if you control the URL given.
-// A user could craft a malicious string performing another action.
-// Only call this function yourself not with user input or make sure to check the string yourself.
-// Ref: https://github.com/raysan5/raylib/issues/686
-void OpenURL(const char *url)
+// Export files into an assets archive (.rpak), returns true on success
+// NOTE: Files stored with provided paths, files compressed only if size is reduced at least 10%,
+// already compressed formats (png, ogg, mp3...) usually stored as is, allowing zero-copy loading
+bool ExportArchive(FilePathList files, const char *fileName, bool compress)
 {
-    // Small security check trying to avoid (partially) malicious code...
-    // sorry for the inconvenience when you hit this point...
-    if (strchr(url, '\'') != NULL)
+    bool success = false;
+
+#if defined(SUPPORT_ASSETS_ARCHIVE) && defined(SUPPORT_STANDARD_FILEIO)
+    ArchiveHeader header = { { 'r', 'P', 'A', 'K' }, 100, files.count, 0 };
+    ArchiveEntry *entries = (ArchiveEntry *)RL_CALLOC(files.count + 1, sizeof(ArchiveEntry));
+
+    // Get entries paths (normalized) and hashes, required before writing entries data
+    unsigned int pathsCapacity = 1;
+    for (unsigned int i = 0; i < files.count; i++) pathsCapacity += (unsigned int)strlen(files.paths[i]) + 1;
+    char *paths = (char *)RL_CALLOC(pathsCapacity, 1);
+
+    for (unsigned int i = 0; i < files.count; i++)
     {
-        TRACELOG(LOG_WARNING, "SYSTEM: Provided URL is not valid");
+        entries[i].hash = GetArchivePath(files.paths[i], paths + header.pathsSize);
+        entries[i].pathOffset = header.pathsSize;
+        header.pathsSize += (unsigned int)strlen(paths + header.pathsSize) + 1;
     }
-    else
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
     {
-#if defined(PLATFORM_DESKTOP)
-        char *cmd = (char *)RL_CALLOC(strlen(url) + 32, sizeof(char));
-    #if defined(_WIN32)
-        sprintf(cmd, "explorer \"%s\"", url);
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
-    #endif
-    #if defined(__APPLE__)
-        sprintf(cmd, "open '%s'", url);
-    #endif
-        int result = system(cmd);
-        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
-        RL_FREE(cmd);
-#endif
-#if defined(PLATFORM_WEB)
-        emscripten_run_script(TextFormat("window.open('%s', '_blank')", url));
-#endif
-#if defined(PLATFORM_ANDROID)
-        JNIEnv *env = NULL;
-        JavaVM *vm = CORE.Android.app->activity->vm;
-        (*vm)->AttachCurrentThread(vm, &env, NULL);
+        // Entries index and paths written once entries data is written
+        unsigned long long offset = sizeof(ArchiveHeader) + (unsigned long long)files.count*sizeof(ArchiveEntry) + header.pathsSize;
+        for (unsigned long long i = 0; i < offset; i++) fputc(0, file);
 
-        jstring urlString = (*env)->NewStringUTF(env, url);
-        jclass uriClass = (*env)->FindClass(env, "android/net/Uri");
-        jmethodID uriParse = (*env)->GetStaticMethodID(env, uriClass, "parse", "(Ljava/lang/String;)Landroid/net/Uri;");
-        jobject uri = (*env)->CallStaticObjectMethod(env, uriClass, uriParse, urlString);
+        success = true;
 
-        jclass intentClass = (*env)->FindClass(env, "android/content/Intent");
-        jfieldID actionViewId = (*env)->GetStaticFieldID(env, intentClass, "ACTION_VIEW", "Ljava/lang/String;");
-        jobject actionView = (*env)->GetStaticObjectField(env, intentClass, actionViewId);
-        jmethodID newIntent = (*env)->GetMethodID(env, intentClass, "<init>", "(Ljava/lang/String;Landroid/net/Uri;)V");
-        jobject intent = (*env)->AllocObject(env, intentClass);
+        for (unsigned int i = 0; (i < files.count) && success; i++)
+        {
+            unsigned int dataSize = 0;
+            unsigned char *data = LoadFileData(files.paths[i], &dataSize);
 
-        (*env)->CallVoidMethod(env, intent, newIntent, actionView, uri);
-        jclass activityClass = (*env)->FindClass(env, "android/app/Activity");
-        jmethodID startActivity = (*env)->GetMethodID(env, activityClass, "startActivity", "(Landroid/content/Intent;)V");
-        (*env)->CallVoidMethod(env, CORE.Android.app->activity->clazz, startActivity, intent);
+            if (data == NULL) { success = false; break; }
 
-        (*vm)->DetachCurrentThread(vm);
+            const unsigned char *entryData = data;
+            unsigned int size = dataSize;
+            unsigned char *compData = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+            if (compress)
+            {
+                int compDataSize = 0;
+                compData = CompressData(data, (int)dataSize, &compDataSize);
+
+                if ((compData != NULL) && ((unsigned long long)compDataSize*10 < (unsigned long long)dataSize*9))
+                {
+                    entryData = compData;
+                    size = (unsigned int)compDataSize;
+                    entries[i].compression = 1;
+                }
+            }
 #endif
-    }
-}
+            // Entries data aligned for zero-copy views
+            while ((offset%ARCHIVE_DATA_ALIGNMENT) != 0) { fputc(0, file); offset++; }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
-//----------------------------------------------------------------------------------
-// Check if a key has been pressed once
-bool IsKeyPressed(int key)
-{
-    bool pressed = false;
+            entries[i].offset = offset;
+            entries[i].size = size;
+            entries[i].dataSize = dataSize;
 
-    if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
+            if (fwrite(entryData, 1, size, file) != size) success = false;
+            offset += size;
 
-    return pressed;
-}
+            RL_FREE(compData);
+            UnloadFileData(data);
+        }
 
-// Check if a key is being pressed (key held down)
-bool IsKeyDown(int key)
-{
-    if (CORE.Input.Keyboard.currentKeyState[key] == 1) return true;
-    else return false;
-}
+        if (success)
+        {
+            // Sort entries index by path hash (insertion sort), required for binary search
+            for (unsigned int i = 1; i < files.count; i++)
+            {
+                ArchiveEntry entry = entries[i];
+                int j = (int)i - 1;
 
-// Check if a key has been released once
-bool IsKeyReleased(int key)
-{
-    bool released = false;
+                while ((j >= 0) && ((entries[j].hash > entry.hash) || ((entries[j].hash == entry.hash) &&
+                       (strcmp(paths + entries[j].pathOffset, paths + entry.pathOffset) > 0))))
+                {
+                    entries[j + 1] = entries[j];
+                    j--;
+                }
 
-    if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
+                entries[j + 1] = entry;
+            }
 
-    return released;
-}
+            fseek(file, 0, SEEK_SET);
+            fwrite(&header, sizeof(ArchiveHeader), 1, file);
+            fwrite(entries, sizeof(ArchiveEntry), files.count, file);
+            fwrite(paths, 1, header.pathsSize, file);
+        }
 
-// Check if a key is NOT being pressed (key not held down)
-bool IsKeyUp(int key)
-{
-    if (CORE.Input.Keyboard.currentKeyState[key] == 0) return true;
-    else return false;
+        if (fclose(file) != 0) success = false;
+    }
+
+    RL_FREE(paths);
+    RL_FREE(entries);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Archive exported successfully (%i files)", fileName, files.count);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export archive", fileName);
+#endif
+
+    return success;
 }
 
-// Get the last key pressed
-int GetKeyPressed(void)
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+// Load file data from mounted assets archives, NULL if not available
+// NOTE: Uncompressed data is a view into archive data (zero-copy), ignored by UnloadFileData()
+// WARNING: Required by LoadFileData() [Module: utils]
+unsigned char *LoadArchiveFileData(const char *fileName, unsigned int *bytesRead)
 {
-    int value = 0;
+    unsigned char *data = NULL;
 
-    if (CORE.Input.Keyboard.keyPressedQueueCount > 0)
+    const Archive *archive = NULL;
+    const ArchiveEntry *entry = (archiveCount > 0)? FindArchiveEntry(fileName, &archive) : NULL;
+
+    if (entry == NULL) return NULL;
+
+    if (entry->compression == 0)
     {
-        // Get character from the queue head
-        value = CORE.Input.Keyboard.keyPressedQueue[0];
+        data = archive->data + entry->offset;
+        *bytesRead = entry->size;
 
-        // Shift elements 1 step toward the head.
-        for (int i = 0; i < (CORE.Input.Keyboard.keyPressedQueueCount - 1); i++)
-            CORE.Input.Keyboard.keyPressedQueue[i] = CORE.Input.Keyboard.keyPressedQueue[i + 1];
+        TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from archive (zero-copy)", fileName);
+    }
+    else
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        // Compressed data decompressed into a buffer of exact size (archive entry data size)
+        int dataSize = 0;
+        data = sinflate_alloc(archive->data + entry->offset, (int)entry->size, (int)entry->dataSize, &dataSize);
 
-        // Reset last character in the queue
-        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount - 1] = 0;
-        CORE.Input.Keyboard.keyPressedQueueCount--;
+        if ((data != NULL) && (dataSize == (int)entry->dataSize))
+        {
+            *bytesRead = entry->dataSize;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from archive", fileName);
+        }
+        else
+        {
+            RL_FREE(data);
+            data = NULL;
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress file from archive", fileName);
+        }
+#else
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Compressed archive files not supported", fileName);
+#endif
     }
 
-    return value;
+    return data;
 }
 
-// Get the last char pressed
-int GetCharPressed(void)
+// Check if data is a view into a mounted assets archive (zero-copy)
+// WARNING: Required by UnloadFileData() [Module: utils]
+bool IsArchiveFileData(const unsigned char *data)
 {
-    int value = 0;
+    for (int i = 0; i < archiveCount; i++)
+    {
+        if ((data >= archives[i].data) && (data <= (archives[i].data + archives[i].size))) return true;
+    }
 
-    if (CORE.Input.Keyboard.charPressedQueueCount > 0)
+    return false;
+}
+#endif
+
+// Load asset asynchronously (AssetType), returns asset handle (-1 on failure)
+// NOTE: Asset file read and decoded by a loading thread, GPU upload done on main thread at EndDrawing() (ProcessAssetUploads())
+int LoadAssetAsync(const char *fileName, int type)
+{
+    int asset = -1;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    if ((fileName == NULL) || (type < ASSET_IMAGE) || (type > ASSET_WAVE))
     {
-        // Get character from the queue head
-        value = CORE.Input.Keyboard.charPressedQueue[0];
+        TRACELOG(LOG_WARNING, "ASSET: Failed to load asset asynchronously, asset type not valid");
+        return -1;
+    }
 
-        // Shift elements 1 step toward the head.
-        for (int i = 0; i < (CORE.Input.Keyboard.charPressedQueueCount - 1); i++)
-            CORE.Input.Keyboard.charPressedQueue[i] = CORE.Input.Keyboard.charPressedQueue[i + 1];
+    LOCK_ASSETS();
 
-        // Reset last character in the queue
-        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount - 1] = 0;
-        CORE.Input.Keyboard.charPressedQueueCount--;
+    int index = -1;
+    for (int i = 0; i < MAX_ASYNC_ASSETS; i++)
+    {
+        if (assetLoader.assets[i].state == ASSET_STATE_INVALID) { index = i; break; }
     }
 
-    return value;
-}
+    if (index == -1) TRACELOG(LOG_WARNING, "ASSET: [%s] Maximum assets loading asynchronously reached (%i)", fileName, MAX_ASYNC_ASSETS);
+    else
+    {
+        AsyncAsset *data = &assetLoader.assets[index];
+        int generation = data->generation;
 
-// Set a custom key to exit program
-// NOTE: default exitKey is ESCAPE
-void SetExitKey(int key)
-{
-#if !defined(PLATFORM_ANDROID)
-    CORE.Input.Keyboard.exitKey = key;
-#endif
-}
+        memset(data, 0, sizeof(AsyncAsset));
+        data->generation = generation;
+        data->type = type;
+        data->state = ASSET_STATE_QUEUED;
+        data->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(data->fileName, fileName);
 
-// NOTE: Gamepad support not implemented in emscripten GLFW3 (PLATFORM_WEB)
+        assetLoader.queue[(assetLoader.first + assetLoader.count)%MAX_ASYNC_ASSETS] = index;
+        assetLoader.count++;
 
-// Check if a gamepad is available
-bool IsGamepadAvailable(int gamepad)
-{
-    bool result = false;
+        asset = index + generation*MAX_ASYNC_ASSETS;
 
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) result = true;
+#if defined(ASYNC_LOADING_THREADED)
+        // Loading threads started on first asset loading
+        if (!assetLoader.started)
+        {
+            for (int i = 0; i < ASYNC_LOADING_THREADS; i++)
+            {
+                if (pthread_create(&assetLoader.threadId[assetLoader.threadCount], NULL, &AssetLoadingThread, NULL) == 0) assetLoader.threadCount++;
+            }
 
-    return result;
-}
+            if (assetLoader.threadCount == 0) TRACELOG(LOG_WARNING, "ASSET: Failed to create loading threads, assets loaded on main thread");
+            else TRACELOG(LOG_INFO, "ASSET: Loading threads started (%i)", assetLoader.threadCount);
+        }
 
-// Get gamepad internal name id
-const char *GetGamepadName(int gamepad)
-{
-#if defined(PLATFORM_DESKTOP)
-    if (CORE.Input.Gamepad.ready[gamepad]) return glfwGetJoystickName(gamepad);
-    else return NULL;
-#endif
-#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    if (CORE.Input.Gamepad.ready[gamepad]) ioctl(CORE.Input.Gamepad.streamId[gamepad], JSIOCGNAME(64), &CORE.Input.Gamepad.name[gamepad]);
-    return CORE.Input.Gamepad.name[gamepad];
-#endif
-#if defined(PLATFORM_WEB)
-    return CORE.Input.Gamepad.name[gamepad];
+        pthread_cond_signal(&assetCond);
 #endif
-#if defined(PLATFORM_NX)
-    int type = CORE.Input.Gamepad.nxPadStyle[gamepad];
-    switch(type) {
-        case HidNpadStyleTag_NpadFullKey: return "Nintendo Switch Pro Controller";
-        case HidNpadStyleTag_NpadHandheld: return "Handheld Joy-Con controller";
-        case HidNpadStyleTag_NpadJoyDual: return "Dual Joy-Con controller";
-        case HidNpadStyleTag_NpadJoyLeft: return "Single Joy-Con left controller";
-        case HidNpadStyleTag_NpadJoyRight: return "Single Joy-Con right controller";
-        case HidNpadStyleTag_NpadGc: return "GameCube controller";
-        case HidNpadStyleTag_NpadPalma: return "Poké Ball Plus controller";
-        case HidNpadStyleTag_NpadLark: return "NES/Famicom controller";
-        case HidNpadStyleTag_NpadHandheldLark: return "Handheld NES/Famicom controller";
-        case HidNpadStyleTag_NpadLucia: return "SNES controller";
-        case HidNpadStyleTag_NpadLagon: return "N64 controller";
-        case HidNpadStyleTag_NpadLager: return "Sega Genesis controller";
-        case HidNpadStyleTag_NpadSystemExt: return "Generic external controller";
-        default: return "Generic controller";
+        assetLoader.started = true;
     }
+
+    UNLOCK_ASSETS();
+#else
+    TRACELOG(LOG_WARNING, "ASSET: [%s] Asynchronous assets loading not supported", fileName);
 #endif
-    return NULL;
+
+    return asset;
 }
 
-// Get gamepad axis count
-int GetGamepadAxisCount(int gamepad)
+// Get asset loading state (AssetState)
+int GetAssetState(int asset)
 {
-#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    int axisCount = 0;
-    if (CORE.Input.Gamepad.ready[gamepad]) ioctl(CORE.Input.Gamepad.streamId[gamepad], JSIOCGAXES, &axisCount);
-    CORE.Input.Gamepad.axisCount = axisCount;
+    int state = ASSET_STATE_INVALID;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (data != NULL) state = data->state;
+    UNLOCK_ASSETS();
 #endif
 
-    return CORE.Input.Gamepad.axisCount;
+    return state;
 }
 
-// Get axis movement vector for a gamepad
-float GetGamepadAxisMovement(int gamepad, int axis)
+// Get asset image (ASSET_IMAGE)
+Image GetAssetImage(int asset)
 {
-    float value = 0;
-
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (axis < MAX_GAMEPAD_AXIS) &&
-        (fabsf(CORE.Input.Gamepad.axisState[gamepad][axis]) > 0.1f)) value = CORE.Input.Gamepad.axisState[gamepad][axis];      // 0.1f = GAMEPAD_AXIS_MINIMUM_DRIFT/DELTA
+    Image image = { 0 };
 
-    return value;
-}
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (IsAsyncAssetLoaded(data, ASSET_IMAGE)) image = data->image;
+    UNLOCK_ASSETS();
+#endif
 
-#if defined(PLATFORM_NX)
-void SetGamepadYAxisInverted(int gamepad, float yInverted)
-{        
-    if (yInverted == -1.0f || yInverted == 1.0f)
-    {
-        CORE.Input.Gamepad.yInverted[gamepad] = yInverted;
-    }
+    return image;
 }
 
-float GetGamepadYAxisInverted(int gamepad)
+// Get asset texture (ASSET_TEXTURE)
+// NOTE: Texture size and format available once loaded, texture id not valid until ready (ASSET_STATE_READY)
+Texture2D GetAssetTexture(int asset)
 {
-    return CORE.Input.Gamepad.yInverted[gamepad];
-}
+    Texture2D texture = { 0 };
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (IsAsyncAssetLoaded(data, ASSET_TEXTURE)) texture = data->texture;
+    UNLOCK_ASSETS();
 #endif
 
-// Check if a gamepad button has been pressed once
-bool IsGamepadButtonPressed(int gamepad, int button)
+    return texture;
+}
+
+// Get asset font (ASSET_FONT)
+// NOTE: Font glyphs data available once loaded, font texture not valid until ready (ASSET_STATE_READY)
+Font GetAssetFont(int asset)
 {
-    bool pressed = false;
+    Font font = { 0 };
 
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 0) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) pressed = true;
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (IsAsyncAssetLoaded(data, ASSET_FONT)) font = data->font;
+    UNLOCK_ASSETS();
+#endif
 
-    return pressed;
+    return font;
 }
 
-// Check if a gamepad button is being pressed
-bool IsGamepadButtonDown(int gamepad, int button)
+// Get asset model (ASSET_MODEL)
+// NOTE: Model meshes and materials data available once loaded, not valid for drawing until ready (ASSET_STATE_READY)
+Model GetAssetModel(int asset)
 {
-    bool result = false;
+    Model model = { 0 };
 
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) result = true;
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (IsAsyncAssetLoaded(data, ASSET_MODEL)) model = data->model;
+    UNLOCK_ASSETS();
+#endif
 
-    return result;
+    return model;
 }
 
-// Check if a gamepad button has NOT been pressed once
-bool IsGamepadButtonReleased(int gamepad, int button)
+// Get asset wave (ASSET_WAVE)
+Wave GetAssetWave(int asset)
 {
-    bool released = false;
+    Wave wave = { 0 };
 
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 1) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) released = true;
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    AsyncAsset *data = GetAsyncAsset(asset);
+    if (IsAsyncAssetLoaded(data, ASSET_WAVE)) wave = data->wave;
+    UNLOCK_ASSETS();
+#endif
 
-    return released;
+    return wave;
 }
 
-// Check if a gamepad button is NOT being pressed
-bool IsGamepadButtonUp(int gamepad, int button)
+// Release asset handle, asset data unloaded or kept (owned by user from now on)
+// NOTE: Asset data not ready is always unloaded, once loaded if still loading
+void ReleaseAsset(int asset, bool unloadData)
 {
-    bool result = false;
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
 
-    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) result = true;
+    AsyncAsset *data = GetAsyncAsset(asset);
 
-    return result;
-}
+    if (data != NULL)
+    {
+        switch (data->state)
+        {
+            case ASSET_STATE_QUEUED:
+            case ASSET_STATE_LOADING: data->released = true; break;     // Asset freed once dequeued or loaded
+            case ASSET_STATE_UPLOADING:
+            {
+                UnloadAsyncAssetData(data);
+                assetLoader.uploadCount--;
+                FreeAsyncAsset(data);
+            } break;
+            case ASSET_STATE_READY:
+            {
+                if (unloadData) UnloadAsyncAssetData(data);
+                FreeAsyncAsset(data);
+            } break;
+            default: FreeAsyncAsset(data); break;
+        }
+    }
 
-// Get the last gamepad button pressed
-int GetGamepadButtonPressed(void)
-{
-    return CORE.Input.Gamepad.lastButtonPressed;
+    UNLOCK_ASSETS();
+#endif
 }
 
-// Set internal gamepad mappings
-int SetGamepadMappings(const char *mappings)
+// Set assets GPU upload time per frame, in milliseconds (at least one texture or mesh uploaded per frame)
+void SetAssetUploadBudget(float milliseconds)
 {
-    int result = 0;
-
-#if defined(PLATFORM_DESKTOP)
-    result = glfwUpdateGamepadMappings(mappings);
+#if defined(SUPPORT_ASYNC_LOADING)
+    assetUploadBudget = (milliseconds > 0.0f)? milliseconds/1000.0 : 0.0;
 #endif
-
-    return result;
 }
 
-// Check if a mouse button has been pressed once
-bool IsMouseButtonPressed(int button)
+// Get assets waiting GPU upload count
+int GetAssetUploadCount(void)
 {
-    bool pressed = false;
-
-    if ((CORE.Input.Mouse.currentButtonState[button] == 1) && (CORE.Input.Mouse.previousButtonState[button] == 0)) pressed = true;
+    int count = 0;
 
-    // Map touches to mouse buttons checking
-    if ((CORE.Input.Touch.currentTouchState[button] == 1) && (CORE.Input.Touch.previousTouchState[button] == 0)) pressed = true;
+#if defined(SUPPORT_ASYNC_LOADING)
+    LOCK_ASSETS();
+    count = assetLoader.uploadCount;
+    UNLOCK_ASSETS();
+#endif
 
-    return pressed;
+    return count;
 }
 
-// Check if a mouse button is being pressed
-bool IsMouseButtonDown(int button)
+// Process assets waiting GPU upload, time budgeted (SetAssetUploadBudget())
+// NOTE: Called by EndDrawing(), if loading threads not available, queued assets are also loaded here
+void ProcessAssetUploads(void)
 {
-    bool down = false;
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (!assetLoader.started) return;
 
-    if (CORE.Input.Mouse.currentButtonState[button] == 1) down = true;
+    PROFILE_ZONE_BEGIN("ProcessAssetUploads");
 
-    // Map touches to mouse buttons checking
-    if (CORE.Input.Touch.currentTouchState[button] == 1) down = true;
+    double startTime = GetTime();
 
-    return down;
-}
+    LOCK_ASSETS();
 
-// Check if a mouse button has been released once
-bool IsMouseButtonReleased(int button)
-{
-    bool released = false;
+    do
+    {
+        if ((assetLoader.threadCount == 0) && (assetLoader.count > 0))
+        {
+            // Assets loaded on main thread, loading threads not available
+            AsyncAsset *asset = &assetLoader.assets[assetLoader.queue[assetLoader.first]];
+            assetLoader.first = (assetLoader.first + 1)%MAX_ASYNC_ASSETS;
+            assetLoader.count--;
 
-    if ((CORE.Input.Mouse.currentButtonState[button] == 0) && (CORE.Input.Mouse.previousButtonState[button] == 1)) released = true;
+            if (asset->released) FreeAsyncAsset(asset);
+            else
+            {
+                asset->state = ASSET_STATE_LOADING;
+                FinishAsyncAssetLoading(asset, LoadAsyncAssetData(asset));
+            }
+        }
+        else
+        {
+            // Assets uploaded in loading finish order
+            AsyncAsset *asset = NULL;
+            for (int i = 0; i < MAX_ASYNC_ASSETS; i++)
+            {
+                AsyncAsset *current = &assetLoader.assets[i];
+                if ((current->state == ASSET_STATE_UPLOADING) && ((asset == NULL) || ((int)(current->order - asset->order) < 0))) asset = current;
+            }
 
-    // Map touches to mouse buttons checking
-    if ((CORE.Input.Touch.currentTouchState[button] == 0) && (CORE.Input.Touch.previousTouchState[button] == 1)) released = true;
+            if (asset == NULL) break;
 
-    return released;
-}
+            // NOTE: Assets waiting upload only accessed by main thread, loading threads not blocked while uploading
+            UNLOCK_ASSETS();
+            bool uploaded = UploadAsyncAssetData(asset);
+            LOCK_ASSETS();
 
-// Check if a mouse button is NOT being pressed
-bool IsMouseButtonUp(int button)
-{
-    return !IsMouseButtonDown(button);
-}
+            if (uploaded)
+            {
+                asset->state = ASSET_STATE_READY;
+                assetLoader.uploadCount--;
+                TRACELOG(LOG_INFO, "ASSET: [%s] Asset loaded successfully", asset->fileName);
+            }
+        }
+    } while ((GetTime() - startTime) < assetUploadBudget);
 
-// Get mouse position X
-int GetMouseX(void)
-{
-#if defined(PLATFORM_ANDROID)
-    return (int)CORE.Input.Touch.position[0].x;
-#else
-    return (int)((CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x);
-#endif
-}
+    UNLOCK_ASSETS();
 
-// Get mouse position Y
-int GetMouseY(void)
-{
-#if defined(PLATFORM_ANDROID)
-    return (int)CORE.Input.Touch.position[0].y;
-#else
-    return (int)((CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y);
+    PROFILE_ZONE_END();
 #endif
 }
 
-// Get mouse position XY
-Vector2 GetMousePosition(void)
+// Watch file or directory changes, for directories changes of files in it are notified (not recursive)
+// NOTE: Changes notified by system on Linux (inotify), files modification times polled otherwise (FILE_WATCH_POLL_INTERVAL)
+bool WatchFile(const char *path)
 {
-    Vector2 position = { 0 };
+    bool result = false;
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB)
-    position = GetTouchPosition(0);
+#if defined(SUPPORT_FILE_WATCHER)
+    if (GetWatchedFile(path) != NULL) return true;
+
+    WatchedFile *watch = NULL;
+    for (int i = 0; i < MAX_WATCHED_FILES; i++) if (fileWatcher.files[i].path == NULL) { watch = &fileWatcher.files[i]; break; }
+
+    if (watch == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file, maximum watched files reached (%i)", path, MAX_WATCHED_FILES);
+        return false;
+    }
+
+    bool isDirectory = DirectoryExists(path);
+
+    if (!isDirectory && !FileExists(path))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file, file does not exist", path);
+        return false;
+    }
+
+    // NOTE: Directory trailing separator removed, changed files paths built as: directory + '/' + file name
+    unsigned int length = (unsigned int)strlen(path);
+    while (isDirectory && (length > 1) && ((path[length - 1] == '/') || (path[length - 1] == '\\'))) length--;
+
+    watch->path = (char *)RL_MALLOC(length + 1);
+    memcpy(watch->path, path, length);
+    watch->path[length] = '\0';
+    watch->isDirectory = isDirectory;
+
+#if defined(FILE_WATCH_INOTIFY)
+    if (!fileWatcher.initialized)
+    {
+        fileWatcher.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        fileWatcher.initialized = (fileWatcher.fd >= 0);
+    }
+
+    // NOTE: Files are watched through parent directory, editors usually save files replacing them (new file renamed)
+    // NOTE: Same watch descriptor returned for same directory, shared by files in it
+    watch->name = isDirectory? NULL : GetFileName(watch->path);
+    watch->wd = fileWatcher.initialized? inotify_add_watch(fileWatcher.fd, isDirectory? watch->path : GetDirectoryPath(watch->path), IN_CLOSE_WRITE | IN_MOVED_TO) : -1;
+
+    if (watch->wd < 0)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file", path);
+        RL_FREE(watch->path);
+        watch->path = NULL;
+        return false;
+    }
 #else
-    position.x = (CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
-    position.y = (CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+    if (isDirectory) ScanWatchedDirectory(watch, false);
+    else watch->modTime = GetFileModTime(watch->path);
 #endif
 
-    return position;
+    result = true;
+#endif
+
+    return result;
 }
 
-// Get mouse delta between frames
-Vector2 GetMouseDelta(void)
+// Stop watching file or directory changes
+void UnwatchFile(const char *path)
 {
-    Vector2 delta = { 0 };
-
-    delta.x = CORE.Input.Mouse.currentPosition.x - CORE.Input.Mouse.previousPosition.x;
-    delta.y = CORE.Input.Mouse.currentPosition.y - CORE.Input.Mouse.previousPosition.y;
+#if defined(SUPPORT_FILE_WATCHER)
+    WatchedFile *watch = GetWatchedFile(path);
 
-    return delta;
-}
+    if (watch == NULL) return;
 
-// Set mouse position XY
-void SetMousePosition(int x, int y)
-{
-    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
-    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+#if defined(FILE_WATCH_INOTIFY)
+    // NOTE: Directory watch only removed if not used by other watched files
+    bool shared = false;
+    for (int i = 0; i < MAX_WATCHED_FILES; i++)
+    {
+        if ((fileWatcher.files[i].path != NULL) && (&fileWatcher.files[i] != watch) && (fileWatcher.files[i].wd == watch->wd)) shared = true;
+    }
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    // NOTE: emscripten not implemented
-    glfwSetCursorPos(CORE.Window.handle, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+    if (!shared) inotify_rm_watch(fileWatcher.fd, watch->wd);
+#else
+    RL_FREE(watch->files);
 #endif
-}
 
-// Set mouse offset
-// NOTE: Useful when rendering to different size targets
-void SetMouseOffset(int offsetX, int offsetY)
-{
-    CORE.Input.Mouse.offset = (Vector2){ (float)offsetX, (float)offsetY };
+    RL_FREE(watch->path);
+    memset(watch, 0, sizeof(WatchedFile));
+#endif
 }
 
-// Set mouse scaling
-// NOTE: Useful when rendering to different size targets
-void SetMouseScale(float scaleX, float scaleY)
+// Load files changed since last call, every file changed only once
+// NOTE: Changed files paths are the watched file paths or watched directory paths + '/' + file name
+FilePathList LoadChangedFiles(void)
 {
-    CORE.Input.Mouse.scale = (Vector2){ scaleX, scaleY };
-}
+    FilePathList files = { 0 };
 
-// Get mouse wheel movement Y
-float GetMouseWheelMove(void)
-{
-    float result = 0.0f;
+#if defined(SUPPORT_FILE_WATCHER)
+    ReadFileChanges();
 
-#if !defined(PLATFORM_ANDROID) || !defined(PLATFORM_NX)
-    if (fabsf(CORE.Input.Mouse.currentWheelMove.x) > fabsf(CORE.Input.Mouse.currentWheelMove.y)) result = (float)CORE.Input.Mouse.currentWheelMove.x;
-    else result = (float)CORE.Input.Mouse.currentWheelMove.y;
+    files = LoadArenaFilePathList(&fileWatcher.changes);
 #endif
 
-    return result;
+    return files;
 }
 
-#if defined(PLATFORM_NX)
-void SetCameraZoomFactor(Vector2 zoomFactor)
+// Unload files changed paths
+void UnloadChangedFiles(FilePathList files)
 {
-    CORE.Input.Mouse.currentWheelMove = zoomFactor;
+    RL_FREE(files.paths);
 }
-void SetCameraPrevZoomFactor(Vector2 previousZoomFactor)
+
+// Set texture reloaded on file changes (ReloadChangedAssets()), file watched
+void SetTextureHotReload(Texture2D *texture, const char *fileName)
 {
-    CORE.Input.Mouse.previousWheelMove = previousZoomFactor;
-}
+#if defined(SUPPORT_FILE_WATCHER)
+    AddHotReloadAsset(texture, HOT_RELOAD_TEXTURE, fileName, NULL);
 #endif
+}
 
-// Get mouse wheel movement X/Y as a vector
-Vector2 GetMouseWheelMoveV(void)
+// Set shader reloaded on files changes (ReloadChangedAssets()), files watched
+// NOTE: Shader locations could change on reloading, shader.locs are updated
+void SetShaderHotReload(Shader *shader, const char *vsFileName, const char *fsFileName)
 {
-    Vector2 result = { 0 };
-
-    result = CORE.Input.Mouse.currentWheelMove;
+#if defined(SUPPORT_FILE_WATCHER)
+    AddHotReloadAsset(shader, HOT_RELOAD_SHADER, vsFileName, fsFileName);
+#endif
+}
 
-    return result;
+// Set model reloaded on file changes (ReloadChangedAssets()), file watched
+void SetModelHotReload(Model *model, const char *fileName)
+{
+#if defined(SUPPORT_FILE_WATCHER)
+    AddHotReloadAsset(model, HOT_RELOAD_MODEL, fileName, NULL);
+#endif
 }
 
-// Set mouse cursor
-// NOTE: This is a no-op on platforms other than PLATFORM_DESKTOP
-void SetMouseCursor(int cursor)
+// Clear asset hot-reloading (texture, shader or model), files still watched
+void ClearHotReload(const void *asset)
 {
-#if defined(PLATFORM_DESKTOP)
-    CORE.Input.Mouse.cursor = cursor;
-    if (cursor == MOUSE_CURSOR_DEFAULT) glfwSetCursor(CORE.Window.handle, NULL);
-    else
+#if defined(SUPPORT_FILE_WATCHER)
+    for (int i = 0; i < MAX_HOT_RELOAD_ASSETS; i++)
     {
-        // NOTE: We are relating internal GLFW enum values to our MouseCursor enum values
-        glfwSetCursor(CORE.Window.handle, glfwCreateStandardCursor(0x00036000 + cursor));
+        if (fileWatcher.assets[i].asset == asset)
+        {
+            RL_FREE(fileWatcher.assets[i].fileName);
+            RL_FREE(fileWatcher.assets[i].fsFileName);
+            memset(&fileWatcher.assets[i], 0, sizeof(HotReloadAsset));
+        }
     }
 #endif
 }
 
-// Get touch position X for touch point 0 (relative to screen size)
-int GetTouchX(void)
+// Reload assets of files changed, only affected assets reloaded, returns assets reloaded count
+// NOTE: Assets replaced in place, textures data updated keeping same texture id if size and format not changed,
+// on reloading failure (i.e. shader compilation error) previous asset is kept
+int ReloadChangedAssets(FilePathList files)
 {
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    return (int)CORE.Input.Touch.position[0].x;
-#else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
-    return GetMouseX();
+    int count = 0;
+
+#if defined(SUPPORT_FILE_WATCHER)
+    for (int i = 0; i < MAX_HOT_RELOAD_ASSETS; i++)
+    {
+        HotReloadAsset *asset = &fileWatcher.assets[i];
+
+        if (asset->asset == NULL) continue;
+
+        for (unsigned int j = 0; j < files.count; j++)
+        {
+            if (((asset->fileName != NULL) && (strcmp(files.paths[j], asset->fileName) == 0)) ||
+                ((asset->fsFileName != NULL) && (strcmp(files.paths[j], asset->fsFileName) == 0)))
+            {
+                if (ReloadHotReloadAsset(asset)) count++;
+                break;
+            }
+        }
+    }
 #endif
+
+    return count;
 }
 
-// Get touch position Y for touch point 0 (relative to screen size)
-int GetTouchY(void)
+// Compress data (DEFLATE algorithm)
+unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    return (int)CORE.Input.Touch.position[0].y;
-#else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
-    return GetMouseY();
+    #define COMPRESSION_QUALITY_DEFLATE  8
+
+    unsigned char *compData = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    // Compress data and generate a valid DEFLATE stream
+    struct sdefl sdefl = { 0 };
+    int bounds = sdefl_bound(dataSize);
+    compData = (unsigned char *)RL_CALLOC(bounds, 1);
+    *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbwi
+
+    TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
+
+    return compData;
 }
 
-// Get touch position XY for a touch point index (relative to screen size)
-// TODO: Touch position should be scaled depending on display size and render size
-Vector2 GetTouchPosition(int index)
+// Decompress data (DEFLATE algorithm)
+// NOTE: Output memory allocated once with decompressed size: raw DEFLATE data does not store it,
+// computed by a first decompression pass (data not stored), gzip data provides it (ISIZE)
+unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
-    Vector2 position = { -1.0f, -1.0f };
+    unsigned char *data = NULL;
 
-#if defined(PLATFORM_DESKTOP)
-    // TODO: GLFW does not support multi-touch input just yet
-    // https://www.codeproject.com/Articles/668404/Programming-for-Multi-Touch
-    // https://docs.microsoft.com/en-us/windows/win32/wintouch/getting-started-with-multi-touch-messages
-    if (index == 0) position = GetMousePosition();
-#endif
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
-    if (index < MAX_TOUCH_POINTS) position = CORE.Input.Touch.position[index];
-    else TRACELOG(LOG_WARNING, "INPUT: Required touch point out of range (Max touch points: %i)", MAX_TOUCH_POINTS);
+#if defined(SUPPORT_COMPRESSION_API)
+    *dataSize = 0;
+
+    // Get decompressed size hint from gzip footer (ISIZE), ignored if not possible for DEFLATE (max ratio ~1032:1)
+    // NOTE: Size hint validated on decompression, size computed if wrong (i.e. multi-member gzip data)
+    int sizeHint = -1;
+    if ((compDataSize >= 18) && (compData[0] == 0x1f) && (compData[1] == 0x8b))
+    {
+        const unsigned char *footer = compData + compDataSize - 4;
+        long long size = (long long)footer[0] | ((long long)footer[1] << 8) | ((long long)footer[2] << 16) | ((long long)footer[3] << 24);
+        if ((size <= 0x7fffffff) && (size <= (long long)compDataSize*1032)) sizeHint = (int)size;
+    }
+
+    data = sinflate_alloc(compData, compDataSize, sizeHint, dataSize);
+
+    if (data != NULL) TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data, not valid DEFLATE data");
 #endif
 
-    return position;
+    return data;
 }
 
-// Get touch point identifier for given index
-int GetTouchPointId(int index)
+// Compress data stream (DEFLATE algorithm), data read and written in chunks
+// NOTE: Input data compressed in blocks of 256KB, matches found up to 32KB back into previous block
+bool CompressDataStream(DataReadCallback read, DataWriteCallback write, void *userData)
 {
-    int id = -1;
+    bool result = false;
 
-    if (index < MAX_TOUCH_POINTS) id = CORE.Input.Touch.pointId[index];
+#if defined(SUPPORT_COMPRESSION_API)
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+    unsigned char *input = (unsigned char *)RL_MALLOC(SDEFL_WIN_SIZ + SDEFL_BLK_MAX);     // Previous data history + block
+    unsigned char *output = (unsigned char *)RL_MALLOC(sdefl_bound(SDEFL_BLK_MAX));
 
-    return id;
+    if ((sdefl != NULL) && (input != NULL) && (output != NULL))
+    {
+        unsigned long long dataSize = 0;
+        unsigned long long compDataSize = 0;
+        int history = 0;
+        bool last = false;
+
+        result = true;
+
+        while (result && !last)
+        {
+            // Fill input block, last block if no more data can be read
+            int size = 0;
+            while (size < SDEFL_BLK_MAX)
+            {
+                int bytesRead = read(input + history + size, SDEFL_BLK_MAX - size, userData);
+
+                if (bytesRead <= 0) { last = true; break; }
+                size += bytesRead;
+            }
+
+            int outputSize = sdeflate_chunk(sdefl, output, input, history, size, COMPRESSION_QUALITY_DEFLATE, last);
+            if ((outputSize > 0) && !write(output, outputSize, userData)) result = false;
+
+            dataSize += size;
+            compDataSize += outputSize;
+
+            // Keep last input data as history for next block
+            int available = history + size;
+            history = (available < SDEFL_WIN_SIZ)? available : SDEFL_WIN_SIZ;
+            memmove(input, input + available - history, history);
+        }
+
+        if (result) TRACELOG(LOG_INFO, "SYSTEM: Compress data stream: Original size: %llu -> Comp. size: %llu", dataSize, compDataSize);
+        else TRACELOG(LOG_WARNING, "SYSTEM: Compress data stream aborted, data could not be written");
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate required compression memory");
+
+    RL_FREE(output);
+    RL_FREE(input);
+    RL_FREE(sdefl);
+#endif
+
+    return result;
 }
 
-// Get number of touch points
-int GetTouchPointCount(void)
+// Decompress data stream (DEFLATE algorithm, zlib or gzip wrapped), data read and written in chunks
+// NOTE: Only input chunk and a 64KB output window kept in memory, no matter decompressed size
+bool DecompressDataStream(DataReadCallback read, DataWriteCallback write, void *userData)
 {
-    return CORE.Input.Touch.pointCount;
-}
+    bool result = false;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+#if defined(SUPPORT_COMPRESSION_API)
+    struct sinfl_stream *stream = (struct sinfl_stream *)RL_CALLOC(1, sizeof(struct sinfl_stream));
+    unsigned char *chunk = (unsigned char *)RL_MALLOC(COMPRESSION_STREAM_CHUNK_SIZE);
+    unsigned char *window = (unsigned char *)RL_MALLOC(SINFL_WIN_SIZ);
 
-// Initialize display device and framebuffer
-// NOTE: width and height represent the screen (framebuffer) desired size, not actual display size
-// If width or height are 0, default display size will be used for framebuffer size
-// NOTE: returns false in case graphic device could not be created
-static bool InitGraphicsDevice(int width, int height)
-{
-    CORE.Window.screen.width = width;            // User desired width
-    CORE.Window.screen.height = height;          // User desired height
-    CORE.Window.screenScale = MatrixIdentity();  // No draw scaling required by default
+    if ((stream != NULL) && (chunk != NULL) && (window != NULL))
+    {
+        DataStreamCallbacks callbacks = { read, write, userData };
 
-    // NOTE: Framebuffer (render area - CORE.Window.render.width, CORE.Window.render.height) could include black bars...
-    // ...in top-down or left-right to match display aspect ratio (no weird scaling)
+        stream->read = ReadInflateStream;
+        stream->write = WriteInflateStream;
+        stream->usr = &callbacks;
+        stream->chunk = chunk;
+        stream->chunk_siz = COMPRESSION_STREAM_CHUNK_SIZE;
+        stream->out = window;
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    glfwSetErrorCallback(ErrorCallback);
-/*
-    // TODO: Setup GLFW custom allocators to match raylib ones
-    const GLFWallocator allocator = {
-        .allocate = MemAlloc,
-        .deallocate = MemFree,
-        .reallocate = MemRealloc,
-        .user = NULL
-    };
+        sinflate_stream(stream);
+        result = !stream->err;      // NOTE: Decompressed size could exceed returned int range
 
-    glfwInitAllocator(&allocator);
-*/
-#if defined(__APPLE__)
-    glfwInitHint(GLFW_COCOA_CHDIR_RESOURCES, GLFW_FALSE);
+        if (result) TRACELOG(LOG_INFO, "SYSTEM: Decompress data stream: Original size: %u", stream->pos);
+        else TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data stream, not valid DEFLATE data or aborted");
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate required decompression memory");
+
+    RL_FREE(window);
+    RL_FREE(chunk);
+    RL_FREE(stream);
 #endif
 
-    if (!glfwInit())
-    {
-        TRACELOG(LOG_WARNING, "GLFW: Failed to initialize GLFW");
-        return false;
-    }
+    return result;
+}
 
-    glfwDefaultWindowHints();                       // Set default windows hints
-    //glfwWindowHint(GLFW_RED_BITS, 8);             // Framebuffer red color component bits
-    //glfwWindowHint(GLFW_GREEN_BITS, 8);           // Framebuffer green color component bits
-    //glfwWindowHint(GLFW_BLUE_BITS, 8);            // Framebuffer blue color component bits
-    //glfwWindowHint(GLFW_ALPHA_BITS, 8);           // Framebuffer alpha color component bits
-    //glfwWindowHint(GLFW_DEPTH_BITS, 24);          // Depthbuffer bits
-    //glfwWindowHint(GLFW_REFRESH_RATE, 0);         // Refresh rate for fullscreen window
-    //glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API); // OpenGL API to use. Alternative: GLFW_OPENGL_ES_API
-    //glfwWindowHint(GLFW_AUX_BUFFERS, 0);          // Number of auxiliar buffers
+// Encode data to Base64 string
+char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
+{
+    static const unsigned char base64encodeTable[] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+        'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+    };
 
-    // Check window creation flags
-    if ((CORE.Window.flags & FLAG_FULLSCREEN_MODE) > 0) CORE.Window.fullscreen = true;
+    static const int modTable[] = { 0, 2, 1 };
 
-    if ((CORE.Window.flags & FLAG_WINDOW_HIDDEN) > 0) glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE); // Visible window
-    else glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);     // Window initially hidden
+    *outputSize = 4*((dataSize + 2)/3);
 
-    if ((CORE.Window.flags & FLAG_WINDOW_UNDECORATED) > 0) glfwWindowHint(GLFW_DECORATED, GLFW_FALSE); // Border and buttons on Window
-    else glfwWindowHint(GLFW_DECORATED, GLFW_TRUE);   // Decorated window
+    char *encodedData = (char *)RL_MALLOC(*outputSize);
 
-    if ((CORE.Window.flags & FLAG_WINDOW_RESIZABLE) > 0) glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE); // Resizable window
-    else glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);  // Avoid window being resizable
+    if (encodedData == NULL) return NULL;
 
-    // Disable FLAG_WINDOW_MINIMIZED, not supported on initialization
-    if ((CORE.Window.flags & FLAG_WINDOW_MINIMIZED) > 0) CORE.Window.flags &= ~FLAG_WINDOW_MINIMIZED;
+    for (int i = 0, j = 0; i < dataSize;)
+    {
+        unsigned int octetA = (i < dataSize)? (unsigned char)data[i++] : 0;
+        unsigned int octetB = (i < dataSize)? (unsigned char)data[i++] : 0;
+        unsigned int octetC = (i < dataSize)? (unsigned char)data[i++] : 0;
 
-    // Disable FLAG_WINDOW_MAXIMIZED, not supported on initialization
-    if ((CORE.Window.flags & FLAG_WINDOW_MAXIMIZED) > 0) CORE.Window.flags &= ~FLAG_WINDOW_MAXIMIZED;
+        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
 
-    if ((CORE.Window.flags & FLAG_WINDOW_UNFOCUSED) > 0) glfwWindowHint(GLFW_FOCUSED, GLFW_FALSE);
-    else glfwWindowHint(GLFW_FOCUSED, GLFW_TRUE);
+        encodedData[j++] = base64encodeTable[(triple >> 3*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 2*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 1*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 0*6) & 0x3F];
+    }
 
-    if ((CORE.Window.flags & FLAG_WINDOW_TOPMOST) > 0) glfwWindowHint(GLFW_FLOATING, GLFW_TRUE);
-    else glfwWindowHint(GLFW_FLOATING, GLFW_FALSE);
+    for (int i = 0; i < modTable[dataSize%3]; i++) encodedData[*outputSize - 1 - i] = '=';  // Padding character
 
-    // NOTE: Some GLFW flags are not supported on HTML5
-#if defined(PLATFORM_DESKTOP)
-    if ((CORE.Window.flags & FLAG_WINDOW_TRANSPARENT) > 0) glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);     // Transparent framebuffer
-    else glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_FALSE);  // Opaque framebuffer
+    return encodedData;
+}
 
-    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
+// Decode Base64 string data
+unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
+{
+    static const unsigned char base64decodeTable[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
+    };
+
+    // Get output size of Base64 input data
+    int outSize = 0;
+    for (int i = 0; data[4*i] != 0; i++)
     {
-        // Resize window content area based on the monitor content scale.
-        // NOTE: This hint only has an effect on platforms where screen coordinates and pixels always map 1:1 such as Windows and X11.
-        // On platforms like macOS the resolution of the framebuffer is changed independently of the window size.
-        glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);   // Scale content area based on the monitor content scale where window is placed on
-    #if defined(__APPLE__)
-        glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
-    #endif
+        if (data[4*i + 3] == '=')
+        {
+            if (data[4*i + 2] == '=') outSize += 1;
+            else outSize += 2;
+        }
+        else outSize += 3;
     }
-    else glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_FALSE);
 
-    // Mouse passthrough
-    if ((CORE.Window.flags & FLAG_WINDOW_MOUSE_PASSTHROUGH) > 0) glfwWindowHint(GLFW_MOUSE_PASSTHROUGH, GLFW_TRUE);
-    else glfwWindowHint(GLFW_MOUSE_PASSTHROUGH, GLFW_FALSE);
-#endif
+    // Allocate memory to store decoded Base64 data
+    unsigned char *decodedData = (unsigned char *)RL_MALLOC(outSize);
 
-    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
+    for (int i = 0; i < outSize/3; i++)
     {
-        // NOTE: MSAA is only enabled for main framebuffer, not user-created FBOs
-        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
-        glfwWindowHint(GLFW_SAMPLES, 4);   // Tries to enable multisampling x4 (MSAA), default is 0
-    }
+        unsigned char a = base64decodeTable[(int)data[4*i]];
+        unsigned char b = base64decodeTable[(int)data[4*i + 1]];
+        unsigned char c = base64decodeTable[(int)data[4*i + 2]];
+        unsigned char d = base64decodeTable[(int)data[4*i + 3]];
 
-    // NOTE: When asking for an OpenGL context version, most drivers provide the highest supported version
-    // with backward compatibility to older OpenGL versions.
-    // For example, if using OpenGL 1.1, driver can provide a 4.3 backwards compatible context.
+        decodedData[3*i] = (a << 2) | (b >> 4);
+        decodedData[3*i + 1] = (b << 4) | (c >> 2);
+        decodedData[3*i + 2] = (c << 6) | d;
+    }
 
-    // Check selection OpenGL version
-    if (rlGetVersion() == RL_OPENGL_21)
+    if (outSize%3 == 1)
     {
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);          // Choose OpenGL major version (just hint)
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);          // Choose OpenGL minor version (just hint)
+        int n = outSize/3;
+        unsigned char a = base64decodeTable[(int)data[4*n]];
+        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
+        decodedData[outSize - 1] = (a << 2) | (b >> 4);
     }
-    else if (rlGetVersion() == RL_OPENGL_33)
+    else if (outSize%3 == 2)
     {
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);          // Choose OpenGL major version (just hint)
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);          // Choose OpenGL minor version (just hint)
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // Profiles Hint: Only 3.3 and above!
-                                                                       // Values: GLFW_OPENGL_CORE_PROFILE, GLFW_OPENGL_ANY_PROFILE, GLFW_OPENGL_COMPAT_PROFILE
-#if defined(__APPLE__)
-        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);  // OSX Requires fordward compatibility
-#else
-        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_FALSE); // Fordward Compatibility Hint: Only 3.3 and above!
-#endif
-        //glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE); // Request OpenGL DEBUG context
+        int n = outSize/3;
+        unsigned char a = base64decodeTable[(int)data[4*n]];
+        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
+        unsigned char c = base64decodeTable[(int)data[4*n + 2]];
+        decodedData[outSize - 2] = (a << 2) | (b >> 4);
+        decodedData[outSize - 1] = (b << 4) | (c >> 2);
     }
-    else if (rlGetVersion() == RL_OPENGL_43)
+
+    *outputSize = outSize;
+    return decodedData;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: This function is only safe to use if you control the URL given.
+// A user could craft a malicious string performing another action.
+// Only call this function yourself not with user input or make sure to check the string yourself.
+// Ref: https://github.com/raysan5/raylib/issues/686
+void OpenURL(const char *url)
+{
+    // Small security check trying to avoid (partially) malicious code...
+    // sorry for the inconvenience when you hit this point...
+    if (strchr(url, '\'') != NULL)
     {
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);          // Choose OpenGL major version (just hint)
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);          // Choose OpenGL minor version (just hint)
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_FALSE);
-#if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT)
-        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);   // Enable OpenGL Debug Context
-#endif
+        TRACELOG(LOG_WARNING, "SYSTEM: Provided URL is not valid");
     }
-    else if (rlGetVersion() == RL_OPENGL_ES_20)                 // Request OpenGL ES 2.0 context
+    else
     {
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
 #if defined(PLATFORM_DESKTOP)
-        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
-#else
-        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_NATIVE_CONTEXT_API);
+        char *cmd = (char *)RL_CALLOC(strlen(url) + 32, sizeof(char));
+    #if defined(_WIN32)
+        sprintf(cmd, "explorer \"%s\"", url);
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
+    #endif
+    #if defined(__APPLE__)
+        sprintf(cmd, "open '%s'", url);
+    #endif
+        int result = system(cmd);
+        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
+        RL_FREE(cmd);
 #endif
-    }
-
-#if defined(PLATFORM_DESKTOP)
-    // NOTE: GLFW 3.4+ defers initialization of the Joystick subsystem on the first call to any Joystick related functions.
-    // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
-    // The initialization will still happen and possible delays still occur, but before the window is shown, which is a nicer experience.
-    // REF: https://github.com/raysan5/raylib/issues/1554
-    if (MAX_GAMEPADS > 0) glfwSetJoystickCallback(NULL);
+#if defined(PLATFORM_WEB)
+        emscripten_run_script(TextFormat("window.open('%s', '_blank')", url));
 #endif
+#if defined(PLATFORM_ANDROID)
+        JNIEnv *env = NULL;
+        JavaVM *vm = CORE.Android.app->activity->vm;
+        (*vm)->AttachCurrentThread(vm, &env, NULL);
 
-#if defined(PLATFORM_DESKTOP)
-    // Find monitor resolution
-    GLFWmonitor *monitor = glfwGetPrimaryMonitor();
-    if (!monitor)
-    {
-        TRACELOG(LOG_WARNING, "GLFW: Failed to get primary monitor");
-        return false;
-    }
-
-    const GLFWvidmode *mode = glfwGetVideoMode(monitor);
+        jstring urlString = (*env)->NewStringUTF(env, url);
+        jclass uriClass = (*env)->FindClass(env, "android/net/Uri");
+        jmethodID uriParse = (*env)->GetStaticMethodID(env, uriClass, "parse", "(Ljava/lang/String;)Landroid/net/Uri;");
+        jobject uri = (*env)->CallStaticObjectMethod(env, uriClass, uriParse, urlString);
 
-    CORE.Window.display.width = mode->width;
-    CORE.Window.display.height = mode->height;
+        jclass intentClass = (*env)->FindClass(env, "android/content/Intent");
+        jfieldID actionViewId = (*env)->GetStaticFieldID(env, intentClass, "ACTION_VIEW", "Ljava/lang/String;");
+        jobject actionView = (*env)->GetStaticObjectField(env, intentClass, actionViewId);
+        jmethodID newIntent = (*env)->GetMethodID(env, intentClass, "<init>", "(Ljava/lang/String;Landroid/net/Uri;)V");
+        jobject intent = (*env)->AllocObject(env, intentClass);
 
-    // Set screen width/height to the display width/height if they are 0
-    if (CORE.Window.screen.width == 0) CORE.Window.screen.width = CORE.Window.display.width;
-    if (CORE.Window.screen.height == 0) CORE.Window.screen.height = CORE.Window.display.height;
-#endif  // PLATFORM_DESKTOP
+        (*env)->CallVoidMethod(env, intent, newIntent, actionView, uri);
+        jclass activityClass = (*env)->FindClass(env, "android/app/Activity");
+        jmethodID startActivity = (*env)->GetMethodID(env, activityClass, "startActivity", "(Landroid/content/Intent;)V");
+        (*env)->CallVoidMethod(env, CORE.Android.app->activity->clazz, startActivity, intent);
 
-#if defined(PLATFORM_WEB)
-    // NOTE: Getting video modes is not implemented in emscripten GLFW3 version
-    CORE.Window.display.width = CORE.Window.screen.width;
-    CORE.Window.display.height = CORE.Window.screen.height;
-#endif  // PLATFORM_WEB
+        (*vm)->DetachCurrentThread(vm);
+#endif
+    }
+}
 
-    if (CORE.Window.fullscreen)
-    {
-        // remember center for switchinging from fullscreen to window
-        if ((CORE.Window.screen.height == CORE.Window.display.height) && (CORE.Window.screen.width == CORE.Window.display.width))
-        {
-            // If screen width/height equal to the display, we can't calculate the window pos for toggling full-screened/windowed.
-            // Toggling full-screened/windowed with pos(0, 0) can cause problems in some platforms, such as X11.
-            CORE.Window.position.x = CORE.Window.display.width/4;
-            CORE.Window.position.y = CORE.Window.display.height/4;
-        }
-        else
-        {
-            CORE.Window.position.x = CORE.Window.display.width/2 - CORE.Window.screen.width/2;
-            CORE.Window.position.y = CORE.Window.display.height/2 - CORE.Window.screen.height/2;
-        }
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
+//----------------------------------------------------------------------------------
+// Check if a key has been pressed once
+bool IsKeyPressed(int key)
+{
+    bool pressed = false;
 
-        if (CORE.Window.position.x < 0) CORE.Window.position.x = 0;
-        if (CORE.Window.position.y < 0) CORE.Window.position.y = 0;
+    if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
 
-        // Obtain recommended CORE.Window.display.width/CORE.Window.display.height from a valid videomode for the monitor
-        int count = 0;
-        const GLFWvidmode *modes = glfwGetVideoModes(glfwGetPrimaryMonitor(), &count);
+    return pressed;
+}
 
-        // Get closest video mode to desired CORE.Window.screen.width/CORE.Window.screen.height
-        for (int i = 0; i < count; i++)
-        {
-            if ((unsigned int)modes[i].width >= CORE.Window.screen.width)
-            {
-                if ((unsigned int)modes[i].height >= CORE.Window.screen.height)
-                {
-                    CORE.Window.display.width = modes[i].width;
-                    CORE.Window.display.height = modes[i].height;
-                    break;
-                }
-            }
-        }
-        TRACELOG(LOG_WARNING, "SYSTEM: Closest fullscreen videomode: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+// Check if a key is being pressed (key held down)
+bool IsKeyDown(int key)
+{
+    if (CORE.Input.Keyboard.currentKeyState[key] == 1) return true;
+    else return false;
+}
 
-        // NOTE: ISSUE: Closest videomode could not match monitor aspect-ratio, for example,
-        // for a desired screen size of 800x450 (16:9), closest supported videomode is 800x600 (4:3),
-        // framebuffer is rendered correctly but once displayed on a 16:9 monitor, it gets stretched
-        // by the sides to fit all monitor space...
+// Check if a key has been released once
+bool IsKeyReleased(int key)
+{
+    bool released = false;
 
-        // Try to setup the most appropriate fullscreen framebuffer for the requested screenWidth/screenHeight
-        // It considers device display resolution mode and setups a framebuffer with black bars if required (render size/offset)
-        // Modified global variables: CORE.Window.screen.width/CORE.Window.screen.height - CORE.Window.render.width/CORE.Window.render.height - CORE.Window.renderOffset.x/CORE.Window.renderOffset.y - CORE.Window.screenScale
-        // TODO: It is a quite cumbersome solution to display size vs requested size, it should be reviewed or removed...
-        // HighDPI monitors are properly considered in a following similar function: SetupViewport()
-        SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+    if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
 
-        CORE.Window.handle = glfwCreateWindow(CORE.Window.display.width, CORE.Window.display.height, (CORE.Window.title != 0)? CORE.Window.title : " ", glfwGetPrimaryMonitor(), NULL);
+    return released;
+}
 
-        // NOTE: Full-screen change, not working properly...
-        //glfwSetWindowMonitor(CORE.Window.handle, glfwGetPrimaryMonitor(), 0, 0, CORE.Window.screen.width, CORE.Window.screen.height, GLFW_DONT_CARE);
-    }
-    else
-    {
-#if defined(PLATFORM_DESKTOP)
-        // If we are windowed fullscreen, ensures that window does not minimize when focus is lost
-        if ((CORE.Window.screen.height == CORE.Window.display.height) && (CORE.Window.screen.width == CORE.Window.display.width))
-        {
-            glfwWindowHint(GLFW_AUTO_ICONIFY, 0);
-        }
-#endif
-        // No-fullscreen window creation
-        CORE.Window.handle = glfwCreateWindow(CORE.Window.screen.width, CORE.Window.screen.height, (CORE.Window.title != 0)? CORE.Window.title : " ", NULL, NULL);
+// Check if a key is NOT being pressed (key not held down)
+bool IsKeyUp(int key)
+{
+    if (CORE.Input.Keyboard.currentKeyState[key] == 0) return true;
+    else return false;
+}
 
-        if (CORE.Window.handle)
-        {
-            CORE.Window.render.width = CORE.Window.screen.width;
-            CORE.Window.render.height = CORE.Window.screen.height;
-        }
-    }
+// Get the last key pressed
+int GetKeyPressed(void)
+{
+    int value = 0;
 
-    if (!CORE.Window.handle)
+    if (CORE.Input.Keyboard.keyPressedQueueCount > 0)
     {
-        glfwTerminate();
-        TRACELOG(LOG_WARNING, "GLFW: Failed to initialize Window");
-        return false;
-    }
-
-    // Set window callback events
-    glfwSetWindowSizeCallback(CORE.Window.handle, WindowSizeCallback);      // NOTE: Resizing not allowed by default!
-#if !defined(PLATFORM_WEB)
-    glfwSetWindowMaximizeCallback(CORE.Window.handle, WindowMaximizeCallback);
-#endif
-    glfwSetWindowIconifyCallback(CORE.Window.handle, WindowIconifyCallback);
-    glfwSetWindowFocusCallback(CORE.Window.handle, WindowFocusCallback);
-    glfwSetDropCallback(CORE.Window.handle, WindowDropCallback);
+        // Get character from the queue head
+        value = CORE.Input.Keyboard.keyPressedQueue[0];
 
-    // Set input callback events
-    glfwSetKeyCallback(CORE.Window.handle, KeyCallback);
-    glfwSetCharCallback(CORE.Window.handle, CharCallback);
-    glfwSetMouseButtonCallback(CORE.Window.handle, MouseButtonCallback);
-    glfwSetCursorPosCallback(CORE.Window.handle, MouseCursorPosCallback);   // Track mouse position changes
-    glfwSetScrollCallback(CORE.Window.handle, MouseScrollCallback);
-    glfwSetCursorEnterCallback(CORE.Window.handle, CursorEnterCallback);
+        // Shift elements 1 step toward the head.
+        for (int i = 0; i < (CORE.Input.Keyboard.keyPressedQueueCount - 1); i++)
+            CORE.Input.Keyboard.keyPressedQueue[i] = CORE.Input.Keyboard.keyPressedQueue[i + 1];
 
-    glfwMakeContextCurrent(CORE.Window.handle);
+        // Reset last character in the queue
+        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount - 1] = 0;
+        CORE.Input.Keyboard.keyPressedQueueCount--;
+    }
 
-#if !defined(PLATFORM_WEB)
-    glfwSetInputMode(CORE.Window.handle, GLFW_LOCK_KEY_MODS, GLFW_TRUE);    // Enable lock keys modifiers (CAPS, NUM)
+    return value;
+}
 
-    glfwSwapInterval(0);        // No V-Sync by default
-#endif
+// Get the last char pressed
+int GetCharPressed(void)
+{
+    int value = 0;
 
-    // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
-    // NOTE: V-Sync can be enabled by graphic driver configuration
-    if (CORE.Window.flags & FLAG_VSYNC_HINT)
+    if (CORE.Input.Keyboard.charPressedQueueCount > 0)
     {
-        // WARNING: It seems to hit a critical render path in Intel HD Graphics
-        glfwSwapInterval(1);
-        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable VSYNC");
-    }
+        // Get character from the queue head
+        value = CORE.Input.Keyboard.charPressedQueue[0];
 
-    int fbWidth = CORE.Window.screen.width;
-    int fbHeight = CORE.Window.screen.height;
+        // Shift elements 1 step toward the head.
+        for (int i = 0; i < (CORE.Input.Keyboard.charPressedQueueCount - 1); i++)
+            CORE.Input.Keyboard.charPressedQueue[i] = CORE.Input.Keyboard.charPressedQueue[i + 1];
 
-#if defined(PLATFORM_DESKTOP)
-    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
-    {
-        // NOTE: On APPLE platforms system should manage window/input scaling and also framebuffer scaling.
-        // Framebuffer scaling should be activated with: glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
-    #if !defined(__APPLE__)
-        glfwGetFramebufferSize(CORE.Window.handle, &fbWidth, &fbHeight);
+        // Reset last character in the queue
+        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount - 1] = 0;
+        CORE.Input.Keyboard.charPressedQueueCount--;
+    }
 
-        // Screen scaling matrix is required in case desired screen area is different from display area
-        CORE.Window.screenScale = MatrixScale((float)fbWidth/CORE.Window.screen.width, (float)fbHeight/CORE.Window.screen.height, 1.0f);
+    return value;
+}
 
-        // Mouse input scaling for the new screen size
-        SetMouseScale((float)CORE.Window.screen.width/fbWidth, (float)CORE.Window.screen.height/fbHeight);
-    #endif
-    }
+// Set a custom key to exit program
+// NOTE: default exitKey is ESCAPE
+void SetExitKey(int key)
+{
+#if !defined(PLATFORM_ANDROID)
+    CORE.Input.Keyboard.exitKey = key;
 #endif
+}
 
-    CORE.Window.render.width = fbWidth;
-    CORE.Window.render.height = fbHeight;
-    CORE.Window.currentFbo.width = fbWidth;
-    CORE.Window.currentFbo.height = fbHeight;
-
-    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
-    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
-    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
-    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
-    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+// NOTE: Gamepad support not implemented in emscripten GLFW3 (PLATFORM_WEB)
 
-#endif  // PLATFORM_DESKTOP || PLATFORM_WEB
+// Check if a gamepad is available
+bool IsGamepadAvailable(int gamepad)
+{
+    bool result = false;
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
-    CORE.Window.fullscreen = true;
-    CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) result = true;
 
-#if defined(PLATFORM_RPI)
-    bcm_host_init();
+    return result;
+}
 
-    DISPMANX_ELEMENT_HANDLE_T dispmanElement = { 0 };
-    DISPMANX_DISPLAY_HANDLE_T dispmanDisplay = { 0 };
-    DISPMANX_UPDATE_HANDLE_T dispmanUpdate = { 0 };
+// Get gamepad internal name id
+const char *GetGamepadName(int gamepad)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (CORE.Input.Gamepad.ready[gamepad]) return glfwGetJoystickName(gamepad);
+    else return NULL;
+#endif
+#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    if (CORE.Input.Gamepad.ready[gamepad]) ioctl(CORE.Input.Gamepad.streamId[gamepad], JSIOCGNAME(64), &CORE.Input.Gamepad.name[gamepad]);
+    return CORE.Input.Gamepad.name[gamepad];
+#endif
+#if defined(PLATFORM_WEB)
+    return CORE.Input.Gamepad.name[gamepad];
+#endif
+#if defined(PLATFORM_NX)
+    int type = CORE.Input.Gamepad.nxPadStyle[gamepad];
+    switch(type) {
+        case HidNpadStyleTag_NpadFullKey: return "Nintendo Switch Pro Controller";
+        case HidNpadStyleTag_NpadHandheld: return "Handheld Joy-Con controller";
+        case HidNpadStyleTag_NpadJoyDual: return "Dual Joy-Con controller";
+        case HidNpadStyleTag_NpadJoyLeft: return "Single Joy-Con left controller";
+        case HidNpadStyleTag_NpadJoyRight: return "Single Joy-Con right controller";
+        case HidNpadStyleTag_NpadGc: return "GameCube controller";
+        case HidNpadStyleTag_NpadPalma: return "Poké Ball Plus controller";
+        case HidNpadStyleTag_NpadLark: return "NES/Famicom controller";
+        case HidNpadStyleTag_NpadHandheldLark: return "Handheld NES/Famicom controller";
+        case HidNpadStyleTag_NpadLucia: return "SNES controller";
+        case HidNpadStyleTag_NpadLagon: return "N64 controller";
+        case HidNpadStyleTag_NpadLager: return "Sega Genesis controller";
+        case HidNpadStyleTag_NpadSystemExt: return "Generic external controller";
+        default: return "Generic controller";
+    }
+#endif
+    return NULL;
+}
 
-    VC_RECT_T dstRect = { 0 };
-    VC_RECT_T srcRect = { 0 };
+// Get gamepad axis count
+int GetGamepadAxisCount(int gamepad)
+{
+#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    int axisCount = 0;
+    if (CORE.Input.Gamepad.ready[gamepad]) ioctl(CORE.Input.Gamepad.streamId[gamepad], JSIOCGAXES, &axisCount);
+    CORE.Input.Gamepad.axisCount = axisCount;
 #endif
 
-#if defined(PLATFORM_DRM)
-    CORE.Window.fd = -1;
-    CORE.Window.connector = NULL;
-    CORE.Window.modeIndex = -1;
-    CORE.Window.crtc = NULL;
-    CORE.Window.gbmDevice = NULL;
-    CORE.Window.gbmSurface = NULL;
-    CORE.Window.prevBO = NULL;
-    CORE.Window.prevFB = 0;
+    return CORE.Input.Gamepad.axisCount;
+}
 
-#if defined(DEFAULT_GRAPHIC_DEVICE_DRM)
-    CORE.Window.fd = open(DEFAULT_GRAPHIC_DEVICE_DRM, O_RDWR);
-#else
-    TRACELOG(LOG_INFO, "DISPLAY: No graphic card set, trying platform-gpu-card");
-    CORE.Window.fd = open("/dev/dri/by-path/platform-gpu-card",  O_RDWR); // VideoCore VI (Raspberry Pi 4)
+// Get axis movement vector for a gamepad
+float GetGamepadAxisMovement(int gamepad, int axis)
+{
+    float value = 0;
 
-    if ((-1 == CORE.Window.fd) || (drmModeGetResources(CORE.Window.fd) == NULL))
-    {
-        TRACELOG(LOG_INFO, "DISPLAY: Failed to open platform-gpu-card, trying card1");
-        CORE.Window.fd = open("/dev/dri/card1", O_RDWR); // Other Embedded
-    }
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (axis < MAX_GAMEPAD_AXIS) &&
+        (fabsf(CORE.Input.Gamepad.axisState[gamepad][axis]) > 0.1f)) value = CORE.Input.Gamepad.axisState[gamepad][axis];      // 0.1f = GAMEPAD_AXIS_MINIMUM_DRIFT/DELTA
 
-    if ((-1 == CORE.Window.fd) || (drmModeGetResources(CORE.Window.fd) == NULL))
+    return value;
+}
+
+#if defined(PLATFORM_NX)
+void SetGamepadYAxisInverted(int gamepad, float yInverted)
+{        
+    if (yInverted == -1.0f || yInverted == 1.0f)
     {
-        TRACELOG(LOG_INFO, "DISPLAY: Failed to open graphic card1, trying card0");
-        CORE.Window.fd = open("/dev/dri/card0", O_RDWR); // VideoCore IV (Raspberry Pi 1-3)
+        CORE.Input.Gamepad.yInverted[gamepad] = yInverted;
     }
+}
+
+float GetGamepadYAxisInverted(int gamepad)
+{
+    return CORE.Input.Gamepad.yInverted[gamepad];
+}
 #endif
-    if (-1 == CORE.Window.fd)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to open graphic card");
-        return false;
-    }
 
-    drmModeRes *res = drmModeGetResources(CORE.Window.fd);
-    if (!res)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed get DRM resources");
-        return false;
-    }
+// Check if a gamepad button has been pressed once
+bool IsGamepadButtonPressed(int gamepad, int button)
+{
+    bool pressed = false;
 
-    TRACELOG(LOG_TRACE, "DISPLAY: Connectors found: %i", res->count_connectors);
-    for (size_t i = 0; i < res->count_connectors; i++)
-    {
-        TRACELOG(LOG_TRACE, "DISPLAY: Connector index %i", i);
-        drmModeConnector *con = drmModeGetConnector(CORE.Window.fd, res->connectors[i]);
-        TRACELOG(LOG_TRACE, "DISPLAY: Connector modes detected: %i", con->count_modes);
-        if ((con->connection == DRM_MODE_CONNECTED) && (con->encoder_id))
-        {
-            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode connected");
-            CORE.Window.connector = con;
-            break;
-        }
-        else
-        {
-            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode NOT connected (deleting)");
-            drmModeFreeConnector(con);
-        }
-    }
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 0) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) pressed = true;
 
-    if (!CORE.Window.connector)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: No suitable DRM connector found");
-        drmModeFreeResources(res);
-        return false;
-    }
+    return pressed;
+}
 
-    drmModeEncoder *enc = drmModeGetEncoder(CORE.Window.fd, CORE.Window.connector->encoder_id);
-    if (!enc)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get DRM mode encoder");
-        drmModeFreeResources(res);
-        return false;
-    }
+// Check if a gamepad button is being pressed
+bool IsGamepadButtonDown(int gamepad, int button)
+{
+    bool result = false;
 
-    CORE.Window.crtc = drmModeGetCrtc(CORE.Window.fd, enc->crtc_id);
-    if (!CORE.Window.crtc)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get DRM mode crtc");
-        drmModeFreeEncoder(enc);
-        drmModeFreeResources(res);
-        return false;
-    }
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) result = true;
 
-    // If InitWindow should use the current mode find it in the connector's mode list
-    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
-    {
-        TRACELOG(LOG_TRACE, "DISPLAY: Selecting DRM connector mode for current used mode...");
+    return result;
+}
 
-        CORE.Window.modeIndex = FindMatchingConnectorMode(CORE.Window.connector, &CORE.Window.crtc->mode);
+// Check if a gamepad button has NOT been pressed once
+bool IsGamepadButtonReleased(int gamepad, int button)
+{
+    bool released = false;
 
-        if (CORE.Window.modeIndex < 0)
-        {
-            TRACELOG(LOG_WARNING, "DISPLAY: No matching DRM connector mode found");
-            drmModeFreeEncoder(enc);
-            drmModeFreeResources(res);
-            return false;
-        }
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 1) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) released = true;
 
-        CORE.Window.screen.width = CORE.Window.display.width;
-        CORE.Window.screen.height = CORE.Window.display.height;
-    }
+    return released;
+}
 
-    const bool allowInterlaced = CORE.Window.flags & FLAG_INTERLACED_HINT;
-    const int fps = (CORE.Time.target > 0) ? (1.0/CORE.Time.target) : 60;
+// Check if a gamepad button is NOT being pressed
+bool IsGamepadButtonUp(int gamepad, int button)
+{
+    bool result = false;
 
-    // Try to find an exact matching mode
-    CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) result = true;
 
-    // If nothing found, try to find a nearly matching mode
-    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindNearestConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
+    return result;
+}
 
-    // If nothing found, try to find an exactly matching mode including interlaced
-    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, true);
+// Get the last gamepad button pressed
+int GetGamepadButtonPressed(void)
+{
+    return CORE.Input.Gamepad.lastButtonPressed;
+}
 
-    // If nothing found, try to find a nearly matching mode including interlaced
-    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindNearestConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, true);
+// Set internal gamepad mappings
+int SetGamepadMappings(const char *mappings)
+{
+    int result = 0;
 
-    // If nothing found, there is no suitable mode
-    if (CORE.Window.modeIndex < 0)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to find a suitable DRM connector mode");
-        drmModeFreeEncoder(enc);
-        drmModeFreeResources(res);
-        return false;
-    }
+#if defined(PLATFORM_DESKTOP)
+    result = glfwUpdateGamepadMappings(mappings);
+#endif
 
-    CORE.Window.display.width = CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay;
-    CORE.Window.display.height = CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay;
+    return result;
+}
 
-    TRACELOG(LOG_INFO, "DISPLAY: Selected DRM connector mode %s (%ux%u%c@%u)", CORE.Window.connector->modes[CORE.Window.modeIndex].name,
-        CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay,
-        (CORE.Window.connector->modes[CORE.Window.modeIndex].flags & DRM_MODE_FLAG_INTERLACE) ? 'i' : 'p',
-        CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh);
+// Check if a mouse button has been pressed once
+bool IsMouseButtonPressed(int button)
+{
+    bool pressed = false;
 
-    // Use the width and height of the surface for render
-    CORE.Window.render.width = CORE.Window.screen.width;
-    CORE.Window.render.height = CORE.Window.screen.height;
+    if ((CORE.Input.Mouse.currentButtonState[button] == 1) && (CORE.Input.Mouse.previousButtonState[button] == 0)) pressed = true;
 
-    drmModeFreeEncoder(enc);
-    enc = NULL;
+    // Map touches to mouse buttons checking
+    if ((CORE.Input.Touch.currentTouchState[button] == 1) && (CORE.Input.Touch.previousTouchState[button] == 0)) pressed = true;
 
-    drmModeFreeResources(res);
-    res = NULL;
+    return pressed;
+}
 
-    CORE.Window.gbmDevice = gbm_create_device(CORE.Window.fd);
-    if (!CORE.Window.gbmDevice)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create GBM device");
-        return false;
-    }
+// Check if a mouse button is being pressed
+bool IsMouseButtonDown(int button)
+{
+    bool down = false;
 
-    CORE.Window.gbmSurface = gbm_surface_create(CORE.Window.gbmDevice, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay,
-        CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, GBM_FORMAT_ARGB8888, GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
-    if (!CORE.Window.gbmSurface)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create GBM surface");
-        return false;
-    }
-#endif
+    if (CORE.Input.Mouse.currentButtonState[button] == 1) down = true;
 
-    EGLint samples = 0;
-    EGLint sampleBuffer = 0;
-    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
-    {
-        samples = 4;
-        sampleBuffer = 1;
-        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
-    }
+    // Map touches to mouse buttons checking
+    if (CORE.Input.Touch.currentTouchState[button] == 1) down = true;
 
-    const EGLint framebufferAttribs[] =
-    {
-        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,     // Type of context support -> Required on RPI?
-#if defined(PLATFORM_DRM)
-        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,          // Don't use it on Android!
-#endif
-        EGL_RED_SIZE, 8,            // RED color bit depth (alternative: 5)
-        EGL_GREEN_SIZE, 8,          // GREEN color bit depth (alternative: 6)
-        EGL_BLUE_SIZE, 8,           // BLUE color bit depth (alternative: 5)
-#if defined(PLATFORM_DRM)
-        EGL_ALPHA_SIZE, 8,        // ALPHA bit depth (required for transparent framebuffer)
-#endif
-        //EGL_TRANSPARENT_TYPE, EGL_NONE, // Request transparent framebuffer (EGL_TRANSPARENT_RGB does not work on RPI)
-        EGL_DEPTH_SIZE, 16,         // Depth buffer size (Required to use Depth testing!)
-        //EGL_STENCIL_SIZE, 8,      // Stencil buffer size
-#if !defined(PLATFORM_NX)
-        EGL_SAMPLE_BUFFERS, sampleBuffer,    // Activate MSAA
-        EGL_SAMPLES, samples,       // 4x Antialiasing if activated (Free on MALI GPUs)
-#endif
-        EGL_NONE
-    };
+    return down;
+}
 
-    const EGLint contextAttribs[] =
-    {
-        EGL_CONTEXT_CLIENT_VERSION, 2,
-        EGL_NONE
-    };
+// Check if a mouse button has been released once
+bool IsMouseButtonReleased(int button)
+{
+    bool released = false;
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
-    EGLint numConfigs = 0;
+    if ((CORE.Input.Mouse.currentButtonState[button] == 0) && (CORE.Input.Mouse.previousButtonState[button] == 1)) released = true;
 
-    // Get an EGL device connection
-#if defined(PLATFORM_DRM)
-    CORE.Window.device = eglGetDisplay((EGLNativeDisplayType)CORE.Window.gbmDevice);
-#else
-    CORE.Window.device = eglGetDisplay(EGL_DEFAULT_DISPLAY);
-#endif
-    if (CORE.Window.device == EGL_NO_DISPLAY)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+    // Map touches to mouse buttons checking
+    if ((CORE.Input.Touch.currentTouchState[button] == 0) && (CORE.Input.Touch.previousTouchState[button] == 1)) released = true;
+
+    return released;
+}
+
+// Check if a mouse button is NOT being pressed
+bool IsMouseButtonUp(int button)
+{
+    return !IsMouseButtonDown(button);
+}
+
+// Get mouse position X
+int GetMouseX(void)
+{
+#if defined(PLATFORM_ANDROID)
+    return (int)CORE.Input.Touch.position[0].x;
+#else
+    return (int)((CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x);
+#endif
+}
+
+// Get mouse position Y
+int GetMouseY(void)
+{
+#if defined(PLATFORM_ANDROID)
+    return (int)CORE.Input.Touch.position[0].y;
+#else
+    return (int)((CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y);
+#endif
+}
+
+// Get mouse position XY
+Vector2 GetMousePosition(void)
+{
+    Vector2 position = { 0 };
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB)
+    position = GetTouchPosition(0);
+#else
+    position.x = (CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
+    position.y = (CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+#endif
+
+    return position;
+}
+
+// Get mouse delta between frames
+Vector2 GetMouseDelta(void)
+{
+    Vector2 delta = { 0 };
+
+    delta.x = CORE.Input.Mouse.currentPosition.x - CORE.Input.Mouse.previousPosition.x;
+    delta.y = CORE.Input.Mouse.currentPosition.y - CORE.Input.Mouse.previousPosition.y;
+
+    return delta;
+}
+
+// Set mouse position XY
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    // NOTE: emscripten not implemented
+    glfwSetCursorPos(CORE.Window.handle, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+#endif
+}
+
+// Set mouse offset
+// NOTE: Useful when rendering to different size targets
+void SetMouseOffset(int offsetX, int offsetY)
+{
+    CORE.Input.Mouse.offset = (Vector2){ (float)offsetX, (float)offsetY };
+}
+
+// Set mouse scaling
+// NOTE: Useful when rendering to different size targets
+void SetMouseScale(float scaleX, float scaleY)
+{
+    CORE.Input.Mouse.scale = (Vector2){ scaleX, scaleY };
+}
+
+// Get mouse wheel movement Y
+float GetMouseWheelMove(void)
+{
+    float result = 0.0f;
+
+#if !defined(PLATFORM_ANDROID) || !defined(PLATFORM_NX)
+    if (fabsf(CORE.Input.Mouse.currentWheelMove.x) > fabsf(CORE.Input.Mouse.currentWheelMove.y)) result = (float)CORE.Input.Mouse.currentWheelMove.x;
+    else result = (float)CORE.Input.Mouse.currentWheelMove.y;
+#endif
+
+    return result;
+}
+
+#if defined(PLATFORM_NX)
+void SetCameraZoomFactor(Vector2 zoomFactor)
+{
+    CORE.Input.Mouse.currentWheelMove = zoomFactor;
+}
+void SetCameraPrevZoomFactor(Vector2 previousZoomFactor)
+{
+    CORE.Input.Mouse.previousWheelMove = previousZoomFactor;
+}
+#endif
+
+// Get mouse wheel movement X/Y as a vector
+Vector2 GetMouseWheelMoveV(void)
+{
+    Vector2 result = { 0 };
+
+    result = CORE.Input.Mouse.currentWheelMove;
+
+    return result;
+}
+
+// Set mouse cursor
+// NOTE: This is a no-op on platforms other than PLATFORM_DESKTOP
+void SetMouseCursor(int cursor)
+{
+#if defined(PLATFORM_DESKTOP)
+    CORE.Input.Mouse.cursor = cursor;
+    if (cursor == MOUSE_CURSOR_DEFAULT) glfwSetCursor(CORE.Window.handle, NULL);
+    else
+    {
+        // NOTE: We are relating internal GLFW enum values to our MouseCursor enum values
+        glfwSetCursor(CORE.Window.handle, glfwCreateStandardCursor(0x00036000 + cursor));
+    }
+#endif
+}
+
+// Get touch position X for touch point 0 (relative to screen size)
+int GetTouchX(void)
+{
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+    return (int)CORE.Input.Touch.position[0].x;
+#else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
+    return GetMouseX();
+#endif
+}
+
+// Get touch position Y for touch point 0 (relative to screen size)
+int GetTouchY(void)
+{
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+    return (int)CORE.Input.Touch.position[0].y;
+#else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
+    return GetMouseY();
+#endif
+}
+
+// Get touch position XY for a touch point index (relative to screen size)
+// TODO: Touch position should be scaled depending on display size and render size
+Vector2 GetTouchPosition(int index)
+{
+    Vector2 position = { -1.0f, -1.0f };
+
+#if defined(PLATFORM_DESKTOP)
+    // TODO: GLFW does not support multi-touch input just yet
+    // https://www.codeproject.com/Articles/668404/Programming-for-Multi-Touch
+    // https://docs.microsoft.com/en-us/windows/win32/wintouch/getting-started-with-multi-touch-messages
+    if (index == 0) position = GetMousePosition();
+#endif
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+    if (index < MAX_TOUCH_POINTS) position = CORE.Input.Touch.position[index];
+    else TRACELOG(LOG_WARNING, "INPUT: Required touch point out of range (Max touch points: %i)", MAX_TOUCH_POINTS);
+#endif
+
+    return position;
+}
+
+// Get touch point identifier for given index
+int GetTouchPointId(int index)
+{
+    int id = -1;
+
+    if (index < MAX_TOUCH_POINTS) id = CORE.Input.Touch.pointId[index];
+
+    return id;
+}
+
+// Get number of touch points
+int GetTouchPointCount(void)
+{
+    return CORE.Input.Touch.pointCount;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize display device and framebuffer
+// NOTE: width and height represent the screen (framebuffer) desired size, not actual display size
+// If width or height are 0, default display size will be used for framebuffer size
+// NOTE: returns false in case graphic device could not be created
+static bool InitGraphicsDevice(int width, int height)
+{
+    CORE.Window.screen.width = width;            // User desired width
+    CORE.Window.screen.height = height;          // User desired height
+    CORE.Window.screenScale = MatrixIdentity();  // No draw scaling required by default
+
+    // NOTE: Framebuffer (render area - CORE.Window.render.width, CORE.Window.render.height) could include black bars...
+    // ...in top-down or left-right to match display aspect ratio (no weird scaling)
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    glfwSetErrorCallback(ErrorCallback);
+/*
+    // TODO: Setup GLFW custom allocators to match raylib ones
+    const GLFWallocator allocator = {
+        .allocate = MemAlloc,
+        .deallocate = MemFree,
+        .reallocate = MemRealloc,
+        .user = NULL
+    };
+
+    glfwInitAllocator(&allocator);
+*/
+#if defined(__APPLE__)
+    glfwInitHint(GLFW_COCOA_CHDIR_RESOURCES, GLFW_FALSE);
+#endif
+#if defined(PLATFORM_DESKTOP) && defined(GRAPHICS_API_SOFTWARE)
+    // Software renderer frames are not presented, no window system or display required (headless)
+    // NOTE: GLFW Null platform keeps window, monitor and input state, window is never shown
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+
+    if (!glfwInit())
+    {
+        TRACELOG(LOG_WARNING, "GLFW: Failed to initialize GLFW");
         return false;
     }
 
-    // Initialize the EGL device connection
-    if (eglInitialize(CORE.Window.device, NULL, NULL) == EGL_FALSE)
-    {
-        // If all of the calls to eglInitialize returned EGL_FALSE then an error has occurred.
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
-        return false;
-    }
+    glfwDefaultWindowHints();                       // Set default windows hints
+    //glfwWindowHint(GLFW_RED_BITS, 8);             // Framebuffer red color component bits
+    //glfwWindowHint(GLFW_GREEN_BITS, 8);           // Framebuffer green color component bits
+    //glfwWindowHint(GLFW_BLUE_BITS, 8);            // Framebuffer blue color component bits
+    //glfwWindowHint(GLFW_ALPHA_BITS, 8);           // Framebuffer alpha color component bits
+    //glfwWindowHint(GLFW_DEPTH_BITS, 24);          // Depthbuffer bits
+    //glfwWindowHint(GLFW_REFRESH_RATE, 0);         // Refresh rate for fullscreen window
+    //glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API); // OpenGL API to use. Alternative: GLFW_OPENGL_ES_API
+    //glfwWindowHint(GLFW_AUX_BUFFERS, 0);          // Number of auxiliar buffers
+
+    // Check window creation flags
+    if ((CORE.Window.flags & FLAG_FULLSCREEN_MODE) > 0) CORE.Window.fullscreen = true;
+
+    if ((CORE.Window.flags & FLAG_WINDOW_HIDDEN) > 0) glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE); // Visible window
+    else glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);     // Window initially hidden
+
+    if ((CORE.Window.flags & FLAG_WINDOW_UNDECORATED) > 0) glfwWindowHint(GLFW_DECORATED, GLFW_FALSE); // Border and buttons on Window
+    else glfwWindowHint(GLFW_DECORATED, GLFW_TRUE);   // Decorated window
+
+    if ((CORE.Window.flags & FLAG_WINDOW_RESIZABLE) > 0) glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE); // Resizable window
+    else glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);  // Avoid window being resizable
+
+    // Disable FLAG_WINDOW_MINIMIZED, not supported on initialization
+    if ((CORE.Window.flags & FLAG_WINDOW_MINIMIZED) > 0) CORE.Window.flags &= ~FLAG_WINDOW_MINIMIZED;
+
+    // Disable FLAG_WINDOW_MAXIMIZED, not supported on initialization
+    if ((CORE.Window.flags & FLAG_WINDOW_MAXIMIZED) > 0) CORE.Window.flags &= ~FLAG_WINDOW_MAXIMIZED;
+
+    if ((CORE.Window.flags & FLAG_WINDOW_UNFOCUSED) > 0) glfwWindowHint(GLFW_FOCUSED, GLFW_FALSE);
+    else glfwWindowHint(GLFW_FOCUSED, GLFW_TRUE);
+
+    if ((CORE.Window.flags & FLAG_WINDOW_TOPMOST) > 0) glfwWindowHint(GLFW_FLOATING, GLFW_TRUE);
+    else glfwWindowHint(GLFW_FLOATING, GLFW_FALSE);
+
+    // NOTE: Some GLFW flags are not supported on HTML5
+#if defined(PLATFORM_DESKTOP)
+    if ((CORE.Window.flags & FLAG_WINDOW_TRANSPARENT) > 0) glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);     // Transparent framebuffer
+    else glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_FALSE);  // Opaque framebuffer
+
+    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
+    {
+        // Resize window content area based on the monitor content scale.
+        // NOTE: This hint only has an effect on platforms where screen coordinates and pixels always map 1:1 such as Windows and X11.
+        // On platforms like macOS the resolution of the framebuffer is changed independently of the window size.
+        glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);   // Scale content area based on the monitor content scale where window is placed on
+    #if defined(__APPLE__)
+        glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
+    #endif
+    }
+    else glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_FALSE);
+
+    // Mouse passthrough
+    if ((CORE.Window.flags & FLAG_WINDOW_MOUSE_PASSTHROUGH) > 0) glfwWindowHint(GLFW_MOUSE_PASSTHROUGH, GLFW_TRUE);
+    else glfwWindowHint(GLFW_MOUSE_PASSTHROUGH, GLFW_FALSE);
+#endif
+
+    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
+    {
+        // NOTE: MSAA is only enabled for main framebuffer, not user-created FBOs
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+        glfwWindowHint(GLFW_SAMPLES, 4);   // Tries to enable multisampling x4 (MSAA), default is 0
+    }
+
+    // NOTE: When asking for an OpenGL context version, most drivers provide the highest supported version
+    // with backward compatibility to older OpenGL versions.
+    // For example, if using OpenGL 1.1, driver can provide a 4.3 backwards compatible context.
+
+    // Check selection OpenGL version
+    if (rlGetVersion() == RL_OPENGL_21)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);          // Choose OpenGL major version (just hint)
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);          // Choose OpenGL minor version (just hint)
+    }
+    else if (rlGetVersion() == RL_OPENGL_33)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);          // Choose OpenGL major version (just hint)
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);          // Choose OpenGL minor version (just hint)
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // Profiles Hint: Only 3.3 and above!
+                                                                       // Values: GLFW_OPENGL_CORE_PROFILE, GLFW_OPENGL_ANY_PROFILE, GLFW_OPENGL_COMPAT_PROFILE
+#if defined(__APPLE__)
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);  // OSX Requires fordward compatibility
+#else
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_FALSE); // Fordward Compatibility Hint: Only 3.3 and above!
+#endif
+        //glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE); // Request OpenGL DEBUG context
+    }
+    else if (rlGetVersion() == RL_OPENGL_43)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);          // Choose OpenGL major version (just hint)
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);          // Choose OpenGL minor version (just hint)
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_FALSE);
+#if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT)
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);   // Enable OpenGL Debug Context
+#endif
+    }
+    else if (rlGetVersion() == RL_OPENGL_ES_20)                 // Request OpenGL ES 2.0 context
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+#if defined(PLATFORM_DESKTOP)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+#else
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_NATIVE_CONTEXT_API);
+#endif
+    }
+    else if (rlGetVersion() == RL_OPENGL_SOFTWARE)              // Software renderer, no context required
+    {
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    }
+
+#if defined(PLATFORM_DESKTOP)
+    // NOTE: GLFW 3.4+ defers initialization of the Joystick subsystem on the first call to any Joystick related functions.
+    // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
+    // The initialization will still happen and possible delays still occur, but before the window is shown, which is a nicer experience.
+    // REF: https://github.com/raysan5/raylib/issues/1554
+    if (MAX_GAMEPADS > 0) glfwSetJoystickCallback(NULL);
+#endif
+
+#if defined(PLATFORM_DESKTOP)
+    // Find monitor resolution
+    GLFWmonitor *monitor = glfwGetPrimaryMonitor();
+    if (!monitor)
+    {
+        TRACELOG(LOG_WARNING, "GLFW: Failed to get primary monitor");
+        return false;
+    }
+
+    const GLFWvidmode *mode = glfwGetVideoMode(monitor);
+
+    CORE.Window.display.width = mode->width;
+    CORE.Window.display.height = mode->height;
+
+    // Set screen width/height to the display width/height if they are 0
+    if (CORE.Window.screen.width == 0) CORE.Window.screen.width = CORE.Window.display.width;
+    if (CORE.Window.screen.height == 0) CORE.Window.screen.height = CORE.Window.display.height;
+#endif  // PLATFORM_DESKTOP
+
+#if defined(PLATFORM_WEB)
+    // NOTE: Getting video modes is not implemented in emscripten GLFW3 version
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+#endif  // PLATFORM_WEB
+
+    if (CORE.Window.fullscreen)
+    {
+        // remember center for switchinging from fullscreen to window
+        if ((CORE.Window.screen.height == CORE.Window.display.height) && (CORE.Window.screen.width == CORE.Window.display.width))
+        {
+            // If screen width/height equal to the display, we can't calculate the window pos for toggling full-screened/windowed.
+            // Toggling full-screened/windowed with pos(0, 0) can cause problems in some platforms, such as X11.
+            CORE.Window.position.x = CORE.Window.display.width/4;
+            CORE.Window.position.y = CORE.Window.display.height/4;
+        }
+        else
+        {
+            CORE.Window.position.x = CORE.Window.display.width/2 - CORE.Window.screen.width/2;
+            CORE.Window.position.y = CORE.Window.display.height/2 - CORE.Window.screen.height/2;
+        }
+
+        if (CORE.Window.position.x < 0) CORE.Window.position.x = 0;
+        if (CORE.Window.position.y < 0) CORE.Window.position.y = 0;
+
+        // Obtain recommended CORE.Window.display.width/CORE.Window.display.height from a valid videomode for the monitor
+        int count = 0;
+        const GLFWvidmode *modes = glfwGetVideoModes(glfwGetPrimaryMonitor(), &count);
+
+        // Get closest video mode to desired CORE.Window.screen.width/CORE.Window.screen.height
+        for (int i = 0; i < count; i++)
+        {
+            if ((unsigned int)modes[i].width >= CORE.Window.screen.width)
+            {
+                if ((unsigned int)modes[i].height >= CORE.Window.screen.height)
+                {
+                    CORE.Window.display.width = modes[i].width;
+                    CORE.Window.display.height = modes[i].height;
+                    break;
+                }
+            }
+        }
+        TRACELOG(LOG_WARNING, "SYSTEM: Closest fullscreen videomode: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+
+        // NOTE: ISSUE: Closest videomode could not match monitor aspect-ratio, for example,
+        // for a desired screen size of 800x450 (16:9), closest supported videomode is 800x600 (4:3),
+        // framebuffer is rendered correctly but once displayed on a 16:9 monitor, it gets stretched
+        // by the sides to fit all monitor space...
+
+        // Try to setup the most appropriate fullscreen framebuffer for the requested screenWidth/screenHeight
+        // It considers device display resolution mode and setups a framebuffer with black bars if required (render size/offset)
+        // Modified global variables: CORE.Window.screen.width/CORE.Window.screen.height - CORE.Window.render.width/CORE.Window.render.height - CORE.Window.renderOffset.x/CORE.Window.renderOffset.y - CORE.Window.screenScale
+        // TODO: It is a quite cumbersome solution to display size vs requested size, it should be reviewed or removed...
+        // HighDPI monitors are properly considered in a following similar function: SetupViewport()
+        SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+        CORE.Window.handle = glfwCreateWindow(CORE.Window.display.width, CORE.Window.display.height, (CORE.Window.title != 0)? CORE.Window.title : " ", glfwGetPrimaryMonitor(), NULL);
+
+        // NOTE: Full-screen change, not working properly...
+        //glfwSetWindowMonitor(CORE.Window.handle, glfwGetPrimaryMonitor(), 0, 0, CORE.Window.screen.width, CORE.Window.screen.height, GLFW_DONT_CARE);
+    }
+    else
+    {
+#if defined(PLATFORM_DESKTOP)
+        // If we are windowed fullscreen, ensures that window does not minimize when focus is lost
+        if ((CORE.Window.screen.height == CORE.Window.display.height) && (CORE.Window.screen.width == CORE.Window.display.width))
+        {
+            glfwWindowHint(GLFW_AUTO_ICONIFY, 0);
+        }
+#endif
+        // No-fullscreen window creation
+        CORE.Window.handle = glfwCreateWindow(CORE.Window.screen.width, CORE.Window.screen.height, (CORE.Window.title != 0)? CORE.Window.title : " ", NULL, NULL);
+
+        if (CORE.Window.handle)
+        {
+            CORE.Window.render.width = CORE.Window.screen.width;
+            CORE.Window.render.height = CORE.Window.screen.height;
+        }
+    }
+
+    if (!CORE.Window.handle)
+    {
+        glfwTerminate();
+        TRACELOG(LOG_WARNING, "GLFW: Failed to initialize Window");
+        return false;
+    }
+
+    // Set window callback events
+    glfwSetWindowSizeCallback(CORE.Window.handle, WindowSizeCallback);      // NOTE: Resizing not allowed by default!
+#if !defined(PLATFORM_WEB)
+    glfwSetWindowMaximizeCallback(CORE.Window.handle, WindowMaximizeCallback);
+#endif
+    glfwSetWindowIconifyCallback(CORE.Window.handle, WindowIconifyCallback);
+    glfwSetWindowFocusCallback(CORE.Window.handle, WindowFocusCallback);
+    glfwSetDropCallback(CORE.Window.handle, WindowDropCallback);
+
+    // Set input callback events
+    glfwSetKeyCallback(CORE.Window.handle, KeyCallback);
+    glfwSetCharCallback(CORE.Window.handle, CharCallback);
+    glfwSetMouseButtonCallback(CORE.Window.handle, MouseButtonCallback);
+    glfwSetCursorPosCallback(CORE.Window.handle, MouseCursorPosCallback);   // Track mouse position changes
+    glfwSetScrollCallback(CORE.Window.handle, MouseScrollCallback);
+    glfwSetCursorEnterCallback(CORE.Window.handle, CursorEnterCallback);
+
+    // NOTE: Software renderer window has no OpenGL context (no context and no V-Sync)
+    bool hasContext = (rlGetVersion() != RL_OPENGL_SOFTWARE);
+
+    if (hasContext) glfwMakeContextCurrent(CORE.Window.handle);
+
+#if !defined(PLATFORM_WEB)
+    glfwSetInputMode(CORE.Window.handle, GLFW_LOCK_KEY_MODS, GLFW_TRUE);    // Enable lock keys modifiers (CAPS, NUM)
+
+    if (hasContext) glfwSwapInterval(0);        // No V-Sync by default
+#endif
+
+    // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
+    // NOTE: V-Sync can be enabled by graphic driver configuration
+    if (hasContext && (CORE.Window.flags & FLAG_VSYNC_HINT))
+    {
+        // WARNING: It seems to hit a critical render path in Intel HD Graphics
+        glfwSwapInterval(1);
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable VSYNC");
+    }
+
+    int fbWidth = CORE.Window.screen.width;
+    int fbHeight = CORE.Window.screen.height;
+
+#if defined(PLATFORM_DESKTOP)
+    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
+    {
+        // NOTE: On APPLE platforms system should manage window/input scaling and also framebuffer scaling.
+        // Framebuffer scaling should be activated with: glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
+    #if !defined(__APPLE__)
+        glfwGetFramebufferSize(CORE.Window.handle, &fbWidth, &fbHeight);
+
+        // Screen scaling matrix is required in case desired screen area is different from display area
+        CORE.Window.screenScale = MatrixScale((float)fbWidth/CORE.Window.screen.width, (float)fbHeight/CORE.Window.screen.height, 1.0f);
+
+        // Mouse input scaling for the new screen size
+        SetMouseScale((float)CORE.Window.screen.width/fbWidth, (float)CORE.Window.screen.height/fbHeight);
+    #endif
+    }
+#endif
+
+    CORE.Window.render.width = fbWidth;
+    CORE.Window.render.height = fbHeight;
+    CORE.Window.currentFbo.width = fbWidth;
+    CORE.Window.currentFbo.height = fbHeight;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+
+#endif  // PLATFORM_DESKTOP || PLATFORM_WEB
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+    CORE.Window.fullscreen = true;
+    CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+
+#if defined(PLATFORM_RPI)
+    bcm_host_init();
+
+    DISPMANX_ELEMENT_HANDLE_T dispmanElement = { 0 };
+    DISPMANX_DISPLAY_HANDLE_T dispmanDisplay = { 0 };
+    DISPMANX_UPDATE_HANDLE_T dispmanUpdate = { 0 };
+
+    VC_RECT_T dstRect = { 0 };
+    VC_RECT_T srcRect = { 0 };
+#endif
+
+#if defined(PLATFORM_DRM)
+    CORE.Window.fd = -1;
+    CORE.Window.connector = NULL;
+    CORE.Window.modeIndex = -1;
+    CORE.Window.crtc = NULL;
+    CORE.Window.gbmDevice = NULL;
+    CORE.Window.gbmSurface = NULL;
+    CORE.Window.prevBO = NULL;
+    CORE.Window.prevFB = 0;
+
+#if defined(DEFAULT_GRAPHIC_DEVICE_DRM)
+    CORE.Window.fd = open(DEFAULT_GRAPHIC_DEVICE_DRM, O_RDWR);
+#else
+    TRACELOG(LOG_INFO, "DISPLAY: No graphic card set, trying platform-gpu-card");
+    CORE.Window.fd = open("/dev/dri/by-path/platform-gpu-card",  O_RDWR); // VideoCore VI (Raspberry Pi 4)
+
+    if ((-1 == CORE.Window.fd) || (drmModeGetResources(CORE.Window.fd) == NULL))
+    {
+        TRACELOG(LOG_INFO, "DISPLAY: Failed to open platform-gpu-card, trying card1");
+        CORE.Window.fd = open("/dev/dri/card1", O_RDWR); // Other Embedded
+    }
+
+    if ((-1 == CORE.Window.fd) || (drmModeGetResources(CORE.Window.fd) == NULL))
+    {
+        TRACELOG(LOG_INFO, "DISPLAY: Failed to open graphic card1, trying card0");
+        CORE.Window.fd = open("/dev/dri/card0", O_RDWR); // VideoCore IV (Raspberry Pi 1-3)
+    }
+#endif
+    if (-1 == CORE.Window.fd)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to open graphic card");
+        return false;
+    }
+
+    drmModeRes *res = drmModeGetResources(CORE.Window.fd);
+    if (!res)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed get DRM resources");
+        return false;
+    }
+
+    TRACELOG(LOG_TRACE, "DISPLAY: Connectors found: %i", res->count_connectors);
+    for (size_t i = 0; i < res->count_connectors; i++)
+    {
+        TRACELOG(LOG_TRACE, "DISPLAY: Connector index %i", i);
+        drmModeConnector *con = drmModeGetConnector(CORE.Window.fd, res->connectors[i]);
+        TRACELOG(LOG_TRACE, "DISPLAY: Connector modes detected: %i", con->count_modes);
+        if ((con->connection == DRM_MODE_CONNECTED) && (con->encoder_id))
+        {
+            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode connected");
+            CORE.Window.connector = con;
+            break;
+        }
+        else
+        {
+            TRACELOG(LOG_TRACE, "DISPLAY: DRM mode NOT connected (deleting)");
+            drmModeFreeConnector(con);
+        }
+    }
+
+    if (!CORE.Window.connector)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: No suitable DRM connector found");
+        drmModeFreeResources(res);
+        return false;
+    }
+
+    drmModeEncoder *enc = drmModeGetEncoder(CORE.Window.fd, CORE.Window.connector->encoder_id);
+    if (!enc)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get DRM mode encoder");
+        drmModeFreeResources(res);
+        return false;
+    }
+
+    CORE.Window.crtc = drmModeGetCrtc(CORE.Window.fd, enc->crtc_id);
+    if (!CORE.Window.crtc)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get DRM mode crtc");
+        drmModeFreeEncoder(enc);
+        drmModeFreeResources(res);
+        return false;
+    }
+
+    // If InitWindow should use the current mode find it in the connector's mode list
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        TRACELOG(LOG_TRACE, "DISPLAY: Selecting DRM connector mode for current used mode...");
+
+        CORE.Window.modeIndex = FindMatchingConnectorMode(CORE.Window.connector, &CORE.Window.crtc->mode);
+
+        if (CORE.Window.modeIndex < 0)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: No matching DRM connector mode found");
+            drmModeFreeEncoder(enc);
+            drmModeFreeResources(res);
+            return false;
+        }
+
+        CORE.Window.screen.width = CORE.Window.display.width;
+        CORE.Window.screen.height = CORE.Window.display.height;
+    }
+
+    const bool allowInterlaced = CORE.Window.flags & FLAG_INTERLACED_HINT;
+    const int fps = (CORE.Time.target > 0) ? (1.0/CORE.Time.target) : 60;
+
+    // Try to find an exact matching mode
+    CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
+
+    // If nothing found, try to find a nearly matching mode
+    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindNearestConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, allowInterlaced);
+
+    // If nothing found, try to find an exactly matching mode including interlaced
+    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindExactConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, true);
+
+    // If nothing found, try to find a nearly matching mode including interlaced
+    if (CORE.Window.modeIndex < 0) CORE.Window.modeIndex = FindNearestConnectorMode(CORE.Window.connector, CORE.Window.screen.width, CORE.Window.screen.height, fps, true);
+
+    // If nothing found, there is no suitable mode
+    if (CORE.Window.modeIndex < 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to find a suitable DRM connector mode");
+        drmModeFreeEncoder(enc);
+        drmModeFreeResources(res);
+        return false;
+    }
+
+    CORE.Window.display.width = CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay;
+    CORE.Window.display.height = CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Selected DRM connector mode %s (%ux%u%c@%u)", CORE.Window.connector->modes[CORE.Window.modeIndex].name,
+        CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay,
+        (CORE.Window.connector->modes[CORE.Window.modeIndex].flags & DRM_MODE_FLAG_INTERLACE) ? 'i' : 'p',
+        CORE.Window.connector->modes[CORE.Window.modeIndex].vrefresh);
+
+    // Use the width and height of the surface for render
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+
+    drmModeFreeEncoder(enc);
+    enc = NULL;
+
+    drmModeFreeResources(res);
+    res = NULL;
+
+    CORE.Window.gbmDevice = gbm_create_device(CORE.Window.fd);
+    if (!CORE.Window.gbmDevice)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create GBM device");
+        return false;
+    }
+
+    CORE.Window.gbmSurface = gbm_surface_create(CORE.Window.gbmDevice, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay,
+        CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, GBM_FORMAT_ARGB8888, GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (!CORE.Window.gbmSurface)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create GBM surface");
+        return false;
+    }
+#endif
+
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+    }
+
+    const EGLint framebufferAttribs[] =
+    {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,     // Type of context support -> Required on RPI?
+#if defined(PLATFORM_DRM)
+        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,          // Don't use it on Android!
+#endif
+        EGL_RED_SIZE, 8,            // RED color bit depth (alternative: 5)
+        EGL_GREEN_SIZE, 8,          // GREEN color bit depth (alternative: 6)
+        EGL_BLUE_SIZE, 8,           // BLUE color bit depth (alternative: 5)
+#if defined(PLATFORM_DRM)
+        EGL_ALPHA_SIZE, 8,        // ALPHA bit depth (required for transparent framebuffer)
+#endif
+        //EGL_TRANSPARENT_TYPE, EGL_NONE, // Request transparent framebuffer (EGL_TRANSPARENT_RGB does not work on RPI)
+        EGL_DEPTH_SIZE, 16,         // Depth buffer size (Required to use Depth testing!)
+        //EGL_STENCIL_SIZE, 8,      // Stencil buffer size
+#if !defined(PLATFORM_NX)
+        EGL_SAMPLE_BUFFERS, sampleBuffer,    // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated (Free on MALI GPUs)
+#endif
+        EGL_NONE
+    };
+
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE
+    };
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+    EGLint numConfigs = 0;
+
+    // Get an EGL device connection
+#if defined(PLATFORM_DRM)
+    CORE.Window.device = eglGetDisplay((EGLNativeDisplayType)CORE.Window.gbmDevice);
+#else
+    CORE.Window.device = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+#endif
+    if (CORE.Window.device == EGL_NO_DISPLAY)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return false;
+    }
+
+    // Initialize the EGL device connection
+    if (eglInitialize(CORE.Window.device, NULL, NULL) == EGL_FALSE)
+    {
+        // If all of the calls to eglInitialize returned EGL_FALSE then an error has occurred.
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return false;
+    }
+
+#if defined(PLATFORM_DRM)
+    if (!eglChooseConfig(CORE.Window.device, NULL, NULL, 0, &numConfigs))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get EGL config count: 0x%x", eglGetError());
+        return false;
+    }
+
+    TRACELOG(LOG_TRACE, "DISPLAY: EGL configs available: %d", numConfigs);
+
+    EGLConfig *configs = RL_CALLOC(numConfigs, sizeof(*configs));
+    if (!configs)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get memory for EGL configs");
+        return false;
+    }
+
+    EGLint matchingNumConfigs = 0;
+    if (!eglChooseConfig(CORE.Window.device, framebufferAttribs, configs, numConfigs, &matchingNumConfigs))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose EGL config: 0x%x", eglGetError());
+        free(configs);
+        return false;
+    }
+
+    TRACELOG(LOG_TRACE, "DISPLAY: EGL matching configs available: %d", matchingNumConfigs);
+
+    // find the EGL config that matches the previously setup GBM format
+    int found = 0;
+    for (EGLint i = 0; i < matchingNumConfigs; ++i)
+    {
+        EGLint id = 0;
+        if (!eglGetConfigAttrib(CORE.Window.device, configs[i], EGL_NATIVE_VISUAL_ID, &id))
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Failed to get EGL config attribute: 0x%x", eglGetError());
+            continue;
+        }
+
+        if (GBM_FORMAT_ARGB8888 == id)
+        {
+            TRACELOG(LOG_TRACE, "DISPLAY: Using EGL config: %d", i);
+            CORE.Window.config = configs[i];
+            found = 1;
+            break;
+        }
+    }
+
+    RL_FREE(configs);
+
+    if (!found)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to find a suitable EGL config");
+        return false;
+    }
+#else
+    // Get an appropriate EGL framebuffer configuration
+    eglChooseConfig(CORE.Window.device, framebufferAttribs, &CORE.Window.config, 1, &numConfigs);
+#endif
+
+    // Set rendering API
+    eglBindAPI(EGL_OPENGL_ES_API);
+
+    // Create an EGL rendering context
+    CORE.Window.context = eglCreateContext(CORE.Window.device, CORE.Window.config, EGL_NO_CONTEXT, contextAttribs);
+    if (CORE.Window.context == EGL_NO_CONTEXT)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL context");
+        return false;
+    }
+#endif
+
+    // Create an EGL window surface
+    //---------------------------------------------------------------------------------
+#if defined(PLATFORM_ANDROID)
+    EGLint displayFormat = 0;
+
+    // EGL_NATIVE_VISUAL_ID is an attribute of the EGLConfig that is guaranteed to be accepted by ANativeWindow_setBuffersGeometry()
+    // As soon as we picked a EGLConfig, we can safely reconfigure the ANativeWindow buffers to match, using EGL_NATIVE_VISUAL_ID
+    eglGetConfigAttrib(CORE.Window.device, CORE.Window.config, EGL_NATIVE_VISUAL_ID, &displayFormat);
+
+    // At this point we need to manage render size vs screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    ANativeWindow_setBuffersGeometry(CORE.Android.app->window, CORE.Window.render.width, CORE.Window.render.height, displayFormat);
+    //ANativeWindow_setBuffersGeometry(CORE.Android.app->window, 0, 0, displayFormat);       // Force use of native display size
+
+    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, CORE.Android.app->window, NULL);
+#endif  // PLATFORM_ANDROID
+
+#if defined(PLATFORM_RPI)
+    graphics_get_display_size(0, &CORE.Window.display.width, &CORE.Window.display.height);
+
+    // Screen size security check
+    if (CORE.Window.screen.width <= 0) CORE.Window.screen.width = CORE.Window.display.width;
+    if (CORE.Window.screen.height <= 0) CORE.Window.screen.height = CORE.Window.display.height;
+
+    // At this point we need to manage render size vs screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    dstRect.x = 0;
+    dstRect.y = 0;
+    dstRect.width = CORE.Window.display.width;
+    dstRect.height = CORE.Window.display.height;
+
+    srcRect.x = 0;
+    srcRect.y = 0;
+    srcRect.width = CORE.Window.render.width << 16;
+    srcRect.height = CORE.Window.render.height << 16;
+
+    // NOTE: RPI dispmanx windowing system takes care of source rectangle scaling to destination rectangle by hardware (no cost)
+    // Take care that renderWidth/renderHeight fit on displayWidth/displayHeight aspect ratio
+
+    VC_DISPMANX_ALPHA_T alpha = { 0 };
+    alpha.flags = DISPMANX_FLAGS_ALPHA_FIXED_ALL_PIXELS;
+    //alpha.flags = DISPMANX_FLAGS_ALPHA_FROM_SOURCE;       // TODO: Allow transparent framebuffer! -> FLAG_WINDOW_TRANSPARENT
+    alpha.opacity = 255;    // Set transparency level for framebuffer, requires EGLAttrib: EGL_TRANSPARENT_TYPE
+    alpha.mask = 0;
+
+    dispmanDisplay = vc_dispmanx_display_open(0);   // LCD
+    dispmanUpdate = vc_dispmanx_update_start(0);
+
+    dispmanElement = vc_dispmanx_element_add(dispmanUpdate, dispmanDisplay, 0/*layer*/, &dstRect, 0/*src*/,
+                                            &srcRect, DISPMANX_PROTECTION_NONE, &alpha, 0/*clamp*/, DISPMANX_NO_ROTATE);
+
+    CORE.Window.handle.element = dispmanElement;
+    CORE.Window.handle.width = CORE.Window.render.width;
+    CORE.Window.handle.height = CORE.Window.render.height;
+    vc_dispmanx_update_submit_sync(dispmanUpdate);
+
+    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, &CORE.Window.handle, NULL);
+
+    const unsigned char *const renderer = glGetString(GL_RENDERER);
+    if (renderer) TRACELOG(LOG_INFO, "DISPLAY: Renderer name is: %s", renderer);
+    else TRACELOG(LOG_WARNING, "DISPLAY: Failed to get renderer name");
+    //---------------------------------------------------------------------------------
+#endif  // PLATFORM_RPI
+
+#if defined(PLATFORM_NX)
+    CORE.Window.gbmSurface = nwindowGetDefault();
+    if (appletGetOperationMode() == AppletOperationMode_Console)
+    {
+        CORE.Window.display.width = 1920;
+        CORE.Window.display.height = 1080;
+    }
+    else if (appletGetOperationMode() == AppletOperationMode_Handheld)
+    {
+        CORE.Window.display.width = 1280;
+        CORE.Window.display.height = 720;
+    }
+#endif
+
+#if defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, (EGLNativeWindowType)CORE.Window.gbmSurface, NULL);
+    if (EGL_NO_SURFACE == CORE.Window.surface)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL window surface: 0x%04x", eglGetError());
+        return false;
+    }
+
+    // At this point we need to manage render size vs screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+#endif  // PLATFORM_DRM
+
+    // There must be at least one frame displayed before the buffers are swapped
+    //eglSwapInterval(CORE.Window.device, 1);
+
+    if (eglMakeCurrent(CORE.Window.device, CORE.Window.surface, CORE.Window.surface, CORE.Window.context) == EGL_FALSE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to attach EGL rendering context to EGL surface");
+        return false;
+    }
+    else
+    {
+        CORE.Window.render.width = CORE.Window.screen.width;
+        CORE.Window.render.height = CORE.Window.screen.height;
+        CORE.Window.currentFbo.width = CORE.Window.render.width;
+        CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+        TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+        TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+        TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+        TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+        TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+    }
+#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
+
+    // Load OpenGL extensions
+    // NOTE: GL procedures address loader is required to load extensions
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    rlLoadExtensions(glfwGetProcAddress);
+#else
+    rlLoadExtensions(eglGetProcAddress);
+#endif
+
+    // Initialize OpenGL context (states and resources)
+    // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
+    rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+
+    // Setup default viewport
+    // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
+    SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+
+#if defined(PLATFORM_ANDROID)
+    CORE.Window.ready = true;
+#endif
+
+    if ((CORE.Window.flags & FLAG_WINDOW_MINIMIZED) > 0) MinimizeWindow();
+
+    return true;
+}
+
+// Set viewport for a provided width and height
+static void SetupViewport(int width, int height)
+{
+    CORE.Window.render.width = width;
+    CORE.Window.render.height = height;
+
+    // Set viewport width and height
+    // NOTE: We consider render size (scaled) and offset in case black bars are required and
+    // render area does not match full display area (this situation is only applicable on fullscreen mode)
+#if defined(__APPLE__)
+    float xScale = 1.0f, yScale = 1.0f;
+    glfwGetWindowContentScale(CORE.Window.handle, &xScale, &yScale);
+    rlViewport(CORE.Window.renderOffset.x/2*xScale, CORE.Window.renderOffset.y/2*yScale, (CORE.Window.render.width)*xScale, (CORE.Window.render.height)*yScale);
+#else
+    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
+#endif
+
+    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
+    rlLoadIdentity();                   // Reset current matrix (projection)
+
+    // Set orthographic projection to current framebuffer size
+    // NOTE: Configured top-left corner as (0, 0)
+    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+
+    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
+    rlLoadIdentity();                   // Reset current matrix (modelview)
+}
+
+// Compute framebuffer size relative to screen size and display size
+// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
+static void SetupFramebuffer(int width, int height)
+{
+    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
+    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+
+        // Downscaling to fit display with border-bars
+        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
+        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
+
+        if (widthRatio <= heightRatio)
+        {
+            CORE.Window.render.width = CORE.Window.display.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
+            CORE.Window.render.height = CORE.Window.display.height;
+            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
+            CORE.Window.renderOffset.y = 0;
+        }
+
+        // Screen scaling required
+        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
+        CORE.Window.screenScale = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+
+        // NOTE: We render to full display resolution!
+        // We just need to calculate above parameters for downscale matrix and offsets
+        CORE.Window.render.width = CORE.Window.display.width;
+        CORE.Window.render.height = CORE.Window.display.height;
+
+        TRACELOG(LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
+    }
+    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+    {
+        // Required screen size is smaller than display size
+        TRACELOG(LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+
+        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        {
+            CORE.Window.screen.width = CORE.Window.display.width;
+            CORE.Window.screen.height = CORE.Window.display.height;
+        }
+
+        // Upscaling to fit display with border-bars
+        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
+        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
+
+        if (displayRatio <= screenRatio)
+        {
+            CORE.Window.render.width = CORE.Window.screen.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
+            CORE.Window.render.height = CORE.Window.screen.height;
+            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
+            CORE.Window.renderOffset.y = 0;
+        }
+    }
+    else
+    {
+        CORE.Window.render.width = CORE.Window.screen.width;
+        CORE.Window.render.height = CORE.Window.screen.height;
+        CORE.Window.renderOffset.x = 0;
+        CORE.Window.renderOffset.y = 0;
+    }
+}
+
+// Initialize hi-resolution timer
+static void InitTimer(void)
+{
+// Setting a higher resolution can improve the accuracy of time-out intervals in wait functions.
+// However, it can also reduce overall system performance, because the thread scheduler switches tasks more often.
+// High resolutions can also prevent the CPU power management system from entering power-saving modes.
+// Setting a higher resolution does not improve the accuracy of the high-resolution performance counter.
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    struct timespec now = { 0 };
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    {
+        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+    }
+    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
+#endif
+
+    CORE.Time.previous = GetTime();     // Get time as double
+
+#if defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+    // Initial sleep overshoot estimate (1 ms), adjusted on every WaitTime()
+    CORE.Time.overshootMean = 0.0005;
+    CORE.Time.overshootDeviation = 0.00025;
+#endif
+}
+
+// Update frame boundary timing: fixed update steps and jitter statistics
+static void UpdateFrameBoundary(void)
+{
+    double current = GetTime();
+    double delta = current - CORE.Time.boundary;
+    CORE.Time.boundary = current;
+
+    // Frame time jitter, standard deviation of last frames time
+    // NOTE: Only measured frames are considered, history is not full on first frames
+    CORE.Time.history[CORE.Time.historyIndex] = (float)delta;
+    CORE.Time.historyIndex = (CORE.Time.historyIndex + 1)%FRAME_TIME_HISTORY;
+    if (CORE.Time.historyCount < FRAME_TIME_HISTORY) CORE.Time.historyCount++;
+
+    float mean = 0.0f;
+    float variance = 0.0f;
+    for (int i = 0; i < CORE.Time.historyCount; i++) mean += CORE.Time.history[i];
+    mean /= CORE.Time.historyCount;
+    for (int i = 0; i < CORE.Time.historyCount; i++) variance += (CORE.Time.history[i] - mean)*(CORE.Time.history[i] - mean);
+    CORE.Time.stats.frameJitter = sqrtf(variance/CORE.Time.historyCount);
+
+    if (CORE.Time.fixed <= 0.0) return;
+
+    // Snap frame time to display refresh multiples, timing noise around vsync is not accumulated
+    // NOTE: Snapping tolerance of 0.2 ms, snapped time is never far from real time
+    if (CORE.Time.refresh > 0.0)
+    {
+        for (int i = 1; i <= CORE.Time.fixedMaxSteps; i++)
+        {
+            if (fabs(delta - CORE.Time.refresh*i) < 0.0002)
+            {
+                delta = CORE.Time.refresh*i;
+                break;
+            }
+        }
+    }
+
+    CORE.Time.accumulator += delta;
+
+    // NOTE: Small epsilon (1 us) avoids losing a step to floating point error when frame time equals time step
+    int steps = (int)((CORE.Time.accumulator + 0.000001)/CORE.Time.fixed);
+
+    if (steps > CORE.Time.fixedMaxSteps)
+    {
+        CORE.Time.stats.fixedStepsDropped += (steps - CORE.Time.fixedMaxSteps);
+        CORE.Time.accumulator -= (steps - CORE.Time.fixedMaxSteps)*CORE.Time.fixed;
+        steps = CORE.Time.fixedMaxSteps;
+    }
+
+    CORE.Time.accumulator -= steps*CORE.Time.fixed;
+    CORE.Time.fixedSteps = steps;
+}
+
+// Wait for some time (stop program execution)
+// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
+// take longer than expected... for that reason we use the busy wait loop
+// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
+// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
+// NOTE: With SUPPORT_ADAPTIVE_WAIT_LOOP, sleep overshoot (time slept over requested) is measured on every wait,
+// frame sleeps for the requested time minus the overshoot estimate and runs a busy-wait-loop only for the rest
+void WaitTime(double seconds)
+{
+    PROFILE_ZONE_BEGIN("WaitTime");
+
+#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP) || defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+    double destinationTime = GetTime() + seconds;
+#endif
+
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+    while (GetTime() < destinationTime) { }
+#else
+    #if defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+        // NOTE: Overshoot estimate is mean plus two deviations, sleep rarely exceeds it
+        double overshoot = CORE.Time.overshootMean + 2.0*CORE.Time.overshootDeviation;
+        double sleepSeconds = seconds - overshoot;
+        double sleepStart = GetTime();
+    #elif defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
+    #else
+        double sleepSeconds = seconds;
+    #endif
+
+    // System halt functions
+    if (sleepSeconds > 0.0)
+    {
+    #if defined(_WIN32)
+        Sleep((unsigned long)(sleepSeconds*1000.0));
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+        struct timespec req = { 0 };
+        time_t sec = sleepSeconds;
+        long nsec = (sleepSeconds - sec)*1000000000L;
+        req.tv_sec = sec;
+        req.tv_nsec = nsec;
+
+        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
+        while (nanosleep(&req, &req) == -1) continue;
+    #endif
+    #if defined(__APPLE__)
+        usleep(sleepSeconds*1000000.0);
+    #endif
+    #if defined(PLATFORM_NX)
+        svcSleepThread((s64)(sleepSeconds*1000000000.0));
+    #endif
+    }
+
+    #if defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+        double spinStart = GetTime();
+
+        if (sleepSeconds > 0.0)
+        {
+            UpdateSleepOvershoot(spinStart - sleepStart - sleepSeconds);
+            CORE.Time.pacing.sleepTime += (spinStart - sleepStart);
+        }
+
+        while (GetTime() < destinationTime) { }
+
+        // Wait error, time waited over requested (only when slept past destination time)
+        double waitEnd = GetTime();
+        float error = (float)(waitEnd - destinationTime);
+        CORE.Time.pacing.spinTime += (waitEnd - spinStart);
+        CORE.Time.pacing.waitCount++;
+        if (error > CORE.Time.pacing.errorMax) CORE.Time.pacing.errorMax = error;
+
+        // Error histogram buckets upper bounds: 10us, 25us, 50us, 100us, 250us, 500us, 1ms, more
+        static const float errorBounds[7] = { 0.00001f, 0.000025f, 0.00005f, 0.0001f, 0.00025f, 0.0005f, 0.001f };
+        int bucket = 0;
+        while ((bucket < 7) && (error >= errorBounds[bucket])) bucket++;
+        CORE.Time.pacing.errorHistogram[bucket]++;
+    #elif defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        while (GetTime() < destinationTime) { }
+    #endif
+#endif
+
+    PROFILE_ZONE_END();
+}
+
+#if defined(SUPPORT_ADAPTIVE_WAIT_LOOP)
+// Update sleep overshoot estimate with a new measure (exponential moving average of mean and deviation)
+// NOTE: Estimate grows fast on oversleep (missed destination time) and decreases slowly
+static void UpdateSleepOvershoot(double overshoot)
+{
+    double estimate = CORE.Time.overshootMean + 2.0*CORE.Time.overshootDeviation;
+
+    // Clamp measure, occasional outliers (thread preemption, process suspension) should not turn waits into busy loops,
+    // a consistently higher overshoot (i.e. coarse system timer) is still reached after a few measures
+    double limit = (estimate*4.0 > 0.001)? estimate*4.0 : 0.001;
+    if (overshoot < 0.0) overshoot = 0.0;
+    else if (overshoot > limit) overshoot = limit;
+
+    double rate = (overshoot > estimate)? 0.1 : 0.02;
+
+    CORE.Time.overshootDeviation += (fabs(overshoot - CORE.Time.overshootMean) - CORE.Time.overshootDeviation)*rate;
+    CORE.Time.overshootMean += (overshoot - CORE.Time.overshootMean)*rate;
+
+    CORE.Time.pacing.sleepOvershoot = (float)(CORE.Time.overshootMean + 2.0*CORE.Time.overshootDeviation);
+}
+#endif
+
+// Swap back buffer with front buffer (screen drawing)
+void SwapScreenBuffer(void)
+{
+    PROFILE_ZONE_BEGIN("SwapScreenBuffer");
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    // NOTE: Software renderer draws into its own framebuffer (not presented),
+    // pending rendering is finished so it can be read back (i.e. TakeScreenshot())
+    if (rlGetVersion() == RL_OPENGL_SOFTWARE) rlFinish();
+    else glfwSwapBuffers(CORE.Window.handle);
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+    eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+
+#if defined(PLATFORM_DRM)
+
+    if (!CORE.Window.gbmSurface || (-1 == CORE.Window.fd) || !CORE.Window.connector || !CORE.Window.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+
+    struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
+    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+
+    uint32_t fb = 0;
+    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
+    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+
+    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
+    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+
+    if (CORE.Window.prevFB)
+    {
+        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+    }
+
+    CORE.Window.prevFB = fb;
+
+    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+
+    CORE.Window.prevBO = bo;
+
+#endif  // PLATFORM_DRM
+#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM || PLATFORM_NX
+
+    PROFILE_ZONE_END();
+}
+
+// Register all input events
+void PollInputEvents(void)
+{
+    PROFILE_ZONE_BEGIN("PollInputEvents");
+
+    // NOTE: Polling events defines the frame boundary, also with SUPPORT_CUSTOM_FRAME_CONTROL
+    UpdateFrameBoundary();
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
+    CORE.Input.Gamepad.axisCount = 0;
+#endif
+
+#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    PollKeyboardEvents();
+
+    // Register previous mouse states
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+    {
+        CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+        CORE.Input.Mouse.currentButtonState[i] = CORE.Input.Mouse.currentButtonStateEvdev[i];
+    }
+
+    // Register gamepads buttons events
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i])
+        {
+            // Register previous gamepad states
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+        }
+    }
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous mouse wheel state
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+
+    // Register previous mouse position
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+#endif
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Reset touch positions
+    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
+    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
+    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+
+#if defined(PLATFORM_DESKTOP)
+    // Check if gamepads are ready
+    // NOTE: We do it here in case of disconnection
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (glfwJoystickPresent(i)) CORE.Input.Gamepad.ready[i] = true;
+        else CORE.Input.Gamepad.ready[i] = false;
+    }
+
+    // Register gamepads buttons events
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
+        {
+            // Register previous gamepad states
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+
+            // Get current gamepad state
+            // NOTE: There is no callback available, so we get it manually
+            // Get remapped buttons
+            GLFWgamepadstate state = { 0 };
+            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+
+            const unsigned char *buttons = state.buttons;
+
+            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
+            {
+                GamepadButton button = -1;
+
+                switch (k)
+                {
+                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
+                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+
+                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
+                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
+                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
+                    case GLFW_GAMEPAD_BUTTON_RIGHT_THUMB: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
+                    default: break;
+                }
+
+                if (button != -1)   // Check for valid button
+                {
+                    if (buttons[k] == GLFW_PRESS)
+                    {
+                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
+                        CORE.Input.Gamepad.lastButtonPressed = button;
+                    }
+                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                }
+            }
+
+            // Get current axis state
+            const float *axes = state.axes;
+
+            for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1) && (k < MAX_GAMEPAD_AXIS); k++)
+            {
+                CORE.Input.Gamepad.axisState[i][k] = axes[k];
+            }
+
+            // Register buttons for 2nd triggers (because GLFW doesn't count these as buttons but rather axis)
+            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
+            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
+
+            CORE.Input.Gamepad.axisCount = GLFW_GAMEPAD_AXIS_LAST + 1;
+        }
+    }
+
+    CORE.Window.resizedLastFrame = false;
+
+    if (CORE.Window.eventWaiting) glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
+    else glfwPollEvents();      // Poll input events: keyboard/mouse/window events (callbacks)
+#endif  // PLATFORM_DESKTOP
+
+#if defined(PLATFORM_WEB)
+    CORE.Window.resizedLastFrame = false;
+#endif  // PLATFORM_WEB
+
+// Gamepad support using emscripten API
+// NOTE: GLFW3 joystick functionality not available in web
+#if defined(PLATFORM_WEB)
+    // Get number of gamepads connected
+    int numGamepads = 0;
+    if (emscripten_sample_gamepad_data() == EMSCRIPTEN_RESULT_SUCCESS) numGamepads = emscripten_get_num_gamepads();
+
+    for (int i = 0; (i < numGamepads) && (i < MAX_GAMEPADS); i++)
+    {
+        // Register previous gamepad button states
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+
+        EmscriptenGamepadEvent gamepadState;
+
+        int result = emscripten_get_gamepad_status(i, &gamepadState);
+
+        if (result == EMSCRIPTEN_RESULT_SUCCESS)
+        {
+            // Register buttons data for every connected gamepad
+            for (int j = 0; (j < gamepadState.numButtons) && (j < MAX_GAMEPAD_BUTTONS); j++)
+            {
+                GamepadButton button = -1;
+
+                // Gamepad Buttons reference: https://www.w3.org/TR/gamepad/#gamepad-interface
+                switch (j)
+                {
+                    case 0: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
+                    case 1: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
+                    case 2: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+                    case 3: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
+                    case 4: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
+                    case 5: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+                    case 6: button = GAMEPAD_BUTTON_LEFT_TRIGGER_2; break;
+                    case 7: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_2; break;
+                    case 8: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
+                    case 9: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+                    case 10: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
+                    case 11: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
+                    case 12: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
+                    case 13: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
+                    case 14: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+                    case 15: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
+                    default: break;
+                }
+
+                if (button != -1)   // Check for valid button
+                {
+                    if (gamepadState.digitalButton[j] == 1)
+                    {
+                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
+                        CORE.Input.Gamepad.lastButtonPressed = button;
+                    }
+                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                }
 
-#if defined(PLATFORM_DRM)
-    if (!eglChooseConfig(CORE.Window.device, NULL, NULL, 0, &numConfigs))
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get EGL config count: 0x%x", eglGetError());
-        return false;
-    }
+                //TRACELOGD("INPUT: Gamepad %d, button %d: Digital: %d, Analog: %g", gamepadState.index, j, gamepadState.digitalButton[j], gamepadState.analogButton[j]);
+            }
 
-    TRACELOG(LOG_TRACE, "DISPLAY: EGL configs available: %d", numConfigs);
+            // Register axis data for every connected gamepad
+            for (int j = 0; (j < gamepadState.numAxes) && (j < MAX_GAMEPAD_AXIS); j++)
+            {
+                CORE.Input.Gamepad.axisState[i][j] = gamepadState.axis[j];
+            }
 
-    EGLConfig *configs = RL_CALLOC(numConfigs, sizeof(*configs));
-    if (!configs)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get memory for EGL configs");
-        return false;
+            CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
+        }
     }
+#endif
 
-    EGLint matchingNumConfigs = 0;
-    if (!eglChooseConfig(CORE.Window.device, framebufferAttribs, configs, numConfigs, &matchingNumConfigs))
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose EGL config: 0x%x", eglGetError());
-        free(configs);
-        return false;
-    }
+#if defined(PLATFORM_ANDROID)
+    // Register previous keys states
+    // NOTE: Android supports up to 260 keys
+    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
 
-    TRACELOG(LOG_TRACE, "DISPLAY: EGL matching configs available: %d", matchingNumConfigs);
+    // Android ALooper_pollAll() variables
+    int pollResult = 0;
+    int pollEvents = 0;
 
-    // find the EGL config that matches the previously setup GBM format
-    int found = 0;
-    for (EGLint i = 0; i < matchingNumConfigs; ++i)
+    // Poll Events (registered events)
+    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
+    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
     {
-        EGLint id = 0;
-        if (!eglGetConfigAttrib(CORE.Window.device, configs[i], EGL_NATIVE_VISUAL_ID, &id))
+        // Process this event
+        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+
+        // NOTE: Never close window, native activity is controlled by the system!
+        if (CORE.Android.app->destroyRequested != 0)
         {
-            TRACELOG(LOG_WARNING, "DISPLAY: Failed to get EGL config attribute: 0x%x", eglGetError());
-            continue;
+            //CORE.Window.shouldClose = true;
+            //ANativeActivity_finish(CORE.Android.app->activity);
         }
+    }
+#endif
 
-        if (GBM_FORMAT_ARGB8888 == id)
+#if defined(PLATFORM_NX)
+/**
+ * Touch screen
+*/
+    HidTouchScreenState state = {0};
+    if (hidGetTouchScreenStates(&state, 1)) {
+        if (state.count != prev_touchcount)
         {
-            TRACELOG(LOG_TRACE, "DISPLAY: Using EGL config: %d", i);
-            CORE.Window.config = configs[i];
-            found = 1;
-            break;
+            prev_touchcount = state.count;
         }
-    }
+        for(int i=0; i<state.count; i++)
+        {
+            CORE.Input.Touch.position[i].x = state.touches[i].x;
+            CORE.Input.Touch.position[i].y = state.touches[i].y;
+            CORE.Input.Touch.pointId[i] = state.touches[i].finger_id;
 
-    RL_FREE(configs);
+            CORE.Input.Touch.deltaTime[i] = state.touches[i].delta_time;
+        }
+        CORE.Input.Touch.pointCount = state.count;
+    }
 
-    if (!found)
+/**
+ * Gamepad
+*/
+    for (int nxGamepadIndex = 0; nxGamepadIndex < MAX_GAMEPADS; nxGamepadIndex++)
     {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to find a suitable EGL config");
-        return false;
-    }
-#else
-    // Get an appropriate EGL framebuffer configuration
-    eglChooseConfig(CORE.Window.device, framebufferAttribs, &CORE.Window.config, 1, &numConfigs);
-#endif
+        // Scan the gamepad. This should be done once for each frame
+        padUpdate(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
+        
+        CORE.Input.Gamepad.ready[nxGamepadIndex] = padIsConnected(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
+        if (CORE.Input.Gamepad.ready[nxGamepadIndex]) {
+            CORE.Input.Gamepad.nxPadStyle[nxGamepadIndex] = hidGetNpadStyleSet(nxGamepadIndex);
 
-    // Set rendering API
-    eglBindAPI(EGL_OPENGL_ES_API);
+            // Returns the set of buttons that are currently pressed
+            u64 kHeld = padGetButtons(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
+            u64 kButton;
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+            {
+                // Register previous gamepad states
+                CORE.Input.Gamepad.previousButtonState[nxGamepadIndex][k] = CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k];
 
-    // Create an EGL rendering context
-    CORE.Window.context = eglCreateContext(CORE.Window.device, CORE.Window.config, EGL_NO_CONTEXT, contextAttribs);
-    if (CORE.Window.context == EGL_NO_CONTEXT)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL context");
-        return false;
-    }
-#endif
+                // Check digital buttons
+                kButton = 0;
+                switch (k)
+                {
+                    case GAMEPAD_BUTTON_LEFT_FACE_UP: kButton = HidNpadButton_Up; break;
+                    case GAMEPAD_BUTTON_LEFT_FACE_RIGHT: kButton = HidNpadButton_Right; break;
+                    case GAMEPAD_BUTTON_LEFT_FACE_DOWN: kButton = HidNpadButton_Down; break;
+                    case GAMEPAD_BUTTON_LEFT_FACE_LEFT: kButton = HidNpadButton_Left; break;
+                    case GAMEPAD_BUTTON_RIGHT_FACE_UP: kButton = HidNpadButton_X; break;
+                    case GAMEPAD_BUTTON_RIGHT_FACE_RIGHT: kButton = HidNpadButton_A; break;
+                    case GAMEPAD_BUTTON_RIGHT_FACE_DOWN: kButton = HidNpadButton_B; break;
+                    case GAMEPAD_BUTTON_RIGHT_FACE_LEFT: kButton = HidNpadButton_Y; break;                
+                    case GAMEPAD_BUTTON_LEFT_TRIGGER_1: kButton = HidNpadButton_L; break;
+                    case GAMEPAD_BUTTON_LEFT_TRIGGER_2: kButton = HidNpadButton_ZL; break;
+                    case GAMEPAD_BUTTON_RIGHT_TRIGGER_1: kButton = HidNpadButton_R; break;
+                    case GAMEPAD_BUTTON_RIGHT_TRIGGER_2: kButton = HidNpadButton_ZR; break;
+                    case GAMEPAD_BUTTON_MIDDLE_LEFT: kButton = HidNpadButton_Minus; break;
+                    case GAMEPAD_BUTTON_MIDDLE_RIGHT: kButton = HidNpadButton_Plus; break;
+                    case GAMEPAD_BUTTON_LEFT_THUMB: kButton = HidNpadButton_StickL; break;
+                    case GAMEPAD_BUTTON_RIGHT_THUMB: kButton = HidNpadButton_StickR; break;
+                }
+                if (kHeld & kButton) {
+                    CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k] = 1;
+                    CORE.Input.Gamepad.lastButtonPressed = k;
+                } else {
+                    CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k] = 0;
+                }
+            }
 
-    // Create an EGL window surface
-    //---------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
-    EGLint displayFormat = 0;
+            // Check analogic axis and buttons
+            HidAnalogStickState kAxisL = padGetStickPos(&CORE.Input.Gamepad.nxPad[nxGamepadIndex], 0);
+            HidAnalogStickState kAxisR = padGetStickPos(&CORE.Input.Gamepad.nxPad[nxGamepadIndex], 1);
 
-    // EGL_NATIVE_VISUAL_ID is an attribute of the EGLConfig that is guaranteed to be accepted by ANativeWindow_setBuffersGeometry()
-    // As soon as we picked a EGLConfig, we can safely reconfigure the ANativeWindow buffers to match, using EGL_NATIVE_VISUAL_ID
-    eglGetConfigAttrib(CORE.Window.device, CORE.Window.config, EGL_NATIVE_VISUAL_ID, &displayFormat);
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_X] = (float)kAxisL.x / 32767.0f;
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_Y] = (float)kAxisL.y / 32767.0f;
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_X] = (float)kAxisR.x / 32767.0f;
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_Y] = (float)kAxisR.y / 32767.0f;
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_TRIGGER] = (kHeld & HidNpadButton_ZL) ? 1.0f : 0.0f;
+            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_TRIGGER] = (kHeld & HidNpadButton_ZR) ? 1.0f : 0.0f;
 
-    // At this point we need to manage render size vs screen size
-    // NOTE: This function use and modify global module variables:
-    //  -> CORE.Window.screen.width/CORE.Window.screen.height
-    //  -> CORE.Window.render.width/CORE.Window.render.height
-    //  -> CORE.Window.screenScale
-    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+#if defined(ENABLE_DEV_EXIT)
+            if (kHeld & HidNpadButton_Plus && kHeld & HidNpadButton_Minus)
+            {
+                CORE.Window.shouldClose = true;
+            }
+#endif
 
-    ANativeWindow_setBuffersGeometry(CORE.Android.app->window, CORE.Window.render.width, CORE.Window.render.height, displayFormat);
-    //ANativeWindow_setBuffersGeometry(CORE.Android.app->window, 0, 0, displayFormat);       // Force use of native display size
+#if defined(NX_SUPPORT_GAMEPAD_EMULATION)
 
-    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, CORE.Android.app->window, NULL);
-#endif  // PLATFORM_ANDROID
+            // Move Right (D key or right arrow)
+            CORE.Input.Keyboard.previousKeyState[KEY_RIGHT] = CORE.Input.Keyboard.currentKeyState[KEY_RIGHT];
+            CORE.Input.Keyboard.previousKeyState[KEY_D] = CORE.Input.Keyboard.currentKeyState[KEY_D];
+            if (kHeld & HidNpadButton_Right || kHeld & HidNpadButton_StickLRight) {
+                CORE.Input.Keyboard.currentKeyState[KEY_RIGHT] = 1;
+                CORE.Input.Keyboard.currentKeyState[KEY_D] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_RIGHT] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_D] = 0;
+            }
 
-#if defined(PLATFORM_RPI)
-    graphics_get_display_size(0, &CORE.Window.display.width, &CORE.Window.display.height);
+            // Move Left (A key or left arrow)
+            CORE.Input.Keyboard.previousKeyState[KEY_LEFT] = CORE.Input.Keyboard.currentKeyState[KEY_LEFT];
+            CORE.Input.Keyboard.previousKeyState[KEY_A] = CORE.Input.Keyboard.currentKeyState[KEY_A];
+            if (kHeld & HidNpadButton_Left || kHeld & HidNpadButton_StickLLeft) {
+                CORE.Input.Keyboard.currentKeyState[KEY_LEFT] = 1;
+                CORE.Input.Keyboard.currentKeyState[KEY_A] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_LEFT] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_A] = 0;
+            }
 
-    // Screen size security check
-    if (CORE.Window.screen.width <= 0) CORE.Window.screen.width = CORE.Window.display.width;
-    if (CORE.Window.screen.height <= 0) CORE.Window.screen.height = CORE.Window.display.height;
+            // Move down (S key or down arrow)
+            CORE.Input.Keyboard.previousKeyState[KEY_DOWN] = CORE.Input.Keyboard.currentKeyState[KEY_DOWN];
+            CORE.Input.Keyboard.previousKeyState[KEY_S] = CORE.Input.Keyboard.currentKeyState[KEY_S];
+            if (kHeld & HidNpadButton_Down || kHeld & HidNpadButton_StickLDown) {
+                CORE.Input.Keyboard.currentKeyState[KEY_DOWN] = 1;
+                CORE.Input.Keyboard.currentKeyState[KEY_S] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_DOWN] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_S] = 0;
+            }
 
-    // At this point we need to manage render size vs screen size
-    // NOTE: This function use and modify global module variables:
-    //  -> CORE.Window.screen.width/CORE.Window.screen.height
-    //  -> CORE.Window.render.width/CORE.Window.render.height
-    //  -> CORE.Window.screenScale
-    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+            // Move up (W key or up arrow)
+            CORE.Input.Keyboard.previousKeyState[KEY_UP] = CORE.Input.Keyboard.currentKeyState[KEY_UP];
+            CORE.Input.Keyboard.previousKeyState[KEY_W] = CORE.Input.Keyboard.currentKeyState[KEY_W];
+            if (kHeld & HidNpadButton_Up || kHeld & HidNpadButton_StickLUp) {
+                CORE.Input.Keyboard.currentKeyState[KEY_UP] = 1;
+                CORE.Input.Keyboard.currentKeyState[KEY_W] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_UP] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_W] = 0;
+            }
 
-    dstRect.x = 0;
-    dstRect.y = 0;
-    dstRect.width = CORE.Window.display.width;
-    dstRect.height = CORE.Window.display.height;
+            // Gamepad Y (Q key)
+            CORE.Input.Keyboard.previousKeyState[KEY_Q] = CORE.Input.Keyboard.currentKeyState[KEY_Q];
+            if (kHeld & HidNpadButton_Y) {
+                CORE.Input.Keyboard.currentKeyState[KEY_Q] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_Q] = 0;
+            }
 
-    srcRect.x = 0;
-    srcRect.y = 0;
-    srcRect.width = CORE.Window.render.width << 16;
-    srcRect.height = CORE.Window.render.height << 16;
+            // Gamepad A (E key)
+            CORE.Input.Keyboard.previousKeyState[KEY_E] = CORE.Input.Keyboard.currentKeyState[KEY_E];
+            if (kHeld & HidNpadButton_A) {
+                CORE.Input.Keyboard.currentKeyState[KEY_E] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_E] = 0;
+            }
 
-    // NOTE: RPI dispmanx windowing system takes care of source rectangle scaling to destination rectangle by hardware (no cost)
-    // Take care that renderWidth/renderHeight fit on displayWidth/displayHeight aspect ratio
+            // Gamepad X (R key)
+            CORE.Input.Keyboard.previousKeyState[KEY_R] = CORE.Input.Keyboard.currentKeyState[KEY_R];
+            if (kHeld & HidNpadButton_X) {
+                CORE.Input.Keyboard.currentKeyState[KEY_R] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_R] = 0;
+            }
 
-    VC_DISPMANX_ALPHA_T alpha = { 0 };
-    alpha.flags = DISPMANX_FLAGS_ALPHA_FIXED_ALL_PIXELS;
-    //alpha.flags = DISPMANX_FLAGS_ALPHA_FROM_SOURCE;       // TODO: Allow transparent framebuffer! -> FLAG_WINDOW_TRANSPARENT
-    alpha.opacity = 255;    // Set transparency level for framebuffer, requires EGLAttrib: EGL_TRANSPARENT_TYPE
-    alpha.mask = 0;
+            // Gamepad B (F key)
+            CORE.Input.Keyboard.previousKeyState[KEY_F] = CORE.Input.Keyboard.currentKeyState[KEY_F];
+            if (kHeld & HidNpadButton_B) {
+                CORE.Input.Keyboard.currentKeyState[KEY_F] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_F] = 0;
+            }
 
-    dispmanDisplay = vc_dispmanx_display_open(0);   // LCD
-    dispmanUpdate = vc_dispmanx_update_start(0);
+            // Gamepad + and - (Escape)
+            CORE.Input.Keyboard.previousKeyState[KEY_ENTER] = CORE.Input.Keyboard.currentKeyState[KEY_ENTER];
+            CORE.Input.Keyboard.previousKeyState[KEY_SPACE] = CORE.Input.Keyboard.currentKeyState[KEY_SPACE];
+            CORE.Input.Keyboard.previousKeyState[KEY_ESCAPE] = CORE.Input.Keyboard.currentKeyState[KEY_ESCAPE];
+            if (kHeld & HidNpadButton_Plus && kHeld & HidNpadButton_Minus) {
+                CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 0;
+                CORE.Input.Keyboard.currentKeyState[KEY_ESCAPE] = 1;
+            } else {
+                if (kHeld & HidNpadButton_Plus) {
+                    CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 1;
+                } else {
+                    CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 0;
+                }
+                if (kHeld & HidNpadButton_Minus) {
+                    CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 1;
+                } else {
+                    CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 0;
+                }
+            }
 
-    dispmanElement = vc_dispmanx_element_add(dispmanUpdate, dispmanDisplay, 0/*layer*/, &dstRect, 0/*src*/,
-                                            &srcRect, DISPMANX_PROTECTION_NONE, &alpha, 0/*clamp*/, DISPMANX_NO_ROTATE);
+            // Gamepad Left Thumb (shift)
+            CORE.Input.Keyboard.previousKeyState[KEY_LEFT_SHIFT] = CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT];
+            if (kHeld & GAMEPAD_BUTTON_LEFT_THUMB) {
+                CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT] = 1;
+            } else {
+                CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT] = 0;
+            }
 
-    CORE.Window.handle.element = dispmanElement;
-    CORE.Window.handle.width = CORE.Window.render.width;
-    CORE.Window.handle.height = CORE.Window.render.height;
-    vc_dispmanx_update_submit_sync(dispmanUpdate);
+            // Gamepad ZL (mouse right)
+            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_LEFT] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT];
+            if (kHeld & HidNpadButton_ZL) {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 1;
+            } else {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 0;
+            }
 
-    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, &CORE.Window.handle, NULL);
+            // Gamepad Right Thumb (mouse middle)
+            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_MIDDLE] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE];
+            if (kHeld & GAMEPAD_BUTTON_RIGHT_THUMB) {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE] = 1;
+            } else {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE] = 0;
+            }
 
-    const unsigned char *const renderer = glGetString(GL_RENDERER);
-    if (renderer) TRACELOG(LOG_INFO, "DISPLAY: Renderer name is: %s", renderer);
-    else TRACELOG(LOG_WARNING, "DISPLAY: Failed to get renderer name");
-    //---------------------------------------------------------------------------------
-#endif  // PLATFORM_RPI
+            // Gamepad ZR (mouse left)
+            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_RIGHT] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT];
+            if (kHeld & HidNpadButton_ZR) {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 1;
+            } else {
+                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 0;
+            }
 
-#if defined(PLATFORM_NX)
-    CORE.Window.gbmSurface = nwindowGetDefault();
-    if (appletGetOperationMode() == AppletOperationMode_Console)
-    {
-        CORE.Window.display.width = 1920;
-        CORE.Window.display.height = 1080;
-    }
-    else if (appletGetOperationMode() == AppletOperationMode_Handheld)
-    {
-        CORE.Window.display.width = 1280;
-        CORE.Window.display.height = 720;
-    }
-#endif
+            // Gamepad L/R Bumpers (mouse wheel)
+            CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+            if (kHeld & HidNpadButton_L) {
+                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, -1.0f };
+            } else if (kHeld & HidNpadButton_R) {
+                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 1.0f };
+            } else {
+                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+            }
 
-#if defined(PLATFORM_DRM) || defined(PLATFORM_NX)
-    CORE.Window.surface = eglCreateWindowSurface(CORE.Window.device, CORE.Window.config, (EGLNativeWindowType)CORE.Window.gbmSurface, NULL);
-    if (EGL_NO_SURFACE == CORE.Window.surface)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL window surface: 0x%04x", eglGetError());
-        return false;
-    }
+            // Gamepad Axis (mouse position)
+            CORE.Input.Mouse.previousPosition.x = CORE.Input.Mouse.currentPosition.x;
+            CORE.Input.Mouse.previousPosition.y = CORE.Input.Mouse.currentPosition.y;
 
-    // At this point we need to manage render size vs screen size
-    // NOTE: This function use and modify global module variables:
-    //  -> CORE.Window.screen.width/CORE.Window.screen.height
-    //  -> CORE.Window.render.width/CORE.Window.render.height
-    //  -> CORE.Window.screenScale
-    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
-#endif  // PLATFORM_DRM
+            CORE.Input.Mouse.currentPosition.x += CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_X] * 10;
+            CORE.Input.Mouse.currentPosition.y -= CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_Y] * 10;
 
-    // There must be at least one frame displayed before the buffers are swapped
-    //eglSwapInterval(CORE.Window.device, 1);
+            // Clamp Mouse X to screen
+            if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
+            else if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
 
-    if (eglMakeCurrent(CORE.Window.device, CORE.Window.surface, CORE.Window.surface, CORE.Window.context) == EGL_FALSE)
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Failed to attach EGL rendering context to EGL surface");
-        return false;
-    }
-    else
-    {
-        CORE.Window.render.width = CORE.Window.screen.width;
-        CORE.Window.render.height = CORE.Window.screen.height;
-        CORE.Window.currentFbo.width = CORE.Window.render.width;
-        CORE.Window.currentFbo.height = CORE.Window.render.height;
+            // Clamp Mouse Y to screen
+            if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
+            else if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
 
-        TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
-        TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
-        TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
-        TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
-        TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+            // Gamepad +/- pressed to exit
+            if (CORE.Input.Keyboard.currentKeyState[CORE.Input.Keyboard.exitKey] == 1) CORE.Window.shouldClose = true;
+#endif
+        }
     }
-#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
-
-    // Load OpenGL extensions
-    // NOTE: GL procedures address loader is required to load extensions
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    rlLoadExtensions(glfwGetProcAddress);
-#else
-    rlLoadExtensions(eglGetProcAddress);
 #endif
 
-    // Initialize OpenGL context (states and resources)
-    // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
-    rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
+    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
+    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
 
-    // Setup default viewport
-    // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
-    SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
 
-#if defined(PLATFORM_ANDROID)
-    CORE.Window.ready = true;
+    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
+    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
 #endif
 
-    if ((CORE.Window.flags & FLAG_WINDOW_MINIMIZED) > 0) MinimizeWindow();
-
-    return true;
+    PROFILE_ZONE_END();
 }
 
-// Set viewport for a provided width and height
-static void SetupViewport(int width, int height)
+// Check if directory entry is a directory
+// NOTE: Entry type is provided by most file systems, stat() only required if not available (or symbolic link)
+static bool IsDirectoryEntryDir(const struct dirent *dp, const char *path)
 {
-    CORE.Window.render.width = width;
-    CORE.Window.render.height = height;
-
-    // Set viewport width and height
-    // NOTE: We consider render size (scaled) and offset in case black bars are required and
-    // render area does not match full display area (this situation is only applicable on fullscreen mode)
-#if defined(__APPLE__)
-    float xScale = 1.0f, yScale = 1.0f;
-    glfwGetWindowContentScale(CORE.Window.handle, &xScale, &yScale);
-    rlViewport(CORE.Window.renderOffset.x/2*xScale, CORE.Window.renderOffset.y/2*yScale, (CORE.Window.render.width)*xScale, (CORE.Window.render.height)*yScale);
-#else
-    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
+#if defined(DT_DIR)
+    if (dp->d_type == DT_DIR) return true;
+    if ((dp->d_type != DT_UNKNOWN) && (dp->d_type != DT_LNK)) return false;
 #endif
 
-    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
-    rlLoadIdentity();                   // Reset current matrix (projection)
+    struct stat pathStat = { 0 };
 
-    // Set orthographic projection to current framebuffer size
-    // NOTE: Configured top-left corner as (0, 0)
-    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+    return ((stat(path, &pathStat) == 0) && S_ISDIR(pathStat.st_mode));
+}
 
-    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
-    rlLoadIdentity();                   // Reset current matrix (modelview)
+// Reserve path buffer capacity, buffer reallocated if required
+static void ReservePathCapacity(char **path, unsigned int *capacity, unsigned int size)
+{
+    if (size > *capacity)
+    {
+        *capacity = (size > 256)? size*2 : 512;
+        *path = (char *)RL_REALLOC(*path, *capacity);
+    }
 }
 
-// Compute framebuffer size relative to screen size and display size
-// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
-static void SetupFramebuffer(int width, int height)
+// Add path to paths arena, arena grown if required
+static void AddArenaPath(PathArena *arena, const char *path, unsigned int length)
 {
-    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
-    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
+    if ((arena->size + length + 1) > arena->capacity)
     {
-        TRACELOG(LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+        if (arena->capacity == 0) arena->capacity = 4096;
+        while ((arena->size + length + 1) > arena->capacity) arena->capacity *= 2;
 
-        // Downscaling to fit display with border-bars
-        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
-        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
+        arena->data = (char *)RL_REALLOC(arena->data, arena->capacity);
+    }
 
-        if (widthRatio <= heightRatio)
-        {
-            CORE.Window.render.width = CORE.Window.display.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
-        }
-        else
-        {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
-            CORE.Window.render.height = CORE.Window.display.height;
-            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
-            CORE.Window.renderOffset.y = 0;
-        }
+    if (arena->count == arena->offsetCapacity)
+    {
+        arena->offsetCapacity = (arena->offsetCapacity > 0)? arena->offsetCapacity*2 : 256;
+        arena->offsets = (unsigned int *)RL_REALLOC(arena->offsets, arena->offsetCapacity*sizeof(unsigned int));
+    }
 
-        // Screen scaling required
-        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
-        CORE.Window.screenScale = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+    arena->offsets[arena->count] = arena->size;
+    arena->count++;
 
-        // NOTE: We render to full display resolution!
-        // We just need to calculate above parameters for downscale matrix and offsets
-        CORE.Window.render.width = CORE.Window.display.width;
-        CORE.Window.render.height = CORE.Window.display.height;
+    memcpy(arena->data + arena->size, path, length);
+    arena->data[arena->size + length] = '\0';
+    arena->size += length + 1;
+}
+
+// Load file paths list from paths arena
+// NOTE: Arena memory reused, paths pointers placed before paths strings in the same memory block
+static FilePathList LoadArenaFilePathList(PathArena *arena)
+{
+    FilePathList files = { 0 };
 
-        TRACELOG(LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
-    }
-    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+    if (arena->count > 0)
     {
-        // Required screen size is smaller than display size
-        TRACELOG(LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+        unsigned int pointersSize = arena->count*sizeof(char *);
+        char *data = (char *)RL_REALLOC(arena->data, pointersSize + arena->size);
 
-        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        if (data != NULL)
         {
-            CORE.Window.screen.width = CORE.Window.display.width;
-            CORE.Window.screen.height = CORE.Window.display.height;
-        }
+            memmove(data + pointersSize, data, arena->size);
 
-        // Upscaling to fit display with border-bars
-        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
-        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
+            files.paths = (char **)data;
+            for (unsigned int i = 0; i < arena->count; i++) files.paths[i] = data + pointersSize + arena->offsets[i];
 
-        if (displayRatio <= screenRatio)
-        {
-            CORE.Window.render.width = CORE.Window.screen.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
-        }
-        else
-        {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
-            CORE.Window.render.height = CORE.Window.screen.height;
-            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
-            CORE.Window.renderOffset.y = 0;
+            files.capacity = arena->count;
+            files.count = arena->count;
         }
+        else RL_FREE(arena->data);
     }
-    else
-    {
-        CORE.Window.render.width = CORE.Window.screen.width;
-        CORE.Window.render.height = CORE.Window.screen.height;
-        CORE.Window.renderOffset.x = 0;
-        CORE.Window.renderOffset.y = 0;
-    }
+    else RL_FREE(arena->data);
+
+    RL_FREE(arena->offsets);
+    memset(arena, 0, sizeof(PathArena));
+
+    return files;
 }
 
-// Initialize hi-resolution timer
-static void InitTimer(void)
+#if defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+// Load directory files recursively, directories scanned in parallel threads
+// NOTE: Files order depends on threads scanning, it is not deterministic
+static FilePathList LoadDirectoryFilesParallel(const char *basePath, const char *filter)
 {
-// Setting a higher resolution can improve the accuracy of time-out intervals in wait functions.
-// However, it can also reduce overall system performance, because the thread scheduler switches tasks more often.
-// High resolutions can also prevent the CPU power management system from entering power-saving modes.
-// Setting a higher resolution does not improve the accuracy of the high-resolution performance counter.
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
-    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
-#endif
+    DirectoryScan scan = { 0 };
+    DirectoryScanWorker workers[DIRECTORY_SCAN_THREADS] = { 0 };
+    pthread_t threadIds[DIRECTORY_SCAN_THREADS] = { 0 };
+    bool threaded[DIRECTORY_SCAN_THREADS] = { 0 };
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    struct timespec now = { 0 };
+    scan.filter = filter;
+    pthread_mutex_init(&scan.mutex, NULL);
+    pthread_cond_init(&scan.cond, NULL);
 
-    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    AddArenaPath(&scan.dirs, basePath, (unsigned int)strlen(basePath));
+
+    // NOTE: Calling thread also scans directories (worker 0)
+    for (int i = 0; i < DIRECTORY_SCAN_THREADS; i++) workers[i].scan = &scan;
+    for (int i = 1; i < DIRECTORY_SCAN_THREADS; i++) threaded[i] = (pthread_create(&threadIds[i], NULL, &ScanDirectoryThread, &workers[i]) == 0);
+
+    ScanDirectoryThread(&workers[0]);
+
+    for (int i = 1; i < DIRECTORY_SCAN_THREADS; i++) if (threaded[i]) pthread_join(threadIds[i], NULL);
+
+    // Files found by every thread merged into a single arena
+    PathArena files = workers[0].files;
+
+    for (int i = 1; i < DIRECTORY_SCAN_THREADS; i++)
     {
-        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+        for (unsigned int j = 0; j < workers[i].files.count; j++)
+        {
+            const char *path = workers[i].files.data + workers[i].files.offsets[j];
+            AddArenaPath(&files, path, (unsigned int)strlen(path));
+        }
+
+        RL_FREE(workers[i].files.data);
+        RL_FREE(workers[i].files.offsets);
     }
-    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
-#endif
 
-    CORE.Time.previous = GetTime();     // Get time as double
+    RL_FREE(scan.dirs.data);
+    RL_FREE(scan.dirs.offsets);
+    pthread_mutex_destroy(&scan.mutex);
+    pthread_cond_destroy(&scan.cond);
+
+    return LoadArenaFilePathList(&files);
 }
 
-// Wait for some time (stop program execution)
-// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
-// take longer than expected... for that reason we use the busy wait loop
-// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
-// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
-void WaitTime(double seconds)
+// Scan directories queued (thread)
+// NOTE: Scanning finishes once no directories are queued and no thread is scanning (no more directories can be found)
+static void *ScanDirectoryThread(void *arg)
 {
-#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-    double destinationTime = GetTime() + seconds;
-#endif
+    DirectoryScanWorker *worker = (DirectoryScanWorker *)arg;
+    DirectoryScan *scan = worker->scan;
 
-#if defined(SUPPORT_BUSY_WAIT_LOOP)
-    while (GetTime() < destinationTime) { }
-#else
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
-    #else
-        double sleepSeconds = seconds;
-    #endif
+    PathArena subdirs = { 0 };
+    char *path = NULL;
+    unsigned int pathCapacity = 0;
 
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned long)(sleepSeconds*1000.0));
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-        struct timespec req = { 0 };
-        time_t sec = sleepSeconds;
-        long nsec = (sleepSeconds - sec)*1000000000L;
-        req.tv_sec = sec;
-        req.tv_nsec = nsec;
+    pthread_mutex_lock(&scan->mutex);
 
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
-        while (nanosleep(&req, &req) == -1) continue;
-    #endif
-    #if defined(__APPLE__)
-        usleep(sleepSeconds*1000000.0);
-    #endif
+    while (true)
+    {
+        while ((scan->next == scan->dirs.count) && (scan->busy > 0)) pthread_cond_wait(&scan->cond, &scan->mutex);
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        while (GetTime() < destinationTime) { }
-    #endif
-#endif
-}
+        if (scan->next == scan->dirs.count) break;
 
-// Swap back buffer with front buffer (screen drawing)
-void SwapScreenBuffer(void)
-{
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    glfwSwapBuffers(CORE.Window.handle);
-#endif
+        // Directory path copied, directories data can be reallocated by other threads
+        const char *dirPath = scan->dirs.data + scan->dirs.offsets[scan->next];
+        unsigned int dirLength = (unsigned int)strlen(dirPath);
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
-    eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+        ReservePathCapacity(&path, &pathCapacity, dirLength + 1);
+        strcpy(path, dirPath);
 
-#if defined(PLATFORM_DRM)
+        scan->next++;
+        scan->busy++;
 
-    if (!CORE.Window.gbmSurface || (-1 == CORE.Window.fd) || !CORE.Window.connector || !CORE.Window.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+        pthread_mutex_unlock(&scan->mutex);
 
-    struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
-    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+        struct dirent *dp = NULL;
+        DIR *dir = opendir(path);
 
-    uint32_t fb = 0;
-    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+        if (dir != NULL)
+        {
+            while ((dp = readdir(dir)) != NULL)
+            {
+                if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
 
-    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+                unsigned int length = dirLength + 1 + (unsigned int)strlen(dp->d_name);
 
-    if (CORE.Window.prevFB)
-    {
-        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
-    }
+                ReservePathCapacity(&path, &pathCapacity, length + 1);
+                path[dirLength] = '/';
+                strcpy(path + dirLength + 1, dp->d_name);
 
-    CORE.Window.prevFB = fb;
+                if (IsDirectoryEntryDir(dp, path)) AddArenaPath(&subdirs, path, length);
+                else if ((scan->filter == NULL) || IsFileExtension(path, scan->filter)) AddArenaPath(&worker->files, path, length);
+            }
 
-    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+            closedir(dir);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", path);
 
-    CORE.Window.prevBO = bo;
+        pthread_mutex_lock(&scan->mutex);
 
-#endif  // PLATFORM_DRM
-#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM || PLATFORM_NX
+        // Subdirectories found queued for scanning
+        for (unsigned int i = 0; i < subdirs.count; i++)
+        {
+            const char *subdir = subdirs.data + subdirs.offsets[i];
+            AddArenaPath(&scan->dirs, subdir, (unsigned int)strlen(subdir));
+        }
+
+        subdirs.size = 0;
+        subdirs.count = 0;
+
+        scan->busy--;
+        pthread_cond_broadcast(&scan->cond);
+    }
+
+    pthread_mutex_unlock(&scan->mutex);
+
+    RL_FREE(subdirs.data);
+    RL_FREE(subdirs.offsets);
+    RL_FREE(path);
+
+    return NULL;
 }
+#endif
 
-// Register all input events
-void PollInputEvents(void)
+#if defined(SUPPORT_COMPRESSION_API)
+// Read data chunk for streaming decompression, user callback called
+static int ReadInflateStream(unsigned char *buffer, int size, void *userData)
 {
-#if defined(SUPPORT_GESTURES_SYSTEM)
-    // NOTE: Gestures update must be called every frame to reset gestures correctly
-    // because ProcessGestureEvent() is just called on an event, not every frame
-    UpdateGestures();
-#endif
+    DataStreamCallbacks *callbacks = (DataStreamCallbacks *)userData;
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    return callbacks->read(buffer, size, callbacks->userData);
+}
 
-#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
-    // Reset last gamepad button/axis registered state
-    CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
-    CORE.Input.Gamepad.axisCount = 0;
+// Write data chunk for streaming decompression, user callback called
+static int WriteInflateStream(const unsigned char *data, int size, void *userData)
+{
+    DataStreamCallbacks *callbacks = (DataStreamCallbacks *)userData;
+
+    return callbacks->write(data, size, callbacks->userData)? 1 : 0;
+}
 #endif
 
-#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+// Get archive entry path and path hash (FNV-1a)
+// NOTE: Path normalized: '/' separators and no leading "./"
+static unsigned int GetArchivePath(const char *fileName, char *path)
+{
+    unsigned int hash = 2166136261u;
+    int length = 0;
 
-    PollKeyboardEvents();
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
 
-    // Register previous mouse states
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+    for (; (fileName[length] != '\0') && (length < (MAX_FILEPATH_LENGTH - 1)); length++)
     {
-        CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
-        CORE.Input.Mouse.currentButtonState[i] = CORE.Input.Mouse.currentButtonStateEvdev[i];
+        path[length] = (fileName[length] == '\\')? '/' : fileName[length];
+        hash = (hash ^ (unsigned char)path[length])*16777619u;
     }
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    path[length] = '\0';
+
+    return hash;
+}
+
+// Find file entry in mounted assets archives, binary search by path hash
+// NOTE: Archives mounted later take priority (i.e. patch archives)
+static const ArchiveEntry *FindArchiveEntry(const char *fileName, const Archive **archive)
+{
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    unsigned int hash = GetArchivePath(fileName, path);
+
+    for (int i = archiveCount - 1; i >= 0; i--)
     {
-        if (CORE.Input.Gamepad.ready[i])
+        const ArchiveEntry *entries = archives[i].entries;
+        int low = 0;
+        int high = (int)archives[i].entryCount;
+
+        while (low < high)
         {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+            int mid = low + (high - low)/2;
+
+            if (entries[mid].hash < hash) low = mid + 1;
+            else high = mid;
+        }
+
+        for (int j = low; (j < (int)archives[i].entryCount) && (entries[j].hash == hash); j++)
+        {
+            if (strcmp(archives[i].paths + entries[j].pathOffset, path) == 0)
+            {
+                *archive = &archives[i];
+                return &entries[j];
+            }
         }
     }
-#endif
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
-    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+    return NULL;
+}
 
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+// Unload archive data, memory mapped or loaded
+static void UnloadArchiveData(Archive *archive)
+{
+#if defined(ARCHIVE_MEMORY_MAPPING) && defined(_WIN32)
+    if (archive->mapped) UnmapViewOfFile(archive->data);
+#elif defined(ARCHIVE_MEMORY_MAPPING)
+    if (archive->mapped) munmap(archive->data, (size_t)archive->size);
+#endif
+    if (!archive->mapped) UnloadFileData(archive->data);
 
-    // Register previous mouse states
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    archive->data = NULL;
+}
+#endif
 
-    // Register previous mouse wheel state
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+#if defined(SUPPORT_ASYNC_LOADING)
+// Check if current thread is loading an asset asynchronously, textures and meshes GPU upload deferred
+// WARNING: Required by LoadTextureFromImage(), SetTextureFilter() [Module: textures] and UploadMesh() [Module: models]
+bool IsAssetLoadingThread(void)
+{
+    return (loadingAsset != NULL);
+}
 
-    // Register previous mouse position
-    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+// Defer texture upload to main thread, image copied, returns placeholder texture id
+// WARNING: Required by LoadTextureFromImage() [Module: textures]
+unsigned int DeferTextureUpload(Image image)
+{
+    unsigned int id = 0;
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    if (loadingAsset != NULL) id = AddDeferredTexture(loadingAsset, ImageCopy(image));   // WARNING: Module required: rtextures
 #endif
 
-    // Register previous touch states
-    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+    return id;
+}
 
-    // Reset touch positions
-    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
-    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
-    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+// Get asset from handle, NULL if not valid or released
+static AsyncAsset *GetAsyncAsset(int asset)
+{
+    if (asset < 0) return NULL;
 
-#if defined(PLATFORM_DESKTOP)
-    // Check if gamepads are ready
-    // NOTE: We do it here in case of disconnection
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    AsyncAsset *data = &assetLoader.assets[asset%MAX_ASYNC_ASSETS];
+
+    if ((data->state == ASSET_STATE_INVALID) || data->released || (data->generation != asset/MAX_ASYNC_ASSETS)) return NULL;
+
+    return data;
+}
+
+// Check if asset data is loaded (CPU data), GPU upload not required
+static bool IsAsyncAssetLoaded(AsyncAsset *asset, int type)
+{
+    return ((asset != NULL) && (asset->type == type) && ((asset->state == ASSET_STATE_UPLOADING) || (asset->state == ASSET_STATE_READY)));
+}
+
+// Load asset data (CPU), textures and meshes GPU upload deferred
+// NOTE: Regular loading functions used, running in loading threads (or main thread if not available)
+static bool LoadAsyncAssetData(AsyncAsset *asset)
+{
+    bool success = false;
+
+    loadingAsset = asset;
+
+    switch (asset->type)
     {
-        if (glfwJoystickPresent(i)) CORE.Input.Gamepad.ready[i] = true;
-        else CORE.Input.Gamepad.ready[i] = false;
+#if defined(SUPPORT_MODULE_RTEXTURES)
+        case ASSET_IMAGE:
+        {
+            asset->image = LoadImage(asset->fileName);      // WARNING: Module required: rtextures
+            success = (asset->image.data != NULL);
+        } break;
+        case ASSET_TEXTURE:
+        {
+            // NOTE: Texture image kept for upload, no copy required
+            Image image = LoadImage(asset->fileName);       // WARNING: Module required: rtextures
+
+            if (image.data != NULL)
+            {
+                asset->texture = (Texture2D){ AddDeferredTexture(asset, image), image.width, image.height, image.mipmaps, image.format };
+                success = true;
+            }
+        } break;
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+        case ASSET_FONT:
+        {
+            asset->font = LoadFont(asset->fileName);        // WARNING: Module required: rtext
+
+            // NOTE: Default font returned on failure, not owned by asset
+            success = ((asset->font.texture.id & ASYNC_TEXTURE_DEFERRED) != 0);
+            if (!success) asset->font = (Font){ 0 };
+        } break;
+#endif
+#if defined(SUPPORT_MODULE_RMODELS)
+        case ASSET_MODEL:
+        {
+            // NOTE: No default mesh on loading failure, asset loading failed
+            asset->model = LoadModelFile(asset->fileName, false);   // WARNING: Module required: rmodels
+            success = (asset->model.meshCount > 0);
+        } break;
+#endif
+#if defined(SUPPORT_MODULE_RAUDIO)
+        case ASSET_WAVE:
+        {
+            asset->wave = LoadWave(asset->fileName);        // WARNING: Module required: raudio
+            success = (asset->wave.data != NULL);
+        } break;
+#endif
+        default: TRACELOG(LOG_WARNING, "ASSET: [%s] Asset type not supported", asset->fileName); break;
     }
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
-    {
-        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
-        {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    loadingAsset = NULL;
 
-            // Get current gamepad state
-            // NOTE: There is no callback available, so we get it manually
-            // Get remapped buttons
-            GLFWgamepadstate state = { 0 };
-            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+    return success;
+}
 
-            const unsigned char *buttons = state.buttons;
+// Finish asset loading, waiting GPU upload if required
+// NOTE: Assets mutex must be locked
+static void FinishAsyncAssetLoading(AsyncAsset *asset, bool success)
+{
+    if (asset->released)
+    {
+        UnloadAsyncAssetData(asset);
+        FreeAsyncAsset(asset);
+    }
+    else if (!success)
+    {
+        UnloadAsyncAssetData(asset);
+        asset->state = ASSET_STATE_FAILED;
+        TRACELOG(LOG_WARNING, "ASSET: [%s] Failed to load asset", asset->fileName);
+    }
+    else if ((asset->imageCount > 0) || (asset->type == ASSET_MODEL))
+    {
+        asset->state = ASSET_STATE_UPLOADING;
+        asset->order = assetLoader.orderCounter++;
+        assetLoader.uploadCount++;
+    }
+    else
+    {
+        asset->state = ASSET_STATE_READY;
+        TRACELOG(LOG_INFO, "ASSET: [%s] Asset loaded successfully", asset->fileName);
+    }
+}
 
-            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
-            {
-                GamepadButton button = -1;
+// Upload next asset texture or mesh to GPU, returns true once all uploaded
+// NOTE: Once uploaded, asset placeholder texture ids replaced by uploaded textures ids
+static bool UploadAsyncAssetData(AsyncAsset *asset)
+{
+    int meshCount = (asset->type == ASSET_MODEL)? asset->model.meshCount : 0;
 
-                switch (k)
-                {
-                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+    if (asset->uploadCounter < asset->imageCount)
+    {
+        Image *image = &asset->images[asset->uploadCounter];
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
-                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+        asset->textureIds[asset->uploadCounter] = rlLoadTexture(image->data, image->width, image->height, image->format, image->mipmaps);
+        RL_FREE(image->data);
+        image->data = NULL;
+    }
+#if defined(SUPPORT_MODULE_RMODELS)
+    else if (asset->uploadCounter < (asset->imageCount + meshCount))
+    {
+        UploadMesh(&asset->model.meshes[asset->uploadCounter - asset->imageCount], false);   // WARNING: Module required: rmodels
+    }
+#endif
 
-                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
-                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
-                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+    asset->uploadCounter++;
 
-                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+    if (asset->uploadCounter < (asset->imageCount + meshCount)) return false;
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
-                    case GLFW_GAMEPAD_BUTTON_RIGHT_THUMB: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
-                    default: break;
-                }
+    switch (asset->type)
+    {
+        case ASSET_TEXTURE: asset->texture.id = GetDeferredTextureId(asset, asset->texture.id); break;
+        case ASSET_FONT: asset->font.texture.id = GetDeferredTextureId(asset, asset->font.texture.id); break;
+        case ASSET_MODEL:
+        {
+            for (int i = 0; i < asset->model.materialCount; i++)
+            {
+                if (asset->model.materials[i].maps == NULL) continue;
 
-                if (button != -1)   // Check for valid button
+                for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
                 {
-                    if (buttons[k] == GLFW_PRESS)
-                    {
-                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
-                        CORE.Input.Gamepad.lastButtonPressed = button;
-                    }
-                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                    asset->model.materials[i].maps[j].texture.id = GetDeferredTextureId(asset, asset->model.materials[i].maps[j].texture.id);
                 }
             }
+        } break;
+        default: break;
+    }
 
-            // Get current axis state
-            const float *axes = state.axes;
+    RL_FREE(asset->images);
+    RL_FREE(asset->textureIds);
+    asset->images = NULL;
+    asset->textureIds = NULL;
+    asset->imageCount = 0;
+    asset->imageCapacity = 0;
 
-            for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1) && (k < MAX_GAMEPAD_AXIS); k++)
-            {
-                CORE.Input.Gamepad.axisState[i][k] = axes[k];
-            }
+    return true;
+}
 
-            // Register buttons for 2nd triggers (because GLFW doesn't count these as buttons but rather axis)
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
+// Unload asset data, only uploaded data unloaded from GPU
+// NOTE: Asset not ready can be unloaded in loading threads (nothing uploaded)
+static void UnloadAsyncAssetData(AsyncAsset *asset)
+{
+    if (asset->state == ASSET_STATE_READY)
+    {
+        switch (asset->type)
+        {
+#if defined(SUPPORT_MODULE_RTEXTURES)
+            case ASSET_IMAGE: UnloadImage(asset->image); break;
+            case ASSET_TEXTURE: UnloadTexture(asset->texture); break;
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+            case ASSET_FONT: UnloadFont(asset->font); break;
+#endif
+#if defined(SUPPORT_MODULE_RMODELS)
+            case ASSET_MODEL: UnloadModel(asset->model); break;
+#endif
+#if defined(SUPPORT_MODULE_RAUDIO)
+            case ASSET_WAVE: UnloadWave(asset->wave); break;
+#endif
+            default: break;
+        }
+    }
+    else
+    {
+        // Deferred textures, unloaded from GPU if already uploaded
+        for (int i = 0; i < asset->imageCount; i++)
+        {
+            if (asset->textureIds[i] != 0) rlUnloadTexture(asset->textureIds[i]);
+            RL_FREE(asset->images[i].data);
+        }
 
-            CORE.Input.Gamepad.axisCount = GLFW_GAMEPAD_AXIS_LAST + 1;
+        // NOTE: Asset data textures are placeholders (deferred textures), not unloaded
+        switch (asset->type)
+        {
+#if defined(SUPPORT_MODULE_RTEXTURES)
+            case ASSET_IMAGE: UnloadImage(asset->image); break;
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+            case ASSET_FONT:
+            {
+                UnloadFontData(asset->font.glyphs, asset->font.glyphCount);
+                RL_FREE(asset->font.recs);
+            } break;
+#endif
+#if defined(SUPPORT_MODULE_RMODELS)
+            case ASSET_MODEL:
+            {
+                // NOTE: Meshes not uploaded (vboId not allocated) only unloaded from RAM
+                for (int i = 0; i < asset->model.meshCount; i++) UnloadMesh(asset->model.meshes[i]);
+                for (int i = 0; i < asset->model.materialCount; i++) RL_FREE(asset->model.materials[i].maps);
+
+                RL_FREE(asset->model.meshes);
+                RL_FREE(asset->model.materials);
+                RL_FREE(asset->model.meshMaterial);
+                RL_FREE(asset->model.bones);
+                RL_FREE(asset->model.bindPose);
+            } break;
+#endif
+#if defined(SUPPORT_MODULE_RAUDIO)
+            case ASSET_WAVE: UnloadWave(asset->wave); break;
+#endif
+            default: break;
         }
     }
 
-    CORE.Window.resizedLastFrame = false;
+    RL_FREE(asset->images);
+    RL_FREE(asset->textureIds);
+    asset->images = NULL;
+    asset->textureIds = NULL;
+    asset->imageCount = 0;
+    asset->imageCapacity = 0;
+}
 
-    if (CORE.Window.eventWaiting) glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
-    else glfwPollEvents();      // Poll input events: keyboard/mouse/window events (callbacks)
-#endif  // PLATFORM_DESKTOP
+// Free asset slot, asset handle not valid anymore
+static void FreeAsyncAsset(AsyncAsset *asset)
+{
+    RL_FREE(asset->fileName);
+    RL_FREE(asset->images);
+    RL_FREE(asset->textureIds);
 
-#if defined(PLATFORM_WEB)
-    CORE.Window.resizedLastFrame = false;
-#endif  // PLATFORM_WEB
+    int generation = (asset->generation + 1)%(0x7fffffff/MAX_ASYNC_ASSETS);
 
-// Gamepad support using emscripten API
-// NOTE: GLFW3 joystick functionality not available in web
-#if defined(PLATFORM_WEB)
-    // Get number of gamepads connected
-    int numGamepads = 0;
-    if (emscripten_sample_gamepad_data() == EMSCRIPTEN_RESULT_SUCCESS) numGamepads = emscripten_get_num_gamepads();
+    memset(asset, 0, sizeof(AsyncAsset));
+    asset->generation = generation;
+}
 
-    for (int i = 0; (i < numGamepads) && (i < MAX_GAMEPADS); i++)
+// Add deferred texture image (owned by asset), returns placeholder texture id
+static unsigned int AddDeferredTexture(AsyncAsset *asset, Image image)
+{
+    if (asset->imageCount == asset->imageCapacity)
     {
-        // Register previous gamepad button states
-        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+        asset->imageCapacity = (asset->imageCapacity > 0)? asset->imageCapacity*2 : 4;
+        asset->images = (Image *)RL_REALLOC(asset->images, asset->imageCapacity*sizeof(Image));
+        asset->textureIds = (unsigned int *)RL_REALLOC(asset->textureIds, asset->imageCapacity*sizeof(unsigned int));
+    }
 
-        EmscriptenGamepadEvent gamepadState;
+    asset->images[asset->imageCount] = image;
+    asset->textureIds[asset->imageCount] = 0;
 
-        int result = emscripten_get_gamepad_status(i, &gamepadState);
+    return (ASYNC_TEXTURE_DEFERRED | (unsigned int)asset->imageCount++);
+}
 
-        if (result == EMSCRIPTEN_RESULT_SUCCESS)
-        {
-            // Register buttons data for every connected gamepad
-            for (int j = 0; (j < gamepadState.numButtons) && (j < MAX_GAMEPAD_BUTTONS); j++)
-            {
-                GamepadButton button = -1;
+// Get uploaded texture id from placeholder texture id, other ids returned unchanged
+static unsigned int GetDeferredTextureId(AsyncAsset *asset, unsigned int id)
+{
+    if ((id & ASYNC_TEXTURE_DEFERRED) && ((int)(id & ~ASYNC_TEXTURE_DEFERRED) < asset->imageCount)) return asset->textureIds[id & ~ASYNC_TEXTURE_DEFERRED];
 
-                // Gamepad Buttons reference: https://www.w3.org/TR/gamepad/#gamepad-interface
-                switch (j)
-                {
-                    case 0: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
-                    case 1: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
-                    case 2: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
-                    case 3: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
-                    case 4: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
-                    case 5: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
-                    case 6: button = GAMEPAD_BUTTON_LEFT_TRIGGER_2; break;
-                    case 7: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_2; break;
-                    case 8: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
-                    case 9: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
-                    case 10: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
-                    case 11: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
-                    case 12: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
-                    case 13: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
-                    case 14: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
-                    case 15: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
-                    default: break;
-                }
+    return id;
+}
 
-                if (button != -1)   // Check for valid button
-                {
-                    if (gamepadState.digitalButton[j] == 1)
-                    {
-                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
-                        CORE.Input.Gamepad.lastButtonPressed = button;
-                    }
-                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
-                }
+// Close assets loading, loading threads finished and assets unloaded
+// NOTE: Assets not released are unloaded, including ready ones (asset data owned by asset handle)
+static void CloseAssetLoading(void)
+{
+    if (!assetLoader.started) return;
 
-                //TRACELOGD("INPUT: Gamepad %d, button %d: Digital: %d, Analog: %g", gamepadState.index, j, gamepadState.digitalButton[j], gamepadState.analogButton[j]);
-            }
+#if defined(ASYNC_LOADING_THREADED)
+    if (assetLoader.threadCount > 0)
+    {
+        // NOTE: Loading threads finish current asset loading before closing
+        LOCK_ASSETS();
+        assetLoader.closing = true;
+        pthread_cond_broadcast(&assetCond);
+        UNLOCK_ASSETS();
 
-            // Register axis data for every connected gamepad
-            for (int j = 0; (j < gamepadState.numAxes) && (j < MAX_GAMEPAD_AXIS); j++)
-            {
-                CORE.Input.Gamepad.axisState[i][j] = gamepadState.axis[j];
-            }
+        for (int i = 0; i < assetLoader.threadCount; i++) pthread_join(assetLoader.threadId[i], NULL);
+    }
+#endif
 
-            CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
+    for (int i = 0; i < MAX_ASYNC_ASSETS; i++)
+    {
+        AsyncAsset *asset = &assetLoader.assets[i];
+
+        if (asset->state != ASSET_STATE_INVALID)
+        {
+            UnloadAsyncAssetData(asset);
+            FreeAsyncAsset(asset);
         }
     }
-#endif
 
-#if defined(PLATFORM_ANDROID)
-    // Register previous keys states
-    // NOTE: Android supports up to 260 keys
-    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    assetLoader.first = 0;
+    assetLoader.count = 0;
+    assetLoader.uploadCount = 0;
+    assetLoader.started = false;
+    assetLoader.closing = false;
+    assetLoader.threadCount = 0;
 
-    // Android ALooper_pollAll() variables
-    int pollResult = 0;
-    int pollEvents = 0;
+    TRACELOG(LOG_INFO, "ASSET: Assets loading closed");
+}
 
-    // Poll Events (registered events)
-    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
-    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
+#if defined(ASYNC_LOADING_THREADED)
+// Load assets queued (thread)
+// NOTE: Assets mutex locked except while loading asset data
+static void *AssetLoadingThread(void *arg)
+{
+    LOCK_ASSETS();
+
+    while (true)
     {
-        // Process this event
-        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+        while (!assetLoader.closing && (assetLoader.count == 0)) pthread_cond_wait(&assetCond, &assetMutex);
 
-        // NOTE: Never close window, native activity is controlled by the system!
-        if (CORE.Android.app->destroyRequested != 0)
+        if (assetLoader.closing) break;
+
+        AsyncAsset *asset = &assetLoader.assets[assetLoader.queue[assetLoader.first]];
+        assetLoader.first = (assetLoader.first + 1)%MAX_ASYNC_ASSETS;
+        assetLoader.count--;
+
+        if (asset->released)
         {
-            //CORE.Window.shouldClose = true;
-            //ANativeActivity_finish(CORE.Android.app->activity);
+            FreeAsyncAsset(asset);
+            continue;
         }
+
+        asset->state = ASSET_STATE_LOADING;
+
+        UNLOCK_ASSETS();
+        bool success = LoadAsyncAssetData(asset);
+        LOCK_ASSETS();
+
+        FinishAsyncAssetLoading(asset, success);
     }
+
+    UNLOCK_ASSETS();
+
+    return NULL;
+}
+#endif
 #endif
 
-#if defined(PLATFORM_NX)
-/**
- * Touch screen
-*/
-    HidTouchScreenState state = {0};
-    if (hidGetTouchScreenStates(&state, 1)) {
-        if (state.count != prev_touchcount)
-        {
-            prev_touchcount = state.count;
-        }
-        for(int i=0; i<state.count; i++)
-        {
-            CORE.Input.Touch.position[i].x = state.touches[i].x;
-            CORE.Input.Touch.position[i].y = state.touches[i].y;
-            CORE.Input.Touch.pointId[i] = state.touches[i].finger_id;
+#if defined(SUPPORT_FILE_WATCHER)
+// Get watched file or directory, NULL if not watched
+static WatchedFile *GetWatchedFile(const char *path)
+{
+    unsigned int length = (unsigned int)strlen(path);
+    while ((length > 1) && ((path[length - 1] == '/') || (path[length - 1] == '\\'))) length--;
 
-            CORE.Input.Touch.deltaTime[i] = state.touches[i].delta_time;
-        }
-        CORE.Input.Touch.pointCount = state.count;
+    for (int i = 0; i < MAX_WATCHED_FILES; i++)
+    {
+        const char *watchPath = fileWatcher.files[i].path;
+
+        if ((watchPath != NULL) && (strncmp(watchPath, path, length) == 0) && (watchPath[length] == '\0')) return &fileWatcher.files[i];
     }
 
-/**
- * Gamepad
-*/
-    for (int nxGamepadIndex = 0; nxGamepadIndex < MAX_GAMEPADS; nxGamepadIndex++)
+    return NULL;
+}
+
+// Add file changed, not added if already changed
+static void AddChangedFile(const char *path)
+{
+    for (unsigned int i = 0; i < fileWatcher.changes.count; i++)
+    {
+        if (strcmp(fileWatcher.changes.data + fileWatcher.changes.offsets[i], path) == 0) return;
+    }
+
+    AddArenaPath(&fileWatcher.changes, path, (unsigned int)strlen(path));
+}
+
+// Read files changes notified (inotify) or poll files modification times
+// NOTE: Files modification times only polled every FILE_WATCH_POLL_INTERVAL seconds
+static void ReadFileChanges(void)
+{
+#if defined(FILE_WATCH_INOTIFY)
+    if (!fileWatcher.initialized) return;
+
+    long buffer[1024] = { 0 };      // NOTE: Aligned for inotify_event
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    int size = 0;
+
+    while ((size = (int)read(fileWatcher.fd, buffer, sizeof(buffer))) > 0)
     {
-        // Scan the gamepad. This should be done once for each frame
-        padUpdate(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
-        
-        CORE.Input.Gamepad.ready[nxGamepadIndex] = padIsConnected(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
-        if (CORE.Input.Gamepad.ready[nxGamepadIndex]) {
-            CORE.Input.Gamepad.nxPadStyle[nxGamepadIndex] = hidGetNpadStyleSet(nxGamepadIndex);
+        for (int offset = 0; offset < size; )
+        {
+            const struct inotify_event *event = (const struct inotify_event *)((char *)buffer + offset);
+            offset += (int)sizeof(struct inotify_event) + event->len;
 
-            // Returns the set of buttons that are currently pressed
-            u64 kHeld = padGetButtons(&CORE.Input.Gamepad.nxPad[nxGamepadIndex]);
-            u64 kButton;
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+            if ((event->len == 0) || (event->mask & IN_ISDIR)) continue;
+
+            for (int i = 0; i < MAX_WATCHED_FILES; i++)
             {
-                // Register previous gamepad states
-                CORE.Input.Gamepad.previousButtonState[nxGamepadIndex][k] = CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k];
+                WatchedFile *watch = &fileWatcher.files[i];
 
-                // Check digital buttons
-                kButton = 0;
-                switch (k)
+                if ((watch->path == NULL) || (watch->wd != event->wd)) continue;
+
+                if (watch->isDirectory)
                 {
-                    case GAMEPAD_BUTTON_LEFT_FACE_UP: kButton = HidNpadButton_Up; break;
-                    case GAMEPAD_BUTTON_LEFT_FACE_RIGHT: kButton = HidNpadButton_Right; break;
-                    case GAMEPAD_BUTTON_LEFT_FACE_DOWN: kButton = HidNpadButton_Down; break;
-                    case GAMEPAD_BUTTON_LEFT_FACE_LEFT: kButton = HidNpadButton_Left; break;
-                    case GAMEPAD_BUTTON_RIGHT_FACE_UP: kButton = HidNpadButton_X; break;
-                    case GAMEPAD_BUTTON_RIGHT_FACE_RIGHT: kButton = HidNpadButton_A; break;
-                    case GAMEPAD_BUTTON_RIGHT_FACE_DOWN: kButton = HidNpadButton_B; break;
-                    case GAMEPAD_BUTTON_RIGHT_FACE_LEFT: kButton = HidNpadButton_Y; break;                
-                    case GAMEPAD_BUTTON_LEFT_TRIGGER_1: kButton = HidNpadButton_L; break;
-                    case GAMEPAD_BUTTON_LEFT_TRIGGER_2: kButton = HidNpadButton_ZL; break;
-                    case GAMEPAD_BUTTON_RIGHT_TRIGGER_1: kButton = HidNpadButton_R; break;
-                    case GAMEPAD_BUTTON_RIGHT_TRIGGER_2: kButton = HidNpadButton_ZR; break;
-                    case GAMEPAD_BUTTON_MIDDLE_LEFT: kButton = HidNpadButton_Minus; break;
-                    case GAMEPAD_BUTTON_MIDDLE_RIGHT: kButton = HidNpadButton_Plus; break;
-                    case GAMEPAD_BUTTON_LEFT_THUMB: kButton = HidNpadButton_StickL; break;
-                    case GAMEPAD_BUTTON_RIGHT_THUMB: kButton = HidNpadButton_StickR; break;
-                }
-                if (kHeld & kButton) {
-                    CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k] = 1;
-                    CORE.Input.Gamepad.lastButtonPressed = k;
-                } else {
-                    CORE.Input.Gamepad.currentButtonState[nxGamepadIndex][k] = 0;
+                    snprintf(path, MAX_FILEPATH_LENGTH, "%s/%s", watch->path, event->name);
+                    AddChangedFile(path);
                 }
+                else if (strcmp(watch->name, event->name) == 0) AddChangedFile(watch->path);
             }
+        }
+    }
+#else
+    double time = GetTime();
 
-            // Check analogic axis and buttons
-            HidAnalogStickState kAxisL = padGetStickPos(&CORE.Input.Gamepad.nxPad[nxGamepadIndex], 0);
-            HidAnalogStickState kAxisR = padGetStickPos(&CORE.Input.Gamepad.nxPad[nxGamepadIndex], 1);
+    if ((time - fileWatcher.pollTime) < FILE_WATCH_POLL_INTERVAL) return;
+    fileWatcher.pollTime = time;
 
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_X] = (float)kAxisL.x / 32767.0f;
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_Y] = (float)kAxisL.y / 32767.0f;
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_X] = (float)kAxisR.x / 32767.0f;
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_Y] = (float)kAxisR.y / 32767.0f;
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_LEFT_TRIGGER] = (kHeld & HidNpadButton_ZL) ? 1.0f : 0.0f;
-            CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_TRIGGER] = (kHeld & HidNpadButton_ZR) ? 1.0f : 0.0f;
+    for (int i = 0; i < MAX_WATCHED_FILES; i++)
+    {
+        WatchedFile *watch = &fileWatcher.files[i];
 
-#if defined(ENABLE_DEV_EXIT)
-            if (kHeld & HidNpadButton_Plus && kHeld & HidNpadButton_Minus)
-            {
-                CORE.Window.shouldClose = true;
-            }
-#endif
+        if (watch->path == NULL) continue;
 
-#if defined(NX_SUPPORT_GAMEPAD_EMULATION)
+        if (watch->isDirectory) ScanWatchedDirectory(watch, true);
+        else
+        {
+            long modTime = GetFileModTime(watch->path);
 
-            // Move Right (D key or right arrow)
-            CORE.Input.Keyboard.previousKeyState[KEY_RIGHT] = CORE.Input.Keyboard.currentKeyState[KEY_RIGHT];
-            CORE.Input.Keyboard.previousKeyState[KEY_D] = CORE.Input.Keyboard.currentKeyState[KEY_D];
-            if (kHeld & HidNpadButton_Right || kHeld & HidNpadButton_StickLRight) {
-                CORE.Input.Keyboard.currentKeyState[KEY_RIGHT] = 1;
-                CORE.Input.Keyboard.currentKeyState[KEY_D] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_RIGHT] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_D] = 0;
-            }
+            // NOTE: Files removed not notified, notified once created again
+            if ((modTime != 0) && (modTime != watch->modTime)) AddChangedFile(watch->path);
+            watch->modTime = modTime;
+        }
+    }
+#endif
+}
 
-            // Move Left (A key or left arrow)
-            CORE.Input.Keyboard.previousKeyState[KEY_LEFT] = CORE.Input.Keyboard.currentKeyState[KEY_LEFT];
-            CORE.Input.Keyboard.previousKeyState[KEY_A] = CORE.Input.Keyboard.currentKeyState[KEY_A];
-            if (kHeld & HidNpadButton_Left || kHeld & HidNpadButton_StickLLeft) {
-                CORE.Input.Keyboard.currentKeyState[KEY_LEFT] = 1;
-                CORE.Input.Keyboard.currentKeyState[KEY_A] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_LEFT] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_A] = 0;
-            }
+#if !defined(FILE_WATCH_INOTIFY)
+// Compare watched directory files by name hash
+static int CompareWatchedDirFiles(const void *a, const void *b)
+{
+    unsigned int hashA = ((const WatchedDirFile *)a)->hash;
+    unsigned int hashB = ((const WatchedDirFile *)b)->hash;
 
-            // Move down (S key or down arrow)
-            CORE.Input.Keyboard.previousKeyState[KEY_DOWN] = CORE.Input.Keyboard.currentKeyState[KEY_DOWN];
-            CORE.Input.Keyboard.previousKeyState[KEY_S] = CORE.Input.Keyboard.currentKeyState[KEY_S];
-            if (kHeld & HidNpadButton_Down || kHeld & HidNpadButton_StickLDown) {
-                CORE.Input.Keyboard.currentKeyState[KEY_DOWN] = 1;
-                CORE.Input.Keyboard.currentKeyState[KEY_S] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_DOWN] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_S] = 0;
-            }
+    return (hashA > hashB) - (hashA < hashB);
+}
 
-            // Move up (W key or up arrow)
-            CORE.Input.Keyboard.previousKeyState[KEY_UP] = CORE.Input.Keyboard.currentKeyState[KEY_UP];
-            CORE.Input.Keyboard.previousKeyState[KEY_W] = CORE.Input.Keyboard.currentKeyState[KEY_W];
-            if (kHeld & HidNpadButton_Up || kHeld & HidNpadButton_StickLUp) {
-                CORE.Input.Keyboard.currentKeyState[KEY_UP] = 1;
-                CORE.Input.Keyboard.currentKeyState[KEY_W] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_UP] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_W] = 0;
-            }
+// Scan watched directory files modification times, files changed (or created) added if notified
+static void ScanWatchedDirectory(WatchedFile *watch, bool notify)
+{
+    WatchedDirFile *files = NULL;
+    unsigned int fileCount = 0;
+    unsigned int fileCapacity = 0;
 
-            // Gamepad Y (Q key)
-            CORE.Input.Keyboard.previousKeyState[KEY_Q] = CORE.Input.Keyboard.currentKeyState[KEY_Q];
-            if (kHeld & HidNpadButton_Y) {
-                CORE.Input.Keyboard.currentKeyState[KEY_Q] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_Q] = 0;
-            }
+    DirectoryEntry entry = { 0 };
+    DirectoryIterator *iterator = LoadDirectoryIterator(watch->path, NULL, false);
 
-            // Gamepad A (E key)
-            CORE.Input.Keyboard.previousKeyState[KEY_E] = CORE.Input.Keyboard.currentKeyState[KEY_E];
-            if (kHeld & HidNpadButton_A) {
-                CORE.Input.Keyboard.currentKeyState[KEY_E] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_E] = 0;
-            }
+    while (NextDirectoryEntry(iterator, &entry))
+    {
+        if (entry.isDirectory) continue;
 
-            // Gamepad X (R key)
-            CORE.Input.Keyboard.previousKeyState[KEY_R] = CORE.Input.Keyboard.currentKeyState[KEY_R];
-            if (kHeld & HidNpadButton_X) {
-                CORE.Input.Keyboard.currentKeyState[KEY_R] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_R] = 0;
-            }
+        if (fileCount == fileCapacity)
+        {
+            fileCapacity = (fileCapacity > 0)? fileCapacity*2 : 64;
+            files = (WatchedDirFile *)RL_REALLOC(files, fileCapacity*sizeof(WatchedDirFile));
+        }
 
-            // Gamepad B (F key)
-            CORE.Input.Keyboard.previousKeyState[KEY_F] = CORE.Input.Keyboard.currentKeyState[KEY_F];
-            if (kHeld & HidNpadButton_B) {
-                CORE.Input.Keyboard.currentKeyState[KEY_F] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_F] = 0;
-            }
+        // File name hash (FNV-1a)
+        unsigned int hash = 2166136261u;
+        for (const char *c = entry.name; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
 
-            // Gamepad + and - (Escape)
-            CORE.Input.Keyboard.previousKeyState[KEY_ENTER] = CORE.Input.Keyboard.currentKeyState[KEY_ENTER];
-            CORE.Input.Keyboard.previousKeyState[KEY_SPACE] = CORE.Input.Keyboard.currentKeyState[KEY_SPACE];
-            CORE.Input.Keyboard.previousKeyState[KEY_ESCAPE] = CORE.Input.Keyboard.currentKeyState[KEY_ESCAPE];
-            if (kHeld & HidNpadButton_Plus && kHeld & HidNpadButton_Minus) {
-                CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 0;
-                CORE.Input.Keyboard.currentKeyState[KEY_ESCAPE] = 1;
-            } else {
-                if (kHeld & HidNpadButton_Plus) {
-                    CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 1;
-                } else {
-                    CORE.Input.Keyboard.currentKeyState[KEY_ENTER] = 0;
-                }
-                if (kHeld & HidNpadButton_Minus) {
-                    CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 1;
-                } else {
-                    CORE.Input.Keyboard.currentKeyState[KEY_SPACE] = 0;
-                }
-            }
+        files[fileCount].hash = hash;
+        files[fileCount].modTime = GetFileModTime(entry.path);
 
-            // Gamepad Left Thumb (shift)
-            CORE.Input.Keyboard.previousKeyState[KEY_LEFT_SHIFT] = CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT];
-            if (kHeld & GAMEPAD_BUTTON_LEFT_THUMB) {
-                CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT] = 1;
-            } else {
-                CORE.Input.Keyboard.currentKeyState[KEY_LEFT_SHIFT] = 0;
-            }
+        if (notify)
+        {
+            WatchedDirFile *previous = NULL;
+            if (watch->fileCount > 0) previous = (WatchedDirFile *)bsearch(&files[fileCount], watch->files, watch->fileCount, sizeof(WatchedDirFile), CompareWatchedDirFiles);
 
-            // Gamepad ZL (mouse right)
-            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_LEFT] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT];
-            if (kHeld & HidNpadButton_ZL) {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 1;
-            } else {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 0;
-            }
+            if ((previous == NULL) || (previous->modTime != files[fileCount].modTime)) AddChangedFile(entry.path);
+        }
 
-            // Gamepad Right Thumb (mouse middle)
-            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_MIDDLE] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE];
-            if (kHeld & GAMEPAD_BUTTON_RIGHT_THUMB) {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE] = 1;
-            } else {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE] = 0;
-            }
+        fileCount++;
+    }
 
-            // Gamepad ZR (mouse left)
-            CORE.Input.Mouse.previousButtonState[MOUSE_BUTTON_RIGHT] = CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT];
-            if (kHeld & HidNpadButton_ZR) {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 1;
-            } else {
-                CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 0;
-            }
+    UnloadDirectoryIterator(iterator);
 
-            // Gamepad L/R Bumpers (mouse wheel)
-            CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-            if (kHeld & HidNpadButton_L) {
-                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, -1.0f };
-            } else if (kHeld & HidNpadButton_R) {
-                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 1.0f };
-            } else {
-                CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
-            }
+    if (fileCount > 0) qsort(files, fileCount, sizeof(WatchedDirFile), CompareWatchedDirFiles);
 
-            // Gamepad Axis (mouse position)
-            CORE.Input.Mouse.previousPosition.x = CORE.Input.Mouse.currentPosition.x;
-            CORE.Input.Mouse.previousPosition.y = CORE.Input.Mouse.currentPosition.y;
+    RL_FREE(watch->files);
+    watch->files = files;
+    watch->fileCount = fileCount;
+}
+#endif
 
-            CORE.Input.Mouse.currentPosition.x += CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_X] * 10;
-            CORE.Input.Mouse.currentPosition.y -= CORE.Input.Gamepad.axisState[nxGamepadIndex][GAMEPAD_AXIS_RIGHT_Y] * 10;
+// Add asset hot-reloaded, asset files watched
+static HotReloadAsset *AddHotReloadAsset(void *asset, int type, const char *fileName, const char *fsFileName)
+{
+    HotReloadAsset *reload = NULL;
 
-            // Clamp Mouse X to screen
-            if (CORE.Input.Mouse.currentPosition.x < 0) CORE.Input.Mouse.currentPosition.x = 0;
-            else if (CORE.Input.Mouse.currentPosition.x > CORE.Window.screen.width/CORE.Input.Mouse.scale.x) CORE.Input.Mouse.currentPosition.x = CORE.Window.screen.width/CORE.Input.Mouse.scale.x;
+    ClearHotReload(asset);
 
-            // Clamp Mouse Y to screen
-            if (CORE.Input.Mouse.currentPosition.y < 0) CORE.Input.Mouse.currentPosition.y = 0;
-            else if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
+    for (int i = 0; i < MAX_HOT_RELOAD_ASSETS; i++) if (fileWatcher.assets[i].asset == NULL) { reload = &fileWatcher.assets[i]; break; }
 
-            // Gamepad +/- pressed to exit
-            if (CORE.Input.Keyboard.currentKeyState[CORE.Input.Keyboard.exitKey] == 1) CORE.Window.shouldClose = true;
-#endif
-        }
+    if (reload == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Failed to set asset hot-reloading, maximum hot-reload assets reached (%i)", MAX_HOT_RELOAD_ASSETS);
+        return NULL;
     }
-#endif
 
-#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
-    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
-    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
+    reload->type = type;
+    reload->asset = asset;
 
-    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
+    if (fileName != NULL)
+    {
+        reload->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(reload->fileName, fileName);
+        WatchFile(fileName);
+    }
 
-    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
-    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
-#endif
+    if (fsFileName != NULL)
+    {
+        reload->fsFileName = (char *)RL_MALLOC(strlen(fsFileName) + 1);
+        strcpy(reload->fsFileName, fsFileName);
+        WatchFile(fsFileName);
+    }
+
+    return reload;
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// Reload asset from files, asset replaced in place
+// NOTE: Previous asset kept if reloading fails
+static bool ReloadHotReloadAsset(HotReloadAsset *asset)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
-
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    bool success = false;
 
-    if (dir != NULL)
+    switch (asset->type)
     {
-        while ((dp = readdir(dir)) != NULL)
+#if defined(SUPPORT_MODULE_RTEXTURES)
+        case HOT_RELOAD_TEXTURE:
         {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
-            {
-                sprintf(path, "%s/%s", basePath, dp->d_name);
+            Texture2D *texture = (Texture2D *)asset->asset;
+            Image image = LoadImage(asset->fileName);       // WARNING: Module required: rtextures
 
-                if (filter != NULL)
+            if (image.data != NULL)
+            {
+                // Texture data updated if size and format not changed, texture id and parameters kept
+                if ((image.width == texture->width) && (image.height == texture->height) && (image.format == texture->format) &&
+                    (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.mipmaps == 1) && (texture->mipmaps == 1))
                 {
-                    if (IsFileExtension(path, filter))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+                    UpdateTexture(*texture, image.data);    // WARNING: Module required: rtextures
+                    success = true;
                 }
                 else
                 {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
+                    Texture2D reloaded = LoadTextureFromImage(image);   // WARNING: Module required: rtextures
+
+                    if (reloaded.id > 0)
+                    {
+                        UnloadTexture(*texture);            // WARNING: Module required: rtextures
+                        *texture = reloaded;
+                        success = true;
+                    }
                 }
+
+                UnloadImage(image);                         // WARNING: Module required: rtextures
             }
-        }
+        } break;
+#endif
+        case HOT_RELOAD_SHADER:
+        {
+            Shader *shader = (Shader *)asset->asset;
+            Shader reloaded = LoadShader(asset->fileName, asset->fsFileName);
+
+            // NOTE: Default shader returned on compilation failure (locations allocated), not replaced
+            if ((reloaded.id > 0) && (reloaded.id != rlGetShaderIdDefault()))
+            {
+                UnloadShader(*shader);
+                *shader = reloaded;
+                success = true;
+            }
+            else RL_FREE(reloaded.locs);
+        } break;
+#if defined(SUPPORT_MODULE_RMODELS)
+        case HOT_RELOAD_MODEL:
+        {
+            // NOTE: No default mesh on loading failure, previous model kept
+            Model *model = (Model *)asset->asset;
+            Model reloaded = LoadModelFile(asset->fileName, false);     // WARNING: Module required: rmodels
 
-        closedir(dir);
+            if (reloaded.meshCount > 0)
+            {
+                reloaded.transform = model->transform;
+                UnloadModel(*model);                        // WARNING: Module required: rmodels
+                *model = reloaded;
+                success = true;
+            }
+        } break;
+#endif
+        default: break;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset reloaded successfully", (asset->fileName != NULL)? asset->fileName : asset->fsFileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to reload asset, previous asset kept", (asset->fileName != NULL)? asset->fileName : asset->fsFileName);
+
+    return success;
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+// Close files watching, watches and hot-reload assets unloaded
+// NOTE: Assets hot-reloaded not unloaded, owned by user
+static void CloseFileWatcher(void)
 {
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
-
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    for (int i = 0; i < MAX_WATCHED_FILES; i++)
+    {
+        RL_FREE(fileWatcher.files[i].path);
+#if !defined(FILE_WATCH_INOTIFY)
+        RL_FREE(fileWatcher.files[i].files);
+#endif
+    }
 
-    if (dir != NULL)
+    for (int i = 0; i < MAX_HOT_RELOAD_ASSETS; i++)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
-        {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
-            {
-                // Construct new path from our base path
-                sprintf(path, "%s/%s", basePath, dp->d_name);
+        RL_FREE(fileWatcher.assets[i].fileName);
+        RL_FREE(fileWatcher.assets[i].fsFileName);
+    }
 
-                if (IsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+    RL_FREE(fileWatcher.changes.data);
+    RL_FREE(fileWatcher.changes.offsets);
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else ScanDirectoryFilesRecursively(path, files, filter);
-            }
-        }
+#if defined(FILE_WATCH_INOTIFY)
+    if (fileWatcher.initialized) close(fileWatcher.fd);
+#endif
 
-        closedir(dir);
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+    memset(&fileWatcher, 0, sizeof(fileWatcher));
 }
+#endif
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 // GLFW3 Error Callback, runs on GLFW3 error
@@ -5716,6 +8769,9 @@ static void ErrorCallback(int error, const char *description)
 // NOTE: Window resizing not allowed by default
 static void WindowSizeCallback(GLFWwindow *window, int width, int height)
 {
+    // Software renderer framebuffer must be resized before viewport setup
+    if (rlGetVersion() == RL_OPENGL_SOFTWARE) rlResizeFramebuffer(width, height);
+
     // Reset viewport and projection matrix for new size
     SetupViewport(width, height);
 
@@ -5805,31 +8861,18 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
         {
             if (gifRecording)
             {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
+                StopScreenRecording();
 
             #if defined(PLATFORM_WEB)
                 // Download file from MEMFS (emscripten memory filesystem)
                 // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
                 emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
             #endif
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
             }
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
+                StartScreenRecording(TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
@@ -5844,17 +8887,13 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     if ((key == GLFW_KEY_F11) && (action == GLFW_PRESS))
     {
-        eventsRecording = !eventsRecording;
-
-        // On finish recording, we export events into a file
-        if (!eventsRecording) ExportAutomationEvents("eventsrec.rep");
+        // On finish recording, events file is closed
+        if (eventsRecording) StopAutomationEventRecording();
+        else StartAutomationEventRecording("eventsrec.rep");
     }
     else if ((key == GLFW_KEY_F9) && (action == GLFW_PRESS))
     {
-        LoadAutomationEvents("eventsrec.rep");
-        eventsPlaying = true;
-
-        TRACELOG(LOG_WARNING, "eventsPlaying enabled!");
+        StartAutomationEventPlaying("eventsrec.rep");
     }
 #endif
 }
@@ -7300,211 +10339,486 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 }
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-// NOTE: Loading happens over AutomationEvent *events
-// TODO: This system should probably be redesigned
-static void LoadAutomationEvents(const char *fileName)
+#if defined(SUPPORT_GIF_RECORDING)
+// Get recording encoder frame buffer to be filled, waits for a frame to be encoded if queue is full
+static unsigned char *GetRecordingFrameBuffer(void)
+{
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+    if (recordingEncoder.threaded)
+    {
+        pthread_mutex_lock(&recordingEncoder.mutex);
+        while (recordingEncoder.count == GIF_ENCODER_FRAMES) pthread_cond_wait(&recordingEncoder.cond, &recordingEncoder.mutex);
+        pthread_mutex_unlock(&recordingEncoder.mutex);
+    }
+#endif
+    // NOTE: Queued frames are not accessed by main thread, only next buffer after them
+    return recordingEncoder.data[(recordingEncoder.first + recordingEncoder.count)%GIF_ENCODER_FRAMES];
+}
+
+// Encode recording frame, added to gif or saved as next file of frames sequence
+// WARNING: Called from encoder thread, no access to functions using shared buffers (i.e. TextFormat())
+static void EncodeRecordingFrame(int index)
 {
-    //unsigned char fileId[4] = { 0 };
+    unsigned char *data = recordingEncoder.data[index];
+    int pitch = recordingEncoder.pitch[index];
 
-    // Load binary
-    /*
-    FILE *repFile = fopen(fileName, "rb");
-    fread(fileId, 1, 4, repFile);
+    if (recordingEncoder.format == RECORDING_GIF)
+    {
+        msf_gif_frame(&gifState, data, recordingEncoder.delay, 16, pitch);
+        return;
+    }
 
-    if ((fileId[0] == 'r') && (fileId[1] == 'E') && (fileId[2] == 'P') && (fileId[1] == ' '))
+    int width = recordingEncoder.width;
+    int height = recordingEncoder.height;
+
+    // Frames sequence requires rows top to bottom and opaque pixels
+    if (pitch < 0)
     {
-        fread(&eventCount, sizeof(int), 1, repFile);
-        TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-        fread(events, sizeof(AutomationEvent), eventCount, repFile);
+        unsigned char *row = (unsigned char *)RL_MALLOC(width*4);
+
+        for (int y = 0; y < height/2; y++)
+        {
+            memcpy(row, data + y*width*4, width*4);
+            memcpy(data + y*width*4, data + (height - 1 - y)*width*4, width*4);
+            memcpy(data + (height - 1 - y)*width*4, row, width*4);
+        }
+
+        RL_FREE(row);
     }
 
-    fclose(repFile);
-    */
+    for (int i = 3; i < width*height*4; i += 4) data[i] = 255;
 
-    // Load events (text file)
-    FILE *repFile = fopen(fileName, "rt");
+    char fileName[MAX_FILEPATH_LENGTH + 16] = { 0 };
+    snprintf(fileName, MAX_FILEPATH_LENGTH + 16, "%.*s%04i%s", (int)(recordingEncoder.fileExt - recordingEncoder.fileName),
+        recordingEncoder.fileName, recordingEncoder.frameCounter, recordingEncoder.fileExt);
+    recordingEncoder.frameCounter++;
 
-    if (repFile != NULL)
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+    if (recordingEncoder.format == RECORDING_QOI)
     {
-        unsigned int count = 0;
-        char buffer[256] = { 0 };
+        qoi_desc desc = { (unsigned int)width, (unsigned int)height, 4, QOI_SRGB };
+        int fileSize = 0;
+        void *fileData = qoi_encode(data, &desc, &fileSize);     // WARNING: Module required: rtextures
+
+        if (fileData != NULL) SaveFileData(fileName, fileData, fileSize);
+        RL_FREE(fileData);
+    }
+    else
+#endif
+    SaveFileData(fileName, data, width*height*4);   // RECORDING_RAW, uncompressed RGBA pixels
+}
+
+// Queue recording encoder frame buffer filled (encoded directly if no encoder thread)
+static void QueueRecordingFrame(int pitch)
+{
+    int index = (recordingEncoder.first + recordingEncoder.count)%GIF_ENCODER_FRAMES;
+    recordingEncoder.pitch[index] = pitch;
+
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+    if (recordingEncoder.threaded)
+    {
+        pthread_mutex_lock(&recordingEncoder.mutex);
+        recordingEncoder.count++;
+        pthread_cond_broadcast(&recordingEncoder.cond);
+        pthread_mutex_unlock(&recordingEncoder.mutex);
+        return;
+    }
+#endif
+    EncodeRecordingFrame(index);
+}
+
+// Retrieve recording frame readback pixels and queue them for encoding
+static void ReadRecordingFrame(int index)
+{
+    unsigned char *data = GetRecordingFrameBuffer();
+
+    // NOTE: Readback pixels rows are bottom to top, flipped by encoder with a negative pitch
+    if (rlGetReadbackPixels(recordingReadbacks[index].id, recordingEncoder.width, recordingEncoder.height, data)) QueueRecordingFrame(-recordingEncoder.width*4);
+
+    recordingReadbacks[index].pending = false;
+}
+
+// Update screen recording, screen frames readback
+// NOTE: Screen pixels readback is issued into a pixel buffer and retrieved a couple of frames later,
+// once GPU has completed the copy, to avoid stalling the pipeline waiting for the current frame
+static void UpdateScreenRecording(void)
+{
+    gifFrameCounter++;
+
+    // Retrieve completed readbacks, oldest first to keep frames order
+    for (int i = 0; i < GIF_READBACK_BUFFERS; i++)
+    {
+        int index = (recordingReadbackIndex + i)%GIF_READBACK_BUFFERS;
 
-        fgets(buffer, 256, repFile);
+        if (recordingReadbacks[index].pending && ((gifFrameCounter - recordingReadbacks[index].frame) >= 2)) ReadRecordingFrame(index);
+    }
 
-        while (!feof(repFile))
+    // NOTE: We record one frame every recordingRate game frames
+    if ((gifFrameCounter%recordingRate) == 0)
+    {
+        if (recordingReadbacks[recordingReadbackIndex].id > 0)
         {
-            if (buffer[0] == 'c') sscanf(buffer, "c %i", &eventCount);
-            else if (buffer[0] == 'e')
-            {
-                sscanf(buffer, "e %d %d %d %d %d", &events[count].frame, &events[count].type,
-                       &events[count].params[0], &events[count].params[1], &events[count].params[2]);
+            if (recordingReadbacks[recordingReadbackIndex].pending) ReadRecordingFrame(recordingReadbackIndex);   // Waits for readback, all buffers in use
 
-                count++;
-            }
+            rlReadScreenPixelsAsync(recordingReadbacks[recordingReadbackIndex].id, recordingEncoder.width, recordingEncoder.height);
+            recordingReadbacks[recordingReadbackIndex].frame = gifFrameCounter;
+            recordingReadbacks[recordingReadbackIndex].pending = true;
+
+            recordingReadbackIndex = (recordingReadbackIndex + 1)%GIF_READBACK_BUFFERS;
+        }
+        else
+        {
+            // Get image data for the current frame (from backbuffer), synchronous readback
+            unsigned char *screenData = rlReadScreenPixels(recordingEncoder.width, recordingEncoder.height);
+            memcpy(GetRecordingFrameBuffer(), screenData, recordingEncoder.width*recordingEncoder.height*4);
+            QueueRecordingFrame(recordingEncoder.width*4);
 
-            fgets(buffer, 256, repFile);
+            RL_FREE(screenData);    // Free image data
         }
+    }
+}
 
-        if (count != eventCount) TRACELOG(LOG_WARNING, "Events count provided is different than count");
+#if defined(SUPPORT_GIF_RECORDING_THREAD)
+// Encode recording frames queued (thread)
+// NOTE: Thread finishes once closing is requested and all queued frames are encoded
+static void *RecordingEncoderThread(void *arg)
+{
+    pthread_mutex_lock(&recordingEncoder.mutex);
+
+    while (true)
+    {
+        while ((recordingEncoder.count == 0) && !recordingEncoder.closing) pthread_cond_wait(&recordingEncoder.cond, &recordingEncoder.mutex);
+        if (recordingEncoder.count == 0) break;
+
+        int index = recordingEncoder.first;
+        pthread_mutex_unlock(&recordingEncoder.mutex);
+
+        // NOTE: Frame encoding is the slow part, done without holding the queue lock
+        EncodeRecordingFrame(index);
+
+        pthread_mutex_lock(&recordingEncoder.mutex);
+        recordingEncoder.first = (recordingEncoder.first + 1)%GIF_ENCODER_FRAMES;
+        recordingEncoder.count--;
+        pthread_cond_broadcast(&recordingEncoder.cond);
+    }
+
+    pthread_mutex_unlock(&recordingEncoder.mutex);
 
-        fclose(repFile);
+    return NULL;
+}
+#endif
+#endif  // SUPPORT_GIF_RECORDING
+
+// Set shader default locations (attributes and uniforms)
+// NOTE: Shader locations array must be allocated
+static void SetShaderLocationsDefault(Shader shader)
+{
+    // Default shader attribute locations have been binded before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
+    //          vertex draw id location     = 7
+
+    // NOTE: If any location is not found, loc point becomes -1
+
+    // All locations reset to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    // Get handles to GLSL input attribute locations
+    shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    shader.locs[SHADER_LOC_VERTEX_DRAWID] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
+    shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
+    shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+}
+
+#if defined(SUPPORT_SHADER_CACHE)
+// Shader cache file header, followed by program binary data
+typedef struct ShaderCacheHeader {
+    char id[4];                     // Cache file identifier: "rSHC"
+    unsigned int version;           // Cache file version
+    unsigned long long driverHash;  // Driver info hash (vendor, renderer, version), raylib version and graphics API
+    unsigned long long codeHash;    // Shader code hash, also used as file name
+    int format;                     // Program binary format (driver specific)
+    int dataSize;                   // Program binary data size
+} ShaderCacheHeader;
+
+// Compute FNV-1a 64bit hash of a string, continuing from a previous hash
+static unsigned long long HashString(unsigned long long hash, const char *text)
+{
+    if (text != NULL)
+    {
+        for (int i = 0; text[i] != '\0'; i++)
+        {
+            hash ^= (unsigned char)text[i];
+            hash *= 0x100000001b3ULL;
+        }
     }
 
-    TRACELOG(LOG_WARNING, "Events loaded: %i", eventCount);
+    // NOTE: Separator byte, distinguishes NULL from empty strings and strings boundaries
+    hash ^= (text == NULL)? 0xff : 0xfe;
+    hash *= 0x100000001b3ULL;
+
+    return hash;
 }
 
-// Export recorded events into a file
-static void ExportAutomationEvents(const char *fileName)
+// Get shader cache driver hash, cached binaries are only valid for same driver, raylib version and graphics API
+static unsigned long long GetShaderCacheDriverHash(void)
 {
-    unsigned char fileId[4] = "rEP ";
+    unsigned long long driverHash = HashString(0xcbf29ce484222325ULL, rlGetDriverInfo());
+    driverHash = HashString(driverHash, RAYLIB_VERSION);
+    driverHash ^= (unsigned long long)rlGetVersion();
 
-    // Save as binary
-    /*
-    FILE *repFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, repFile);
-    fwrite(&eventCount, sizeof(int), 1, repFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, repFile);
-    fclose(repFile);
-    */
+    return driverHash;
+}
+
+// Load shader program from cache binary (0 if not cached)
+// NOTE: Cache file name is the hash of shader code and cache file header stores the hash of driver info,
+// a binary created by a different driver (or rejected by the driver) must be compiled again and overwritten,
+// shader code hash is returned to save the compiled program (0 if cache disabled)
+static unsigned int LoadShaderCache(const char *vsCode, const char *fsCode, unsigned long long *codeHash)
+{
+    *codeHash = 0;
+
+    // Default shader is not cached (already loaded)
+    if ((shaderCacheDirectory[0] == '\0') || ((vsCode == NULL) && (fsCode == NULL))) return 0;
+
+    *codeHash = HashString(0xcbf29ce484222325ULL, vsCode);
+    *codeHash = HashString(*codeHash, fsCode);
+
+    char fileName[MAX_FILEPATH_LENGTH + 32] = { 0 };
+    snprintf(fileName, MAX_FILEPATH_LENGTH + 32, "%s/%08x%08x.shc", shaderCacheDirectory, (unsigned int)(*codeHash >> 32), (unsigned int)(*codeHash & 0xffffffff));
 
-    // Export events as text
-    FILE *repFile = fopen(fileName, "wt");
+    unsigned int id = 0;
 
-    if (repFile != NULL)
+    if (FileExists(fileName))
     {
-        fprintf(repFile, "# Automation events list\n");
-        fprintf(repFile, "#    c <events_count>\n");
-        fprintf(repFile, "#    e <frame> <event_type> <param0> <param1> <param2> // <event_type_name>\n");
+        unsigned int fileSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &fileSize);
 
-        fprintf(repFile, "c %i\n", eventCount);
-        for (int i = 0; i < eventCount; i++)
+        if (fileData != NULL)
         {
-            fprintf(repFile, "e %i %i %i %i %i // %s\n", events[i].frame, events[i].type,
-                    events[i].params[0], events[i].params[1], events[i].params[2], autoEventTypeName[events[i].type]);
+            ShaderCacheHeader header = { 0 };
+            if (fileSize >= sizeof(ShaderCacheHeader)) memcpy(&header, fileData, sizeof(ShaderCacheHeader));
+
+            if ((memcmp(header.id, "rSHC", 4) == 0) && (header.version == 100) &&
+                (header.driverHash == GetShaderCacheDriverHash()) && (header.codeHash == *codeHash) &&
+                (header.dataSize > 0) && ((sizeof(ShaderCacheHeader) + header.dataSize) == fileSize))
+            {
+                id = rlLoadShaderProgramBinary(fileData + sizeof(ShaderCacheHeader), header.dataSize, header.format);
+            }
+            else TRACELOG(LOG_INFO, "SHADER: [%s] Shader cache binary not valid for current driver", fileName);
+
+            UnloadFileData(fileData);
         }
+    }
+
+    return id;
+}
 
-        fclose(repFile);
+// Save shader program binary into cache
+static void SaveShaderCache(unsigned int id, unsigned long long codeHash)
+{
+    int dataSize = 0;
+    int format = 0;
+    unsigned char *data = rlGetShaderProgramBinary(id, &dataSize, &format);
+
+    if (data != NULL)
+    {
+        char fileName[MAX_FILEPATH_LENGTH + 32] = { 0 };
+        snprintf(fileName, MAX_FILEPATH_LENGTH + 32, "%s/%08x%08x.shc", shaderCacheDirectory, (unsigned int)(codeHash >> 32), (unsigned int)(codeHash & 0xffffffff));
+
+        ShaderCacheHeader header = { { 'r', 'S', 'H', 'C' }, 100, GetShaderCacheDriverHash(), codeHash, format, dataSize };
+
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(sizeof(ShaderCacheHeader) + dataSize);
+        memcpy(fileData, &header, sizeof(ShaderCacheHeader));
+        memcpy(fileData + sizeof(ShaderCacheHeader), data, dataSize);
+
+        SaveFileData(fileName, fileData, sizeof(ShaderCacheHeader) + dataSize);
+
+        RL_FREE(fileData);
+        RL_FREE(data);
+    }
+}
+#endif  // SUPPORT_SHADER_CACHE
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+// Write unsigned value into automation events file (varint, 7 bits per byte)
+static void WriteAutomationVarint(unsigned int value)
+{
+    while (value >= 0x80)
+    {
+        fputc((int)((value & 0x7f) | 0x80), automation.file);
+        value >>= 7;
+    }
+
+    fputc((int)value, automation.file);
+}
+
+// Read unsigned value from automation events file (varint, 7 bits per byte)
+static bool ReadAutomationVarint(unsigned int *value)
+{
+    *value = 0;
+
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        int byte = fgetc(automation.file);
+        if (byte == EOF) return false;
+
+        *value |= (unsigned int)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+
+    return false;
+}
+
+// Read frame block frames from automation events file, false at frame blocks end (frames index or end of file)
+static bool ReadAutomationBlockFrames(unsigned int *frames)
+{
+    if ((automation.dataEnd > 0) && ((unsigned int)ftell(automation.file) >= automation.dataEnd)) return false;
+
+    return ReadAutomationVarint(frames);
+}
+
+// Read frame block events count from automation events file, params delta-encoding reset on key frame block
+static bool ReadAutomationBlockCount(unsigned int *count)
+{
+    if (!ReadAutomationVarint(count)) return false;
+
+    // NOTE: Version 100 files have no key frame blocks
+    if (automation.version >= 101)
+    {
+        if (*count & 1) memset(automation.lastParams, 0, sizeof(automation.lastParams));
+        *count >>= 1;
+    }
+
+    return true;
+}
+
+// Read event from automation events file, params delta decoded
+// NOTE: Params used as input states indices are checked, file data could be corrupted
+static bool ReadAutomationEvent(int *type, int *params)
+{
+    *type = fgetc(automation.file);
+
+    if ((*type <= EVENT_NONE) || (*type > ACTION_SETTARGETFPS)) return false;
+
+    for (int p = 0; p < 3; p++)
+    {
+        unsigned int value = 0;
+        if (!ReadAutomationVarint(&value)) return false;
+
+        int delta = (int)(value >> 1) ^ -(int)(value & 1);
+        params[p] = (int)((unsigned int)automation.lastParams[*type][p] + (unsigned int)delta);
+        automation.lastParams[*type][p] = params[p];
+    }
+
+    bool valid = true;
+
+    switch (*type)
+    {
+        case INPUT_KEY_UP:
+        case INPUT_KEY_DOWN: valid = ((params[0] >= 0) && (params[0] < MAX_KEYBOARD_KEYS)); break;
+        case INPUT_MOUSE_BUTTON_UP:
+        case INPUT_MOUSE_BUTTON_DOWN: valid = ((params[0] >= 0) && (params[0] < MAX_MOUSE_BUTTONS)); break;
+        case INPUT_TOUCH_UP:
+        case INPUT_TOUCH_DOWN:
+        case INPUT_TOUCH_POSITION: valid = ((params[0] >= 0) && (params[0] < MAX_TOUCH_POINTS)); break;
+        case INPUT_GAMEPAD_CONNECT:
+        case INPUT_GAMEPAD_DISCONNECT: valid = ((params[0] >= 0) && (params[0] < MAX_GAMEPADS)); break;
+        case INPUT_GAMEPAD_BUTTON_UP:
+        case INPUT_GAMEPAD_BUTTON_DOWN: valid = ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_BUTTONS)); break;
+        case INPUT_GAMEPAD_AXIS_MOTION: valid = ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_AXIS)); break;
+        default: break;
     }
+
+    if (!valid) TRACELOG(LOG_WARNING, "AUTOMATION: Automation event params out of range (%s: %i, %i, %i)", autoEventTypeName[*type], params[0], params[1], params[2]);
+
+    return valid;
+}
+
+// Add event to current frame events (recording)
+static void AddAutomationEvent(unsigned int type, int param0, int param1, int param2)
+{
+    if (automation.frameEventCount >= automation.frameEventCapacity)
+    {
+        automation.frameEventCapacity = (automation.frameEventCapacity == 0)? 64 : automation.frameEventCapacity*2;
+        automation.frameEvents = (AutomationEvent *)RL_REALLOC(automation.frameEvents, automation.frameEventCapacity*sizeof(AutomationEvent));
+    }
+
+    AutomationEvent *event = &automation.frameEvents[automation.frameEventCount];
+    event->frame = CORE.Time.frameCounter - automation.baseFrame;
+    event->type = type;
+    event->params[0] = param0;
+    event->params[1] = param1;
+    event->params[2] = param2;
+    automation.frameEventCount++;
+
+    TRACELOG(LOG_DEBUG, "AUTOMATION: [%i] %s: %i, %i, %i", event->frame, autoEventTypeName[type], param0, param1, param2);
 }
 
 // EndDrawing() -> After PollInputEvents()
-// Check event in current frame and save into the events[i] array
+// Check events in current frame and write them into file as a frame block
 static void RecordAutomationEvent(unsigned int frame)
 {
+    automation.frameEventCount = 0;
+
     for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
     {
         // INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_UP;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key]) AddAutomationEvent(INPUT_KEY_UP, key, 0, 0);
 
         // INPUT_KEY_DOWN
-        if (CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_DOWN;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Keyboard.currentKeyState[key]) AddAutomationEvent(INPUT_KEY_DOWN, key, 0, 0);
     }
 
     for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
     {
         // INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_UP;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button]) AddAutomationEvent(INPUT_MOUSE_BUTTON_UP, button, 0, 0);
 
         // INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_DOWN;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Mouse.currentButtonState[button]) AddAutomationEvent(INPUT_MOUSE_BUTTON_DOWN, button, 0, 0);
     }
 
     // INPUT_MOUSE_POSITION (only saved if changed)
     if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
         ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_POSITION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        events[eventCount].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        AddAutomationEvent(INPUT_MOUSE_POSITION, (int)CORE.Input.Mouse.currentPosition.x, (int)CORE.Input.Mouse.currentPosition.y, 0);
     }
 
-    // INPUT_MOUSE_WHEEL_MOTION
-    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
-        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    // INPUT_MOUSE_WHEEL_MOTION (wheel move is reset every frame)
+    if (((int)CORE.Input.Mouse.currentWheelMove.x != 0) || ((int)CORE.Input.Mouse.currentWheelMove.y != 0))
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_WHEEL_MOTION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;;
-        events[eventCount].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_WHEEL_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        AddAutomationEvent(INPUT_MOUSE_WHEEL_MOTION, (int)CORE.Input.Mouse.currentWheelMove.x, (int)CORE.Input.Mouse.currentWheelMove.y, 0);
     }
 
     for (int id = 0; id < MAX_TOUCH_POINTS; id++)
     {
         // INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_UP;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id]) AddAutomationEvent(INPUT_TOUCH_UP, id, 0, 0);
 
         // INPUT_TOUCH_DOWN
-        if (CORE.Input.Touch.currentTouchState[id])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_DOWN;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Touch.currentTouchState[id]) AddAutomationEvent(INPUT_TOUCH_DOWN, id, 0, 0);
 
         // INPUT_TOUCH_POSITION
         // TODO: It requires the id!
@@ -7512,14 +10826,7 @@ static void RecordAutomationEvent(unsigned int frame)
         if (((int)CORE.Input.Touch.currentPosition[id].x != (int)CORE.Input.Touch.previousPosition[id].x) ||
             ((int)CORE.Input.Touch.currentPosition[id].y != (int)CORE.Input.Touch.previousPosition[id].y))
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_POSITION;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = (int)CORE.Input.Touch.currentPosition[id].x;
-            events[eventCount].params[2] = (int)CORE.Input.Touch.currentPosition[id].y;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            AddAutomationEvent(INPUT_TOUCH_POSITION, id, (int)CORE.Input.Touch.currentPosition[id].x, (int)CORE.Input.Touch.currentPosition[id].y);
         }
         */
     }
@@ -7547,123 +10854,149 @@ static void RecordAutomationEvent(unsigned int frame)
         for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
         {
             // INPUT_GAMEPAD_BUTTON_UP
-            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button])
-            {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_UP;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
-            }
+            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button]) AddAutomationEvent(INPUT_GAMEPAD_BUTTON_UP, gamepad, button, 0);
 
             // INPUT_GAMEPAD_BUTTON_DOWN
-            if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
-            {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_DOWN;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
-            }
+            if (CORE.Input.Gamepad.currentButtonState[gamepad][button]) AddAutomationEvent(INPUT_GAMEPAD_BUTTON_DOWN, gamepad, button, 0);
         }
 
         for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
         {
             // INPUT_GAMEPAD_AXIS_MOTION
-            if (CORE.Input.Gamepad.axisState[gamepad][axis] > 0.1f)
-            {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_AXIS_MOTION;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = axis;
-                events[eventCount].params[2] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_AXIS_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
-            }
+            if (CORE.Input.Gamepad.axisState[gamepad][axis] > 0.1f) AddAutomationEvent(INPUT_GAMEPAD_AXIS_MOTION, gamepad, axis, (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f));
         }
     }
 
+#if defined(SUPPORT_GESTURES_SYSTEM)
     // INPUT_GESTURE
-    if (GESTURES.current != GESTURE_NONE)
+    if (GESTURES.current != GESTURE_NONE) AddAutomationEvent(INPUT_GESTURE, GESTURES.current, 0, 0);
+#endif
+
+    if (automation.frameEventCount == 0) return;
+
+    // Write frame block, params delta-encoded to previous event of same type (zigzag encoding for signed values)
+    unsigned int blockFrame = frame - automation.baseFrame;
+    WriteAutomationVarint(blockFrame - automation.blockFrame);
+
+    // Key frame block every AUTOMATION_INDEX_FRAMES frames: params delta-encoding reset, block added to frames index
+    bool keyBlock = ((automation.indexCount == 0) || ((blockFrame - automation.index[automation.indexCount - 1].frame) >= AUTOMATION_INDEX_FRAMES));
+
+    if (keyBlock)
+    {
+        if (automation.indexCount >= automation.indexCapacity)
+        {
+            automation.indexCapacity = (automation.indexCapacity == 0)? 256 : automation.indexCapacity*2;
+            automation.index = (AutomationFrameIndex *)RL_REALLOC(automation.index, automation.indexCapacity*sizeof(AutomationFrameIndex));
+        }
+
+        automation.index[automation.indexCount].frame = blockFrame;
+        automation.index[automation.indexCount].offset = (unsigned int)ftell(automation.file);
+        automation.indexCount++;
+
+        memset(automation.lastParams, 0, sizeof(automation.lastParams));
+    }
+
+    WriteAutomationVarint((automation.frameEventCount << 1) | (keyBlock? 1 : 0));
+
+    for (unsigned int i = 0; i < automation.frameEventCount; i++)
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_GESTURE;
-        events[eventCount].params[0] = GESTURES.current;
-        events[eventCount].params[1] = 0;
-        events[eventCount].params[2] = 0;
+        AutomationEvent *event = &automation.frameEvents[i];
+        fputc((int)event->type, automation.file);
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_GESTURE: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+        for (int p = 0; p < 3; p++)
+        {
+            int delta = (int)((unsigned int)event->params[p] - (unsigned int)automation.lastParams[event->type][p]);
+            WriteAutomationVarint(((unsigned int)delta << 1) ^ (unsigned int)(delta >> 31));
+            automation.lastParams[event->type][p] = event->params[p];
+        }
     }
+
+    automation.blockFrame = blockFrame;
+    automation.eventCount += automation.frameEventCount;
 }
 
-// Play automation event
+// Play automation events of current frame
+// NOTE: Frame blocks are read in order, only the block of current frame is read (if any), SeekAutomationEventPlaying() repositions file
 static void PlayAutomationEvent(unsigned int frame)
 {
-    for (unsigned int i = 0; i < eventCount; i++)
+    if ((frame - automation.baseFrame) != automation.blockFrame) return;
+
+    unsigned int count = 0;
+    bool valid = ReadAutomationBlockCount(&count);
+
+    for (unsigned int i = 0; valid && (i < count); i++)
     {
-        if (events[i].frame == frame)
+        int type = 0;
+        int params[3] = { 0 };
+
+        valid = ReadAutomationEvent(&type, params);
+        if (!valid) break;
+
+        automation.eventCount++;
+
+        switch (type)
         {
-            switch (events[i].type)
+            // Input events
+            case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[params[0]] = false; break;             // param[0]: key
+            case INPUT_KEY_DOWN: CORE.Input.Keyboard.currentKeyState[params[0]] = true; break;            // param[0]: key
+            case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[params[0]] = false; break;    // param[0]: key
+            case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[params[0]] = true; break;   // param[0]: key
+            case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
             {
-                // Input events
-                case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = false; break;             // param[0]: key
-                case INPUT_KEY_DOWN: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = true; break;            // param[0]: key
-                case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = false; break;    // param[0]: key
-                case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = true; break;   // param[0]: key
-                case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
-                {
-                    CORE.Input.Mouse.currentPosition.x = (float)events[i].params[0];
-                    CORE.Input.Mouse.currentPosition.y = (float)events[i].params[1];
-                } break;
-                case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
-                {
-                    CORE.Input.Mouse.currentWheelMove.x = (float)events[i].params[0]; break;
-                    CORE.Input.Mouse.currentWheelMove.y = (float)events[i].params[1]; break;
-                } break;
-                case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[events[i].params[0]] = false; break;            // param[0]: id
-                case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[events[i].params[0]] = true; break;           // param[0]: id
-                case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
-                {
-                    CORE.Input.Touch.position[events[i].params[0]].x = (float)events[i].params[1];
-                    CORE.Input.Touch.position[events[i].params[0]].y = (float)events[i].params[2];
-                } break;
-                case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = true; break;                // param[0]: gamepad
-                case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = false; break;            // param[0]: gamepad
-                case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = false; break;    // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = true; break;   // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
-                {
-                    CORE.Input.Gamepad.axisState[events[i].params[0]][events[i].params[1]] = ((float)events[i].params[2]/32768.0f);
-                } break;
-                case INPUT_GESTURE: GESTURES.current = events[i].params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
-
-                // Window events
-                case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
-                case WINDOW_MAXIMIZE: MaximizeWindow(); break;
-                case WINDOW_MINIMIZE: MinimizeWindow(); break;
-                case WINDOW_RESIZE: SetWindowSize(events[i].params[0], events[i].params[1]); break;
-
-                // Custom events
-                case ACTION_TAKE_SCREENSHOT:
-                {
-                    TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-                    screenshotCounter++;
-                } break;
-                case ACTION_SETTARGETFPS: SetTargetFPS(events[i].params[0]); break;
-                default: break;
-            }
+                CORE.Input.Mouse.currentPosition.x = (float)params[0];
+                CORE.Input.Mouse.currentPosition.y = (float)params[1];
+            } break;
+            case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
+            {
+                CORE.Input.Mouse.currentWheelMove.x = (float)params[0];
+                CORE.Input.Mouse.currentWheelMove.y = (float)params[1];
+            } break;
+            case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[params[0]] = false; break;            // param[0]: id
+            case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[params[0]] = true; break;           // param[0]: id
+            case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
+            {
+                CORE.Input.Touch.position[params[0]].x = (float)params[1];
+                CORE.Input.Touch.position[params[0]].y = (float)params[2];
+            } break;
+            case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[params[0]] = true; break;                // param[0]: gamepad
+            case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[params[0]] = false; break;            // param[0]: gamepad
+            case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[params[0]][params[1]] = false; break;    // param[0]: gamepad, param[1]: button
+            case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[params[0]][params[1]] = true; break;   // param[0]: gamepad, param[1]: button
+            case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
+            {
+                CORE.Input.Gamepad.axisState[params[0]][params[1]] = ((float)params[2]/32768.0f);
+            } break;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+            case INPUT_GESTURE: GESTURES.current = params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
+#endif
+            // Window events
+            case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
+            case WINDOW_MAXIMIZE: MaximizeWindow(); break;
+            case WINDOW_MINIMIZE: MinimizeWindow(); break;
+            case WINDOW_RESIZE: SetWindowSize(params[0], params[1]); break;
+
+            // Custom events
+            case ACTION_TAKE_SCREENSHOT:
+            {
+                TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                screenshotCounter++;
+            } break;
+            case ACTION_SETTARGETFPS: SetTargetFPS(params[0]); break;
+            default: break;
         }
     }
+
+    // Read next frame block header, playing finishes at end of file
+    unsigned int frames = 0;
+
+    if (valid && ReadAutomationBlockFrames(&frames)) automation.blockFrame += frames;
+    else
+    {
+        if (!valid) TRACELOG(LOG_WARNING, "AUTOMATION: Automation events file data not valid");
+        StopAutomationEventPlaying();
+    }
 }
-#endif
+#endif  // SUPPORT_EVENTS_AUTOMATION
 
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
@@ -7678,8 +11011,8 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
@@ -133,3 +133,14 @@
     #include "external/glfw/src/egl_context.c"
     #include "external/glfw/src/osmesa_context.c"
 #endif
+
+// Null platform: window, monitor and input state with no window system (headless)
+// NOTE: Only required by software renderer, its frames are not presented to a window
+#if defined(GRAPHICS_API_SOFTWARE)
+    #include "external/glfw/src/null_init.c"
+    #include "external/glfw/src/null_monitor.c"
+    #include "external/glfw/src/null_window.c"
+    #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(__DragonFly__)
+        #include "external/glfw/src/null_joystick.c"
+    #endif
+#endif
@@ -30,6 +30,10 @@
 *       Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *       required by any other module, use rlGetVersion() to check it
 *
+*   #define GRAPHICS_API_SOFTWARE
+*       Use software renderer (external/rlsw.h), no GPU required, OpenGL 1.1 code path is used
+*       Rendering result is only available reading framebuffer pixels (rlReadScreenPixels())
+*
 *   #define RLGL_IMPLEMENTATION
 *       Generates the implementation of the library into the included file.
 *       If not defined, the library is in header only mode and can be included in other headers
@@ -52,9 +56,15 @@
 *   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *   #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *   #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*   #define RL_DEFAULT_BATCH_LAYOUT               0    // Default render batch vertex layout (0: separate arrays, 1: interleaved)
+*   #define RL_DEFAULT_BATCH_STREAM_BUFFERS       0    // Default render batch streaming VBO size (in batch buffers), 0 disables streaming
+*   #define RL_DEFAULT_BATCH_TEXTURE_SLOTS        8    // Maximum number of textures by draw call on texture batching (rlEnableTextureBatching())
 *
 *   #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
+*   #define RL_MAX_BATCH_STREAM_UPLOADS           8    // Maximum number of render batch streamed uploads tracked
 *   #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*   #define RL_MAX_UNIFORM_CACHE_ENTRIES        512    // Maximum number of uniform values tracked by state cache (skip redundant uploads)
+*   #define RL_MAX_CACHED_TEXTURE_UNITS          16    // Maximum number of texture units bindings tracked by state cache
 *   #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *   #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -66,6 +76,8 @@
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL       "vertexNormal"      // Bound by default to shader location: 2
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID       "vertexDrawId"      // Bound by default to shader location: 7
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -129,6 +141,12 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Profiler zones, defined by raylib (utils.h) if profiler supported
+#ifndef PROFILE_ZONE_BEGIN
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
 // Allow custom memory allocators
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)     malloc(sz)
@@ -144,6 +162,11 @@
 #endif
 
 // Security check in case no GRAPHICS_API_OPENGL_* defined
+// Software renderer implements OpenGL 1.1 functionality
+#if defined(GRAPHICS_API_SOFTWARE)
+    #define GRAPHICS_API_OPENGL_11
+#endif
+
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
     !defined(GRAPHICS_API_OPENGL_33) && \
@@ -210,17 +233,39 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_LAYOUT
+    #define RL_DEFAULT_BATCH_LAYOUT                  0      // Default render batch vertex layout (rlBatchLayout)
+#endif
+#ifndef RL_DEFAULT_BATCH_STREAM_BUFFERS
+    #define RL_DEFAULT_BATCH_STREAM_BUFFERS          0      // Default render batch streaming VBO size (in batch buffers), 0 disables streaming
+#endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+    #define RL_DEFAULT_BATCH_TEXTURE_SLOTS           8      // Maximum number of textures by draw call on texture batching (rlEnableTextureBatching())
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
     #define RL_MAX_MATRIX_STACK_SIZE                32      // Maximum size of Matrix stack
 #endif
 
+// Render batch streaming uploads tracked to skip unchanged vertex data upload
+#ifndef RL_MAX_BATCH_STREAM_UPLOADS
+    #define RL_MAX_BATCH_STREAM_UPLOADS              8      // Maximum number of render batch streamed uploads tracked
+#endif
+
 // Shader limits
 #ifndef RL_MAX_SHADER_LOCATIONS
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// State cache limits, redundant GL state changes and uniform uploads are skipped
+#ifndef RL_MAX_UNIFORM_CACHE_ENTRIES
+    #define RL_MAX_UNIFORM_CACHE_ENTRIES           512      // Maximum number of uniform values tracked (power of two)
+#endif
+#ifndef RL_MAX_CACHED_TEXTURE_UNITS
+    #define RL_MAX_CACHED_TEXTURE_UNITS             16      // Maximum number of texture units bindings tracked
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -333,21 +378,44 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// Interleaved batch vertex (position + texcoord + color in a single struct, 24 bytes)
+typedef struct rlBatchVertex {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    float u, v;                 // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+} rlBatchVertex;
+
+// Render batch streamed vertex data upload
+typedef struct rlBatchUpload {
+    int offset;                 // Vertex data position in GPU vertex buffers (in vertex)
+    int count;                  // Vertex data count (in vertex)
+    int size;                   // Vertex data size (in bytes), all vertex buffers
+    unsigned long long hash;    // Vertex data hash, used to skip unchanged data upload (0 if not hashed)
+} rlBatchUpload;
+
+// Dynamic vertex buffers (position + texcoords + colors arrays)
+// NOTE: Quads indices are not stored per buffer, all render batches share a static index buffer (vboId[3])
+// NOTE: With RL_BATCH_LAYOUT_INTERLEAVED, vertex data is stored in [interleaved] and
+// vertices/texcoords/colors arrays are not allocated (NULL)
+// NOTE: Texture slots (texture batching) are stored in a separate array for both layouts,
+// only allocated on OpenGL 3.3+ (NULL on OpenGL ES 2.0)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#endif
+    rlBatchVertex *interleaved; // Vertex data interleaved (position + texcoord + color), only for interleaved layout
+    unsigned char *texslots;    // Vertex texture slot, draw call texture used by the vertex (1 component per vertex) (shader-location = 6)
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (3 types of vertex data + shared quads indices + texture slots, interleaved layout uses vboId[0] + vboId[3] + vboId[4])
+
+    int streamCapacity;         // Streaming: GPU vertex buffers capacity (in vertex), 0 if streaming disabled
+    int streamOffset;           // Streaming: GPU vertex buffers next write position (in vertex)
+    int drawOffset;             // Streaming: Vertex data position to be drawn from GPU vertex buffers (in vertex)
+    int uploadCounter;          // Streaming: Uploads counter since GPU vertex buffers storage orphaning
+    unsigned char *streamData;  // Streaming: Vertex data of hashed uploads (CPU copy at upload offset), compared on hash match
+    rlBatchUpload uploads[RL_MAX_BATCH_STREAM_UPLOADS]; // Streaming: Latest uploads, still available on GPU vertex buffers (least recently used first)
 } rlVertexBuffer;
 
 // Draw call type
@@ -361,6 +429,8 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int textureCount;           // Number of textures used by the draw, textureId + textureSlots (texture batching only)
+    unsigned int textureSlots[RL_DEFAULT_BATCH_TEXTURE_SLOTS - 1]; // Additional textures ids used by the draw, selected per vertex (texture batching only)
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -370,6 +440,7 @@ typedef struct rlDrawCall {
 typedef struct rlRenderBatch {
     int bufferCount;            // Number of vertex buffers (multi-buffering support)
     int currentBuffer;          // Current buffer tracking in case of multi-buffering
+    int layout;                 // Vertex buffers layout (rlBatchLayout)
     rlVertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
@@ -377,13 +448,49 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Render batch record, CPU only vertex data and draw calls
+// NOTE: Filled from any thread with rlRecord*() functions (no GL calls), submitted on main thread
+typedef struct rlBatchRecord {
+    rlBatchVertex *vertices;    // Recorded vertex data (position + texcoord + color)
+    int vertexCount;            // Recorded vertex count
+    int vertexCapacity;         // Vertex data capacity, it grows when required
+
+    rlDrawCall *draws;          // Recorded draw calls (mode, vertexCount, textureId)
+    int drawCount;              // Recorded draw calls count
+    int drawCapacity;           // Draw calls capacity, it grows when required
+
+    int mode;                   // Current drawing mode: RL_LINES, RL_TRIANGLES, RL_QUADS
+    unsigned int textureId;     // Current texture id (0 for default texture)
+    float texcoordx, texcoordy; // Current texture coordinates
+    unsigned char colorr, colorg, colorb, colora; // Current color
+    float currentDepth;         // Current depth value for next draw
+} rlBatchRecord;
+
+// Render statistics
+// NOTE: Accumulated since last rlResetRenderStats()
+typedef struct rlRenderStats {
+    unsigned int batchUploads;      // Number of render batch vertex data uploads to GPU
+    unsigned int batchUploadSkips;  // Number of render batch vertex data uploads skipped (data unchanged, streaming only)
+    unsigned int batchOrphans;      // Number of render batch streaming buffers orphaned (buffer full)
+    unsigned int bytesUploaded;     // Render batch vertex data uploaded to GPU (in bytes)
+    unsigned int drawCalls;         // Number of render batch draw calls submitted to GPU
+    unsigned int drawCallsMerged;   // Number of render batch draw calls removed by merging (draw merging only)
+    unsigned int vertexCount;       // Number of vertex submitted on render batch draws
+    unsigned int batchFlushes;      // Number of render batch draws forced by batch limits (vertex or draw calls)
+    unsigned int textureBinds;      // Number of textures bound for render batch draw calls
+    unsigned int bufferBytesUploaded;   // Vertex buffers data updated with rlUpdateVertexBuffer*() (in bytes)
+    unsigned int textureBytesUploaded;  // Texture data uploaded with rlLoadTexture()/rlUpdateTexture() (in bytes)
+    unsigned int callsElided;       // Number of redundant GL calls skipped by state cache (state changes, bindings, uniforms)
+} rlRenderStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
     RL_OPENGL_21,               // OpenGL 2.1 (GLSL 120)
     RL_OPENGL_33,               // OpenGL 3.3 (GLSL 330)
     RL_OPENGL_43,               // OpenGL 4.3 (using GLSL 330)
-    RL_OPENGL_ES_20             // OpenGL ES 2.0 (GLSL 100)
+    RL_OPENGL_ES_20,            // OpenGL ES 2.0 (GLSL 100)
+    RL_OPENGL_SOFTWARE          // Software renderer (OpenGL 1.1 functionality)
 } rlGlVersion;
 
 // Trace log level
@@ -476,7 +583,8 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,          // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,       // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,        // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF              // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_VERTEX_DRAWID         // Shader location: vertex attribute: draw id (mesh list)
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE       RL_SHADER_LOC_MAP_ALBEDO
@@ -536,6 +644,12 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Render batch vertex buffers layout
+typedef enum {
+    RL_BATCH_LAYOUT_SEPARATE = 0,       // Separate arrays and VBOs for position, texcoords and colors
+    RL_BATCH_LAYOUT_INTERLEAVED         // Single array of rlBatchVertex, uploaded to one VBO
+} rlBatchLayout;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -633,6 +747,7 @@ RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo rende
 
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
+RLAPI void rlFinish(void);                              // Finish all pending rendering commands (blocking)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
@@ -646,10 +761,12 @@ RLAPI void rlglInit(int width, int height);             // Initialize rlgl (buff
 RLAPI void rlglClose(void);                             // De-initialize rlgl (buffers, shaders, textures)
 RLAPI void rlLoadExtensions(void *loader);              // Load OpenGL extensions (loader function required)
 RLAPI int rlGetVersion(void);                           // Get current OpenGL version
+RLAPI const char *rlGetDriverInfo(void);                // Get graphics driver info string (vendor, renderer and version)
 RLAPI void rlSetFramebufferWidth(int width);            // Set current framebuffer width
 RLAPI int rlGetFramebufferWidth(void);                  // Get default framebuffer width
 RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuffer height
 RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuffer height
+RLAPI void rlResizeFramebuffer(int width, int height);  // Resize default framebuffer (only required by software renderer)
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
@@ -659,14 +776,42 @@ RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader lo
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int layout); // Load a render batch system with defined vertex layout (rlBatchLayout)
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI void rlEnableRenderBatchStreaming(rlRenderBatch *batch, int streamBuffers); // Enable render batch streaming, VBOs sized to streamBuffers batch buffers
+RLAPI void rlDisableRenderBatchStreaming(rlRenderBatch *batch);             // Disable render batch streaming
+RLAPI void rlEnableDrawMerging(void);                   // Enable render batch draw calls merging (by mode and texture), assumes 2D drawing
+RLAPI void rlDisableDrawMerging(void);                  // Disable render batch draw calls merging
+RLAPI bool rlIsDrawMergingEnabled(void);                // Check if render batch draw calls merging is enabled
+RLAPI void rlEnableTextureBatching(void);               // Enable render batch texture batching (several textures by draw call, default shader only)
+RLAPI void rlDisableTextureBatching(void);              // Disable render batch texture batching
+RLAPI bool rlIsTextureBatchingEnabled(void);            // Check if render batch texture batching is enabled
+
+RLAPI rlRenderStats rlGetRenderStats(void);             // Get render statistics, accumulated since last reset
+RLAPI void rlResetRenderStats(void);                    // Reset render statistics
+RLAPI void rlResetStateCache(void);                     // Reset GL state cache, required after GL state changed outside rlgl
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Render batch recording
+// NOTE: Records are CPU only (no GL calls), every record can be filled from a different thread,
+// recorded vertex are not transformed by current matrix, submit is required on main thread
+RLAPI rlBatchRecord rlLoadBatchRecord(int vertexCapacity);  // Load a render batch record (CPU only)
+RLAPI void rlUnloadBatchRecord(rlBatchRecord record);       // Unload render batch record
+RLAPI void rlResetBatchRecord(rlBatchRecord *record);       // Reset render batch record data and state
+RLAPI void rlRecordBegin(rlBatchRecord *record, int mode);  // Initialize recording drawing mode (how to organize vertex)
+RLAPI void rlRecordEnd(rlBatchRecord *record);              // Finish recording vertex providing
+RLAPI void rlRecordSetTexture(rlBatchRecord *record, unsigned int id);  // Set recording current texture (0 for default texture)
+RLAPI void rlRecordVertex2f(rlBatchRecord *record, float x, float y);   // Record one vertex (position), current depth used as z
+RLAPI void rlRecordVertex3f(rlBatchRecord *record, float x, float y, float z); // Record one vertex (position)
+RLAPI void rlRecordTexCoord2f(rlBatchRecord *record, float x, float y); // Set recording current texture coordinate
+RLAPI void rlRecordColor4ub(rlBatchRecord *record, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Set recording current color
+RLAPI void rlSubmitBatchRecords(rlBatchRecord *records, int count); // Submit render batch records into current batch, in array order (main thread)
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -684,6 +829,8 @@ RLAPI void rlDrawVertexArray(int offset, int count);
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer);
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances);
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances);
+RLAPI void rlDrawVertexArrayElementsBaseVertex(int offset, int count, const void *buffer, int baseVertex);  // Draw vertex array elements, indices added to base vertex (requires OpenGL 3.3)
+RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int commandsId, int offset, int drawCount);          // Draw vertex array elements, several draws from indirect commands buffer (requires OpenGL 4.3)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
@@ -696,6 +843,10 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadReadbackBuffer(int width, int height);           // Load pixel buffer for asynchronous screen readback (0 if not supported)
+RLAPI void rlUnloadReadbackBuffer(unsigned int id);                       // Unload pixel buffer for asynchronous screen readback
+RLAPI void rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Start screen pixel data readback into pixel buffer, GPU copy not waited
+RLAPI bool rlGetReadbackPixels(unsigned int id, int width, int height, unsigned char *pixels); // Get pixel buffer readback data (RGBA, rows bottom to top), waits if not completed
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -705,9 +856,13 @@ RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Del
 
 // Shaders management
 RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
+RLAPI unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode); // Load shader from code strings, compilation not waited (check with rlCheckShaderProgram())
+RLAPI int rlCheckShaderProgram(unsigned int id);                                // Check shader program compilation: 0 (pending), 1 (ready) or -1 (failed)
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, int *format); // Get shader program binary data (driver specific), NULL if not supported
+RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, int format); // Load shader program from binary data, 0 if rejected by driver
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
@@ -760,7 +915,14 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
 #if defined(RLGL_IMPLEMENTATION)
 
-#if defined(GRAPHICS_API_OPENGL_11)
+#if defined(GRAPHICS_API_SOFTWARE)
+    #define RLSW_MALLOC RL_MALLOC
+    #define RLSW_REALLOC RL_REALLOC
+    #define RLSW_FREE RL_FREE
+
+    #define RLSW_IMPLEMENTATION
+    #include "external/rlsw.h"      // OpenGL 1.1 software renderer, no GPU required
+#elif defined(GRAPHICS_API_OPENGL_11)
     #if defined(__APPLE__)
         #include <OpenGL/gl.h>          // OpenGL 1.1 library for OSX
         #include <OpenGL/glext.h>       // OpenGL extensions library
@@ -813,8 +975,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy(), memmove(), memset()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stdio.h>                      // Required for: snprintf() [Used in rlLoadShaderBatch()]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -874,6 +1037,16 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
 #endif
 
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH            0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS       0x87FE
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR            0x91B1
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
     #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
@@ -910,6 +1083,12 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID       "vertexDrawId"      // Bound by default to shader location: 7
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -939,10 +1118,33 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// State cache tracked render states
+#define RL_STATE_BLEND                   0      // Color blending enabled
+#define RL_STATE_DEPTH_TEST              1      // Depth test enabled
+#define RL_STATE_DEPTH_MASK              2      // Depth write enabled
+#define RL_STATE_CULL_FACE               3      // Face culling enabled
+#define RL_STATE_CULL_FACE_MODE          4      // Face culling mode (RL_CULL_FACE_BACK, RL_CULL_FACE_FRONT)
+#define RL_STATE_SCISSOR_TEST            5      // Scissor test enabled
+#define RL_STATE_COUNT                   6
+
+#define RL_STATE_UNKNOWN_ID     0xffffffff      // State cache unknown binding (shader program or texture)
+#define RL_UNIFORM_CACHE_SIZE           64      // State cache uniform value maximum size (in bytes), fits a Matrix
+
+// Render batch streaming vertex data copy size by vertex (in bytes): position, texcoord, color and texture slot
+#define RL_BATCH_STREAM_VERTEX_SIZE     (sizeof(rlBatchVertex) + 1)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Uniform value uploaded, tracked by state cache
+typedef struct rlUniformCache {
+    unsigned int program;                   // Shader program id (0 if entry not used)
+    int location;                           // Uniform location
+    int size;                               // Uniform value size (in bytes)
+    unsigned char value[RL_UNIFORM_CACHE_SIZE]; // Uniform value data
+} rlUniformCache;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -991,6 +1193,27 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        unsigned int quadIndexBufferId;     // Render batches shared quads index buffer id (6 indices per quad)
+        int quadIndexElements;              // Render batches shared quads index buffer size (in quads)
+        int quadIndexType;                  // Render batches shared quads index buffer type (GL_UNSIGNED_SHORT, GL_UNSIGNED_INT)
+        int quadIndexUsers;                 // Render batches vertex buffers using shared quads index buffer
+
+        bool drawMerging;                   // Render batch draw calls merging flag
+        void *mergeBuffer;                  // Render batch draw calls merging vertex data scratch buffer
+        int mergeBufferSize;                // Render batch draw calls merging scratch buffer size (in bytes)
+
+        bool textureBatching;               // Render batch texture batching flag
+        int textureSlots;                   // Texture batching maximum textures by draw call (limited by texture units)
+        int currentTextureSlot;             // Current draw call texture slot (added on glVertex*())
+        unsigned int batchShaderId;         // Texture batching shader program id, default shader sampling several textures
+        int *batchShaderLocs;               // Texture batching shader locations pointer
+
+        unsigned int cacheProgram;          // State cache: shader program in use (RL_STATE_UNKNOWN_ID if unknown)
+        int cacheTextureUnit;               // State cache: texture unit active (-1 if unknown)
+        unsigned int cacheTextures[RL_MAX_CACHED_TEXTURE_UNITS]; // State cache: 2D texture bound by texture unit (RL_STATE_UNKNOWN_ID if unknown)
+        int cacheStates[RL_STATE_COUNT];    // State cache: render states values (-1 if unknown)
+        rlUniformCache cacheUniforms[RL_MAX_UNIFORM_CACHE_ENTRIES]; // State cache: uniform values uploaded, by program and location
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1008,11 +1231,15 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool programBinary;                 // Shader program binaries support (GL_ARB_get_program_binary, GL_OES_get_program_binary)
+        bool parallelCompile;               // Shaders compilation status can be polled (GL_KHR_parallel_shader_compile, GL_ARB_parallel_shader_compile)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+
+    rlRenderStats stats;                    // Render statistics
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1036,6 +1263,10 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: Program binaries functionality is exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1044,11 +1275,30 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlUploadRenderBatchData(unsigned int vboId, int offset, int size, const void *data, bool unsynchronized); // Upload render batch vertex data to GPU buffer
+static void rlSetRenderBatchAttribs(rlVertexBuffer *buffer, int layout, int vertexOffset); // Set render batch vertex attributes pointers, starting at vertex offset
+static void rlSetRenderBatchStorage(rlVertexBuffer *buffer, int layout, int vertexCount, int usage); // Set render batch GPU vertex buffers storage (previous data discarded)
+static unsigned int rlLoadQuadIndexBuffer(int elements);   // Load render batches shared quads index buffer (grown if required)
+static void rlUnloadQuadIndexBuffer(void);  // Unload render batches shared quads index buffer (once not used)
+static unsigned long long rlGetDataHash(const void *data, int size, unsigned long long hash); // Get data hash (FNV-1a on 64 bit words)
+static int rlGetRenderBatchData(rlVertexBuffer *buffer, int layout, int vertexCount, const void **data, int *sizes); // Get render batch vertex data arrays to be uploaded, returns arrays count
+static int rlMergeRenderBatchDraws(rlRenderBatch *batch, int drawCount);   // Merge render batch draw calls sharing mode and texture
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlLoadShaderBatch(void);        // Load texture batching shader (default shader sampling several textures)
+#endif
+static int rlGetDrawTextureSlot(rlDrawCall *draw, unsigned int id);         // Get draw call texture slot for a texture id (-1 if not used)
+static void rlUseProgram(unsigned int id);  // Use shader program (skipped if already in use)
+static void rlActiveTexture(int unit);      // Select active texture unit (skipped if already active)
+static bool rlCheckUniformCache(int location, const void *value, int size); // Check uniform value against state cache, stored if changed (returns true if upload can be skipped)
+static void rlUnloadUniformCache(unsigned int program);  // Remove shader program uniform values from state cache
+static void rlSetShaderProgramDefaults(unsigned int program);   // Set shader program default attribute locations and hints, required before linking
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static void rlBindTexture2D(unsigned int id);   // Bind 2D texture to active texture unit (skipped if already bound)
+static bool rlCheckStateCache(int state, int value);    // Check render state against state cache, stored if changed (returns true if GL call can be skipped)
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
 // Auxiliar matrix math functions
@@ -1349,11 +1599,22 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            // Try merging draw calls before forcing a batch draw
+            if (RLGL.State.drawMerging) RLGL.currentBatch->drawCounter = rlMergeRenderBatchDraws(RLGL.currentBatch, RLGL.currentBatch->drawCounter - 1) + 1;
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                rlDrawRenderBatch(RLGL.currentBatch);
+                RLGL.stats.batchFlushes++;
+            }
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
+        RLGL.State.currentTextureSlot = 0;
     }
 }
 
@@ -1407,6 +1668,32 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+    // Add current texture slot (texture batching)
+    if (RLGL.State.textureBatching && (buffer->texslots != NULL)) buffer->texslots[RLGL.State.vertexCounter] = (unsigned char)RLGL.State.currentTextureSlot;
+
+    if (buffer->interleaved != NULL)
+    {
+        // Add vertex position, texcoord and color in a single struct write
+        rlBatchVertex *vertex = &buffer->interleaved[RLGL.State.vertexCounter];
+
+        vertex->x = tx;
+        vertex->y = ty;
+        vertex->z = tz;
+        vertex->u = RLGL.State.texcoordx;
+        vertex->v = RLGL.State.texcoordy;
+        vertex->r = RLGL.State.colorr;
+        vertex->g = RLGL.State.colorg;
+        vertex->b = RLGL.State.colorb;
+        vertex->a = RLGL.State.colora;
+
+        RLGL.State.vertexCounter++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+
+        return;
+    }
+
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1498,6 +1785,7 @@ void rlSetTexture(unsigned int id)
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
             rlDrawRenderBatch(RLGL.currentBatch);
+            RLGL.stats.batchFlushes++;
         }
 #endif
     }
@@ -1506,7 +1794,30 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        // Texture batching: texture is added to current draw call textures if possible,
+        // vertex select the texture to sample by texture slot, no new draw call is required
+        // NOTE: Only supported by default shader, texture batching shader replaces it on drawing
+        if (RLGL.State.textureBatching && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) &&
+            (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0))
+        {
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            int slot = rlGetDrawTextureSlot(draw, id);
+
+            if ((slot == -1) && (draw->textureCount < RLGL.State.textureSlots))
+            {
+                slot = draw->textureCount;
+                draw->textureSlots[slot - 1] = id;
+                draw->textureCount++;
+            }
+
+            if (slot != -1)
+            {
+                RLGL.State.currentTextureSlot = slot;
+                return;
+            }
+        }
+
+        if ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id) || (RLGL.State.currentTextureSlot != 0))
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
@@ -1527,10 +1838,21 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                // Try merging draw calls before forcing a batch draw
+                if (RLGL.State.drawMerging) RLGL.currentBatch->drawCounter = rlMergeRenderBatchDraws(RLGL.currentBatch, RLGL.currentBatch->drawCounter - 1) + 1;
+                if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+                {
+                    rlDrawRenderBatch(RLGL.currentBatch);
+                    RLGL.stats.batchFlushes++;
+                }
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.State.currentTextureSlot = 0;
         }
 #endif
     }
@@ -1540,7 +1862,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlActiveTexture(slot);
 #endif
 }
 
@@ -1550,7 +1872,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 }
 
 // Disable texture
@@ -1559,7 +1881,7 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 }
 
 // Enable texture cubemap
@@ -1581,7 +1903,7 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1623,7 +1945,7 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1674,15 +1996,16 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlUseProgram(id);
 #endif
 }
 
 // Disable shader program
+// NOTE: No program left in use (required by external OpenGL code), skipped if already disabled (state cache)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlUseProgram(0);
 #endif
 }
 
@@ -1739,33 +2062,37 @@ void rlActiveDrawBuffers(int count)
 // General render state configuration
 //----------------------------------------------------------------------------------
 
+// NOTE: Render states are tracked by state cache, setting a state already set is skipped
+
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { if (!rlCheckStateCache(RL_STATE_BLEND, 1)) glEnable(GL_BLEND); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { if (!rlCheckStateCache(RL_STATE_BLEND, 0)) glDisable(GL_BLEND); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { if (!rlCheckStateCache(RL_STATE_DEPTH_TEST, 1)) glEnable(GL_DEPTH_TEST); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { if (!rlCheckStateCache(RL_STATE_DEPTH_TEST, 0)) glDisable(GL_DEPTH_TEST); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { if (!rlCheckStateCache(RL_STATE_DEPTH_MASK, 1)) glDepthMask(GL_TRUE); }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { if (!rlCheckStateCache(RL_STATE_DEPTH_MASK, 0)) glDepthMask(GL_FALSE); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { if (!rlCheckStateCache(RL_STATE_CULL_FACE, 1)) glEnable(GL_CULL_FACE); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { if (!rlCheckStateCache(RL_STATE_CULL_FACE, 0)) glDisable(GL_CULL_FACE); }
 
 // Set face culling mode
 void rlSetCullFace(int mode)
 {
+    if (rlCheckStateCache(RL_STATE_CULL_FACE_MODE, mode)) return;
+
     switch (mode)
     {
         case RL_CULL_FACE_BACK: glCullFace(GL_BACK); break;
@@ -1775,10 +2102,10 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { if (!rlCheckStateCache(RL_STATE_SCISSOR_TEST, 1)) glEnable(GL_SCISSOR_TEST); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { if (!rlCheckStateCache(RL_STATE_SCISSOR_TEST, 0)) glDisable(GL_SCISSOR_TEST); }
 
 // Scissor test
 void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
@@ -1873,6 +2200,13 @@ void rlClearScreenBuffers(void)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
 
+// Finish all pending rendering commands (blocking)
+// NOTE: Software renderer rasterizes all binned primitives
+void rlFinish(void)
+{
+    glFinish();
+}
+
 // Check and log OpenGL error codes
 void rlCheckErrors()
 {
@@ -1932,6 +2266,7 @@ void rlSetBlendMode(int mode)
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
     }
+    else RLGL.stats.callsElided++;
 #endif
 }
 
@@ -2057,7 +2392,16 @@ void rlglInit(int width, int height)
     }
 #endif
 
+#if defined(GRAPHICS_API_SOFTWARE)
+    // Init software renderer context (default framebuffer)
+    if (swInit(width, height)) TRACELOG(RL_LOG_INFO, "RLGL: Software renderer initialized successfully (%i x %i)", width, height);
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Failed to initialize software renderer");
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init state cache, GL state unknown
+    rlResetStateCache();
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2072,8 +2416,11 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    RLGL.defaultBatch = rlLoadRenderBatchEx(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_DEFAULT_BATCH_LAYOUT);
     RLGL.currentBatch = &RLGL.defaultBatch;
+#if (RL_DEFAULT_BATCH_STREAM_BUFFERS > 0)
+    rlEnableRenderBatchStreaming(&RLGL.defaultBatch, RL_DEFAULT_BATCH_STREAM_BUFFERS);
+#endif
 
     // Init stack matrices (emulating OpenGL 1.1)
     for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = rlMatrixIdentity();
@@ -2133,11 +2480,27 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    RL_FREE(RLGL.State.mergeBuffer);  // Unload draw calls merging scratch buffer
+    RLGL.State.mergeBuffer = NULL;
+    RLGL.State.mergeBufferSize = 0;
+
     rlUnloadShaderDefault();          // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    if (RLGL.State.batchShaderId > 0)
+    {
+        rlUnloadShaderProgram(RLGL.State.batchShaderId);   // Unload texture batching shader
+        RL_FREE(RLGL.State.batchShaderLocs);
+        RLGL.State.batchShaderId = 0;
+        RLGL.State.batchShaderLocs = NULL;
+    }
+
+    rlUnloadTexture(RLGL.State.defaultTextureId);   // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    swClose();                        // Unload software renderer context
+#endif
 }
 
 // Load OpenGL extensions
@@ -2189,6 +2552,19 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.programBinary = GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary;    // Program binaries: core since OpenGL 4.1
+
+    #if !defined(GRAPHICS_API_OPENGL_21)
+    // Check parallel shaders compilation support
+    // NOTE: Extension only adds a compilation status query, not included in glad
+    for (int i = 0; i < numExt; i++)
+    {
+        const char *extName = (const char *)glGetStringi(GL_EXTENSIONS, i);
+
+        if ((strcmp(extName, (const char *)"GL_KHR_parallel_shader_compile") == 0) ||
+            (strcmp(extName, (const char *)"GL_ARB_parallel_shader_compile") == 0)) RLGL.ExtSupported.parallelCompile = true;
+    }
+    #endif
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2270,6 +2646,18 @@ void rlLoadExtensions(void *loader)
             }
         }
 
+        // Check parallel shaders compilation support
+        if (strcmp(extList[i], (const char *)"GL_KHR_parallel_shader_compile") == 0) RLGL.ExtSupported.parallelCompile = true;
+
+        // Check program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+        }
+
         // Check NPOT textures support
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
@@ -2331,6 +2719,14 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // NOTE: Program binaries are only usable if driver provides some binary format
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if (formatCount == 0) RLGL.ExtSupported.programBinary = false;
+    }
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2377,6 +2773,8 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
+    if (RLGL.ExtSupported.parallelCompile) TRACELOG(RL_LOG_INFO, "GL: Parallel shaders compilation supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2386,7 +2784,9 @@ void rlLoadExtensions(void *loader)
 int rlGetVersion(void)
 {
     int glVersion = 0;
-#if defined(GRAPHICS_API_OPENGL_11)
+#if defined(GRAPHICS_API_SOFTWARE)
+    glVersion = RL_OPENGL_SOFTWARE;
+#elif defined(GRAPHICS_API_OPENGL_11)
     glVersion = RL_OPENGL_11;
 #endif
 #if defined(GRAPHICS_API_OPENGL_21)
@@ -2403,6 +2803,19 @@ int rlGetVersion(void)
     return glVersion;
 }
 
+// Get graphics driver info string (vendor, renderer and version)
+// NOTE: Useful to identify driver specific data, i.e. shader program binaries
+const char *rlGetDriverInfo(void)
+{
+    static char info[512] = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    snprintf(info, 512, "%s, %s, %s", (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION));
+#endif
+
+    return info;
+}
+
 // Set current framebuffer width
 void rlSetFramebufferWidth(int width)
 {
@@ -2439,6 +2852,15 @@ int rlGetFramebufferHeight(void)
     return height;
 }
 
+// Resize default framebuffer
+// NOTE: Only software renderer owns the default framebuffer memory, OpenGL framebuffer is managed by platform
+void rlResizeFramebuffer(int width, int height)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    if (!swResize(width, height)) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to resize software renderer framebuffer (%i x %i)", width, height);
+#endif
+}
+
 // Get default internal texture (white texture)
 // NOTE: Default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
 unsigned int rlGetTextureIdDefault(void)
@@ -2474,9 +2896,26 @@ int *rlGetShaderLocsDefault(void)
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchEx(numBuffers, bufferElements, RL_BATCH_LAYOUT_SEPARATE);
+}
+
+// Load render batch with defined vertex layout
+// NOTE: Interleaved layout stores position, texcoord and color per vertex in a single
+// array (rlBatchVertex), requiring only one VBO and one upload per batch draw
+rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int layout)
 {
     rlRenderBatch batch = { 0 };
 
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // Quads indices are 16 bit (up to 65536 vertex), batch elements clamped to not wrap around indices
+    if (bufferElements > 16384)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Render batch elements (%i) exceed 16 bit indices limit, clamped to 16384 quads", bufferElements);
+        bufferElements = 16384;
+    }
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
@@ -2485,44 +2924,52 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].vertices = NULL;
+        batch.vertexBuffer[i].texcoords = NULL;
+        batch.vertexBuffer[i].colors = NULL;
+        batch.vertexBuffer[i].interleaved = NULL;
+        batch.vertexBuffer[i].texslots = NULL;
+        batch.vertexBuffer[i].vboId[4] = 0;
+        batch.vertexBuffer[i].streamCapacity = 0;
+        batch.vertexBuffer[i].streamOffset = 0;
+        batch.vertexBuffer[i].drawOffset = 0;
+        batch.vertexBuffer[i].uploadCounter = 0;
+        batch.vertexBuffer[i].streamData = NULL;
+
+        if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+        {
+            batch.vertexBuffer[i].interleaved = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));    // 4 vertex by quad
+        }
+        else
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
 #if defined(GRAPHICS_API_OPENGL_33)
-        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
+        // Texture slots, only used on texture batching
+        batch.vertexBuffer[i].texslots = (unsigned char *)RL_CALLOC(bufferElements*4, sizeof(unsigned char));  // 1 byte by vertex, 4 vertex by quad
 #endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
-#endif
-
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
-        int k = 0;
-
-        // Indices can be initialized right now
-        for (int j = 0; j < (6*bufferElements); j += 6)
-        {
-            batch.vertexBuffer[i].indices[j] = 4*k;
-            batch.vertexBuffer[i].indices[j + 1] = 4*k + 1;
-            batch.vertexBuffer[i].indices[j + 2] = 4*k + 2;
-            batch.vertexBuffer[i].indices[j + 3] = 4*k;
-            batch.vertexBuffer[i].indices[j + 4] = 4*k + 2;
-            batch.vertexBuffer[i].indices[j + 5] = 4*k + 3;
-
-            k++;
-        }
 
         RLGL.State.vertexCounter = 0;
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in RAM (CPU)");
+    // NOTE: Vertex data size is the same for both layouts (position + texcoord + color, 4 vertex by quad)
+    int vertexBufferSize = bufferElements*4*sizeof(rlBatchVertex);
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in RAM (CPU) [%i buffers, %i KB]", numBuffers, numBuffers*vertexBufferSize/1024);
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
     //--------------------------------------------------------------------------------------------
+    // Load (or grow) quads index buffer shared by all batches vertex buffers
+    unsigned int quadIndexBufferId = rlLoadQuadIndexBuffer(bufferElements);
+
     for (int i = 0; i < numBuffers; i++)
     {
         if (RLGL.ExtSupported.vao)
@@ -2532,40 +2979,61 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+        {
+            // Quads - Single interleaved vertex buffer, attributes defined by stride and offset
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].interleaved, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
 
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (batch.vertexBuffer[i].texslots != NULL)
+        {
+            // Vertex texture slot buffer (shader-location = 6)
+            // NOTE: Attribute is only enabled when drawing with texture batching shader
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].texslots, GL_DYNAMIC_DRAW);
+            glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+        }
 
-        // Fill index buffer
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        // Shared quads index buffer
+        batch.vertexBuffer[i].vboId[3] = quadIndexBufferId;
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-#if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
+        RLGL.State.quadIndexUsers++;
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU) [%i buffers, %i KB]", numBuffers, numBuffers*vertexBufferSize/1024);
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2583,11 +3051,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].textureCount = 1;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
 
     batch.bufferCount = numBuffers;    // Record buffer count
+    batch.layout = layout;             // Record vertex buffers layout
     batch.drawCounter = 1;             // Reset draws counter
     batch.currentDepth = -1.0f;         // Reset depth value
     //--------------------------------------------------------------------------------------------
@@ -2615,14 +3085,19 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
+            glDisableVertexAttribArray(6);
             glBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Unused VBOs on interleaved layout are 0, silently ignored by glDeleteBuffers()
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+
+        // Shared quads index buffer is deleted once not used by any batch
+        rlUnloadQuadIndexBuffer();
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
@@ -2631,7 +3106,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
-        RL_FREE(batch.vertexBuffer[i].indices);
+        RL_FREE(batch.vertexBuffer[i].interleaved);
+        RL_FREE(batch.vertexBuffer[i].texslots);
+        RL_FREE(batch.vertexBuffer[i].streamData);
     }
 
     // Unload arrays
@@ -2645,47 +3122,153 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    PROFILE_ZONE_BEGIN("rlDrawRenderBatch");
+
+    // Merge batch draw calls sharing mode and texture, if enabled
+    if (RLGL.State.drawMerging && (RLGL.State.vertexCounter > 0)) batch->drawCounter = rlMergeRenderBatchDraws(batch, batch->drawCounter);
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-    // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        bool streaming = (buffer->streamCapacity > 0);
+        bool upload = true;
+
+        if (streaming)
+        {
+            // Check if vertex data changed since latest uploads
+            // NOTE: Static scenes redrawn every frame fill the batch with exactly the same data,
+            // vertex data is only hashed if some latest upload has the same vertex count (could be the same data),
+            // uploads not hashed are registered with hash 0, static data is skipped from its third upload
+            int uploadsCount = (buffer->uploadCounter < RL_MAX_BATCH_STREAM_UPLOADS)? buffer->uploadCounter : RL_MAX_BATCH_STREAM_UPLOADS;
+            unsigned long long hash = 0;
+
+            const void *data[4] = { 0 };
+            int sizes[4] = { 0 };
+            int dataCount = rlGetRenderBatchData(buffer, batch->layout, RLGL.State.vertexCounter, data, sizes);
+            int dataSize = 0;
+            for (int k = 0; k < dataCount; k++) dataSize += sizes[k];
+
+            for (int i = 0; i < uploadsCount; i++)
+            {
+                if (buffer->uploads[i].count == RLGL.State.vertexCounter)
+                {
+                    hash = 0xcbf29ce484222325ULL;
+                    break;
+                }
+            }
+
+            if (hash != 0)
+            {
+                for (int k = 0; k < dataCount; k++) hash = rlGetDataHash(data[k], sizes[k], hash);
+
+                // Look for the same vertex data on latest uploads, still available in GPU buffers
+                // NOTE: Hash match is confirmed comparing vertex data with the upload copy, hash collisions are
+                // never drawn with the wrong data; upload found is moved to most recently used, data reused
+                // every frame is never dropped
+                for (int i = 0; i < uploadsCount; i++)
+                {
+                    if ((buffer->uploads[i].count == RLGL.State.vertexCounter) && (buffer->uploads[i].size == dataSize) && (buffer->uploads[i].hash == hash))
+                    {
+                        const unsigned char *copy = buffer->streamData + (size_t)buffer->uploads[i].offset*RL_BATCH_STREAM_VERTEX_SIZE;
+                        bool equal = true;
+
+                        for (int k = 0; (k < dataCount) && equal; k++)
+                        {
+                            equal = (memcmp(copy, data[k], sizes[k]) == 0);
+                            copy += sizes[k];
+                        }
+
+                        if (!equal) continue;
+
+                        rlBatchUpload reused = buffer->uploads[i];
+                        memmove(&buffer->uploads[i], &buffer->uploads[i + 1], (uploadsCount - i - 1)*sizeof(rlBatchUpload));
+                        buffer->uploads[uploadsCount - 1] = reused;
+
+                        buffer->drawOffset = reused.offset;
+                        upload = false;
+                        break;
+                    }
+                }
+            }
+
+            if (!upload) RLGL.stats.batchUploadSkips++;
+            else
+            {
+                // Append vertex data after previous uploads, buffer storage is orphaned when full
+                // NOTE: Orphaning (glBufferData() with NULL) provides new storage immediately,
+                // previous storage is released by the driver once the GPU is done with it
+                if ((buffer->streamOffset + RLGL.State.vertexCounter) > buffer->streamCapacity)
+                {
+                    rlSetRenderBatchStorage(buffer, batch->layout, buffer->streamCapacity, GL_STREAM_DRAW);
+
+                    buffer->streamOffset = 0;
+                    buffer->uploadCounter = 0;
+                    RLGL.stats.batchOrphans++;
+                }
+
+                // Register upload as most recently used, least recently used one dropped if required
+                // NOTE: Uploads are kept from least to most recently used
+                int index = buffer->uploadCounter;
+
+                if (index >= RL_MAX_BATCH_STREAM_UPLOADS)
+                {
+                    memmove(&buffer->uploads[0], &buffer->uploads[1], (RL_MAX_BATCH_STREAM_UPLOADS - 1)*sizeof(rlBatchUpload));
+                    index = RL_MAX_BATCH_STREAM_UPLOADS - 1;
+                }
+
+                rlBatchUpload *record = &buffer->uploads[index];
+                record->offset = buffer->streamOffset;
+                record->count = RLGL.State.vertexCounter;
+                record->size = dataSize;
+                record->hash = hash;
+                buffer->uploadCounter++;
+
+                // Hashed uploads vertex data copied, required to confirm hash matches
+                if (hash != 0)
+                {
+                    unsigned char *copy = buffer->streamData + (size_t)buffer->streamOffset*RL_BATCH_STREAM_VERTEX_SIZE;
+
+                    for (int k = 0; k < dataCount; k++)
+                    {
+                        memcpy(copy, data[k], sizes[k]);
+                        copy += sizes[k];
+                    }
+                }
+
+                buffer->drawOffset = buffer->streamOffset;
+                buffer->streamOffset += RLGL.State.vertexCounter;
+            }
+        }
+
+        if (upload)
+        {
+            // NOTE: glMapBuffer() causes sync issue.
+            // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
+            // Streaming mode avoids it: data is appended to a buffer range not used by the GPU and
+            // mapped unsynchronized, buffer storage is orphaned with glBufferData() NULL when full
+            int offset = streaming? buffer->drawOffset : 0;
+
+            if (batch->layout == RL_BATCH_LAYOUT_INTERLEAVED)
+            {
+                // Interleaved vertex buffer, all vertex data updated at once
+                rlUploadRenderBatchData(buffer->vboId[0], offset*sizeof(rlBatchVertex), RLGL.State.vertexCounter*sizeof(rlBatchVertex), buffer->interleaved, streaming);
+            }
+            else
+            {
+                // Vertex positions, texture coordinates and colors buffers
+                rlUploadRenderBatchData(buffer->vboId[0], offset*3*sizeof(float), RLGL.State.vertexCounter*3*sizeof(float), buffer->vertices, streaming);
+                rlUploadRenderBatchData(buffer->vboId[1], offset*2*sizeof(float), RLGL.State.vertexCounter*2*sizeof(float), buffer->texcoords, streaming);
+                rlUploadRenderBatchData(buffer->vboId[2], offset*4*sizeof(unsigned char), RLGL.State.vertexCounter*4*sizeof(unsigned char), buffer->colors, streaming);
+            }
+
+            // Vertex texture slots buffer, only required on texture batching
+            if (RLGL.State.textureBatching && (buffer->texslots != NULL)) rlUploadRenderBatchData(buffer->vboId[4], offset*sizeof(unsigned char), RLGL.State.vertexCounter*sizeof(unsigned char), buffer->texslots, streaming);
+
+            RLGL.stats.batchUploads++;
+        }
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2713,8 +3296,26 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Draw buffers
         if (RLGL.State.vertexCounter > 0)
         {
+            unsigned int shaderId = RLGL.State.currentShaderId;
+            int *shaderLocs = RLGL.State.currentShaderLocs;
+
+            // Texture batching shader replaces default shader if any draw call uses several textures
+            // NOTE: Texture slots are only assigned while default shader is active (rlSetTexture())
+            bool textureSlots = false;
+
+            if (RLGL.State.textureBatching)
+            {
+                for (int i = 0; i < batch->drawCounter; i++) if (batch->draws[i].textureCount > 1) textureSlots = true;
+            }
+
+            if (textureSlots)
+            {
+                shaderId = RLGL.State.batchShaderId;
+                shaderLocs = RLGL.State.batchShaderLocs;
+            }
+
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlUseProgram(shaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2724,32 +3325,32 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
                 matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
             };
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+            if (!rlCheckUniformCache(shaderLocs[RL_SHADER_LOC_MATRIX_MVP], matMVPfloat, sizeof(matMVPfloat))) glUniformMatrix4fv(shaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
+            // NOTE: On streaming mode, vertex attributes point to the last uploaded vertex data position
+            bool streaming = (batch->vertexBuffer[batch->currentBuffer].streamCapacity > 0);
+            int vertexBase = streaming? batch->vertexBuffer[batch->currentBuffer].drawOffset : 0;
+
+            if (RLGL.ExtSupported.vao)
+            {
+                glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+                if (streaming) rlSetRenderBatchAttribs(&batch->vertexBuffer[batch->currentBuffer], batch->layout, vertexBase);
+            }
+            else rlSetRenderBatchAttribs(&batch->vertexBuffer[batch->currentBuffer], batch->layout, vertexBase);
+
+            // Vertex texture slot attribute only enabled for texture batching shader
+            if (batch->vertexBuffer[batch->currentBuffer].texslots != NULL)
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+                if (textureSlots) glEnableVertexAttribArray(6);
+                else glDisableVertexAttribArray(6);
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            // NOTE: Values already uploaded for the shader are skipped (state cache)
+            float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int texture0 = 0;
+            if (!rlCheckUniformCache(shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colDiffuse, sizeof(colDiffuse))) glUniform4fv(shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1, colDiffuse);
+            if (!textureSlots && !rlCheckUniformCache(shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &texture0, sizeof(int))) glUniform1i(shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], texture0);  // Active default sampler2D: texture0
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -2757,32 +3358,48 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlActiveTexture(1 + i);
+                    rlBindTexture2D(RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlActiveTexture(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Bind draw call additional textures (texture batching), bound to texture units 1..textureCount-1
+                if (batch->draws[i].textureCount > 1)
+                {
+                    for (int s = 1; s < batch->draws[i].textureCount; s++)
+                    {
+                        rlActiveTexture(s);
+                        rlBindTexture2D(batch->draws[i].textureSlots[s - 1]);
+                        RLGL.stats.textureBinds++;
+                    }
+
+                    rlActiveTexture(0);
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlBindTexture2D(batch->draws[i].textureId);
+                RLGL.stats.textureBinds++;
+
+                if (batch->draws[i].vertexCount > 0)
+                {
+                    RLGL.stats.drawCalls++;
+                    RLGL.stats.vertexCount += batch->draws[i].vertexCount;
+                }
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
                 {
-#if defined(GRAPHICS_API_OPENGL_33)
                     // We need to define the number of indices to be processed: elementCount*6
                     // NOTE: The final parameter tells the GPU the offset in bytes from the
                     // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
-#endif
+                    size_t indexSize = (RLGL.State.quadIndexType == GL_UNSIGNED_INT)? sizeof(GLuint) : sizeof(GLushort);
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, RLGL.State.quadIndexType, (GLvoid *)(vertexOffset/4*6*indexSize));
                 }
 
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
@@ -2794,12 +3411,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlBindTexture2D(0);     // Unbind textures
         }
 
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlUseProgram(0);    // Unbind shader program
     }
 
     // Restore viewport to default measures
@@ -2824,8 +3441,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].textureCount = 1;
     }
 
+    // Reset texture slot for next batch
+    RLGL.State.currentTextureSlot = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -2836,6 +3457,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+    PROFILE_ZONE_END();
 #endif
 }
 
@@ -2874,7 +3497,11 @@ bool rlCheckRenderBatchLimit(int vCount)
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
 
+        // NOTE: On texture batching, current texture is the one used by current texture slot
+        if (RLGL.State.currentTextureSlot > 0) currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[RLGL.State.currentTextureSlot - 1];
+
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+        RLGL.stats.batchFlushes++;
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
@@ -2885,37 +3512,420 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Enable render batch streaming
+// NOTE: GPU vertex buffers are resized to [streamBuffers] times the batch buffer size, successive
+// batch draws append vertex data instead of updating it from the start, unchanged data is not uploaded
+void rlEnableRenderBatchStreaming(rlRenderBatch *batch, int streamBuffers)
 {
-    unsigned int id = 0;
-
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (streamBuffers < 1) streamBuffers = 1;
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    for (int i = 0; i < batch->bufferCount; i++)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
+        batch->vertexBuffer[i].streamCapacity = batch->vertexBuffer[i].elementCount*4*streamBuffers;
+        batch->vertexBuffer[i].streamOffset = 0;
+        batch->vertexBuffer[i].drawOffset = 0;
+        batch->vertexBuffer[i].uploadCounter = 0;
+
+        // Vertex data copy, same size as GPU vertex buffers
+        RL_FREE(batch->vertexBuffer[i].streamData);
+        batch->vertexBuffer[i].streamData = (unsigned char *)RL_MALLOC((size_t)batch->vertexBuffer[i].streamCapacity*RL_BATCH_STREAM_VERTEX_SIZE);
+
+        rlSetRenderBatchStorage(&batch->vertexBuffer[i], batch->layout, batch->vertexBuffer[i].streamCapacity, GL_STREAM_DRAW);
     }
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch streaming enabled (%i vertex per buffer)", batch->vertexBuffer[0].streamCapacity);
+#endif
+}
+
+// Disable render batch streaming
+void rlDisableRenderBatchStreaming(rlRenderBatch *batch)
+{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    for (int i = 0; i < batch->bufferCount; i++)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
+        if (batch->vertexBuffer[i].streamCapacity == 0) continue;
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+        batch->vertexBuffer[i].streamCapacity = 0;
+        batch->vertexBuffer[i].streamOffset = 0;
+        batch->vertexBuffer[i].drawOffset = 0;
+        batch->vertexBuffer[i].uploadCounter = 0;
+
+        RL_FREE(batch->vertexBuffer[i].streamData);
+        batch->vertexBuffer[i].streamData = NULL;
+
+        rlSetRenderBatchStorage(&batch->vertexBuffer[i], batch->layout, batch->vertexBuffer[i].elementCount*4, GL_DYNAMIC_DRAW);
+
+        // Reset VAO vertex attributes pointers to buffers start
+        if (RLGL.ExtSupported.vao)
+        {
+            glBindVertexArray(batch->vertexBuffer[i].vaoId);
+            rlSetRenderBatchAttribs(&batch->vertexBuffer[i], batch->layout, 0);
+            glBindVertexArray(0);
+        }
+    }
+#endif
+}
+
+// Enable render batch draw calls merging
+// NOTE: Draw calls sharing mode and texture are merged when the batch is drawn or draw calls
+// limit is reached, a draw call is only moved over draw calls not overlapping it, so blending
+// result is preserved; overlap is checked with XY vertex bounds, it is only valid for 2D drawing
+void rlEnableDrawMerging(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawMerging = true;
+#endif
+}
+
+// Disable render batch draw calls merging
+void rlDisableDrawMerging(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawMerging = false;
+#endif
+}
+
+// Check if render batch draw calls merging is enabled
+bool rlIsDrawMergingEnabled(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.drawMerging;
+#else
+    return false;
+#endif
+}
+
+// Enable render batch texture batching
+// NOTE: Up to RL_DEFAULT_BATCH_TEXTURE_SLOTS textures are used by a single draw call, texture is
+// selected per vertex; only available on OpenGL 3.3+ while default shader is active
+void rlEnableTextureBatching(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.textureBatching) return;
+
+    // Texture batching shader loaded on first use
+    if (RLGL.State.batchShaderId == 0) rlLoadShaderBatch();
+
+    if ((RLGL.State.batchShaderId > 0) && (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texslots != NULL))
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);   // Current batch vertex data has no texture slots uploaded
+        RLGL.State.textureBatching = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Texture batching could not be enabled");
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    TRACELOG(RL_LOG_WARNING, "RLGL: Texture batching not supported on OpenGL ES 2.0, one texture by draw call");
+#endif
+}
+
+// Disable render batch texture batching
+void rlDisableTextureBatching(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.textureBatching)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);   // Current batch draw calls could use several textures
+        RLGL.State.textureBatching = false;
+    }
+#endif
+}
+
+// Check if render batch texture batching is enabled
+bool rlIsTextureBatchingEnabled(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.textureBatching;
+#else
+    return false;
+#endif
+}
+
+// Get render statistics, accumulated since last reset
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.stats;
+#endif
+
+    return stats;
+}
+
+// Reset render statistics
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    memset(&RLGL.stats, 0, sizeof(rlRenderStats));
+#endif
+}
+
+// Reset GL state cache, tracked states and uniform values are set as unknown
+// NOTE: Required after changing GL state or uploading uniforms with OpenGL calls not done through rlgl
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.cacheProgram = RL_STATE_UNKNOWN_ID;
+    RLGL.State.cacheTextureUnit = -1;
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_UNITS; i++) RLGL.State.cacheTextures[i] = RL_STATE_UNKNOWN_ID;
+    for (int i = 0; i < RL_STATE_COUNT; i++) RLGL.State.cacheStates[i] = -1;
+    memset(RLGL.State.cacheUniforms, 0, sizeof(RLGL.State.cacheUniforms));
+#endif
+}
+
+// Render batch recording
+//-----------------------------------------------------------------------------------------
+// Load a render batch record (CPU only)
+// NOTE: It can be loaded and filled on any thread, it does not access rlgl global state
+rlBatchRecord rlLoadBatchRecord(int vertexCapacity)
+{
+    rlBatchRecord record = { 0 };
+
+    if (vertexCapacity < 4) vertexCapacity = 4;
+
+    record.vertices = (rlBatchVertex *)RL_MALLOC(vertexCapacity*sizeof(rlBatchVertex));
+    record.vertexCapacity = vertexCapacity;
+    record.draws = (rlDrawCall *)RL_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+    record.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;
+
+    rlResetBatchRecord(&record);
+
+    return record;
+}
+
+// Unload render batch record
+void rlUnloadBatchRecord(rlBatchRecord record)
+{
+    RL_FREE(record.vertices);
+    RL_FREE(record.draws);
+}
+
+// Reset render batch record data and state
+// NOTE: Memory is kept, records can be reused every frame
+void rlResetBatchRecord(rlBatchRecord *record)
+{
+    record->vertexCount = 0;
+    record->drawCount = 0;
+
+    record->mode = RL_QUADS;
+    record->textureId = 0;
+    record->texcoordx = 0.0f;
+    record->texcoordy = 0.0f;
+    record->colorr = 255;
+    record->colorg = 255;
+    record->colorb = 255;
+    record->colora = 255;
+    record->currentDepth = -1.0f;
+}
+
+// Initialize recording drawing mode (how to organize vertex)
+void rlRecordBegin(rlBatchRecord *record, int mode)
+{
+    record->mode = mode;
+}
+
+// Finish recording vertex providing
+void rlRecordEnd(rlBatchRecord *record)
+{
+    // NOTE: Same depth increment than rlEnd()
+    record->currentDepth += (1.0f/20000.0f);
+}
+
+// Set recording current texture (0 for default texture)
+void rlRecordSetTexture(rlBatchRecord *record, unsigned int id)
+{
+    record->textureId = id;
+}
+
+// Record one vertex (position), current depth used as z
+void rlRecordVertex2f(rlBatchRecord *record, float x, float y)
+{
+    rlRecordVertex3f(record, x, y, record->currentDepth);
+}
+
+// Record one vertex (position)
+// NOTE: A new draw call is registered if mode or texture changed since last recorded vertex
+void rlRecordVertex3f(rlBatchRecord *record, float x, float y, float z)
+{
+    if ((record->drawCount == 0) ||
+        (record->draws[record->drawCount - 1].mode != record->mode) ||
+        (record->draws[record->drawCount - 1].textureId != record->textureId))
+    {
+        if (record->drawCount >= record->drawCapacity)
+        {
+            record->drawCapacity *= 2;
+            record->draws = (rlDrawCall *)RL_REALLOC(record->draws, record->drawCapacity*sizeof(rlDrawCall));
+        }
+
+        record->draws[record->drawCount].mode = record->mode;
+        record->draws[record->drawCount].vertexCount = 0;
+        record->draws[record->drawCount].vertexAlignment = 0;
+        record->draws[record->drawCount].textureId = record->textureId;
+        record->drawCount++;
+    }
+
+    if (record->vertexCount >= record->vertexCapacity)
+    {
+        record->vertexCapacity *= 2;
+        record->vertices = (rlBatchVertex *)RL_REALLOC(record->vertices, record->vertexCapacity*sizeof(rlBatchVertex));
+    }
+
+    rlBatchVertex *vertex = &record->vertices[record->vertexCount];
+
+    vertex->x = x;
+    vertex->y = y;
+    vertex->z = z;
+    vertex->u = record->texcoordx;
+    vertex->v = record->texcoordy;
+    vertex->r = record->colorr;
+    vertex->g = record->colorg;
+    vertex->b = record->colorb;
+    vertex->a = record->colora;
+
+    record->vertexCount++;
+    record->draws[record->drawCount - 1].vertexCount++;
+}
+
+// Set recording current texture coordinate
+void rlRecordTexCoord2f(rlBatchRecord *record, float x, float y)
+{
+    record->texcoordx = x;
+    record->texcoordy = y;
+}
+
+// Set recording current color
+void rlRecordColor4ub(rlBatchRecord *record, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    record->colorr = r;
+    record->colorg = g;
+    record->colorb = b;
+    record->colora = a;
+}
+
+// Submit render batch records into current batch, in array order (main thread)
+// NOTE: Recorded vertex data is copied in blocks into current batch, batch is drawn when full
+// (never breaking primitives), records are not reset after submit
+void rlSubmitBatchRecords(rlBatchRecord *records, int count)
+{
+    for (int r = 0; r < count; r++)
+    {
+        rlBatchRecord *record = &records[r];
+
+        for (int i = 0, offset = 0; i < record->drawCount; i++)
+        {
+            rlDrawCall *draw = &record->draws[i];
+
+#if defined(GRAPHICS_API_OPENGL_11)
+            // Replay recorded vertex data through immediate mode
+            rlSetTexture(draw->textureId);
+            rlBegin(draw->mode);
+            for (int v = offset; v < (offset + draw->vertexCount); v++)
+            {
+                rlColor4ub(record->vertices[v].r, record->vertices[v].g, record->vertices[v].b, record->vertices[v].a);
+                rlTexCoord2f(record->vertices[v].u, record->vertices[v].v);
+                rlVertex3f(record->vertices[v].x, record->vertices[v].y, record->vertices[v].z);
+            }
+            rlEnd();
+            rlSetTexture(0);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            // Setup current batch draw call for recorded mode and texture
+            // NOTE: rlBegin() could reset texture and rlSetTexture() could register a new draw call
+            // not keeping current mode, so mode is enforced after both
+            rlBegin(draw->mode);
+            rlSetTexture((draw->textureId == 0)? RLGL.State.defaultTextureId : draw->textureId);
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = draw->mode;
+
+            int primitiveSize = (draw->mode == RL_LINES)? 2 : ((draw->mode == RL_TRIANGLES)? 3 : 4);
+            int remaining = draw->vertexCount - draw->vertexCount%primitiveSize;   // Incomplete primitives not submitted
+            int copied = 0;
+
+            while (remaining > 0)
+            {
+                rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+                // Copy as many full primitives as available batch space allows
+                int chunk = buffer->elementCount*4 - RLGL.State.vertexCounter;
+                if (chunk > remaining) chunk = remaining;
+                chunk -= chunk%primitiveSize;
+
+                if (chunk <= 0)
+                {
+                    // Batch full, draw it keeping current draw call mode and texture
+                    rlCheckRenderBatchLimit(buffer->elementCount*4);
+                    continue;
+                }
+
+                rlBatchVertex *src = &record->vertices[offset + copied];
+
+                if (buffer->interleaved != NULL) memcpy(&buffer->interleaved[RLGL.State.vertexCounter], src, chunk*sizeof(rlBatchVertex));
+                else
+                {
+                    for (int v = 0, k = RLGL.State.vertexCounter; v < chunk; v++, k++)
+                    {
+                        buffer->vertices[3*k] = src[v].x;
+                        buffer->vertices[3*k + 1] = src[v].y;
+                        buffer->vertices[3*k + 2] = src[v].z;
+                        buffer->texcoords[2*k] = src[v].u;
+                        buffer->texcoords[2*k + 1] = src[v].v;
+                        buffer->colors[4*k] = src[v].r;
+                        buffer->colors[4*k + 1] = src[v].g;
+                        buffer->colors[4*k + 2] = src[v].b;
+                        buffer->colors[4*k + 3] = src[v].a;
+                    }
+                }
+
+                if (RLGL.State.textureBatching && (buffer->texslots != NULL)) memset(&buffer->texslots[RLGL.State.vertexCounter], RLGL.State.currentTextureSlot, chunk);
+
+                RLGL.State.vertexCounter += chunk;
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += chunk;
+                remaining -= chunk;
+                copied += chunk;
+            }
+
+            rlEnd();
+#endif
+            offset += draw->vertexCount;
+        }
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSetTexture(0);
+#endif
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    rlBindTexture2D(0);    // Free any old binding
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
     {
         TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
         return id;
@@ -2939,7 +3949,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -2961,6 +3971,9 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 #if !defined(GRAPHICS_API_OPENGL_11)
             else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            if (data != NULL) RLGL.stats.textureBytesUploaded += mipSize;
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_33)
             if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
@@ -3027,7 +4040,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3063,7 +4076,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlBindTexture2D(id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3071,7 +4084,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlBindTexture2D(0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3175,7 +4188,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3183,6 +4196,9 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        RLGL.stats.textureBytesUploaded += rlGetPixelDataSize(width, height, format);
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
@@ -3243,6 +4259,11 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Deleted texture is unbound from all texture units (binding reverts to 0)
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_UNITS; i++) if (RLGL.State.cacheTextures[i] == id) RLGL.State.cacheTextures[i] = 0;
+#endif
 }
 
 // Generate mipmap data for selected texture
@@ -3250,7 +4271,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3271,7 +4292,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3284,7 +4305,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture2D(id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3310,7 +4331,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3324,7 +4345,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer(width, height);
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture2D(0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3371,6 +4392,68 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel buffer for asynchronous screen readback
+// NOTE: Pixel buffer objects (PBO) require OpenGL 2.1, not available on OpenGL ES 2.0
+unsigned int rlLoadReadbackBuffer(int width, int height)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width*height*4, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    TRACELOG(RL_LOG_DEBUG, "PBO: [ID %i] Readback buffer loaded (%ix%i)", id, width, height);
+#endif
+
+    return id;
+}
+
+// Unload pixel buffer for asynchronous screen readback
+void rlUnloadReadbackBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Start screen pixel data readback into pixel buffer, GPU copy not waited
+// NOTE: Pixels must be retrieved with rlGetReadbackPixels() a frame or two later to avoid stalling
+void rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);    // Offset into pixel buffer
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Get pixel buffer readback data (RGBA, rows bottom to top)
+// NOTE: Pixels are copied as read by OpenGL (not flipped, alpha not modified), it waits if readback not completed
+bool rlGetReadbackPixels(unsigned int id, int width, int height, unsigned char *pixels)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+
+    void *data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+
+    if (data != NULL)
+    {
+        memcpy(pixels, data, width*height*4);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        result = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "PBO: [ID %i] Failed to map readback buffer", id);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return result;
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3475,7 +4558,7 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
@@ -3556,6 +4639,7 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.stats.bufferBytesUploaded += dataSize;
 #endif
 }
 
@@ -3566,6 +4650,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.stats.bufferBytesUploaded += dataSize;
 #endif
 }
 
@@ -3635,6 +4720,33 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
 #endif
 }
 
+// Draw vertex array elements, indices added to base vertex
+// NOTE: Base vertex draws not available on OpenGL ES 2.0 and OpenGL 2.1, vertex attributes
+// must be set again at the base vertex offset to draw elements with rlDrawVertexArrayElements()
+void rlDrawVertexArrayElementsBaseVertex(int offset, int count, const void *buffer, int baseVertex)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, baseVertex);
+#else
+    if (baseVertex == 0) glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+    else TRACELOG(RL_LOG_WARNING, "GL: Draw elements with base vertex not supported");
+#endif
+}
+
+// Draw vertex array elements, several draws from indirect commands buffer
+// NOTE: Commands buffer contains drawCount commands (starting at offset) with five unsigned int values:
+// indices count, instances count, first index, base vertex and base instance; indices are unsigned short
+void rlDrawVertexArrayElementsIndirect(unsigned int commandsId, int offset, int drawCount)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandsId);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)(offset*5*sizeof(unsigned int)), drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Multi-draw indirect requires OpenGL 4.3");
+#endif
+}
+
 #if defined(GRAPHICS_API_OPENGL_11)
 // Enable vertex state pointer
 void rlEnableStatePointer(int vertexAttribType, void *buffer)
@@ -3789,28 +4901,155 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     return id;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Load shader from code strings, compilation not waited
+// NOTE: Shaders compilation and program linkage are queued to the driver and status is not checked
+// (checking it waits for the driver), several shaders can be compiled in parallel (GL_KHR_parallel_shader_compile)
+// while the application keeps working, program must be checked with rlCheckShaderProgram() before use
+unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode)
 {
-    unsigned int shader = 0;
+    unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
+    // In case vertex and fragment shader are the default ones, we can just assign the default shader program id
+    if ((vsCode == NULL) && (fsCode == NULL)) return RLGL.State.defaultShaderId;
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
 
-    if (success == GL_FALSE)
+    if (vsCode != NULL)
     {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+        vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShaderId, 1, &vsCode, NULL);
+        glCompileShader(vertexShaderId);
+    }
+
+    if (fsCode != NULL)
+    {
+        fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShaderId, 1, &fsCode, NULL);
+        glCompileShader(fragmentShaderId);
+    }
+
+    id = glCreateProgram();
+
+    // NOTE: Shaders are kept attached until compilation is checked, compilation errors are reported then,
+    // they are flagged for deletion, actually deleted once detached or program unloaded
+    glAttachShader(id, vertexShaderId);
+    glAttachShader(id, fragmentShaderId);
+    if (vertexShaderId != RLGL.State.defaultVShaderId) glDeleteShader(vertexShaderId);
+    if (fragmentShaderId != RLGL.State.defaultFShaderId) glDeleteShader(fragmentShaderId);
+
+    rlSetShaderProgramDefaults(id);
+
+    glLinkProgram(id);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader compilation queued", id);
+#endif
+
+    return id;
+}
+
+// Check shader program compilation: 0 (pending), 1 (ready) or -1 (failed)
+// NOTE: Without GL_KHR_parallel_shader_compile, checking waits for the driver to complete compilation,
+// failed program is not unloaded (program id not reused while checked), it must be unloaded by user
+int rlCheckShaderProgram(unsigned int id)
+{
+    int result = -1;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || !glIsProgram(id)) return -1;
+
+    GLint status = GL_TRUE;
+    if (RLGL.ExtSupported.parallelCompile) glGetProgramiv(id, GL_COMPLETION_STATUS_KHR, &status);
+    if (status == GL_FALSE) return 0;
+
+    // Program compilation completed, attached shaders (if not default ones) are not required anymore
+    // NOTE: Attached shaders were already flagged for deletion, detaching them deletes them
+    GLint shaderCount = 0;
+    unsigned int shaderIds[2] = { 0 };
+    glGetAttachedShaders(id, 2, &shaderCount, shaderIds);
+
+    bool checked = true;        // Program already checked (no custom shaders attached)
+
+    for (int i = 0; i < shaderCount; i++)
+    {
+        if ((shaderIds[i] == RLGL.State.defaultVShaderId) || (shaderIds[i] == RLGL.State.defaultFShaderId)) continue;
+
+        checked = false;
+
+        glGetShaderiv(shaderIds[i], GL_COMPILE_STATUS, &status);
+
+        if (status == GL_FALSE)
+        {
+            int maxLength = 0;
+            glGetShaderiv(shaderIds[i], GL_INFO_LOG_LENGTH, &maxLength);
+
+            if (maxLength > 0)
+            {
+                int length = 0;
+                char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+                glGetShaderInfoLog(shaderIds[i], maxLength, &length, log);
+                TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shaderIds[i], log);
+                RL_FREE(log);
+            }
+        }
+
+        glDetachShader(id, shaderIds[i]);
+    }
+
+    glGetProgramiv(id, GL_LINK_STATUS, &status);
+
+    if (status == GL_FALSE)
+    {
+        if (!checked)
+        {
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", id);
+
+            int maxLength = 0;
+            glGetProgramiv(id, GL_INFO_LOG_LENGTH, &maxLength);
+
+            if (maxLength > 0)
+            {
+                int length = 0;
+                char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+                glGetProgramInfoLog(id, maxLength, &length, log);
+                TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", id, log);
+                RL_FREE(log);
+            }
+        }
+    }
+    else
+    {
+        if (!checked) TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", id);
+        result = 1;
+    }
+#endif
+
+    return result;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    unsigned int shader = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderCode, NULL);
+
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
         #endif
             default: break;
         }
@@ -3858,14 +5097,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glAttachShader(program, fShaderId);
 
     // NOTE: Default attribute shader locations must be Bound before linking
-    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    rlSetShaderProgramDefaults(program);
 
     glLinkProgram(program);
 
@@ -3910,12 +5142,84 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Program in use is unbound before deleting (state cache)
+    if (RLGL.State.cacheProgram == id) rlUseProgram(0);
+    rlUnloadUniformCache(id);
+
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
 }
 
+// Get shader program binary data (driver specific)
+// NOTE: Returned data must be freed by user, binary can only be loaded by same driver and GPU
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize, int *format)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+    *format = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.programBinary || (id == 0)) return NULL;
+
+    GLint length = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (length > 0)
+    {
+        data = (unsigned char *)RL_MALLOC(length);
+
+        GLenum binaryFormat = 0;
+        glGetProgramBinary(id, length, &length, &binaryFormat, data);
+
+        if (length > 0)
+        {
+            *dataSize = length;
+            *format = (int)binaryFormat;
+        }
+        else
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+    }
+
+    if (data == NULL) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to get program binary", id);
+#endif
+
+    return data;
+}
+
+// Load shader program from binary data
+// NOTE: Driver could reject binary (i.e. driver updated), in that case program must be compiled again
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize, int format)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.programBinary || (data == NULL) || (dataSize <= 0)) return 0;
+
+    GLint success = 0;
+    program = glCreateProgram();
+
+    // NOTE: Attribute locations bound before linking are part of program binary
+    glProgramBinary(program, (GLenum)format, data, dataSize);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Program binary rejected by driver", program);
+
+        glDeleteProgram(program);
+        program = 0;
+    }
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", program);
+#endif
+
+    return program;
+}
+
 // Get shader location uniform
 int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
 {
@@ -3946,6 +5250,19 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check uniform value already uploaded for current shader (state cache)
+    int size = 0;
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: case RL_SHADER_UNIFORM_INT: case RL_SHADER_UNIFORM_SAMPLER2D: size = 4; break;
+        case RL_SHADER_UNIFORM_VEC2: case RL_SHADER_UNIFORM_IVEC2: size = 8; break;
+        case RL_SHADER_UNIFORM_VEC3: case RL_SHADER_UNIFORM_IVEC3: size = 12; break;
+        case RL_SHADER_UNIFORM_VEC4: case RL_SHADER_UNIFORM_IVEC4: size = 16; break;
+        default: break;
+    }
+
+    if ((size > 0) && rlCheckUniformCache(locIndex, value, size*count)) return;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -3987,6 +5304,10 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
+
+    // Check uniform value already uploaded for current shader (state cache)
+    if (rlCheckUniformCache(locIndex, matfloat, sizeof(matfloat))) return;
+
     glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
@@ -4004,7 +5325,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int unit = 1 + i;
+            if (!rlCheckUniformCache(locIndex, &unit, sizeof(int))) glUniform1i(locIndex, unit);   // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -4091,7 +5413,7 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
     glGenBuffers(1, &ssbo);
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
     glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
-    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);
+    if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);    // Clear buffer data to 0
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 #endif
 
@@ -4554,11 +5876,226 @@ static void rlLoadShaderDefault(void)
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+// Load texture batching shader, default shader sampling several textures selected per vertex
+// NOTE: Loads: RLGL.State.batchShaderId, RLGL.State.batchShaderLocs, RLGL.State.textureSlots
+// Sampler arrays can only be indexed by constant expressions, texture selection is done by comparison
+static void rlLoadShaderBatch(void)
+{
+    int maxTextureUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+
+    RLGL.State.textureSlots = (maxTextureUnits < RL_DEFAULT_BATCH_TEXTURE_SLOTS)? maxTextureUnits : RL_DEFAULT_BATCH_TEXTURE_SLOTS;
+
+    const char *batchVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
+#else
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader generated for available texture slots
+    // NOTE: Texture sampling out of non-uniform control flow (slot is not uniform across the draw),
+    // implicit derivatives are undefined inside a branch: every slot is sampled and selected (GLSL 120)
+    // or derivatives are computed first and sampled with explicit gradients (GLSL 330)
+    char batchFShaderCode[4096] = { 0 };
+    int length = 0;
+
+#if defined(GRAPHICS_API_OPENGL_21)
+    length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length,
+        "#version 120\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\nvarying float fragTexSlot;\n"
+        "uniform sampler2D textures[%i];\nuniform vec4 colDiffuse;\n"
+        "void main()\n{\n    float slot = floor(fragTexSlot + 0.5);\n    vec4 texelColor = texture2D(textures[0], fragTexCoord);\n", RLGL.State.textureSlots);
+    for (int i = 1; i < RLGL.State.textureSlots; i++) length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length,
+        "    texelColor = mix(texelColor, texture2D(textures[%i], fragTexCoord), step(abs(slot - %i.0), 0.5));\n", i, i);
+    length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length, "    gl_FragColor = texelColor*colDiffuse*fragColor;\n}\n");
+#else
+    length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length,
+        "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nin float fragTexSlot;\nout vec4 finalColor;\n"
+        "uniform sampler2D textures[%i];\nuniform vec4 colDiffuse;\n"
+        "void main()\n{\n    int slot = int(fragTexSlot + 0.5);\n    vec2 dx = dFdx(fragTexCoord);\n    vec2 dy = dFdy(fragTexCoord);\n"
+        "    vec4 texelColor = textureGrad(textures[0], fragTexCoord, dx, dy);\n", RLGL.State.textureSlots);
+    for (int i = 1; i < RLGL.State.textureSlots; i++) length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length,
+        "    if (slot == %i) texelColor = textureGrad(textures[%i], fragTexCoord, dx, dy);\n", i, i);
+    length += snprintf(batchFShaderCode + length, sizeof(batchFShaderCode) - length, "    finalColor = texelColor*colDiffuse*fragColor;\n}\n");
+#endif
+
+    // NOTE: Default shaders are not used as fallback, texture batching is not enabled on failure
+    unsigned int vShaderId = rlCompileShader(batchVShaderCode, GL_VERTEX_SHADER);
+    unsigned int fShaderId = rlCompileShader(batchFShaderCode, GL_FRAGMENT_SHADER);
+
+    if ((vShaderId > 0) && (fShaderId > 0)) RLGL.State.batchShaderId = rlLoadShaderProgram(vShaderId, fShaderId);
+
+    if (RLGL.State.batchShaderId > 0)
+    {
+        glDetachShader(RLGL.State.batchShaderId, vShaderId);
+        glDetachShader(RLGL.State.batchShaderId, fShaderId);
+    }
+
+    if (vShaderId > 0) glDeleteShader(vShaderId);
+    if (fShaderId > 0) glDeleteShader(fShaderId);
+
+    if (RLGL.State.batchShaderId > 0)
+    {
+        RLGL.State.batchShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.batchShaderLocs[i] = -1;
+
+        RLGL.State.batchShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.batchShaderId, "mvp");
+        RLGL.State.batchShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.batchShaderId, "colDiffuse");
+        RLGL.State.batchShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.batchShaderId, "textures");
+
+        // Texture slots sampler array bound to texture units 0..textureSlots-1
+        int units[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_TEXTURE_SLOTS; i++) units[i] = i;
+
+        rlUseProgram(RLGL.State.batchShaderId);
+        glUniform1iv(RLGL.State.batchShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RLGL.State.textureSlots, units);
+        rlUseProgram(0);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Texture batching shader loaded successfully (%i texture slots)", RLGL.State.batchShaderId, RLGL.State.textureSlots);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load texture batching shader");
+}
+#endif
+
+// Get draw call texture slot for a texture id, -1 if texture is not used by the draw call
+static int rlGetDrawTextureSlot(rlDrawCall *draw, unsigned int id)
+{
+    if (draw->textureId == id) return 0;
+
+    for (int i = 1; i < draw->textureCount; i++) if (draw->textureSlots[i - 1] == id) return i;
+
+    return -1;
+}
+
+// Use shader program, skipped if program is already in use (state cache)
+static void rlUseProgram(unsigned int id)
+{
+    if (RLGL.State.cacheProgram == id) RLGL.stats.callsElided++;
+    else
+    {
+        glUseProgram(id);
+        RLGL.State.cacheProgram = id;
+    }
+}
+
+// Select active texture unit, skipped if unit is already active (state cache)
+static void rlActiveTexture(int unit)
+{
+    if (RLGL.State.cacheTextureUnit == unit) RLGL.stats.callsElided++;
+    else
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        RLGL.State.cacheTextureUnit = unit;
+    }
+}
+
+// Check uniform value against state cache for current program, returns true if value is already uploaded
+// NOTE: Value is stored if changed, uniform values are tracked by program and location on a
+// fixed size table, an entry is replaced if no free space is found near its hash position
+static bool rlCheckUniformCache(int location, const void *value, int size)
+{
+    unsigned int program = RLGL.State.cacheProgram;
+
+    // Uniforms not found on shader (location -1) are ignored by GL, nothing to track
+    if ((location < 0) || (program == 0) || (program == RL_STATE_UNKNOWN_ID)) return false;
+
+    int mask = RL_MAX_UNIFORM_CACHE_ENTRIES - 1;
+    int index = (int)((program*31 + (unsigned int)location) & (unsigned int)mask);
+    rlUniformCache *entry = NULL;
+    rlUniformCache *empty = NULL;
+
+    // Look for program uniform entry, linear probing a few entries
+    for (int i = 0; i < 8; i++)
+    {
+        rlUniformCache *current = &RLGL.State.cacheUniforms[(index + i) & mask];
+
+        if ((current->program == program) && (current->location == location)) { entry = current; break; }
+        if ((current->program == 0) && (empty == NULL)) empty = current;
+    }
+
+    if (size > RL_UNIFORM_CACHE_SIZE)
+    {
+        // Value too big to be tracked, previous value is not valid anymore
+        if (entry != NULL) entry->program = 0;
+        return false;
+    }
+
+    if (entry != NULL)
+    {
+        if ((entry->size == size) && (memcmp(entry->value, value, size) == 0))
+        {
+            RLGL.stats.callsElided++;
+            return true;
+        }
+    }
+    else entry = (empty != NULL)? empty : &RLGL.State.cacheUniforms[index];
+
+    entry->program = program;
+    entry->location = location;
+    entry->size = size;
+    memcpy(entry->value, value, size);
+
+    return false;
+}
+
+// Remove shader program uniform values from state cache
+static void rlUnloadUniformCache(unsigned int program)
+{
+    for (int i = 0; i < RL_MAX_UNIFORM_CACHE_ENTRIES; i++)
+    {
+        if (RLGL.State.cacheUniforms[i].program == program) RLGL.State.cacheUniforms[i].program = 0;
+    }
+}
+
+// Set shader program default attribute locations and hints, required before linking
+static void rlSetShaderProgramDefaults(unsigned int program)
+{
+    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID);
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Hint driver program binary will be retrieved (shader binaries cache)
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+}
+
 // Unload default shader
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlUseProgram(0);
+    rlUnloadUniformCache(RLGL.State.defaultShaderId);
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -4572,6 +6109,390 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Upload render batch vertex data to GPU buffer
+// NOTE: Unsynchronized upload requires the buffer range not being used by any pending draw,
+// streaming mode guarantees it: data is only appended, buffer storage is orphaned when full
+static void rlUploadRenderBatchData(unsigned int vboId, int offset, int size, const void *data, bool unsynchronized)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, vboId);
+
+    RLGL.stats.bytesUploaded += size;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glMapBufferRange() is core on OpenGL 3.0, it could not be available on OpenGL 2.1
+    if (unsynchronized && (glMapBufferRange != NULL))
+    {
+        // Map buffer range without waiting for GPU to finish with the buffer
+        void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+        if (mapped != NULL)
+        {
+            memcpy(mapped, data, size);
+
+            // NOTE: Unmap could fail if buffer data store gets corrupted, upload it again in that case
+            if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE) return;
+        }
+    }
+#endif
+
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+// Set render batch vertex attributes pointers, starting at vertex offset
+// NOTE: Vertex attributes offset allows drawing streamed vertex data with the same
+// index buffer, draws vertex offsets remain relative to the batch start
+static void rlSetRenderBatchAttribs(rlVertexBuffer *buffer, int layout, int vertexOffset)
+{
+    if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+    {
+        // Bind interleaved vertex attribs: position, texcoord, color (shader-location = 0, 1, 3)
+        size_t offset = vertexOffset*sizeof(rlBatchVertex);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offset);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(offset + 3*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(offset + 5*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+    else
+    {
+        // Bind vertex attrib: position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, (void *)(vertexOffset*3*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        // Bind vertex attrib: texcoord (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, (void *)(vertexOffset*2*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        // Bind vertex attrib: color (shader-location = 3)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (void *)(vertexOffset*4*sizeof(unsigned char)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+
+    if (buffer->texslots != NULL)
+    {
+        // Bind vertex attrib: texture slot (shader-location = 6), enabled on drawing if required
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[4]);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, (void *)(vertexOffset*sizeof(unsigned char)));
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+}
+
+// Set render batch GPU vertex buffers storage (previous data discarded)
+// NOTE: Buffers ids do not change, so VAO attributes keep referencing them
+static void rlSetRenderBatchStorage(rlVertexBuffer *buffer, int layout, int vertexCount, int usage)
+{
+    if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(rlBatchVertex), NULL, usage);
+    }
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*3*sizeof(float), NULL, usage);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*2*sizeof(float), NULL, usage);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*4*sizeof(unsigned char), NULL, usage);
+    }
+
+    if (buffer->texslots != NULL)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(unsigned char), NULL, usage);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Load render batches shared quads index buffer, returns buffer id
+// NOTE: Quads indices are the same for all batches, only one static buffer is kept for the largest batch,
+// using 16 bit indices if possible (up to 65536 vertex); buffer id does not change when grown, so
+// existing VAOs keep referencing it
+static unsigned int rlLoadQuadIndexBuffer(int elements)
+{
+    if (elements <= RLGL.State.quadIndexElements) return RLGL.State.quadIndexBufferId;
+
+    // NOTE: OpenGL ES 2.0 batches are limited to 16 bit indices (rlLoadRenderBatchEx())
+    int type = GL_UNSIGNED_SHORT;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((elements*4) > 65536) type = GL_UNSIGNED_INT;
+#endif
+
+    // Indices can be initialized right now, CPU copy is not required after upload
+    int size = elements*6*((type == GL_UNSIGNED_INT)? sizeof(unsigned int) : sizeof(unsigned short));
+    void *indices = RL_MALLOC(size);
+
+    for (int i = 0, k = 0; i < (6*elements); i += 6, k++)
+    {
+        unsigned int quad[6] = { 4*k, 4*k + 1, 4*k + 2, 4*k, 4*k + 2, 4*k + 3 };
+
+        for (int j = 0; j < 6; j++)
+        {
+            if (type == GL_UNSIGNED_INT) ((unsigned int *)indices)[i + j] = quad[j];
+            else ((unsigned short *)indices)[i + j] = (unsigned short)quad[j];
+        }
+    }
+
+    // NOTE: VAO must be unbound to not modify its element array binding
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+
+    if (RLGL.State.quadIndexBufferId == 0) glGenBuffers(1, &RLGL.State.quadIndexBufferId);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.quadIndexBufferId);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    RL_FREE(indices);
+
+    RLGL.State.quadIndexElements = elements;
+    RLGL.State.quadIndexType = type;
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch quads index buffer loaded successfully in VRAM (GPU) [ID %i] [%i quads, %i bit, %i KB] (shared)",
+        RLGL.State.quadIndexBufferId, elements, (type == GL_UNSIGNED_INT)? 32 : 16, size/1024);
+
+    return RLGL.State.quadIndexBufferId;
+}
+
+// Unload render batches shared quads index buffer, once not used by any batch vertex buffer
+static void rlUnloadQuadIndexBuffer(void)
+{
+    if (RLGL.State.quadIndexUsers > 0) RLGL.State.quadIndexUsers--;
+
+    if ((RLGL.State.quadIndexUsers == 0) && (RLGL.State.quadIndexBufferId > 0))
+    {
+        glDeleteBuffers(1, &RLGL.State.quadIndexBufferId);
+
+        RLGL.State.quadIndexBufferId = 0;
+        RLGL.State.quadIndexElements = 0;
+
+        TRACELOG(RL_LOG_INFO, "RLGL: Render batch quads index buffer unloaded successfully from VRAM (GPU)");
+    }
+}
+
+// Get data hash (FNV-1a on 64 bit words)
+// NOTE: Used to detect unchanged render batch vertex data, previous hash can be provided to chain data
+static unsigned long long rlGetDataHash(const void *data, int size, unsigned long long hash)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long word = 0;
+    int i = 0;
+
+    for (; i <= (size - 8); i += 8)
+    {
+        memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word)*0x100000001b3ULL;
+    }
+
+    for (; i < size; i++) hash = (hash ^ bytes[i])*0x100000001b3ULL;
+
+    return hash;
+}
+
+// Get render batch vertex data arrays to be uploaded, returns arrays count
+// NOTE: Same arrays uploaded to GPU vertex buffers, texture slots only required on texture batching;
+// arrays total size is RL_BATCH_STREAM_VERTEX_SIZE by vertex maximum
+static int rlGetRenderBatchData(rlVertexBuffer *buffer, int layout, int vertexCount, const void **data, int *sizes)
+{
+    int count = 0;
+
+    if (layout == RL_BATCH_LAYOUT_INTERLEAVED)
+    {
+        data[count] = buffer->interleaved; sizes[count++] = vertexCount*sizeof(rlBatchVertex);
+    }
+    else
+    {
+        data[count] = buffer->vertices; sizes[count++] = vertexCount*3*sizeof(float);
+        data[count] = buffer->texcoords; sizes[count++] = vertexCount*2*sizeof(float);
+        data[count] = buffer->colors; sizes[count++] = vertexCount*4*sizeof(unsigned char);
+    }
+
+    if (RLGL.State.textureBatching && (buffer->texslots != NULL))
+    {
+        data[count] = buffer->texslots; sizes[count++] = vertexCount*sizeof(unsigned char);
+    }
+
+    return count;
+}
+
+// Merge render batch draw calls sharing mode and texture, returns resulting draw calls count
+// NOTE: Draw calls are processed in order, every draw call is moved back to the latest compatible
+// group only if it does not overlap (XY bounds) any draw call group in between, preserving blending
+// result for 2D drawing; batch vertex data is reordered to keep every group contiguous
+static int rlMergeRenderBatchDraws(rlRenderBatch *batch, int drawCount)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    rlDrawCall *draws = batch->draws;
+
+    int drawsGroup[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };     // Group of every draw call (-1 if empty)
+    int drawsOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // Vertex data offset of every draw call
+    int groupsMode[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    unsigned int groupsTextureId[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int groupsTextureDraw[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };  // Group draw call using several textures (-1 if none)
+    int groupsVertexCount[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    float groupsBounds[RL_DEFAULT_BATCH_DRAWCALLS][4] = { 0 };  // Group vertex bounds: min x, min y, max x, max y
+    int groupCount = 0;
+    int drawsNotEmpty = 0;
+
+    for (int i = 0, offset = 0; i < drawCount; i++)
+    {
+        drawsOffset[i] = offset;
+        drawsGroup[i] = -1;
+        offset += (draws[i].vertexCount + draws[i].vertexAlignment);
+
+        if (draws[i].vertexCount == 0) continue;
+        drawsNotEmpty++;
+
+        // Get draw call vertex bounds
+        float bounds[4] = { 0 };
+
+        for (int v = drawsOffset[i]; v < (drawsOffset[i] + draws[i].vertexCount); v++)
+        {
+            float x = (buffer->interleaved != NULL)? buffer->interleaved[v].x : buffer->vertices[3*v];
+            float y = (buffer->interleaved != NULL)? buffer->interleaved[v].y : buffer->vertices[3*v + 1];
+
+            if ((v == drawsOffset[i]) || (x < bounds[0])) bounds[0] = x;
+            if ((v == drawsOffset[i]) || (y < bounds[1])) bounds[1] = y;
+            if ((v == drawsOffset[i]) || (x > bounds[2])) bounds[2] = x;
+            if ((v == drawsOffset[i]) || (y > bounds[3])) bounds[3] = y;
+        }
+
+        // Look for the latest compatible group, stop on first overlapping group
+        int group = -1;
+
+        for (int g = groupCount - 1; g >= 0; g--)
+        {
+            // NOTE: Draw calls using several textures (texture batching) are never merged
+            if ((groupsMode[g] == draws[i].mode) && (groupsTextureId[g] == draws[i].textureId) &&
+                (groupsTextureDraw[g] == -1) && (draws[i].textureCount <= 1))
+            {
+                group = g;
+                break;
+            }
+
+            // NOTE: Bounds only sharing an edge are not considered overlapping
+            if ((bounds[0] < groupsBounds[g][2]) && (bounds[2] > groupsBounds[g][0]) &&
+                (bounds[1] < groupsBounds[g][3]) && (bounds[3] > groupsBounds[g][1])) break;
+        }
+
+        if (group == -1)
+        {
+            group = groupCount;
+            groupsMode[group] = draws[i].mode;
+            groupsTextureId[group] = draws[i].textureId;
+            groupsTextureDraw[group] = (draws[i].textureCount > 1)? i : -1;
+            groupsVertexCount[group] = 0;
+            for (int k = 0; k < 4; k++) groupsBounds[group][k] = bounds[k];
+            groupCount++;
+        }
+        else
+        {
+            if (bounds[0] < groupsBounds[group][0]) groupsBounds[group][0] = bounds[0];
+            if (bounds[1] < groupsBounds[group][1]) groupsBounds[group][1] = bounds[1];
+            if (bounds[2] > groupsBounds[group][2]) groupsBounds[group][2] = bounds[2];
+            if (bounds[3] > groupsBounds[group][3]) groupsBounds[group][3] = bounds[3];
+        }
+
+        drawsGroup[i] = group;
+        groupsVertexCount[group] += draws[i].vertexCount;
+    }
+
+    // Nothing to merge, keep draw calls unchanged
+    if (groupCount == drawsNotEmpty) return drawCount;
+
+    // Get merged vertex data size, groups aligned to 4 vertex to keep following quads indexing
+    int vertexCount = 0;
+    for (int g = 0; g < groupCount; g++) vertexCount += (groupsVertexCount[g] + (4 - groupsVertexCount[g]%4)%4);
+
+    // NOTE: Aligning a last draw call not aligned yet could exceed buffer limits, skip merging in that case
+    if (vertexCount > buffer->elementCount*4) return drawCount;
+
+    int vertexSize = (buffer->interleaved != NULL)? sizeof(rlBatchVertex) : (3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+    if (RLGL.State.textureBatching && (buffer->texslots != NULL)) vertexSize += sizeof(unsigned char);
+
+    if (RLGL.State.mergeBufferSize < (vertexCount*vertexSize))
+    {
+        RL_FREE(RLGL.State.mergeBuffer);
+        RLGL.State.mergeBuffer = RL_MALLOC(buffer->elementCount*4*vertexSize);
+        RLGL.State.mergeBufferSize = buffer->elementCount*4*vertexSize;
+    }
+
+    // Copy vertex data group by group into scratch buffer and back
+    // NOTE: Scratch buffer data layout for separate arrays: vertices, texcoords, colors (+ texslots)
+    // and for interleaved layout: interleaved (+ texslots)
+    float *vertices = (float *)RLGL.State.mergeBuffer;
+    float *texcoords = vertices + 3*vertexCount;
+    unsigned char *colors = (unsigned char *)(texcoords + 2*vertexCount);
+    rlBatchVertex *interleaved = (rlBatchVertex *)RLGL.State.mergeBuffer;
+    unsigned char *texslots = (buffer->interleaved != NULL)? (unsigned char *)(interleaved + vertexCount) : (colors + 4*vertexCount);
+
+    for (int g = 0, offset = 0; g < groupCount; g++)
+    {
+        for (int i = 0; i < drawCount; i++)
+        {
+            if (drawsGroup[i] != g) continue;
+
+            if (buffer->interleaved != NULL) memcpy(interleaved + offset, buffer->interleaved + drawsOffset[i], draws[i].vertexCount*sizeof(rlBatchVertex));
+            else
+            {
+                memcpy(vertices + 3*offset, buffer->vertices + 3*drawsOffset[i], draws[i].vertexCount*3*sizeof(float));
+                memcpy(texcoords + 2*offset, buffer->texcoords + 2*drawsOffset[i], draws[i].vertexCount*2*sizeof(float));
+                memcpy(colors + 4*offset, buffer->colors + 4*drawsOffset[i], draws[i].vertexCount*4*sizeof(unsigned char));
+            }
+
+            if (RLGL.State.textureBatching && (buffer->texslots != NULL)) memcpy(texslots + offset, buffer->texslots + drawsOffset[i], draws[i].vertexCount*sizeof(unsigned char));
+
+            offset += draws[i].vertexCount;
+        }
+
+        offset += (4 - groupsVertexCount[g]%4)%4;
+    }
+
+    if (buffer->interleaved != NULL) memcpy(buffer->interleaved, interleaved, vertexCount*sizeof(rlBatchVertex));
+    else
+    {
+        memcpy(buffer->vertices, vertices, vertexCount*3*sizeof(float));
+        memcpy(buffer->texcoords, texcoords, vertexCount*2*sizeof(float));
+        memcpy(buffer->colors, colors, vertexCount*4*sizeof(unsigned char));
+    }
+
+    if (RLGL.State.textureBatching && (buffer->texslots != NULL)) memcpy(buffer->texslots, texslots, vertexCount*sizeof(unsigned char));
+
+    // Update draw calls, unused ones are reset
+    // NOTE: Group draw call using several textures is never placed after its group index,
+    // so its additional textures are still available when the group draw call is updated
+    for (int g = 0; g < groupCount; g++)
+    {
+        draws[g].mode = groupsMode[g];
+        draws[g].textureId = groupsTextureId[g];
+        draws[g].textureCount = (groupsTextureDraw[g] != -1)? draws[groupsTextureDraw[g]].textureCount : 1;
+        if ((groupsTextureDraw[g] != -1) && (groupsTextureDraw[g] != g)) memcpy(draws[g].textureSlots, draws[groupsTextureDraw[g]].textureSlots, sizeof(draws[g].textureSlots));
+
+        draws[g].vertexCount = groupsVertexCount[g];
+        draws[g].vertexAlignment = (4 - groupsVertexCount[g]%4)%4;
+    }
+
+    for (int i = groupCount; i < drawCount; i++)
+    {
+        draws[i].mode = RL_QUADS;
+        draws[i].vertexCount = 0;
+        draws[i].vertexAlignment = 0;
+        draws[i].textureId = RLGL.State.defaultTextureId;
+        draws[i].textureCount = 1;
+    }
+
+    RLGL.stats.drawCallsMerged += (drawsNotEmpty - groupCount);
+    RLGL.State.vertexCounter = vertexCount;
+
+    return groupCount;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -4650,6 +6571,45 @@ static char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Bind 2D texture to active texture unit, skipped if texture is already bound (state cache)
+static void rlBindTexture2D(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int unit = RLGL.State.cacheTextureUnit;
+
+    if ((unit >= 0) && (unit < RL_MAX_CACHED_TEXTURE_UNITS))
+    {
+        if (RLGL.State.cacheTextures[unit] == id) RLGL.stats.callsElided++;
+        else
+        {
+            glBindTexture(GL_TEXTURE_2D, id);
+            RLGL.State.cacheTextures[unit] = id;
+        }
+    }
+    else glBindTexture(GL_TEXTURE_2D, id);
+#else
+    glBindTexture(GL_TEXTURE_2D, id);
+#endif
+}
+
+// Check render state against state cache, returns true if state is already set
+// NOTE: State value is stored if changed, GL call is required
+static bool rlCheckStateCache(int state, int value)
+{
+    bool cached = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.cacheStates[state] == value)
+    {
+        RLGL.stats.callsElided++;
+        cached = true;
+    }
+    else RLGL.State.cacheStates[state] = value;
+#endif
+
+    return cached;
+}
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -117,14 +117,6 @@
 
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
-#else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
-#endif
-
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -134,6 +126,9 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_LIST_TRANSFORMS_BINDING
+    #define MESH_LIST_TRANSFORMS_BINDING  0   // Mesh list transforms shader buffer (SSBO) binding point (OpenGL 4.3)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -145,9 +140,14 @@
 //----------------------------------------------------------------------------------
 // ...
 
+#if defined(SUPPORT_ASYNC_LOADING)
+extern bool IsAssetLoadingThread(void);     // [Module: core] Check if current thread is loading an asset asynchronously (GPU work deferred)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+Model LoadModelFile(const char *fileName, bool defaultMesh);    // Load model from file, default cube mesh on failure if requested (required by core)
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
 #endif
@@ -167,8 +167,10 @@ static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount);   // Load M3D animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static const char *GetTexturePathOBJ(const char *basePath, const char *texName);    // Get obj material texture path
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *basePath);  // Process obj materials
 #endif
+static void SetMeshListAttributes(MeshList list, int baseVertex);   // Set mesh list vertex attributes pointers, starting at base vertex
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1032,6 +1034,20 @@ void DrawGrid(int slices, float spacing)
 
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
+{
+    PROFILE_ZONE_BEGIN("LoadModel");
+
+    Model model = LoadModelFile(fileName, true);
+
+    PROFILE_ZONE_END();
+
+    return model;
+}
+
+// Load model from file, default cube mesh generated on failure if requested
+// NOTE: No default mesh: empty model returned (meshCount = 0) on failure or file format not supported
+// WARNING: Required by LoadAssetAsync() and ReloadChangedAssets() [Module: core]
+Model LoadModelFile(const char *fileName, bool defaultMesh)
 {
     Model model = { 0 };
 
@@ -1054,6 +1070,21 @@ Model LoadModel(const char *fileName)
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
 
+    if (!defaultMesh)
+    {
+        // NOTE: Some loaders return empty meshes on invalid data (i.e. OBJ), vertex data required
+        int vertexCount = 0;
+        for (int i = 0; i < model.meshCount; i++) vertexCount += model.meshes[i].vertexCount;
+
+        if (vertexCount == 0)
+        {
+            TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data", fileName);
+            UnloadModel(model);     // Materials could be loaded
+
+            return (Model){ 0 };
+        }
+    }
+
     if (model.meshCount == 0)
     {
         model.meshCount = 1;
@@ -1179,6 +1210,11 @@ BoundingBox GetModelBoundingBox(Model model)
 // Upload vertex data into a VAO (if supported) and VBO
 void UploadMesh(Mesh *mesh, bool dynamic)
 {
+#if defined(SUPPORT_ASYNC_LOADING)
+    // Loading asset asynchronously (LoadAssetAsync()): mesh uploaded to GPU on main thread, vboId not allocated until then
+    if (IsAssetLoadingThread()) return;
+#endif
+
     if (mesh->vaoId > 0)
     {
         // Check if mesh has already been loaded in GPU
@@ -1753,13 +1789,452 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 #endif
 }
 
+// Load mesh list, meshes packed in shared vertex buffers to be drawn together
+// NOTE: Mesh list vertex format includes all vertex attributes available on any mesh, attributes not available
+// on some mesh are filled with default values; meshes vertex data is copied (meshes CPU data required),
+// meshes indices are kept as 16 bit values relative to a base vertex; meshes transforms are set to identity
+MeshList LoadMeshList(const Mesh *meshes, int meshCount)
+{
+    MeshList list = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((meshes == NULL) || (meshCount <= 0)) return list;
+
+    bool hasNormals = false;
+    bool hasColors = false;
+    bool hasTangents = false;
+    bool hasTexcoords2 = false;
+    int vertexCount = 0;
+    int indexCount = 0;
+
+    for (int i = 0; i < meshCount; i++)
+    {
+        if ((meshes[i].vertices == NULL) || ((meshes[i].indices == NULL) && (meshes[i].vertexCount > 65536)))
+        {
+            TRACELOG(LOG_WARNING, "MESH: [%i] Mesh list requires mesh vertex data (not indexed meshes up to 65536 vertices)", i);
+            return list;
+        }
+
+        if (meshes[i].normals != NULL) hasNormals = true;
+        if (meshes[i].colors != NULL) hasColors = true;
+        if (meshes[i].tangents != NULL) hasTangents = true;
+        if (meshes[i].texcoords2 != NULL) hasTexcoords2 = true;
+
+        vertexCount += meshes[i].vertexCount;
+        indexCount += (meshes[i].indices != NULL)? meshes[i].triangleCount*3 : meshes[i].vertexCount;
+    }
+
+    float *vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    float *texcoords = (float *)RL_CALLOC(vertexCount*2, sizeof(float));
+    float *normals = hasNormals? (float *)RL_MALLOC(vertexCount*3*sizeof(float)) : NULL;
+    unsigned char *colors = hasColors? (unsigned char *)RL_MALLOC(vertexCount*4*sizeof(unsigned char)) : NULL;
+    float *tangents = hasTangents? (float *)RL_CALLOC(vertexCount*4, sizeof(float)) : NULL;
+    float *texcoords2 = hasTexcoords2? (float *)RL_CALLOC(vertexCount*2, sizeof(float)) : NULL;
+    unsigned short *indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+    list.meshCount = meshCount;
+    list.vertexCount = vertexCount;
+    list.triangleCount = indexCount/3;
+    list.firstIndex = (int *)RL_MALLOC(meshCount*sizeof(int));
+    list.indexCount = (int *)RL_MALLOC(meshCount*sizeof(int));
+    list.baseVertex = (int *)RL_MALLOC(meshCount*sizeof(int));
+    list.transforms = (Matrix *)RL_MALLOC(meshCount*sizeof(Matrix));
+
+    // Pack meshes vertex data and indices
+    // NOTE: Indices are relative to base vertex, a new base vertex is started when 16 bit indices range is exceeded
+    for (int i = 0, vertexOffset = 0, indexOffset = 0, baseVertex = 0; i < meshCount; i++)
+    {
+        Mesh mesh = meshes[i];
+        int count = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount;
+
+        if ((vertexOffset - baseVertex + mesh.vertexCount) > 65536) baseVertex = vertexOffset;
+
+        memcpy(vertices + vertexOffset*3, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+        if (mesh.texcoords != NULL) memcpy(texcoords + vertexOffset*2, mesh.texcoords, mesh.vertexCount*2*sizeof(float));
+        if (mesh.tangents != NULL) memcpy(tangents + vertexOffset*4, mesh.tangents, mesh.vertexCount*4*sizeof(float));
+        if (mesh.texcoords2 != NULL) memcpy(texcoords2 + vertexOffset*2, mesh.texcoords2, mesh.vertexCount*2*sizeof(float));
+
+        if (hasNormals)
+        {
+            if (mesh.normals != NULL) memcpy(normals + vertexOffset*3, mesh.normals, mesh.vertexCount*3*sizeof(float));
+            else for (int v = 0; v < mesh.vertexCount*3; v++) normals[vertexOffset*3 + v] = 1.0f;
+        }
+
+        if (hasColors)
+        {
+            if (mesh.colors != NULL) memcpy(colors + vertexOffset*4, mesh.colors, mesh.vertexCount*4*sizeof(unsigned char));
+            else memset(colors + vertexOffset*4, 255, mesh.vertexCount*4*sizeof(unsigned char));    // WHITE
+        }
+
+        for (int k = 0; k < count; k++)
+        {
+            int index = (mesh.indices != NULL)? mesh.indices[k] : k;
+            indices[indexOffset + k] = (unsigned short)(vertexOffset - baseVertex + index);
+        }
+
+        list.firstIndex[i] = indexOffset;
+        list.indexCount[i] = count;
+        list.baseVertex[i] = baseVertex;
+        list.transforms[i] = MatrixIdentity();
+
+        vertexOffset += mesh.vertexCount;
+        indexOffset += count;
+    }
+
+    // Upload vertex data, vertex buffers ids stored as mesh ones, draw ids buffer is the last one
+    list.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS + 1, sizeof(unsigned int));
+
+    list.vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(list.vaoId);
+
+    list.vboId[0] = rlLoadVertexBuffer(vertices, vertexCount*3*sizeof(float), false);
+    list.vboId[1] = rlLoadVertexBuffer(texcoords, vertexCount*2*sizeof(float), false);
+    if (hasNormals) list.vboId[2] = rlLoadVertexBuffer(normals, vertexCount*3*sizeof(float), false);
+    if (hasColors) list.vboId[3] = rlLoadVertexBuffer(colors, vertexCount*4*sizeof(unsigned char), false);
+    if (hasTangents) list.vboId[4] = rlLoadVertexBuffer(tangents, vertexCount*4*sizeof(float), false);
+    if (hasTexcoords2) list.vboId[5] = rlLoadVertexBuffer(texcoords2, vertexCount*2*sizeof(float), false);
+    list.vboId[6] = rlLoadVertexBufferElement(indices, indexCount*sizeof(unsigned short), false);
+
+    SetMeshListAttributes(list, 0);
+
+    if (rlGetVersion() == RL_OPENGL_43)
+    {
+        // Draw ids, instanced vertex attribute (shader-location = 7) selected by indirect draw commands base instance,
+        // shader reads mesh transform from transforms shader buffer at draw id
+        float *drawIds = (float *)RL_MALLOC(meshCount*sizeof(float));
+        for (int i = 0; i < meshCount; i++) drawIds[i] = (float)i;
+
+        list.vboId[MAX_MESH_VERTEX_BUFFERS] = rlLoadVertexBuffer(drawIds, meshCount*sizeof(float), false);
+        rlSetVertexAttribute(7, 1, RL_FLOAT, 0, 0, 0);
+        rlSetVertexAttributeDivisor(7, 1);
+        rlEnableVertexAttribute(7);
+
+        // Indirect draw commands: indices count, instances count, first index, base vertex, base instance
+        unsigned int *commands = (unsigned int *)RL_MALLOC(meshCount*5*sizeof(unsigned int));
+
+        for (int i = 0; i < meshCount; i++)
+        {
+            commands[i*5 + 0] = (unsigned int)list.indexCount[i];
+            commands[i*5 + 1] = 1;
+            commands[i*5 + 2] = (unsigned int)list.firstIndex[i];
+            commands[i*5 + 3] = (unsigned int)list.baseVertex[i];
+            commands[i*5 + 4] = (unsigned int)i;
+        }
+
+        list.commandsId = rlLoadShaderBuffer(meshCount*5*sizeof(unsigned int), commands, RL_STATIC_DRAW);
+        list.transformsId = rlLoadShaderBuffer(meshCount*sizeof(float16), NULL, RL_DYNAMIC_DRAW);
+        UpdateMeshListTransforms(list, list.transforms, 0, meshCount);
+
+        RL_FREE(drawIds);
+        RL_FREE(commands);
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    RL_FREE(vertices);
+    RL_FREE(texcoords);
+    RL_FREE(normals);
+    RL_FREE(colors);
+    RL_FREE(tangents);
+    RL_FREE(texcoords2);
+    RL_FREE(indices);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh list loaded successfully (%i meshes, %i vertices, %s)", meshCount, vertexCount, (list.commandsId > 0)? "multi-draw indirect" : "draw by mesh");
+#endif
+
+    return list;
+}
+
+// Unload mesh list from memory (RAM and VRAM)
+void UnloadMeshList(MeshList list)
+{
+    rlUnloadVertexArray(list.vaoId);
+
+    if (list.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS + 1; i++) rlUnloadVertexBuffer(list.vboId[i]);
+    RL_FREE(list.vboId);
+
+    if (list.commandsId > 0) rlUnloadShaderBuffer(list.commandsId);
+    if (list.transformsId > 0) rlUnloadShaderBuffer(list.transformsId);
+
+    RL_FREE(list.firstIndex);
+    RL_FREE(list.indexCount);
+    RL_FREE(list.baseVertex);
+    RL_FREE(list.transforms);
+}
+
+// Update mesh list meshes transforms, starting at mesh offset
+void UpdateMeshListTransforms(MeshList list, const Matrix *transforms, int offset, int count)
+{
+    if ((offset < 0) || (count <= 0) || ((offset + count) > list.meshCount))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to update mesh list transforms, out of bounds");
+        return;
+    }
+
+    if (transforms != (list.transforms + offset)) memcpy(list.transforms + offset, transforms, count*sizeof(Matrix));
+
+    if (list.transformsId > 0)
+    {
+        // Transforms shader buffer contains float16 arrays, read as mat4 by shader
+        float16 *data = (float16 *)RL_MALLOC(count*sizeof(float16));
+        for (int i = 0; i < count; i++) data[i] = MatrixToFloatV(list.transforms[offset + i]);
+
+        rlUpdateShaderBuffer(list.transformsId, data, count*sizeof(float16), offset*sizeof(float16));
+        RL_FREE(data);
+    }
+}
+
+// Draw all mesh list meshes with material and meshes transforms
+// NOTE: Meshes are drawn with a single multi-draw indirect call on OpenGL 4.3 if material shader provides
+// vertex attribute draw id (vertexDrawId), meshes transforms must be read by shader from a shader buffer:
+//     layout(std430, binding = 0) readonly buffer transformsBuffer { mat4 transforms[]; };
+// Otherwise, meshes are drawn one by one with shared vertex buffers bound once (same uniforms as DrawMesh())
+void DrawMeshList(MeshList list, Material material)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (list.meshCount == 0) return;
+
+    bool indirect = (list.commandsId > 0) && (material.shader.locs[SHADER_LOC_VERTEX_DRAWID] != -1);
+    bool baseVertex = (rlGetVersion() == RL_OPENGL_33) || (rlGetVersion() == RL_OPENGL_43);
+
+    // Bind shader program
+    rlEnableShader(material.shader.id);
+
+    // Send required data to shader (matrices, values)
+    //-----------------------------------------------------
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+    Matrix matTransform = rlGetMatrixTransform();
+
+    // Upload view and projection matrices (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Enable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
+
+            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+        }
+    }
+
+    // Bind vertex array object (VAO) or vertex buffers if not possible, bound once for all meshes
+    if (!rlEnableVertexArray(list.vaoId))
+    {
+        SetMeshListAttributes(list, 0);
+        rlEnableVertexBufferElement(list.vboId[6]);
+    }
+
+    // WARNING: Disable vertex attribute color input if mesh list can not provide that data (despite location being enabled in shader)
+    if ((list.vboId[3] == 0) && (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)) rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+
+    if (indirect) rlBindShaderBuffer(list.transformsId, MESH_LIST_TRANSFORMS_BINDING);
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate view-projection matrix, meshes model matrix is applied by mesh
+        Matrix matViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matViewProjection = MatrixMultiply(matView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matViewProjection = MatrixMultiply(MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
+
+        if (indirect)
+        {
+            // Draw all meshes in one call, meshes transforms are applied in shader
+            // NOTE: Internal matrix transform (push/pop) is combined into model-view-projection matrix
+            rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matTransform, matViewProjection));
+            rlDrawVertexArrayElementsIndirect(list.commandsId, 0, list.meshCount);
+        }
+        else
+        {
+            int currentBaseVertex = 0;
+
+            for (int i = 0; i < list.meshCount; i++)
+            {
+                Matrix matModel = MatrixMultiply(list.transforms[i], matTransform);
+
+                // Upload model and normal matrices (if locations available)
+                if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], list.transforms[i]);
+                if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+                rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModel, matViewProjection));
+
+                if (baseVertex) rlDrawVertexArrayElementsBaseVertex(list.firstIndex[i], list.indexCount[i], 0, list.baseVertex[i]);
+                else
+                {
+                    // Base vertex not supported, vertex attributes are set again starting at mesh base vertex
+                    if (list.baseVertex[i] != currentBaseVertex)
+                    {
+                        currentBaseVertex = list.baseVertex[i];
+                        SetMeshListAttributes(list, currentBaseVertex);
+                    }
+
+                    rlDrawVertexArrayElements(list.firstIndex[i], list.indexCount[i], 0);
+                }
+            }
+
+            // Restore vertex attributes for next draw (stored in VAO)
+            if (currentBaseVertex != 0) SetMeshListAttributes(list, 0);
+        }
+    }
+
+    // Unbind all bound texture maps
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Disable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
+    }
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Disable shader program
+    rlDisableShader();
+
+    // Restore viewport if stereo render modified it
+    if (eyeCount == 2) rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+#endif
+}
+
+// Set mesh list vertex attributes pointers, starting at base vertex
+// NOTE: Vertex attributes set at default shader locations (same as UploadMesh()),
+// default values are provided for vertex attributes not available
+static void SetMeshListAttributes(MeshList list, int baseVertex)
+{
+    // Enable vertex attributes: position (shader-location = 0), texcoords (shader-location = 1)
+    rlEnableVertexBuffer(list.vboId[0]);
+    rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, (void *)(baseVertex*3*sizeof(float)));
+    rlEnableVertexAttribute(0);
+
+    rlEnableVertexBuffer(list.vboId[1]);
+    rlSetVertexAttribute(1, 2, RL_FLOAT, 0, 0, (void *)(baseVertex*2*sizeof(float)));
+    rlEnableVertexAttribute(1);
+
+    // Enable vertex attributes: normals (shader-location = 2)
+    if (list.vboId[2] != 0)
+    {
+        rlEnableVertexBuffer(list.vboId[2]);
+        rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, (void *)(baseVertex*3*sizeof(float)));
+        rlEnableVertexAttribute(2);
+    }
+    else
+    {
+        float value[3] = { 1.0f, 1.0f, 1.0f };
+        rlSetVertexAttributeDefault(2, value, SHADER_ATTRIB_VEC3, 3);
+        rlDisableVertexAttribute(2);
+    }
+
+    // Enable vertex attributes: colors (shader-location = 3)
+    if (list.vboId[3] != 0)
+    {
+        rlEnableVertexBuffer(list.vboId[3]);
+        rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, (void *)(baseVertex*4*sizeof(unsigned char)));
+        rlEnableVertexAttribute(3);
+    }
+    else
+    {
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+        rlSetVertexAttributeDefault(3, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(3);
+    }
+
+    // Enable vertex attributes: tangents (shader-location = 4)
+    if (list.vboId[4] != 0)
+    {
+        rlEnableVertexBuffer(list.vboId[4]);
+        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, (void *)(baseVertex*4*sizeof(float)));
+        rlEnableVertexAttribute(4);
+    }
+    else
+    {
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(4, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(4);
+    }
+
+    // Enable vertex attributes: texcoords2 (shader-location = 5)
+    if (list.vboId[5] != 0)
+    {
+        rlEnableVertexBuffer(list.vboId[5]);
+        rlSetVertexAttribute(5, 2, RL_FLOAT, 0, 0, (void *)(baseVertex*2*sizeof(float)));
+        rlEnableVertexAttribute(5);
+    }
+    else
+    {
+        float value[2] = { 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(5, value, SHADER_ATTRIB_VEC2, 2);
+        rlDisableVertexAttribute(5);
+    }
+}
+
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
     // Unload rlgl mesh vboId data
-    rlUnloadVertexArray(mesh.vaoId);
-
-    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
+    // NOTE: Mesh never uploaded to GPU (vboId not allocated) is only unloaded from RAM
+    if (mesh.vboId != NULL)
+    {
+        rlUnloadVertexArray(mesh.vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
+    }
     RL_FREE(mesh.vboId);
 
     RL_FREE(mesh.vertices);
@@ -1857,8 +2332,18 @@ bool ExportMesh(Mesh mesh, const char *fileName)
 }
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
+// Get obj material texture path, relative texture paths are relative to basePath (if provided)
+// NOTE: Drive letter (texName[1]) only checked if texName is not empty, never read past its end
+static const char *GetTexturePathOBJ(const char *basePath, const char *texName)
+{
+    if ((basePath == NULL) || (texName[0] == '\0')) return texName;
+    if ((texName[0] == '/') || (texName[0] == '\\') || (texName[1] == ':')) return texName;
+
+    return TextFormat("%s/%s", basePath, texName);
+}
+
 // Process obj materials
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount)
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *basePath)
 {
     // Init model materials
     for (int m = 0; m < materialCount; m++)
@@ -1871,22 +2356,22 @@ static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *mate
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (materials[m].diffuse_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (materials[m].diffuse_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(GetTexturePathOBJ(basePath, materials[m].diffuse_texname));  //char *diffuse_texname; // map_Kd
 
         rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(materials[m].diffuse[0]*255.0f), (unsigned char)(materials[m].diffuse[1]*255.0f), (unsigned char)(materials[m].diffuse[2] * 255.0f), 255 }; //float diffuse[3];
         rayMaterials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (materials[m].specular_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (materials[m].specular_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(GetTexturePathOBJ(basePath, materials[m].specular_texname));  //char *specular_texname; // map_Ks
         rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(materials[m].specular[0]*255.0f), (unsigned char)(materials[m].specular[1]*255.0f), (unsigned char)(materials[m].specular[2] * 255.0f), 255 }; //float specular[3];
         rayMaterials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (materials[m].bump_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (materials[m].bump_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(GetTexturePathOBJ(basePath, materials[m].bump_texname));  //char *bump_texname; // map_bump, bump
         rayMaterials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         rayMaterials[m].maps[MATERIAL_MAP_NORMAL].value = materials[m].shininess;
 
         rayMaterials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(materials[m].emission[0]*255.0f), (unsigned char)(materials[m].emission[1]*255.0f), (unsigned char)(materials[m].emission[2] * 255.0f), 255 }; //float emission[3];
 
-        if (materials[m].displacement_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
+        if (materials[m].displacement_texname != NULL) rayMaterials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(GetTexturePathOBJ(basePath, materials[m].displacement_texname));  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -1908,7 +2393,7 @@ Material *LoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = MemAlloc(count*sizeof(Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -3922,16 +4407,13 @@ static Model LoadOBJ(const char *fileName)
     if (fileText != NULL)
     {
         unsigned int dataSize = (unsigned int)strlen(fileText);
-        char currentDir[1024] = { 0 };
-        strcpy(currentDir, GetWorkingDirectory());
-        const char *workingDir = GetDirectoryPath(fileName);
-        if (CHDIR(workingDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-        }
+
+        // NOTE: Materials and textures loaded relative to model directory, working directory not changed (thread safe)
+        char basePath[1024] = { 0 };
+        strncpy(basePath, GetDirectoryPath(fileName), 1024 - 1);
 
         unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+        int ret = tinyobj_parse_obj_ex(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags, basePath);
 
         if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
         else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
@@ -4033,7 +4515,7 @@ static Model LoadOBJ(const char *fileName)
         }
 
         // Init model materials
-        ProcessMaterialsOBJ(model.materials, materials, materialCount);
+        ProcessMaterialsOBJ(model.materials, materials, materialCount, basePath);
 
         tinyobj_attrib_free(&attrib);
         tinyobj_shapes_free(meshes, meshCount);
@@ -4046,11 +4528,6 @@ static Model LoadOBJ(const char *fileName)
         RL_FREE(vtCount);
         RL_FREE(vnCount);
         RL_FREE(faceCount);
-
-        if (CHDIR(currentDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
-        }
     }
 
     return model;
@@ -4413,7 +4890,7 @@ static Model LoadIQM(const char *fileName)
 
     BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
 
-    RL_FREE(fileData);
+    UnloadFileData(fileData);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4645,7 +5122,7 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int
         }
     }
 
-    RL_FREE(fileData);
+    UnloadFileData(fileData);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -195,6 +195,13 @@
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 
+// NOTE: stb_rect_pack implementation is included by rtext module with SUPPORT_FILEFORMAT_TTF (reused here),
+// only included here if not available, to avoid symbols collision
+#if !defined(SUPPORT_MODULE_RTEXT) || !defined(SUPPORT_FILEFORMAT_TTF)
+    #define STB_RECT_PACK_IMPLEMENTATION
+#endif
+#include "external/stb_rect_pack.h"     // Required for: stbrp_init_target(), stbrp_pack_rects() [LoadAtlasSpriteFromImage()]
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -209,7 +216,29 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Texture atlas page packing data
+typedef struct rAtlasPage {
+    stbrp_context *context;     // Rectangles packing context (skyline), it can not be moved in memory
+    stbrp_node *nodes;          // Rectangles packing nodes (one node by page column)
+    Rectangle *freeRecs;        // Rectangles released by unloaded sprites, reused before packing
+    int freeCount;              // Released rectangles count
+    int freeCapacity;           // Released rectangles capacity
+    int spriteCount;            // Sprites count in page
+} rAtlasPage;
+
+// Texture atlas sprite slot
+typedef struct rAtlasSlot {
+    int page;                   // Page containing the sprite (-1 if slot not used)
+    Rectangle rec;              // Sprite rectangle in page, padding included
+} rAtlasSlot;
+
+// Texture atlas packing data
+struct rAtlasPacker {
+    rAtlasPage *pages;          // Pages packing data (atlas.pageCount)
+    rAtlasSlot *slots;          // Sprites slots, sprite id is the slot index
+    int slotCount;              // Sprites slots count
+    int slotCapacity;           // Sprites slots capacity
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -219,12 +248,16 @@
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_ASYNC_LOADING)
+extern bool IsAssetLoadingThread(void);             // [Module: core] Check if current thread is loading an asset asynchronously (GPU work deferred)
+extern unsigned int DeferTextureUpload(Image image);    // [Module: core] Defer texture upload to main thread, returns placeholder texture id
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static bool PackAtlasPageRec(rAtlasPage *page, int width, int height, Rectangle *rec);  // Pack rectangle into texture atlas page, released rectangles first
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -248,6 +281,8 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
+    PROFILE_ZONE_BEGIN("LoadImage");
+
     // Loading file to memory
     unsigned int fileSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &fileSize);
@@ -255,7 +290,9 @@ Image LoadImage(const char *fileName)
     // Loading image from memory data
     if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnloadFileData(fileData);
+
+    PROFILE_ZONE_END();
 
     return image;
 }
@@ -282,7 +319,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
         image.mipmaps = 1;
         image.format = format;
 
-        RL_FREE(fileData);
+        UnloadFileData(fileData);
     }
 
     return image;
@@ -313,7 +350,7 @@ Image LoadImageAnim(const char *fileName, int *frames)
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            RL_FREE(fileData);
+            UnloadFileData(fileData);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
     }
@@ -3200,6 +3237,11 @@ Texture2D LoadTextureFromImage(Image image)
 
     if ((image.width != 0) && (image.height != 0))
     {
+#if defined(SUPPORT_ASYNC_LOADING)
+        // Loading asset asynchronously (LoadAssetAsync()): image kept, uploaded to GPU on main thread
+        if (IsAssetLoadingThread()) texture.id = DeferTextureUpload(image);
+        else
+#endif
         texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
@@ -3395,6 +3437,230 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load texture atlas, pages of defined size are created as required
+// NOTE: Pages use PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, sprites are packed with stb_rect_pack (skyline)
+// and uploaded once to its page texture, sprites drawn from the same page share the texture
+TextureAtlas LoadTextureAtlas(int width, int height, int padding)
+{
+    TextureAtlas atlas = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (padding < 0))
+    {
+        TRACELOG(LOG_WARNING, "ATLAS: Texture atlas parameters not valid");
+        return atlas;
+    }
+
+    atlas.width = width;
+    atlas.height = height;
+    atlas.padding = padding;
+    atlas.packer = (rAtlasPacker *)RL_CALLOC(1, sizeof(rAtlasPacker));
+
+    return atlas;
+}
+
+// Unload texture atlas pages from GPU memory (VRAM)
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    for (int i = 0; i < atlas.pageCount; i++)
+    {
+        UnloadTexture(atlas.pages[i]);
+
+        RL_FREE(atlas.packer->pages[i].context);
+        RL_FREE(atlas.packer->pages[i].nodes);
+        RL_FREE(atlas.packer->pages[i].freeRecs);
+    }
+
+    if (atlas.packer != NULL)
+    {
+        RL_FREE(atlas.packer->pages);
+        RL_FREE(atlas.packer->slots);
+        RL_FREE(atlas.packer);
+    }
+
+    RL_FREE(atlas.pages);
+}
+
+// Load sprite from file into texture atlas
+AtlasSprite LoadAtlasSprite(TextureAtlas *atlas, const char *fileName)
+{
+    AtlasSprite sprite = { 0 };
+    sprite.id = -1;
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        sprite = LoadAtlasSpriteFromImage(atlas, image);
+        UnloadImage(image);
+    }
+
+    return sprite;
+}
+
+// Load sprite from image data into texture atlas
+// NOTE: Sprite is packed into the first page with enough space, a new page is created if none
+AtlasSprite LoadAtlasSpriteFromImage(TextureAtlas *atlas, Image image)
+{
+    AtlasSprite sprite = { 0 };
+    sprite.id = -1;
+
+    if ((atlas == NULL) || (atlas->packer == NULL) || (image.data == NULL)) return sprite;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "ATLAS: Compressed image formats not supported");
+        return sprite;
+    }
+
+    int width = image.width + 2*atlas->padding;
+    int height = image.height + 2*atlas->padding;
+
+    if ((width > atlas->width) || (height > atlas->height))
+    {
+        TRACELOG(LOG_WARNING, "ATLAS: Image size (%i x %i) does not fit atlas pages size (%i x %i)", image.width, image.height, atlas->width, atlas->height);
+        return sprite;
+    }
+
+    rAtlasPacker *packer = atlas->packer;
+    Rectangle rec = { 0 };
+    int page = -1;
+
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+        if (PackAtlasPageRec(&packer->pages[i], width, height, &rec))
+        {
+            page = i;
+            break;
+        }
+    }
+
+    if (page == -1)
+    {
+        // Create a new page, initialized transparent
+        // NOTE: Previous pages data is not moved, textures ids do not change
+        void *pixels = RL_CALLOC(atlas->width*atlas->height, 4);
+        Texture2D texture = { 0 };
+        texture.id = rlLoadTexture(pixels, atlas->width, atlas->height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        RL_FREE(pixels);
+
+        if (texture.id == 0)
+        {
+            TRACELOG(LOG_WARNING, "ATLAS: Failed to load texture atlas page");
+            return sprite;
+        }
+
+        texture.width = atlas->width;
+        texture.height = atlas->height;
+        texture.mipmaps = 1;
+        texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        page = atlas->pageCount;
+        atlas->pages = (Texture2D *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(Texture2D));
+        atlas->pages[page] = texture;
+
+        packer->pages = (rAtlasPage *)RL_REALLOC(packer->pages, (atlas->pageCount + 1)*sizeof(rAtlasPage));
+        rAtlasPage *newPage = &packer->pages[page];
+        newPage->context = (stbrp_context *)RL_MALLOC(sizeof(stbrp_context));
+        newPage->nodes = (stbrp_node *)RL_MALLOC(atlas->width*sizeof(stbrp_node));
+        newPage->freeRecs = NULL;
+        newPage->freeCount = 0;
+        newPage->freeCapacity = 0;
+        newPage->spriteCount = 0;
+        stbrp_init_target(newPage->context, atlas->width, atlas->height, newPage->nodes, atlas->width);
+
+        atlas->pageCount++;
+
+        TRACELOG(LOG_INFO, "ATLAS: [ID %i] Texture atlas page %i loaded successfully (%i x %i)", texture.id, page, atlas->width, atlas->height);
+
+        PackAtlasPageRec(newPage, width, height, &rec);
+    }
+
+    // Upload sprite with its transparent padding border, previous sprites data in the area is overwritten
+    Image padded = ImageFromImage(image, (Rectangle){ 0, 0, (float)image.width, (float)image.height });
+    ImageFormat(&padded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    if (atlas->padding > 0) ImageResizeCanvas(&padded, width, height, atlas->padding, atlas->padding, BLANK);
+
+    UpdateTextureRec(atlas->pages[page], rec, padded.data);
+    UnloadImage(padded);
+
+    // Register sprite into a free slot
+    int id = -1;
+
+    for (int i = 0; i < packer->slotCount; i++)
+    {
+        if (packer->slots[i].page == -1)
+        {
+            id = i;
+            break;
+        }
+    }
+
+    if (id == -1)
+    {
+        if (packer->slotCount >= packer->slotCapacity)
+        {
+            packer->slotCapacity = (packer->slotCapacity == 0)? 64 : packer->slotCapacity*2;
+            packer->slots = (rAtlasSlot *)RL_REALLOC(packer->slots, packer->slotCapacity*sizeof(rAtlasSlot));
+        }
+
+        id = packer->slotCount;
+        packer->slotCount++;
+    }
+
+    packer->slots[id].page = page;
+    packer->slots[id].rec = rec;
+    packer->pages[page].spriteCount++;
+
+    sprite.texture = atlas->pages[page];
+    sprite.source = (Rectangle){ rec.x + atlas->padding, rec.y + atlas->padding, (float)image.width, (float)image.height };
+    sprite.id = id;
+
+    return sprite;
+}
+
+// Unload sprite from texture atlas, space is reused by next sprites
+// NOTE: Page data is not cleared, page packing is reset once it contains no sprites
+void UnloadAtlasSprite(TextureAtlas *atlas, AtlasSprite sprite)
+{
+    if ((atlas == NULL) || (atlas->packer == NULL)) return;
+
+    rAtlasPacker *packer = atlas->packer;
+
+    if ((sprite.id < 0) || (sprite.id >= packer->slotCount) || (packer->slots[sprite.id].page == -1))
+    {
+        TRACELOG(LOG_WARNING, "ATLAS: Sprite [ID %i] not loaded in texture atlas", sprite.id);
+        return;
+    }
+
+    rAtlasSlot *slot = &packer->slots[sprite.id];
+    rAtlasPage *page = &packer->pages[slot->page];
+
+    page->spriteCount--;
+
+    if (page->spriteCount == 0)
+    {
+        // Page is empty, all its space is available again
+        stbrp_init_target(page->context, atlas->width, atlas->height, page->nodes, atlas->width);
+        page->freeCount = 0;
+    }
+    else
+    {
+        if (page->freeCount >= page->freeCapacity)
+        {
+            page->freeCapacity = (page->freeCapacity == 0)? 16 : page->freeCapacity*2;
+            page->freeRecs = (Rectangle *)RL_REALLOC(page->freeRecs, page->freeCapacity*sizeof(Rectangle));
+        }
+
+        page->freeRecs[page->freeCount] = slot->rec;
+        page->freeCount++;
+    }
+
+    slot->page = -1;
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -3409,6 +3675,11 @@ void GenTextureMipmaps(Texture2D *texture)
 // Set texture scaling filter mode
 void SetTextureFilter(Texture2D texture, int filter)
 {
+#if defined(SUPPORT_ASYNC_LOADING)
+    // Texture upload deferred (LoadAssetAsync()), texture uploaded with default filter
+    if (IsAssetLoadingThread()) return;
+#endif
+
     switch (filter)
     {
         case TEXTURE_FILTER_POINT:
@@ -4470,4 +4741,72 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Pack rectangle into texture atlas page, released rectangles first
+// NOTE: Released rectangles are reused best-fit (guillotine split of remaining space),
+// released space could be fragmented until page is empty
+static bool PackAtlasPageRec(rAtlasPage *page, int width, int height, Rectangle *rec)
+{
+    int best = -1;
+    float bestArea = 0.0f;
+
+    for (int i = 0; i < page->freeCount; i++)
+    {
+        Rectangle freeRec = page->freeRecs[i];
+
+        if ((freeRec.width >= width) && (freeRec.height >= height) && ((best == -1) || ((freeRec.width*freeRec.height) < bestArea)))
+        {
+            best = i;
+            bestArea = freeRec.width*freeRec.height;
+        }
+    }
+
+    if (best != -1)
+    {
+        Rectangle freeRec = page->freeRecs[best];
+        *rec = (Rectangle){ freeRec.x, freeRec.y, (float)width, (float)height };
+
+        // Split remaining space along the shorter leftover axis
+        Rectangle right = { freeRec.x + width, freeRec.y, freeRec.width - width, freeRec.height };
+        Rectangle bottom = { freeRec.x, freeRec.y + height, (float)width, freeRec.height - height };
+
+        if ((freeRec.width - width) < (freeRec.height - height))
+        {
+            right.height = (float)height;
+            bottom.width = freeRec.width;
+        }
+
+        page->freeRecs[best] = page->freeRecs[page->freeCount - 1];
+        page->freeCount--;
+
+        // NOTE: Released rectangles array has space, one rectangle was just removed
+        if ((right.width > 0) && (right.height > 0)) page->freeRecs[page->freeCount++] = right;
+        if ((bottom.width > 0) && (bottom.height > 0))
+        {
+            if (page->freeCount >= page->freeCapacity)
+            {
+                page->freeCapacity *= 2;
+                page->freeRecs = (Rectangle *)RL_REALLOC(page->freeRecs, page->freeCapacity*sizeof(Rectangle));
+            }
+
+            page->freeRecs[page->freeCount++] = bottom;
+        }
+
+        return true;
+    }
+
+    stbrp_rect packRec = { 0 };
+    packRec.w = width;
+    packRec.h = height;
+
+    stbrp_pack_rects(page->context, &packRec, 1);
+
+    if (packRec.was_packed)
+    {
+        *rec = (Rectangle){ (float)packRec.x, (float)packRec.y, (float)width, (float)height };
+        return true;
+    }
+
+    return false;
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
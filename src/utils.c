@@ -8,6 +8,10 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_PROFILER
+*       Record profiler zones (BeginProfileZone()/EndProfileZone()) per thread, exported as Chrome trace JSON
+*       NOTE: Internal zones macros are removed on compilation if not defined
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -48,7 +52,7 @@
 #include <stdlib.h>                     // Required for: exit()
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
-#include <string.h>                     // Required for: strcpy(), strcat()
+#include <string.h>                     // Required for: strcpy(), strcat(), memmove()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -57,6 +61,68 @@
     #define MAX_TRACELOG_MSG_LENGTH     128     // Max length of one trace-log message
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    #ifndef MAX_PROFILER_EVENTS
+        #define MAX_PROFILER_EVENTS    8192     // Max profiler zones recorded per thread (ring buffer, oldest discarded)
+    #endif
+    #ifndef MAX_PROFILER_THREADS
+        #define MAX_PROFILER_THREADS     16     // Max threads recording profiler zones
+    #endif
+    #ifndef MAX_PROFILER_ZONE_DEPTH
+        #define MAX_PROFILER_ZONE_DEPTH  32     // Max profiler zones nesting depth per thread
+    #endif
+
+    // Thread local storage and atomic operations, required for lock-free per thread recording
+    // NOTE: Values written by recording threads are published with a release store and read by
+    // ExportProfileTrace() with an acquire load, interlocked operations are full barriers on MSVC;
+    // events fields use relaxed accesses (plain moves), ring buffer slots could be overwritten while read
+    #if defined(_MSC_VER)
+        #include <intrin.h>                     // Required for: _InterlockedIncrement(), _InterlockedOr(), _InterlockedExchange()
+        #define PROFILER_THREAD_LOCAL __declspec(thread)
+        #define PROFILER_ATOMIC_INCREMENT(value) (_InterlockedIncrement((volatile long *)(value)) - 1)
+        #define PROFILER_ATOMIC_LOAD(value) ((unsigned int)_InterlockedOr((volatile long *)(value), 0))
+        #define PROFILER_ATOMIC_STORE(value, x) _InterlockedExchange((volatile long *)(value), (long)(x))
+        #define PROFILER_ATOMIC_LOAD_PTR(value) _InterlockedCompareExchangePointer((void *volatile *)(value), NULL, NULL)
+        #define PROFILER_ATOMIC_STORE_PTR(value, x) _InterlockedExchangePointer((void *volatile *)(value), (x))
+        #define PROFILER_ATOMIC_FENCE() _ReadWriteBarrier()
+        #define PROFILER_RELAXED_LOAD(value, result) (*(result) = *(value))
+        #define PROFILER_RELAXED_STORE(value, x) (*(value) = *(x))
+    #else
+        #define PROFILER_THREAD_LOCAL __thread
+        #define PROFILER_ATOMIC_INCREMENT(value) __sync_fetch_and_add(value, 1)
+        #define PROFILER_ATOMIC_LOAD(value) __atomic_load_n(value, __ATOMIC_ACQUIRE)
+        #define PROFILER_ATOMIC_STORE(value, x) __atomic_store_n(value, x, __ATOMIC_RELEASE)
+        #define PROFILER_ATOMIC_LOAD_PTR(value) __atomic_load_n(value, __ATOMIC_ACQUIRE)
+        #define PROFILER_ATOMIC_STORE_PTR(value, x) __atomic_store_n(value, x, __ATOMIC_RELEASE)
+        #define PROFILER_ATOMIC_FENCE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+        #define PROFILER_RELAXED_LOAD(value, result) __atomic_load(value, result, __ATOMIC_RELAXED)
+        #define PROFILER_RELAXED_STORE(value, x) __atomic_store(value, x, __ATOMIC_RELAXED)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_PROFILER)
+// Profiler zone event (complete zone)
+typedef struct ProfileEvent {
+    const char *name;                   // Zone name (static string)
+    double start;                       // Zone start time (in seconds)
+    double duration;                    // Zone duration (in seconds)
+} ProfileEvent;
+
+// Profiler thread recording data
+// NOTE: Only written by owner thread, events ring buffer is read on export (events counter release/acquire)
+typedef struct ProfileThread {
+    ProfileEvent *events;               // Events ring buffer (MAX_PROFILER_EVENTS)
+    volatile unsigned int eventCounter; // Events recorded counter (ring buffer write position), atomic store/load
+    const char *zoneNames[MAX_PROFILER_ZONE_DEPTH];     // Open zones names stack
+    double zoneStarts[MAX_PROFILER_ZONE_DEPTH];         // Open zones start time stack
+    int zoneDepth;                      // Open zones counter
+    int id;                             // Thread id for trace (registration order)
+} ProfileThread;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -68,6 +134,20 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+extern unsigned char *LoadArchiveFileData(const char *fileName, unsigned int *bytesRead);   // [Module: core] Load file data from mounted assets archives
+extern bool IsArchiveFileData(const unsigned char *data);   // [Module: core] Check if data is a view into a mounted assets archive
+#endif
+
+#if defined(SUPPORT_PROFILER)
+static ProfileThread *profileThreads[MAX_PROFILER_THREADS] = { 0 };   // Profiler threads registered
+static volatile long profileThreadCounter = 0;                      // Profiler threads registered counter
+static volatile long profileSession = 0;                            // Profiler session, increased on CloseProfiler()
+static ProfileThread profileThreadRejected = { 0 };                 // Profiler thread sentinel, threads over limit (never written)
+static PROFILER_THREAD_LOCAL ProfileThread *profileThread = NULL;   // Profiler current thread data
+static PROFILER_THREAD_LOCAL long profileThreadSession = 0;         // Profiler session current thread data belongs to
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -187,6 +267,11 @@ unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+        // Load file data from mounted assets archives if available, uncompressed data not copied
+        data = LoadArchiveFileData(fileName, bytesRead);
+        if (data != NULL) return data;
+#endif
         if (loadFileData)
         {
             data = loadFileData(fileName, bytesRead);
@@ -231,6 +316,9 @@ unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
 // Unload file data allocated by LoadFileData()
 void UnloadFileData(unsigned char *data)
 {
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+    if (IsArchiveFileData(data)) return;    // Data view into mounted assets archive (zero-copy), not allocated
+#endif
     RL_FREE(data);
 }
 
@@ -322,6 +410,21 @@ char *LoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_ASSETS_ARCHIVE)
+        // Load text data from mounted assets archives if available
+        unsigned int dataSize = 0;
+        unsigned char *data = LoadArchiveFileData(fileName, &dataSize);
+
+        if (data != NULL)
+        {
+            text = (char *)RL_MALLOC((dataSize + 1)*sizeof(char));
+            memcpy(text, data, dataSize);
+            text[dataSize] = '\0';
+
+            UnloadFileData(data);
+            return text;
+        }
+#endif
         if (loadFileText)
         {
             text = loadFileText(fileName);
@@ -407,6 +510,189 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Begin profiler zone on current thread
+// NOTE: Zone name is not copied, it must be a static string (string literal)
+void BeginProfileZone(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    // Current thread data released by CloseProfiler(), thread registered again
+    if (profileThreadSession != profileSession)
+    {
+        profileThread = NULL;
+        profileThreadSession = profileSession;
+    }
+
+    if (profileThread == &profileThreadRejected) return;
+
+    if (profileThread == NULL)
+    {
+        // Register current thread on first zone, lock-free (threads over limit are not recorded)
+        // NOTE: Rejected threads are marked, so registered threads counter is only increased once by thread
+        int index = (int)PROFILER_ATOMIC_INCREMENT(&profileThreadCounter);
+
+        if ((index < 0) || (index >= MAX_PROFILER_THREADS))
+        {
+            profileThread = &profileThreadRejected;
+            return;
+        }
+
+        ProfileThread *thread = (ProfileThread *)RL_CALLOC(1, sizeof(ProfileThread));
+        thread->events = (ProfileEvent *)RL_CALLOC(MAX_PROFILER_EVENTS, sizeof(ProfileEvent));
+        thread->id = index;
+
+        // Thread data published once initialized, read by ExportProfileTrace()
+        profileThread = thread;
+        PROFILER_ATOMIC_STORE_PTR(&profileThreads[index], thread);
+    }
+
+    // NOTE: Zones over max depth are not recorded but counted, so begin/end pairs keep matching
+    if (profileThread->zoneDepth < MAX_PROFILER_ZONE_DEPTH)
+    {
+        profileThread->zoneNames[profileThread->zoneDepth] = name;
+        profileThread->zoneStarts[profileThread->zoneDepth] = GetTime();
+    }
+
+    profileThread->zoneDepth++;
+#endif
+}
+
+// End latest profiler zone begun on current thread
+void EndProfileZone(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if ((profileThread == NULL) || (profileThread == &profileThreadRejected) || (profileThreadSession != profileSession)) return;
+    if (profileThread->zoneDepth <= 0) return;
+
+    profileThread->zoneDepth--;
+
+    if (profileThread->zoneDepth < MAX_PROFILER_ZONE_DEPTH)
+    {
+        // Store completed zone in ring buffer, counter published (release) after event data is written
+        // NOTE: Counter only written by current thread, it can be read without atomic load
+        unsigned int counter = profileThread->eventCounter;
+        ProfileEvent *event = &profileThread->events[counter%MAX_PROFILER_EVENTS];
+        const char *name = profileThread->zoneNames[profileThread->zoneDepth];
+        double start = profileThread->zoneStarts[profileThread->zoneDepth];
+        double duration = GetTime() - start;
+
+        PROFILER_RELAXED_STORE(&event->name, &name);
+        PROFILER_RELAXED_STORE(&event->start, &start);
+        PROFILER_RELAXED_STORE(&event->duration, &duration);
+
+        PROFILER_ATOMIC_STORE(&profileThread->eventCounter, counter + 1);
+    }
+#endif
+}
+
+// Export recorded profiler zones as Chrome trace JSON (chrome://tracing, Perfetto)
+// NOTE: Latest MAX_PROFILER_EVENTS zones are exported for every thread, zones recorded by other threads
+// while exporting could be missed; recorded events are copied first (events counter acquire load),
+// copied events overwritten by their thread while copying are discarded (events counter checked again)
+// NOTE: Recorded zones are released by CloseWindow(), trace must be exported before
+bool ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    long counter = (long)PROFILER_ATOMIC_LOAD(&profileThreadCounter);
+    int threadCount = (counter < 0)? 0 : ((counter < MAX_PROFILER_THREADS)? (int)counter : MAX_PROFILER_THREADS);
+
+    // Copy recorded events, from oldest to newest available in ring buffers
+    ProfileEvent *events = (ProfileEvent *)RL_MALLOC((threadCount*MAX_PROFILER_EVENTS + 1)*sizeof(ProfileEvent));
+    int *eventThreads = (int *)RL_MALLOC((threadCount*MAX_PROFILER_EVENTS + 1)*sizeof(int));
+    int eventCount = 0;
+
+    // Get required text size, every event requires ~128 bytes plus name length
+    int size = 128;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        ProfileThread *thread = (ProfileThread *)PROFILER_ATOMIC_LOAD_PTR(&profileThreads[i]);
+        if (thread == NULL) continue;
+
+        unsigned int last = PROFILER_ATOMIC_LOAD(&thread->eventCounter);
+        unsigned int first = (last > MAX_PROFILER_EVENTS)? (last - MAX_PROFILER_EVENTS) : 0;
+        int threadFirst = eventCount;
+
+        for (unsigned int j = first; j < last; j++)
+        {
+            ProfileEvent *event = &thread->events[j%MAX_PROFILER_EVENTS];
+
+            PROFILER_RELAXED_LOAD(&event->name, &events[eventCount].name);
+            PROFILER_RELAXED_LOAD(&event->start, &events[eventCount].start);
+            PROFILER_RELAXED_LOAD(&event->duration, &events[eventCount].duration);
+            eventCount++;
+        }
+
+        // Events overwritten while copying are discarded: event j slot is written again by event (j + MAX_PROFILER_EVENTS),
+        // written while counter is (j + MAX_PROFILER_EVENTS), copied events must be read before counter is loaded again
+        PROFILER_ATOMIC_FENCE();
+        unsigned int current = PROFILER_ATOMIC_LOAD(&thread->eventCounter);
+        unsigned int valid = (current >= MAX_PROFILER_EVENTS)? (current - MAX_PROFILER_EVENTS + 1) : 0;
+
+        if (valid > first)
+        {
+            int discarded = (valid >= last)? (int)(last - first) : (int)(valid - first);
+            memmove(&events[threadFirst], &events[threadFirst + discarded], (eventCount - threadFirst - discarded)*sizeof(ProfileEvent));
+            eventCount -= discarded;
+        }
+
+        for (int j = threadFirst; j < eventCount; j++)
+        {
+            eventThreads[j] = thread->id;
+            size += 128 + (int)strlen(events[j].name);
+        }
+    }
+
+    char *text = (char *)RL_CALLOC(size, sizeof(char));
+    int length = sprintf(text, "{\"traceEvents\":[\n");
+
+    for (int i = 0; i < eventCount; i++)
+    {
+        // NOTE: Time values exported in microseconds, zone names are not escaped (static strings)
+        length += sprintf(text + length, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}",
+            (i > 0)? ",\n" : "", events[i].name, eventThreads[i], events[i].start*1000000.0, events[i].duration*1000000.0);
+    }
+
+    sprintf(text + length, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    RL_FREE(events);
+    RL_FREE(eventThreads);
+
+    success = SaveFileText(fileName, text);
+    RL_FREE(text);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Trace exported successfully (%i zones, %i threads)", fileName, eventCount, threadCount);
+    else TRACELOG(LOG_WARNING, "PROFILER: [%s] Failed to export trace", fileName);
+#else
+    TRACELOG(LOG_WARNING, "PROFILER: Profiler not supported, enable SUPPORT_PROFILER on config.h");
+#endif
+
+    return success;
+}
+
+#if defined(SUPPORT_PROFILER)
+// Unload profiler threads recorded data
+// NOTE: Threads recording zones while closing are not supported,
+// threads data is registered again on next zone begun (new session)
+// WARNING: Required by CloseWindow() [Module: core]
+void CloseProfiler(void)
+{
+    for (int i = 0; i < MAX_PROFILER_THREADS; i++)
+    {
+        if (profileThreads[i] != NULL)
+        {
+            RL_FREE(profileThreads[i]->events);
+            RL_FREE(profileThreads[i]);
+            profileThreads[i] = NULL;
+        }
+    }
+
+    profileThreadCounter = 0;
+    profileSession++;
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
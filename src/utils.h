@@ -45,6 +45,15 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// NOTE: Profiler zones are removed on compilation if not supported (no overhead)
+#if defined(SUPPORT_PROFILER)
+    #define PROFILE_ZONE_BEGIN(name) BeginProfileZone(name)
+    #define PROFILE_ZONE_END() EndProfileZone()
+#else
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -52,6 +61,17 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Thread local storage, internal static buffers (TextFormat(), GetDirectoryPath()...) used by loading and scanning threads
+#if defined(SUPPORT_ASYNC_LOADING) || defined(SUPPORT_PARALLEL_DIRECTORY_SCAN)
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#else
+    #define RL_THREAD_LOCAL
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -0,0 +1,166 @@
+/*******************************************************************************************
+*
+*   raylib [tests] test - compression exact size
+*
+*   NOTE: Memory decompression (sinflate_alloc(), used by DecompressData() and assets archives)
+*         allocations tracked: output allocated once with decompressed size, raw DEFLATE data
+*         (CompressData() output), zlib and gzip wrapped data, gzip size hint right and wrong
+*
+*   Test originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), realloc(), free()
+#include <string.h>         // Required for: memcmp(), memcpy()
+
+// Allocations tracked: live bytes, peak live bytes and allocations count
+static struct {
+    void *ptr[16];
+    size_t size[16];
+    size_t live;
+    size_t peak;
+    int count;
+} allocs = { 0 };
+
+static void *TestRealloc(void *ptr, size_t size);
+static void TestFree(void *ptr);
+
+#define SINFL_IMPLEMENTATION
+#define SINFL_REALLOC(p,n) TestRealloc(p,n)
+#define SINFL_FREE(p) TestFree(p)
+#include "external/sinfl.h"
+
+#define SDEFL_IMPLEMENTATION
+#include "external/sdefl.h"
+
+#define DATA_SIZE       (1024*1024)     // Uncompressed data size, bigger than decompression window
+
+static int failures = 0;
+
+// Check test condition, failure logged
+#define CHECK(condition, ...) do { if (!(condition)) { printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+// Get tracked allocation size, 0 if not tracked
+static size_t GetAllocSize(void *ptr)
+{
+    for (int i = 0; i < 16; i++) if ((ptr != NULL) && (allocs.ptr[i] == ptr)) return allocs.size[i];
+
+    return 0;
+}
+
+static void *TestRealloc(void *ptr, size_t size)
+{
+    void *result = realloc(ptr, size);
+    if (result == NULL) return NULL;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if ((ptr != NULL) && (allocs.ptr[i] == ptr)) { allocs.live -= allocs.size[i]; allocs.ptr[i] = NULL; break; }
+    }
+    for (int i = 0; i < 16; i++)
+    {
+        if (allocs.ptr[i] == NULL) { allocs.ptr[i] = result; allocs.size[i] = size; break; }
+    }
+
+    allocs.live += size;
+    if (allocs.live > allocs.peak) allocs.peak = allocs.live;
+    allocs.count++;
+
+    return result;
+}
+
+static void TestFree(void *ptr)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        if ((ptr != NULL) && (allocs.ptr[i] == ptr)) { allocs.live -= allocs.size[i]; allocs.ptr[i] = NULL; break; }
+    }
+
+    free(ptr);
+}
+
+// Decompress data, check output data and allocations: output allocated with decompressed size,
+// peak memory limited to output (and window if size is computed)
+static void CheckDecompress(const char *name, const unsigned char *compData, int compDataSize, int sizeHint,
+                            const unsigned char *data, int maxAllocs, size_t maxPeak)
+{
+    allocs.peak = allocs.live;
+    allocs.count = 0;
+
+    int dataSize = 0;
+    unsigned char *output = sinflate_alloc(compData, compDataSize, sizeHint, &dataSize);
+
+    CHECK(output != NULL, "%s: decompression failed", name);
+    if (output == NULL) return;
+
+    CHECK(dataSize == DATA_SIZE, "%s: decompressed size %i, expected %i", name, dataSize, DATA_SIZE);
+    CHECK(GetAllocSize(output) == (size_t)dataSize, "%s: allocated size %zu, decompressed size %i", name, GetAllocSize(output), dataSize);
+    CHECK(allocs.count <= maxAllocs, "%s: %i allocations, expected %i max", name, allocs.count, maxAllocs);
+    CHECK(allocs.peak <= maxPeak, "%s: peak memory %zu, expected %zu max", name, allocs.peak, maxPeak);
+    CHECK(memcmp(output, data, DATA_SIZE) == 0, "%s: decompressed data not matching", name);
+
+    TestFree(output);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Data compressible but not trivial: repeated runs and pseudo-random bytes
+    unsigned char *data = (unsigned char *)malloc(DATA_SIZE);
+    unsigned int seed = 12345;
+    for (int i = 0; i < DATA_SIZE; i++)
+    {
+        seed = seed*1103515245u + 12345u;
+        data[i] = ((i/64)%3 == 0)? (unsigned char)(seed >> 24) : (unsigned char)(i/256);
+    }
+
+    static struct sdefl sdefl = { 0 };
+    int bound = sdefl_bound(DATA_SIZE);
+    unsigned char *compData = (unsigned char *)malloc(bound + 18);
+
+    // Raw DEFLATE data (CompressData() output): size computed, one output allocation plus window
+    int compDataSize = sdeflate(&sdefl, compData, data, DATA_SIZE, 8);
+    CheckDecompress("raw deflate", compData, compDataSize, -1, data, 2, DATA_SIZE + SINFL_WIN_SIZ);
+
+    // zlib wrapped data: same as raw DEFLATE data
+    compDataSize = zsdeflate(&sdefl, compData, data, DATA_SIZE, 8);
+    CheckDecompress("zlib", compData, compDataSize, -1, data, 2, DATA_SIZE + SINFL_WIN_SIZ);
+
+    // gzip wrapped data: size hint from footer (ISIZE), single allocation
+    static const unsigned char gzipHeader[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3 };
+    memcpy(compData, gzipHeader, 10);
+    compDataSize = 10 + sdeflate(&sdefl, compData + 10, data, DATA_SIZE, 8);
+    memset(compData + compDataSize, 0, 4);      // CRC32, not verified on decompression
+    compData[compDataSize + 4] = DATA_SIZE & 0xff;
+    compData[compDataSize + 5] = (DATA_SIZE >> 8) & 0xff;
+    compData[compDataSize + 6] = (DATA_SIZE >> 16) & 0xff;
+    compData[compDataSize + 7] = (DATA_SIZE >> 24) & 0xff;
+    compDataSize += 8;
+    CheckDecompress("gzip", compData, compDataSize, DATA_SIZE, data, 1, DATA_SIZE);
+
+    // gzip wrapped data, wrong size hints: size computed, output allocated with decompressed size
+    CheckDecompress("gzip size hint too small", compData, compDataSize, DATA_SIZE/2, data, 3, DATA_SIZE + SINFL_WIN_SIZ);
+    CheckDecompress("gzip size hint too big", compData, compDataSize, DATA_SIZE*2, data, 3, DATA_SIZE*2);
+
+    // Invalid data (reserved block type): no output, no memory leaked
+    static const unsigned char invalidData[4] = { 0x07, 0, 0, 0 };
+    int dataSize = 0;
+    unsigned char *output = sinflate_alloc(invalidData, 4, -1, &dataSize);
+    CHECK((output == NULL) && (dataSize == 0), "invalid data: output returned");
+    CHECK(allocs.live == 0, "%zu bytes leaked", allocs.live);
+
+    free(compData);
+    free(data);
+
+    if (failures == 0) printf("PASS: compression exact size\n");
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************************
+*
+*   raylib [tests] test - rlgl batch streaming
+*
+*   NOTE: rlgl runs on null OpenGL (rlgl_null.h), no window or GL context required:
+*         streaming render batch drawn every frame, bytes uploaded by frame counted by null OpenGL:
+*         static frames not uploaded (from third frame), changed frames fully uploaded,
+*         data with the same hash as a previous upload (crafted collision) still uploaded
+*
+*   Test originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#define RLGL_IMPLEMENTATION
+#include "rlgl.h"
+
+#include "rlgl_null.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <string.h>         // Required for: memcpy()
+
+#define QUADS_COUNT         256                             // Quads drawn by frame
+#define VERTEX_COUNT        (QUADS_COUNT*4)                 // Vertex drawn by frame
+#define FRAME_SIZE          (VERTEX_COUNT*(3*4 + 2*4 + 4))  // Vertex data size by frame (in bytes): position, texcoord, color
+
+static int failures = 0;
+
+// Check test condition, failure logged
+#define CHECK(condition, ...) do { if (!(condition)) { printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+// Draw frame quads with provided vertex colors, returns bytes uploaded by null OpenGL
+static size_t DrawFrame(const unsigned char *colors)
+{
+    rlNullGLReset();
+    rlResetRenderStats();
+
+    rlBegin(RL_QUADS);
+    for (int i = 0; i < VERTEX_COUNT; i++)
+    {
+        float x = (float)((i/4)%16)*16.0f + (((i%4) >= 2)? 16.0f : 0.0f);
+        float y = (float)((i/4)/16)*16.0f + ((((i%4) == 1) || ((i%4) == 2))? 16.0f : 0.0f);
+
+        rlColor4ub(colors[i*4], colors[i*4 + 1], colors[i*4 + 2], colors[i*4 + 3]);
+        rlTexCoord2f(x/256.0f, y/256.0f);
+        rlVertex2f(x, y);
+    }
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+
+    CHECK(rlGetRenderStats().bytesUploaded == nullGL.bytesUploaded, "render stats bytes uploaded (%u) not matching GL bytes uploaded (%zu)",
+          (unsigned int)rlGetRenderStats().bytesUploaded, nullGL.bytesUploaded);
+
+    return nullGL.bytesUploaded;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    rlLoadExtensions((void *)rlNullGLLoader);
+    rlglInit(800, 450);
+
+    rlRenderBatch batch = rlLoadRenderBatchEx(1, QUADS_COUNT, RL_BATCH_LAYOUT_SEPARATE);
+    rlEnableRenderBatchStreaming(&batch, 4);
+    rlSetRenderBatchActive(&batch);
+
+    static unsigned char colors[VERTEX_COUNT*4] = { 0 };
+    for (int i = 0; i < VERTEX_COUNT*4; i++) colors[i] = (unsigned char)(i*7);
+
+    // Static frames: uploaded on first frame and second frame (hashed), not uploaded anymore
+    for (int frame = 0; frame < 10; frame++)
+    {
+        size_t bytes = DrawFrame(colors);
+        size_t expected = (frame < 2)? FRAME_SIZE : 0;
+
+        CHECK(bytes == expected, "static frame %i: %zu bytes uploaded, expected %zu", frame, bytes, expected);
+    }
+
+    // Changed frame: fully uploaded
+    colors[0] ^= 0xff;
+    size_t bytes = DrawFrame(colors);
+    CHECK(bytes == FRAME_SIZE, "changed frame: %zu bytes uploaded, expected %i", bytes, FRAME_SIZE);
+
+    // Previous frame data again: still on GPU buffers, not uploaded
+    colors[0] ^= 0xff;
+    bytes = DrawFrame(colors);
+    CHECK(bytes == 0, "previous frame: %zu bytes uploaded, expected 0", bytes);
+
+    // Hash collision: first colors word changed, second one fixed to get the same hash state,
+    // data is different but hashed the same, it must be uploaded anyway
+    // NOTE: Colors are hashed after positions and texcoords (separate layout), both unchanged
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    hash = rlGetDataHash(batch.vertexBuffer[0].vertices, VERTEX_COUNT*3*sizeof(float), hash);
+    hash = rlGetDataHash(batch.vertexBuffer[0].texcoords, VERTEX_COUNT*2*sizeof(float), hash);
+
+    unsigned long long word[2] = { 0 };
+    memcpy(word, colors, 16);
+
+    unsigned long long collision[2] = { word[0] ^ 0x01, 0 };
+    collision[1] = word[1] ^ ((hash ^ word[0])*0x100000001b3ULL) ^ ((hash ^ collision[0])*0x100000001b3ULL);
+
+    static unsigned char collisionColors[VERTEX_COUNT*4] = { 0 };
+    memcpy(collisionColors, colors, VERTEX_COUNT*4);
+    memcpy(collisionColors, collision, 16);
+
+    CHECK(rlGetDataHash(colors, VERTEX_COUNT*4, hash) == rlGetDataHash(collisionColors, VERTEX_COUNT*4, hash), "crafted colors data hash not colliding");
+
+    bytes = DrawFrame(collisionColors);
+    CHECK(bytes == FRAME_SIZE, "hash collision frame: %zu bytes uploaded, expected %i", bytes, FRAME_SIZE);
+    CHECK(rlGetRenderStats().batchUploadSkips == 0, "hash collision frame: upload skipped");
+
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(batch);
+
+    rlglClose();
+    rlNullGLClose();
+
+    if (failures == 0) printf("PASS: rlgl batch streaming\n");
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,354 @@
+/**********************************************************************************************
+*
+*   rlgl_null - Null OpenGL implementation for rlgl tests
+*
+*   DESCRIPTION:
+*       OpenGL functions loader returning functions that do nothing, no window or GL context required,
+*       rlgl runs on CPU only: draw calls and data uploaded to GPU are counted by the null functions,
+*       rlgl render statistics can be checked against them
+*
+*   NOTE: Only functions used by rlgl are provided, rlgl must be compiled in the same translation unit
+*   (RLGL_IMPLEMENTATION defined) with GRAPHICS_API_OPENGL_33 or GRAPHICS_API_OPENGL_ES2 (PLATFORM_DESKTOP)
+*
+*   USAGE:
+*       rlLoadExtensions((void *)rlNullGLLoader);
+*       rlglInit(width, height);
+*       ...
+*       rlNullGLReset();        // Reset counters
+*       ...                     // rlgl calls
+*       nullGL.drawCalls;       // Draw calls submitted
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+**********************************************************************************************/
+
+#ifndef RLGL_NULL_H
+#define RLGL_NULL_H
+
+#include <stdlib.h>         // Required for: realloc(), free()
+#include <string.h>         // Required for: strcmp()
+
+#if !defined(RLGL_IMPLEMENTATION)
+    #error "rlgl_null.h requires rlgl.h included with RLGL_IMPLEMENTATION defined"
+#endif
+
+#if !defined(GL_MAP_WRITE_BIT)
+    #define GL_MAP_WRITE_BIT        0x0002
+#endif
+#if !defined(GL_NUM_EXTENSIONS)
+    #define GL_NUM_EXTENSIONS       0x821D
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static struct {
+    unsigned int drawCalls;             // Draw calls submitted (glDraw*())
+    unsigned int textureBinds;          // Textures bound (glBindTexture())
+    size_t bytesUploaded;               // Buffers data uploaded (glBufferData(), glBufferSubData(), glMapBufferRange())
+    size_t textureBytesUploaded;        // Textures data uploaded (RGBA size, glTexImage2D(), glTexSubImage2D())
+
+    unsigned int lastId;                // Last object id generated
+    int lastLocation;                   // Last shader location returned
+    void *mapData;                      // Buffer returned by glMapBufferRange()
+    size_t mapSize;                     // Buffer size returned by glMapBufferRange()
+} nullGL = { 0 };
+
+//----------------------------------------------------------------------------------
+// Null OpenGL functions
+//----------------------------------------------------------------------------------
+static void GLAD_API_PTR null_glActiveTexture(GLenum texture) { (void)texture; }
+static void GLAD_API_PTR null_glAttachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+static void GLAD_API_PTR null_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; }
+static void GLAD_API_PTR null_glBindBuffer(GLenum target, GLuint buffer) { (void)target; (void)buffer; }
+static void GLAD_API_PTR null_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { (void)target; (void)index; (void)buffer; }
+static void GLAD_API_PTR null_glBindFramebuffer(GLenum target, GLuint framebuffer) { (void)target; (void)framebuffer; }
+static void GLAD_API_PTR null_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { (void)target; (void)renderbuffer; }
+static void GLAD_API_PTR null_glBindVertexArray(GLuint array) { (void)array; }
+static void GLAD_API_PTR null_glBlendEquation(GLenum mode) { (void)mode; }
+static void GLAD_API_PTR null_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { (void)modeRGB; (void)modeAlpha; }
+static void GLAD_API_PTR null_glBlendFunc(GLenum sfactor, GLenum dfactor) { (void)sfactor; (void)dfactor; }
+static void GLAD_API_PTR null_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { (void)sfactorRGB; (void)dfactorRGB; (void)sfactorAlpha; (void)dfactorAlpha; }
+static void GLAD_API_PTR null_glClear(GLbitfield mask) { (void)mask; }
+static void GLAD_API_PTR null_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; }
+static void GLAD_API_PTR null_glClearDepth(GLdouble depth) { (void)depth; }
+static void GLAD_API_PTR null_glClearDepthf(GLfloat d) { (void)d; }
+static void GLAD_API_PTR null_glCompileShader(GLuint shader) { (void)shader; }
+static void GLAD_API_PTR null_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)border; (void)imageSize; (void)data; }
+static void GLAD_API_PTR null_glCullFace(GLenum mode) { (void)mode; }
+static void GLAD_API_PTR null_glDeleteBuffers(GLsizei n, const GLuint *buffers) { (void)n; (void)buffers; }
+static void GLAD_API_PTR null_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { (void)n; (void)framebuffers; }
+static void GLAD_API_PTR null_glDeleteProgram(GLuint program) { (void)program; }
+static void GLAD_API_PTR null_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { (void)n; (void)renderbuffers; }
+static void GLAD_API_PTR null_glDeleteShader(GLuint shader) { (void)shader; }
+static void GLAD_API_PTR null_glDeleteTextures(GLsizei n, const GLuint *textures) { (void)n; (void)textures; }
+static void GLAD_API_PTR null_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { (void)n; (void)arrays; }
+static void GLAD_API_PTR null_glDepthFunc(GLenum func) { (void)func; }
+static void GLAD_API_PTR null_glDepthMask(GLboolean flag) { (void)flag; }
+static void GLAD_API_PTR null_glDetachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+static void GLAD_API_PTR null_glDisable(GLenum cap) { (void)cap; }
+static void GLAD_API_PTR null_glDisableVertexAttribArray(GLuint index) { (void)index; }
+static void GLAD_API_PTR null_glDrawBuffers(GLsizei n, const GLenum *bufs) { (void)n; (void)bufs; }
+static void GLAD_API_PTR null_glEnable(GLenum cap) { (void)cap; }
+static void GLAD_API_PTR null_glEnableVertexAttribArray(GLuint index) { (void)index; }
+static void GLAD_API_PTR null_glFinish(void) {  }
+static void GLAD_API_PTR null_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { (void)target; (void)attachment; (void)renderbuffertarget; (void)renderbuffer; }
+static void GLAD_API_PTR null_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; }
+static void GLAD_API_PTR null_glFrontFace(GLenum mode) { (void)mode; }
+static void GLAD_API_PTR null_glGenerateMipmap(GLenum target) { (void)target; }
+static void GLAD_API_PTR null_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; }
+static void GLAD_API_PTR null_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { (void)program; (void)maxCount; (void)count; (void)shaders; }
+static void GLAD_API_PTR null_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { (void)target; (void)offset; (void)size; (void)data; }
+static void GLAD_API_PTR null_glGetFloatv(GLenum pname, GLfloat *data) { (void)pname; (void)data; }
+static void GLAD_API_PTR null_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { (void)target; (void)attachment; (void)pname; (void)params; }
+static void GLAD_API_PTR null_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { (void)program; (void)bufSize; (void)length; (void)binaryFormat; (void)binary; }
+static void GLAD_API_PTR null_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)program; (void)bufSize; (void)length; (void)infoLog; }
+static void GLAD_API_PTR null_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)shader; (void)bufSize; (void)length; (void)infoLog; }
+static void GLAD_API_PTR null_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { (void)target; (void)level; (void)format; (void)type; (void)pixels; }
+static void GLAD_API_PTR null_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { (void)target; (void)level; (void)pname; (void)params; }
+static void GLAD_API_PTR null_glHint(GLenum target, GLenum mode) { (void)target; (void)mode; }
+static void GLAD_API_PTR null_glLineWidth(GLfloat width) { (void)width; }
+static void GLAD_API_PTR null_glLinkProgram(GLuint program) { (void)program; }
+static void GLAD_API_PTR null_glPixelStorei(GLenum pname, GLint param) { (void)pname; (void)param; }
+static void GLAD_API_PTR null_glPolygonMode(GLenum face, GLenum mode) { (void)face; (void)mode; }
+static void GLAD_API_PTR null_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { (void)program; (void)binaryFormat; (void)binary; (void)length; }
+static void GLAD_API_PTR null_glProgramParameteri(GLuint program, GLenum pname, GLint value) { (void)program; (void)pname; (void)value; }
+static void GLAD_API_PTR null_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { (void)x; (void)y; (void)width; (void)height; (void)format; (void)type; (void)pixels; }
+static void GLAD_API_PTR null_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)internalformat; (void)width; (void)height; }
+static void GLAD_API_PTR null_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; }
+static void GLAD_API_PTR null_glShaderSource(GLuint shader, GLsizei count, const GLchar*const *string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; }
+static void GLAD_API_PTR null_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { (void)target; (void)pname; (void)param; }
+static void GLAD_API_PTR null_glTexParameteri(GLenum target, GLenum pname, GLint param) { (void)target; (void)pname; (void)param; }
+static void GLAD_API_PTR null_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { (void)target; (void)pname; (void)params; }
+static void GLAD_API_PTR null_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform1i(GLint location, GLint v0) { (void)location; (void)v0; }
+static void GLAD_API_PTR null_glUniform1iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform2iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform3iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniform4iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+static void GLAD_API_PTR null_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; }
+static void GLAD_API_PTR null_glUseProgram(GLuint program) { (void)program; }
+static void GLAD_API_PTR null_glVertexAttrib1fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void GLAD_API_PTR null_glVertexAttrib2fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void GLAD_API_PTR null_glVertexAttrib3fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void GLAD_API_PTR null_glVertexAttrib4fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void GLAD_API_PTR null_glVertexAttribDivisor(GLuint index, GLuint divisor) { (void)index; (void)divisor; }
+static void GLAD_API_PTR null_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)normalized; (void)stride; (void)pointer; }
+static void GLAD_API_PTR null_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; }
+
+// Stateful functions: objects ids, queries and counters
+static void GLAD_API_PTR null_glGenBuffers(GLsizei n, GLuint *buffers) { for (int i = 0; i < n; i++) buffers[i] = ++nullGL.lastId; }
+static void GLAD_API_PTR null_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { for (int i = 0; i < n; i++) framebuffers[i] = ++nullGL.lastId; }
+static void GLAD_API_PTR null_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { for (int i = 0; i < n; i++) renderbuffers[i] = ++nullGL.lastId; }
+static void GLAD_API_PTR null_glGenTextures(GLsizei n, GLuint *textures) { for (int i = 0; i < n; i++) textures[i] = ++nullGL.lastId; }
+static void GLAD_API_PTR null_glGenVertexArrays(GLsizei n, GLuint *arrays) { for (int i = 0; i < n; i++) arrays[i] = ++nullGL.lastId; }
+static GLuint GLAD_API_PTR null_glCreateProgram(void) { return ++nullGL.lastId; }
+static GLuint GLAD_API_PTR null_glCreateShader(GLenum type) { (void)type; return ++nullGL.lastId; }
+static GLint GLAD_API_PTR null_glGetAttribLocation(GLuint program, const GLchar *name) { (void)program; (void)name; return nullGL.lastLocation++; }
+static GLint GLAD_API_PTR null_glGetUniformLocation(GLuint program, const GLchar *name) { (void)program; (void)name; return nullGL.lastLocation++; }
+static GLenum GLAD_API_PTR null_glCheckFramebufferStatus(GLenum target) { (void)target; return GL_FRAMEBUFFER_COMPLETE; }
+static GLenum GLAD_API_PTR null_glGetError(void) { return GL_NO_ERROR; }
+static GLboolean GLAD_API_PTR null_glIsProgram(GLuint program) { return (program > 0); }
+static GLboolean GLAD_API_PTR null_glUnmapBuffer(GLenum target) { (void)target; return GL_TRUE; }
+
+static const GLubyte *GLAD_API_PTR null_glGetString(GLenum name)
+{
+    // NOTE: glad parses version string to load functions, at least one extension required
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const char *version = "OpenGL ES 2.0 NullGL";
+#else
+    const char *version = "3.3.0 NullGL";
+#endif
+    if (name == GL_VERSION) return (const GLubyte *)version;
+    if (name == GL_EXTENSIONS) return (const GLubyte *)"GL_NULL_extension";
+    return (const GLubyte *)"NullGL";
+}
+static const GLubyte *GLAD_API_PTR null_glGetStringi(GLenum name, GLuint index) { (void)name; (void)index; return (const GLubyte *)"GL_NULL_extension"; }
+
+static void GLAD_API_PTR null_glGetIntegerv(GLenum pname, GLint *data)
+{
+    if (pname == GL_NUM_EXTENSIONS) data[0] = 1;
+    else if ((pname == GL_MAX_TEXTURE_SIZE) || (pname == GL_MAX_VIEWPORT_DIMS)) data[0] = data[1] = 4096;
+    else if (pname == GL_MAX_TEXTURE_IMAGE_UNITS) data[0] = 16;
+    else data[0] = 0;
+}
+static void GLAD_API_PTR null_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { (void)shader; params[0] = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0; }
+static void GLAD_API_PTR null_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { (void)program; params[0] = (pname == GL_LINK_STATUS)? GL_TRUE : 0; }
+
+// Draw calls counted
+static void GLAD_API_PTR null_glDrawArrays(GLenum mode, GLint first, GLsizei count) { (void)mode; (void)first; (void)count; nullGL.drawCalls++; }
+static void GLAD_API_PTR null_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { (void)mode; (void)first; (void)count; (void)instancecount; nullGL.drawCalls++; }
+static void GLAD_API_PTR null_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { (void)mode; (void)count; (void)type; (void)indices; nullGL.drawCalls++; }
+static void GLAD_API_PTR null_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { (void)mode; (void)count; (void)type; (void)indices; (void)basevertex; nullGL.drawCalls++; }
+static void GLAD_API_PTR null_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { (void)mode; (void)count; (void)type; (void)indices; (void)instancecount; nullGL.drawCalls++; }
+
+// Data uploads counted: buffers data (mapped ranges counted as fully written) and textures data
+static void GLAD_API_PTR null_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { (void)target; (void)usage; if (data != NULL) nullGL.bytesUploaded += (size_t)size; }
+static void GLAD_API_PTR null_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { (void)target; (void)offset; (void)data; nullGL.bytesUploaded += (size_t)size; }
+static void *GLAD_API_PTR null_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    (void)target; (void)offset;
+    if ((size_t)length > nullGL.mapSize)
+    {
+        nullGL.mapData = realloc(nullGL.mapData, (size_t)length);
+        nullGL.mapSize = (size_t)length;
+    }
+    if (access & GL_MAP_WRITE_BIT) nullGL.bytesUploaded += (size_t)length;
+    return nullGL.mapData;
+}
+static void *GLAD_API_PTR null_glMapBuffer(GLenum target, GLenum access) { (void)target; (void)access; return NULL; }
+static void GLAD_API_PTR null_glBindTexture(GLenum target, GLuint texture) { (void)target; (void)texture; nullGL.textureBinds++; }
+static void GLAD_API_PTR null_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)internalformat; (void)border; (void)format; (void)type; if (pixels != NULL) nullGL.textureBytesUploaded += (size_t)width*height*4; }
+static void GLAD_API_PTR null_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)format; (void)type; (void)pixels; nullGL.textureBytesUploaded += (size_t)width*height*4; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static const struct { const char *name; GLADapiproc proc; } nullGLProcs[] = {
+    { "glActiveTexture", (GLADapiproc)null_glActiveTexture },
+    { "glAttachShader", (GLADapiproc)null_glAttachShader },
+    { "glBindAttribLocation", (GLADapiproc)null_glBindAttribLocation },
+    { "glBindBuffer", (GLADapiproc)null_glBindBuffer },
+    { "glBindBufferBase", (GLADapiproc)null_glBindBufferBase },
+    { "glBindFramebuffer", (GLADapiproc)null_glBindFramebuffer },
+    { "glBindRenderbuffer", (GLADapiproc)null_glBindRenderbuffer },
+    { "glBindTexture", (GLADapiproc)null_glBindTexture },
+    { "glBindVertexArray", (GLADapiproc)null_glBindVertexArray },
+    { "glBlendEquation", (GLADapiproc)null_glBlendEquation },
+    { "glBlendEquationSeparate", (GLADapiproc)null_glBlendEquationSeparate },
+    { "glBlendFunc", (GLADapiproc)null_glBlendFunc },
+    { "glBlendFuncSeparate", (GLADapiproc)null_glBlendFuncSeparate },
+    { "glBufferData", (GLADapiproc)null_glBufferData },
+    { "glBufferSubData", (GLADapiproc)null_glBufferSubData },
+    { "glCheckFramebufferStatus", (GLADapiproc)null_glCheckFramebufferStatus },
+    { "glClear", (GLADapiproc)null_glClear },
+    { "glClearColor", (GLADapiproc)null_glClearColor },
+    { "glClearDepth", (GLADapiproc)null_glClearDepth },
+    { "glClearDepthf", (GLADapiproc)null_glClearDepthf },
+    { "glCompileShader", (GLADapiproc)null_glCompileShader },
+    { "glCompressedTexImage2D", (GLADapiproc)null_glCompressedTexImage2D },
+    { "glCreateProgram", (GLADapiproc)null_glCreateProgram },
+    { "glCreateShader", (GLADapiproc)null_glCreateShader },
+    { "glCullFace", (GLADapiproc)null_glCullFace },
+    { "glDeleteBuffers", (GLADapiproc)null_glDeleteBuffers },
+    { "glDeleteFramebuffers", (GLADapiproc)null_glDeleteFramebuffers },
+    { "glDeleteProgram", (GLADapiproc)null_glDeleteProgram },
+    { "glDeleteRenderbuffers", (GLADapiproc)null_glDeleteRenderbuffers },
+    { "glDeleteShader", (GLADapiproc)null_glDeleteShader },
+    { "glDeleteTextures", (GLADapiproc)null_glDeleteTextures },
+    { "glDeleteVertexArrays", (GLADapiproc)null_glDeleteVertexArrays },
+    { "glDepthFunc", (GLADapiproc)null_glDepthFunc },
+    { "glDepthMask", (GLADapiproc)null_glDepthMask },
+    { "glDetachShader", (GLADapiproc)null_glDetachShader },
+    { "glDisable", (GLADapiproc)null_glDisable },
+    { "glDisableVertexAttribArray", (GLADapiproc)null_glDisableVertexAttribArray },
+    { "glDrawArrays", (GLADapiproc)null_glDrawArrays },
+    { "glDrawArraysInstanced", (GLADapiproc)null_glDrawArraysInstanced },
+    { "glDrawBuffers", (GLADapiproc)null_glDrawBuffers },
+    { "glDrawElements", (GLADapiproc)null_glDrawElements },
+    { "glDrawElementsBaseVertex", (GLADapiproc)null_glDrawElementsBaseVertex },
+    { "glDrawElementsInstanced", (GLADapiproc)null_glDrawElementsInstanced },
+    { "glEnable", (GLADapiproc)null_glEnable },
+    { "glEnableVertexAttribArray", (GLADapiproc)null_glEnableVertexAttribArray },
+    { "glFinish", (GLADapiproc)null_glFinish },
+    { "glFramebufferRenderbuffer", (GLADapiproc)null_glFramebufferRenderbuffer },
+    { "glFramebufferTexture2D", (GLADapiproc)null_glFramebufferTexture2D },
+    { "glFrontFace", (GLADapiproc)null_glFrontFace },
+    { "glGenBuffers", (GLADapiproc)null_glGenBuffers },
+    { "glGenFramebuffers", (GLADapiproc)null_glGenFramebuffers },
+    { "glGenRenderbuffers", (GLADapiproc)null_glGenRenderbuffers },
+    { "glGenTextures", (GLADapiproc)null_glGenTextures },
+    { "glGenVertexArrays", (GLADapiproc)null_glGenVertexArrays },
+    { "glGenerateMipmap", (GLADapiproc)null_glGenerateMipmap },
+    { "glGetActiveUniform", (GLADapiproc)null_glGetActiveUniform },
+    { "glGetAttachedShaders", (GLADapiproc)null_glGetAttachedShaders },
+    { "glGetAttribLocation", (GLADapiproc)null_glGetAttribLocation },
+    { "glGetBufferSubData", (GLADapiproc)null_glGetBufferSubData },
+    { "glGetError", (GLADapiproc)null_glGetError },
+    { "glGetFloatv", (GLADapiproc)null_glGetFloatv },
+    { "glGetFramebufferAttachmentParameteriv", (GLADapiproc)null_glGetFramebufferAttachmentParameteriv },
+    { "glGetIntegerv", (GLADapiproc)null_glGetIntegerv },
+    { "glGetProgramBinary", (GLADapiproc)null_glGetProgramBinary },
+    { "glGetProgramInfoLog", (GLADapiproc)null_glGetProgramInfoLog },
+    { "glGetProgramiv", (GLADapiproc)null_glGetProgramiv },
+    { "glGetShaderInfoLog", (GLADapiproc)null_glGetShaderInfoLog },
+    { "glGetShaderiv", (GLADapiproc)null_glGetShaderiv },
+    { "glGetString", (GLADapiproc)null_glGetString },
+    { "glGetStringi", (GLADapiproc)null_glGetStringi },
+    { "glGetTexImage", (GLADapiproc)null_glGetTexImage },
+    { "glGetTexLevelParameteriv", (GLADapiproc)null_glGetTexLevelParameteriv },
+    { "glGetUniformLocation", (GLADapiproc)null_glGetUniformLocation },
+    { "glHint", (GLADapiproc)null_glHint },
+    { "glIsProgram", (GLADapiproc)null_glIsProgram },
+    { "glLineWidth", (GLADapiproc)null_glLineWidth },
+    { "glLinkProgram", (GLADapiproc)null_glLinkProgram },
+    { "glMapBuffer", (GLADapiproc)null_glMapBuffer },
+    { "glMapBufferRange", (GLADapiproc)null_glMapBufferRange },
+    { "glPixelStorei", (GLADapiproc)null_glPixelStorei },
+    { "glPolygonMode", (GLADapiproc)null_glPolygonMode },
+    { "glProgramBinary", (GLADapiproc)null_glProgramBinary },
+    { "glProgramParameteri", (GLADapiproc)null_glProgramParameteri },
+    { "glReadPixels", (GLADapiproc)null_glReadPixels },
+    { "glRenderbufferStorage", (GLADapiproc)null_glRenderbufferStorage },
+    { "glScissor", (GLADapiproc)null_glScissor },
+    { "glShaderSource", (GLADapiproc)null_glShaderSource },
+    { "glTexImage2D", (GLADapiproc)null_glTexImage2D },
+    { "glTexParameterf", (GLADapiproc)null_glTexParameterf },
+    { "glTexParameteri", (GLADapiproc)null_glTexParameteri },
+    { "glTexParameteriv", (GLADapiproc)null_glTexParameteriv },
+    { "glTexSubImage2D", (GLADapiproc)null_glTexSubImage2D },
+    { "glUniform1fv", (GLADapiproc)null_glUniform1fv },
+    { "glUniform1i", (GLADapiproc)null_glUniform1i },
+    { "glUniform1iv", (GLADapiproc)null_glUniform1iv },
+    { "glUniform2fv", (GLADapiproc)null_glUniform2fv },
+    { "glUniform2iv", (GLADapiproc)null_glUniform2iv },
+    { "glUniform3fv", (GLADapiproc)null_glUniform3fv },
+    { "glUniform3iv", (GLADapiproc)null_glUniform3iv },
+    { "glUniform4fv", (GLADapiproc)null_glUniform4fv },
+    { "glUniform4iv", (GLADapiproc)null_glUniform4iv },
+    { "glUniformMatrix4fv", (GLADapiproc)null_glUniformMatrix4fv },
+    { "glUnmapBuffer", (GLADapiproc)null_glUnmapBuffer },
+    { "glUseProgram", (GLADapiproc)null_glUseProgram },
+    { "glVertexAttrib1fv", (GLADapiproc)null_glVertexAttrib1fv },
+    { "glVertexAttrib2fv", (GLADapiproc)null_glVertexAttrib2fv },
+    { "glVertexAttrib3fv", (GLADapiproc)null_glVertexAttrib3fv },
+    { "glVertexAttrib4fv", (GLADapiproc)null_glVertexAttrib4fv },
+    { "glVertexAttribDivisor", (GLADapiproc)null_glVertexAttribDivisor },
+    { "glVertexAttribPointer", (GLADapiproc)null_glVertexAttribPointer },
+    { "glViewport", (GLADapiproc)null_glViewport },
+};
+
+// Get null OpenGL function by name (GLADloadfunc), NULL for functions not used by rlgl
+static GLADapiproc rlNullGLLoader(const char *name)
+{
+    for (int i = 0; i < (int)(sizeof(nullGLProcs)/sizeof(nullGLProcs[0])); i++)
+    {
+        if (strcmp(nullGLProcs[i].name, name) == 0) return nullGLProcs[i].proc;
+    }
+
+    return NULL;
+}
+
+// Reset null OpenGL counters
+static void rlNullGLReset(void)
+{
+    nullGL.drawCalls = 0;
+    nullGL.textureBinds = 0;
+    nullGL.bytesUploaded = 0;
+    nullGL.textureBytesUploaded = 0;
+}
+
+// Free null OpenGL resources
+static void rlNullGLClose(void)
+{
+    free(nullGL.mapData);
+    nullGL.mapData = NULL;
+    nullGL.mapSize = 0;
+}
+
+#endif // RLGL_NULL_H
@@ -0,0 +1,85 @@
+/*******************************************************************************************
+*
+*   raylib [tests] test - rlgl quad indices
+*
+*   NOTE: rlgl runs on null OpenGL (rlgl_null.h), no window or GL context required:
+*         render batch loaded with more quads than 16 bit indices can address (16384 quads),
+*         OpenGL 3.3 uses 32 bit indices (one draw call), OpenGL ES 2.0 batch is clamped
+*         to 16384 quads (batch flushed when full, indices never wrap around)
+*
+*   Test originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#define RLGL_IMPLEMENTATION
+#include "rlgl.h"
+
+#include "rlgl_null.h"
+
+#include <stdio.h>          // Required for: printf()
+
+#define BATCH_ELEMENTS      20000   // Render batch quads, more than 16 bit indices limit
+
+static int failures = 0;
+
+// Check test condition, failure logged
+#define CHECK(condition, ...) do { if (!(condition)) { printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    rlLoadExtensions((void *)rlNullGLLoader);
+    rlglInit(800, 450);
+
+    rlRenderBatch batch = rlLoadRenderBatch(1, BATCH_ELEMENTS);
+    rlSetRenderBatchActive(&batch);
+
+    rlNullGLReset();
+    rlResetRenderStats();
+
+    // Quads fill the batch requested size, batch flushed only if its size was clamped
+    rlBegin(RL_QUADS);
+    for (int i = 0; i < BATCH_ELEMENTS; i++)
+    {
+        float x = (float)(i%100)*8.0f;
+        float y = (float)(i/100)*2.0f;
+
+        rlColor4ub(255, 255, 255, 255);
+        rlVertex2f(x, y);
+        rlVertex2f(x, y + 2.0f);
+        rlVertex2f(x + 8.0f, y + 2.0f);
+        rlVertex2f(x + 8.0f, y);
+    }
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    CHECK(batch.vertexBuffer[0].elementCount == 16384, "batch elements %i, expected clamped to 16384", batch.vertexBuffer[0].elementCount);
+    CHECK(RLGL.State.quadIndexType == GL_UNSIGNED_SHORT, "quad indices not 16 bit");
+    CHECK(RLGL.State.quadIndexElements <= 16384, "quad indices %i, exceed 16 bit indices limit", RLGL.State.quadIndexElements);
+    CHECK(nullGL.drawCalls == 2, "%u draw calls, expected 2 (batch full)", nullGL.drawCalls);
+#else
+    CHECK(batch.vertexBuffer[0].elementCount == BATCH_ELEMENTS, "batch elements %i, expected %i", batch.vertexBuffer[0].elementCount, BATCH_ELEMENTS);
+    CHECK(RLGL.State.quadIndexType == GL_UNSIGNED_INT, "quad indices not 32 bit");
+    CHECK(nullGL.drawCalls == 1, "%u draw calls, expected 1", nullGL.drawCalls);
+#endif
+    CHECK(rlGetRenderStats().vertexCount == BATCH_ELEMENTS*4, "%u vertex drawn, expected %i", rlGetRenderStats().vertexCount, BATCH_ELEMENTS*4);
+
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(batch);
+
+    rlglClose();
+    rlNullGLClose();
+
+    if (failures == 0) printf("PASS: rlgl quad indices\n");
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************************
+*
+*   raylib [tests] test - rlgl texture batching
+*
+*   NOTE: rlgl runs on null OpenGL (rlgl_null.h), no window or GL context required:
+*         sprites alternating between TEXTURES_COUNT textures are drawn, draw calls submitted
+*         by rlgl checked: one draw call with texture batching enabled (OpenGL 3.3),
+*         one draw call by texture change with texture batching disabled or not supported (OpenGL ES 2.0)
+*
+*   Test originally created with raylib 4.5, last time updated with raylib 4.5
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib-nx contributors
+*
+********************************************************************************************/
+
+#define RLGL_IMPLEMENTATION
+#include "rlgl.h"
+
+#include "rlgl_null.h"
+
+#include <stdio.h>          // Required for: printf()
+
+#define TEXTURES_COUNT       4      // Textures alternated by sprites, lower than RL_DEFAULT_BATCH_TEXTURE_SLOTS
+#define SPRITES_COUNT       64      // Sprites drawn, texture changed on every sprite
+
+static int failures = 0;
+
+// Check test condition, failure logged
+#define CHECK(condition, ...) do { if (!(condition)) { printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+// Draw sprites alternating between textures, returns draw calls submitted by rlgl
+static unsigned int DrawSprites(const unsigned int *textures)
+{
+    rlNullGLReset();
+    rlResetRenderStats();
+
+    for (int i = 0; i < SPRITES_COUNT; i++)
+    {
+        float x = (float)(i%8)*32.0f;
+        float y = (float)(i/8)*32.0f;
+
+        rlSetTexture(textures[i%TEXTURES_COUNT]);
+        rlBegin(RL_QUADS);
+            rlColor4ub(255, 255, 255, 255);
+            rlNormal3f(0.0f, 0.0f, 1.0f);
+            rlTexCoord2f(0.0f, 0.0f); rlVertex2f(x, y);
+            rlTexCoord2f(0.0f, 1.0f); rlVertex2f(x, y + 32.0f);
+            rlTexCoord2f(1.0f, 1.0f); rlVertex2f(x + 32.0f, y + 32.0f);
+            rlTexCoord2f(1.0f, 0.0f); rlVertex2f(x + 32.0f, y);
+        rlEnd();
+    }
+    rlSetTexture(0);
+
+    rlDrawRenderBatchActive();
+
+    rlRenderStats stats = rlGetRenderStats();
+    CHECK(stats.drawCalls == nullGL.drawCalls, "render stats draw calls (%u) not matching GL draw calls (%u)", stats.drawCalls, nullGL.drawCalls);
+
+    return nullGL.drawCalls;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    rlLoadExtensions((void *)rlNullGLLoader);
+    rlglInit(800, 450);
+
+    unsigned int textures[TEXTURES_COUNT] = { 0 };
+    unsigned char pixels[4*4*4] = { 0 };
+    for (int i = 0; i < TEXTURES_COUNT; i++) textures[i] = rlLoadTexture(pixels, 4, 4, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+
+    rlDrawRenderBatchActive();
+
+    // Texture batching disabled: one draw call by texture change
+    unsigned int drawCalls = DrawSprites(textures);
+    CHECK(drawCalls == SPRITES_COUNT, "batching disabled: %u draw calls, expected %i", drawCalls, SPRITES_COUNT);
+
+    rlEnableTextureBatching();
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // Texture batching not supported, same draw calls
+    CHECK(!rlIsTextureBatchingEnabled(), "batching enabled on OpenGL ES 2.0");
+
+    drawCalls = DrawSprites(textures);
+    CHECK(drawCalls == SPRITES_COUNT, "batching fallback: %u draw calls, expected %i", drawCalls, SPRITES_COUNT);
+#else
+    // Texture batching enabled: all textures fit in one draw call
+    CHECK(rlIsTextureBatchingEnabled(), "batching not enabled");
+
+    drawCalls = DrawSprites(textures);
+    CHECK(drawCalls == 1, "batching enabled: %u draw calls, expected 1", drawCalls);
+
+    // Texture batching disabled again: one draw call by texture change
+    rlDisableTextureBatching();
+
+    drawCalls = DrawSprites(textures);
+    CHECK(drawCalls == SPRITES_COUNT, "batching disabled again: %u draw calls, expected %i", drawCalls, SPRITES_COUNT);
+#endif
+
+    for (int i = 0; i < TEXTURES_COUNT; i++) rlUnloadTexture(textures[i]);
+
+    rlglClose();
+    rlNullGLClose();
+
+    if (failures == 0) printf("PASS: rlgl texture batching\n");
+
+    return (failures == 0)? 0 : 1;
+}
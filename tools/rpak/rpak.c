@@ -0,0 +1,100 @@
+/**********************************************************************************************
+
+    rpak - raylib assets archive packer
+
+    Packs files and directories (scanned recursively) into an assets archive (.rpak), to be
+    mounted at runtime with MountArchive(). Files are stored with provided paths, so paths must
+    be the same ones used to load them, i.e. run from game working directory:
+
+        rpak -c assets.rpak resources
+
+    USAGE:
+        rpak [-c] <archive.rpak> <file|directory> [<file|directory> ...]
+
+        -c      Compress files (DEFLATE), only stored compressed if size is reduced at least 10%,
+                already compressed formats (png, ogg, mp3...) stored as is for zero-copy loading
+
+    ARCHIVE FORMAT (.rpak):
+        ArchiveHeader           "rPAK", version, entries count, paths size
+        ArchiveEntry[count]     Path hash, path offset, data offset, sizes and compression (sorted by path hash)
+        char paths[]            Entries paths, '\0' terminated
+        data[]                  Entries data, 64 bytes aligned
+
+    LICENSE: zlib/libpng
+
+    rpak is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+    BSD-like license that allows static linking with closed source software:
+
+    Copyright (c) 2026 raylib-nx contributors
+
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: strcmp(), strcpy()
+
+//----------------------------------------------------------------------------------
+// Program main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    bool compress = false;
+    int first = 1;
+
+    if ((argc > 1) && (strcmp(argv[1], "-c") == 0)) { compress = true; first++; }
+
+    if ((argc - first) < 2)
+    {
+        printf("USAGE: rpak [-c] <archive.rpak> <file|directory> [<file|directory> ...]\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    const char *archiveFileName = argv[first];
+
+    // Get all files to pack, directories scanned recursively
+    FilePathList files = { 0 };
+    unsigned int capacity = 0;
+
+    for (int i = first + 1; i < argc; i++)
+    {
+        FilePathList found = { 0 };
+        bool directory = DirectoryExists(argv[i]);
+
+        if (directory) found = LoadDirectoryFilesEx(argv[i], NULL, true);
+        else if (FileExists(argv[i]))
+        {
+            found.count = 1;
+            found.paths = &argv[i];
+        }
+        else printf("WARNING: File not found: %s\n", argv[i]);
+
+        if ((files.count + found.count) > capacity)
+        {
+            capacity = (files.count + found.count)*2;
+            files.paths = (char **)realloc(files.paths, capacity*sizeof(char *));
+        }
+
+        for (unsigned int j = 0; j < found.count; j++)
+        {
+            files.paths[files.count] = (char *)malloc(strlen(found.paths[j]) + 1);
+            strcpy(files.paths[files.count], found.paths[j]);
+            files.count++;
+        }
+
+        if (directory) UnloadDirectoryFiles(found);
+    }
+
+    bool success = (files.count > 0) && ExportArchive(files, archiveFileName, compress);
+
+    if (success) printf("INFO: %i files packed into %s\n", files.count, archiveFileName);
+    else printf("ERROR: Archive could not be packed: %s\n", archiveFileName);
+
+    for (unsigned int i = 0; i < files.count; i++) free(files.paths[i]);
+    free(files.paths);
+
+    return success? 0 : 1;
+}